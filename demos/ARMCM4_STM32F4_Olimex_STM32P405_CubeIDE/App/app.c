@@ -78,6 +78,8 @@ static void     AppButtonScanTask(void * pvParameters);
 static uint32_t AppPortSystemGetTime(void);
 static uint8_t  AppPortXcpTransmitPacket(tPortXcpPacket const * txPacket);
 static uint8_t  AppPortXcpReceivePacket(tPortXcpPacket * rxPacket);
+static uint8_t  AppPortXcpReceivePacketTimeout(tPortXcpPacket * rxPacket,
+                                               uint32_t timeout);
 static uint8_t  AppPortXcpComputeKeyFromSeed(uint8_t seedLen, uint8_t const * seedPtr,
                                              uint8_t * keyLenPtr, uint8_t * keyPtr);
 static void     AppCanMessageReceived(tCanMsg const * msg);
@@ -118,7 +120,8 @@ void AppInit(void)
     .SystemGetTime = AppPortSystemGetTime,
     .XcpTransmitPacket = AppPortXcpTransmitPacket,
     .XcpReceivePacket = AppPortXcpReceivePacket,
-    .XcpComputeKeyFromSeed = AppPortXcpComputeKeyFromSeed
+    .XcpComputeKeyFromSeed = AppPortXcpComputeKeyFromSeed,
+    .XcpReceivePacketTimeout = AppPortXcpReceivePacketTimeout
   };
 
   /* Register the application specific assertion handler. */
@@ -469,6 +472,23 @@ static uint8_t AppPortXcpTransmitPacket(tPortXcpPacket const * txPacket)
 **
 ****************************************************************************************/
 static uint8_t AppPortXcpReceivePacket(tPortXcpPacket * rxPacket)
+{
+  /* Check for a newly received packet, without waiting. */
+  return AppPortXcpReceivePacketTimeout(rxPacket, 0U);
+} /*** end of AppPortXcpReceivePacket ****/
+
+
+/************************************************************************************//**
+** \brief     Attempts to receive an XCP packet using the transport layer implemented by
+**            the port, while blocking for at most the specified time. The blocking is
+**            done on the RTOS queue, so other tasks can run in the meantime.
+** \param     rxPacket Structure where the newly received XCP packet should be stored.
+** \param     timeout Maximum time in milliseconds to wait for a packet.
+** \return    TBX_TRUE if a packet was received, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t AppPortXcpReceivePacketTimeout(tPortXcpPacket * rxPacket,
+                                              uint32_t timeout)
 {
   uint8_t result = TBX_FALSE;
   tCanMsg rxMsg;
@@ -480,10 +500,10 @@ static uint8_t AppPortXcpReceivePacket(tPortXcpPacket * rxPacket)
   /* Only continue with valid parameter. */
   if (rxPacket != NULL)
   {
-    /* Check if an XCP CAN message was received. The reception should be non-blocking.
-     * Therefore a timeout of 0 ticks was specified.
+    /* Check if an XCP CAN message was received, while blocking at most for the
+     * specified time.
      */
-    if (xQueueReceive(appXcpCanRxMsgQueue, &rxMsg, 0U) == pdPASS)
+    if (xQueueReceive(appXcpCanRxMsgQueue, &rxMsg, pdMS_TO_TICKS(timeout)) == pdPASS)
     {
       /* Store the XCP CAN message in the rxPacket if its length does not exceed that
        * of an XCP packet.
@@ -505,7 +525,7 @@ static uint8_t AppPortXcpReceivePacket(tPortXcpPacket * rxPacket)
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of AppPortXcpReceivePacket ****/
+} /*** end of AppPortXcpReceivePacketTimeout ****/
 
 
 /************************************************************************************//**
@@ -51,16 +51,10 @@
 uint8_t UpdateFirmware(char const * firmwareFile, uint8_t nodeId)
 {
   uint8_t                            result = TBX_ERROR;
-  uint8_t                            segmentIdx;
-  uint32_t                           segmentLen;
-  uint32_t                           segmentBase;
-  uint8_t                   const *  chunkData;
-  uint16_t                           chunkLen;
-  uint32_t                           chunkBase;
   uint32_t                  const    connectTimeout = 5000U;
   uint32_t                           connectStartTime;
   uint32_t                           connectDeltaTime;
-  uint8_t                            continueLoop;
+  uint8_t                            pipelineStatus;
   uint32_t                        (* portSystemGetTimeFcn)(void) = NULL;
   tBltSessionSettingsXcpV10 const    sessionSettings =
   {
@@ -130,82 +124,28 @@ uint8_t UpdateFirmware(char const * firmwareFile, uint8_t nodeId)
     }
 
     /* ------------------------------------------------------------------------------- */
-    /* ------------------ Erase memory segments -------------------------------------- */
+    /* ------------------ Erase and program memory segments -------------------------- */
     /* ------------------------------------------------------------------------------- */
     /* Only continue when connected to the target. */
     if (result == TBX_OK)
     {
-      /* Erase the memory segments on the target that the firmware data covers. */
-      for (segmentIdx = 0U; segmentIdx < BltFirmwareSegmentGetCount(); segmentIdx++)
+      /* Erase and program the memory segments on the target with the help of the
+       * pipeline. This already reads the first chunks of data from the firmware file,
+       * while the target erases its memory. Afterwards, it reads the next chunk of data,
+       * while the target programs the current one. Whenever there is nothing to read,
+       * this task blocks while the target erases or programs, which gives other tasks
+       * the CPU.
+       */
+      BltPipelineStartWithErase();
+      do
       {
-        /* Obtain segment information such as its base memory adddress and length. */
-        segmentLen = BltFirmwareSegmentGetInfo(segmentIdx, &segmentBase);
-        /* Erase the segment. */
-        if (BltSessionClearMemory(segmentBase, segmentLen) == TBX_ERROR)
-        {
-          /* The the erase error and stop the loop. */
-          result = TBX_ERROR;
-          break;
-        }
+        pipelineStatus = BltPipelineTaskWait();
       }
-    }
-
-    /* ------------------------------------------------------------------------------- */
-    /* ------------------ Program memory segments ------------------------------------ */
-    /* ------------------------------------------------------------------------------- */
-    /* Only continue when memory segments were successfully erased. */
-    if (result == TBX_OK)
-    {
-      /* Program the memory segments on the target one segment at a time. */
-      for (segmentIdx = 0U; segmentIdx < BltFirmwareSegmentGetCount(); segmentIdx++)
+      while (pipelineStatus == BLT_PIPELINE_STATUS_BUSY);
+      /* Check if an error occured while programming the data. */
+      if (pipelineStatus != BLT_PIPELINE_STATUS_DONE)
       {
-        /* Open the segment for reading. */
-        BltFirmwareSegmentOpen(segmentIdx);
-
-        /* Set flag to start the loop. */
-        continueLoop = TBX_TRUE;
-
-        /* Program the segment data, one chunk at a time. */
-        while (continueLoop == TBX_TRUE)
-        {
-          /* Attempt to read the next chunk of data in this segment. */
-          chunkData = BltFirmwareSegmentGetNextData(&chunkBase, &chunkLen);
-          /* Did an error occur? */
-          if (chunkData == NULL)
-          {
-            /* Could not read the data chunk. Flag error and request the loop to stop. */
-            result = TBX_ERROR;
-            continueLoop = TBX_FALSE;
-          }
-          /* No error occured. The segment end was reached or new data was read. */
-          else
-          {
-            /* Segment end reached? */
-            if (chunkLen == 0U)
-            {
-              /* All done with this segment so request the loop to stop. */
-              continueLoop = TBX_FALSE;
-            }
-            /* New data chunk was read. */
-            else
-            {
-              /* Program the newly read data chunk. */
-              if (BltSessionWriteData(chunkBase, chunkLen, chunkData) != TBX_OK)
-              {
-                /* Could not program the data. Flag error and request the loop to stop.*/
-                result = TBX_ERROR;
-                continueLoop = TBX_FALSE;
-              }
-            }
-          }
-        }
-
-        /* Check if an error occured while programming the segment's data chunks. */
-        if (result != TBX_OK)
-        {
-          /* Stop segment loop, because an error was detected. */
-          break;
-        }
+        result = TBX_ERROR;
       }
     }
 
@@ -0,0 +1,611 @@
+/************************************************************************************//**
+* \file         binreader.c
+* \brief        Binary firmware file reader source file.
+* \ingroup      BinReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "binreader.h"                      /* Binary firmware file reader             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Size of the byte buffer to store firmware data read from the binary file. */
+#define BIN_DATA_BUFFER_SIZE          (512)
+
+/** \brief Size of the optional header at the start of the binary file. It consists of
+ *         the 4 magic bytes, followed by the 32-bit base address in little endian byte
+ *         order.
+ */
+#define BIN_HEADER_SIZE               (8U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Structure that represents the handle to the binary file, which groups all
+ *         its relevent data.
+ */
+typedef struct
+{
+  /** \brief Boolean flag to keep track if a file is opened or not. */
+  uint8_t  fileOpened;
+  /** \brief Boolean flag to keep track if the opened file is shared with another reader
+   *         instance, which owns it.
+   */
+  uint8_t  fileShared;
+  /** \brief Boolean flag to keep track if the segment is opened or not. */
+  uint8_t  segmentOpened;
+  /** \brief FatFS file object handle. */
+  FIL      file;
+  /** \brief Byte buffer for storing data read from the binary file with the help of
+   *         function BinReaderSegmentGetNextData().
+   */
+  uint8_t  dataBuf[BIN_DATA_BUFFER_SIZE];
+  /** \brief Base memory address that is used for files without a header. */
+  uint32_t baseAddr;
+  /** \brief Base memory address of the segment's data. */
+  uint32_t addr;
+  /** \brief Total length of the segment in bytes. */
+  uint32_t len;
+  /** \brief File pointer inside the firmware file where the segment starts. */
+  FSIZE_t  fptr;
+} tBinHandle;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void          * BinReaderCreate(void);
+static void            BinReaderDestroy(void * instance);
+static uint8_t         BinReaderFileOpen(void * instance, char const * firmwareFile);
+static uint8_t         BinReaderFileShare(void * instance, void const * image);
+static void            BinReaderFileClose(void * instance);
+static uint32_t        BinReaderSegmentGetCount(void * instance);
+static uint32_t        BinReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                               uint32_t * address);
+static void            BinReaderSegmentOpen(void * instance, uint32_t idx);
+static uint8_t const * BinReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                   uint16_t * len);
+static uint8_t         BinReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                                       uint8_t * data);
+static void            BinReaderSetBaseAddress(void * instance, uint32_t address);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Magic bytes that identify the optional header at the start of the file. */
+static const uint8_t binHeaderMagic[] = { 'M', 'B', 'I', 'N' };
+
+
+/***********************************************************************************//**
+** \brief     Obtains a pointer to the reader structure, so that it can be linked to the
+**            firmware reader module.
+** \return    Pointer to firmware reader structure.
+**
+****************************************************************************************/
+tFirmwareReader const * BinReaderGet(void)
+{
+  /** \brief File reader structure filled with binary file reading specifics. */
+  static const tFirmwareReader binReader =
+  {
+    .Create = BinReaderCreate,
+    .Destroy = BinReaderDestroy,
+    .FileOpen = BinReaderFileOpen,
+    .FileShare = BinReaderFileShare,
+    .FileClose = BinReaderFileClose,
+    .SegmentGetCount = BinReaderSegmentGetCount,
+    .SegmentGetInfo = BinReaderSegmentGetInfo,
+    .SegmentOpen = BinReaderSegmentOpen,
+    .SegmentGetNextData = BinReaderSegmentGetNextData,
+    .ReadAt = BinReaderReadAt,
+    .SetBaseAddress = BinReaderSetBaseAddress
+  };
+
+  /* Give the pointer to the firmware reader back to the caller. */
+  return &binReader;
+} /*** end of BinReaderGet ***/
+
+
+/************************************************************************************//**
+** \brief     Creates an instance of the binary reader. The instance is allocated from
+**            the memory pool.
+** \return    Pointer to the reader instance if successful, NULL otherwise.
+**
+****************************************************************************************/
+static void * BinReaderCreate(void)
+{
+  tBinHandle * binHandle;
+
+  /* Attempt to allocate the handle. */
+  binHandle = TbxMemPoolAllocate(sizeof(tBinHandle));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (binHandle == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tBinHandle));
+    /* Allocation should now work. */
+    binHandle = TbxMemPoolAllocate(sizeof(tBinHandle));
+  }
+
+  /* Only continue if the handle was allocated. */
+  if (binHandle != NULL)
+  {
+    /* Initialize the binary handle members. */
+    binHandle->fileOpened = TBX_FALSE;
+    binHandle->fileShared = TBX_FALSE;
+    binHandle->segmentOpened = TBX_FALSE;
+    binHandle->baseAddr = BIN_DEFAULT_BASE_ADDRESS;
+    binHandle->addr = 0U;
+    binHandle->len = 0U;
+    binHandle->fptr = 0U;
+  }
+
+  /* Give the reader instance back to the caller. */
+  return binHandle;
+} /*** end of BinReaderCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases an instance of the binary reader.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+**
+****************************************************************************************/
+static void BinReaderDestroy(void * instance)
+{
+  /* Make sure a possibly previously opened file is closed. */
+  BinReaderFileClose(instance);
+  /* Give the handle back to the memory pool. */
+  TbxMemPoolRelease(instance);
+} /*** end of BinReaderDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file and determines the segment information. A binary
+**            file always holds exactly one segment, which spans the entire file. Only
+**            the optional header is read from the file. Its data is not parsed at all.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t BinReaderFileOpen(void * instance, char const * firmwareFile)
+{
+  tBinHandle * binHandle = instance;
+  uint8_t  result = TBX_OK;
+  uint8_t  header[BIN_HEADER_SIZE];
+  UINT     bytesRead = 0U;
+  uint8_t  byteIdx;
+  uint8_t  headerFound = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(firmwareFile != NULL);
+
+  /* Only continue with valid parameter. */
+  if (firmwareFile != NULL)
+  {
+    /* Make sure a possibly previously opened file is first closed. */
+    BinReaderFileClose(binHandle);
+    /* Open the file for reading. */
+    if (f_open(&binHandle->file, firmwareFile, FA_READ) != FR_OK)
+    {
+      /* Could not open the file. Update the result to flag this problem. */
+      result = TBX_ERROR;
+    }
+    /* File successfully opened. */
+    else
+    {
+      /* Update the flag that tracks the file opened state. */
+      binHandle->fileOpened = TBX_TRUE;
+    }
+
+    /* Only continue if the file was successfully opened. */
+    if (result == TBX_OK)
+    {
+      /* Attempt to read the optional header. */
+      if (f_read(&binHandle->file, header, BIN_HEADER_SIZE, &bytesRead) != FR_OK)
+      {
+        /* Could not read from the file. Close it and flag the problem. */
+        BinReaderFileClose(binHandle);
+        result = TBX_ERROR;
+      }
+      /* Check for the presence of the header. */
+      else if (bytesRead == BIN_HEADER_SIZE)
+      {
+        headerFound = TBX_TRUE;
+        for (byteIdx = 0U; (byteIdx < sizeof(binHeaderMagic)) &&
+                           (headerFound == TBX_TRUE); byteIdx++)
+        {
+          if (header[byteIdx] != binHeaderMagic[byteIdx])
+          {
+            headerFound = TBX_FALSE;
+          }
+        }
+      }
+      else
+      {
+        /* File is too small to hold the header. Nothing else to do here. */
+      }
+    }
+
+    /* Only continue if the header read was successful. */
+    if (result == TBX_OK)
+    {
+      /* Was the header found? */
+      if (headerFound == TBX_TRUE)
+      {
+        /* Use the base address from the header. It is stored in little endian. */
+        binHandle->addr = ((uint32_t)header[4]) | ((uint32_t)header[5] << 8U) |
+                         ((uint32_t)header[6] << 16U) | ((uint32_t)header[7] << 24U);
+        binHandle->fptr = BIN_HEADER_SIZE;
+      }
+      /* No header present, so all bytes in the file are firmware data. */
+      else
+      {
+        binHandle->addr = binHandle->baseAddr;
+        binHandle->fptr = 0U;
+      }
+      /* The segment spans the rest of the file. */
+      binHandle->len = (uint32_t)(f_size(&binHandle->file) - binHandle->fptr);
+    }
+  }
+  /* Invalid parameter. */
+  else
+  {
+    result = TBX_ERROR;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderFileOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file that another reader instance already opened. The
+**            segment information is copied from the other instance, so the optional
+**            header does not need to be read again. This instance does get its own file
+**            object, such that it can read the firmware data independent from the other
+**            instance. The other instance must keep its firmware file opened, until this
+**            instance closed it.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     image Pointer to the reader instance that opened the firmware file.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t BinReaderFileShare(void * instance, void const * image)
+{
+  tBinHandle       * binHandle = instance;
+  tBinHandle const * imageHandle = image;
+  uint8_t            result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(image != NULL);
+
+  /* Only continue with valid parameter. */
+  if (image != NULL)
+  {
+    /* Make sure a possibly previously opened file is first closed. */
+    BinReaderFileClose(binHandle);
+    /* Only continue if the other instance actually opened a file. */
+    if (imageHandle->fileOpened == TBX_TRUE)
+    {
+      /* Duplicate the file object. This gives this instance its own file pointer, just
+       * like opening the file again for reading would. The duplicate is never closed
+       * with f_close(), because it did not open the file itself.
+       */
+      binHandle->file = imageHandle->file;
+      /* Copy the segment information. */
+      binHandle->addr = imageHandle->addr;
+      binHandle->len = imageHandle->len;
+      binHandle->fptr = imageHandle->fptr;
+      /* Update the flags that track the file opened state. */
+      binHandle->fileOpened = TBX_TRUE;
+      binHandle->fileShared = TBX_TRUE;
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderFileShare ***/
+
+
+/************************************************************************************//**
+** \brief     Closes the previously opened firmware file.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+**
+****************************************************************************************/
+static void BinReaderFileClose(void * instance)
+{
+  tBinHandle * binHandle = instance;
+
+  /* Only close the file if one is actually opened. */
+  if (binHandle->fileOpened == TBX_TRUE)
+  {
+    /* Reset the flag. */
+    binHandle->fileOpened = TBX_FALSE;
+    /* Only close the file if this instance opened it itself. */
+    if (binHandle->fileShared == TBX_FALSE)
+    {
+      (void)f_close(&binHandle->file);
+    }
+    binHandle->fileShared = TBX_FALSE;
+    /* Reset the segment information. */
+    binHandle->segmentOpened = TBX_FALSE;
+    binHandle->addr = 0U;
+    binHandle->len = 0U;
+    binHandle->fptr = 0U;
+  }
+} /*** end of BinReaderFileClose ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of firmware data segments encountered in the
+**            firmware file. A binary firmware file holds exactly one segment, as long
+**            as it contains data.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \return    Total number of firmware data segments present in the firmware file.
+**
+****************************************************************************************/
+static uint32_t BinReaderSegmentGetCount(void * instance)
+{
+  tBinHandle * binHandle = instance;
+  uint32_t result = 0U;
+
+  /* Only continue if a file is actually opened and it holds data. */
+  if ( (binHandle->fileOpened == TBX_TRUE) && (binHandle->len > 0U) )
+  {
+    result = 1U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderSegmentGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains information about the specified segment, such as the base memory
+**            address that its data belongs to and the total number of data bytes in the
+**            segment.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (SegmentGetCount() - 1).
+** \param     address The base memory address of the segment's data is written to this
+**            pointer.
+** \return    The total number of data bytes inside this segment.
+**
+****************************************************************************************/
+static uint32_t BinReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                        uint32_t * address)
+{
+  tBinHandle * binHandle = instance;
+  uint32_t result = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT((idx < BinReaderSegmentGetCount(binHandle)) && (address != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((idx < BinReaderSegmentGetCount(binHandle)) && (address != NULL))
+  {
+    /* Store the segment's data address. */
+    *address = binHandle->addr;
+    /* Set the result to the segment's length. */
+    result = binHandle->len;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderSegmentGetInfo ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware data segment for reading. This should always be called
+**            before calling the SegmentGetNextData() function.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (SegmentGetCount() - 1).
+**
+****************************************************************************************/
+static void BinReaderSegmentOpen(void * instance, uint32_t idx)
+{
+  tBinHandle * binHandle = instance;
+
+  /* Verify parameter. */
+  TBX_ASSERT(idx < BinReaderSegmentGetCount(binHandle));
+
+  /* Only continue with valid parameter. */
+  if (idx < BinReaderSegmentGetCount(binHandle))
+  {
+    /* Set the file pointer to where the segment's data starts. */
+    if (f_lseek(&binHandle->file, binHandle->fptr) == FR_OK)
+    {
+      /* Keep track of the segment opened state. */
+      binHandle->segmentOpened = TBX_TRUE;
+    }
+  }
+} /*** end of BinReaderSegmentOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains a data pointer to the next chunk of firmware data in the segment
+**            that was opened with function SegmentOpen(). The idea is that you first
+**            open the segment and afterwards you can keep calling this function to
+**            read out the segment's firmware data. When all data is read, len will be
+**            set to zero and a non-NULL pointer is returned. The data is read directly
+**            from the file into the data buffer, without any decoding.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successul, NULL otherwise.
+** \attention There are three possible outsomes when calling this function:
+**            1) len > 0 and a non-NULL pointer is returned. This means valid data was
+**               read.
+**            2) len = 0 and a non-NULL pointer is returned. This means the end of the
+**               segment is reached and therefore no new data was actually read.
+**            3) A NULL pointer is returned. This happens only when an error occurred.
+**
+****************************************************************************************/
+static uint8_t const * BinReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                   uint16_t * len)
+{
+  tBinHandle    * binHandle = instance;
+  uint8_t const * result = NULL;
+  FSIZE_t         filePtr;
+  UINT            bytesRead = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT((address != NULL) && (len != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((address != NULL) && (len != NULL))
+  {
+    /* Initialize the length output parameter. */
+    *len = 0U;
+    /* Only continue if a file is actually opened and the segment was opened. */
+    if ( (binHandle->fileOpened == TBX_TRUE) && (binHandle->segmentOpened == TBX_TRUE) )
+    {
+      /* Determine the memory address of the data, based on the file pointer. */
+      filePtr = f_tell(&binHandle->file);
+      *address = binHandle->addr + (uint32_t)(filePtr - binHandle->fptr);
+      /* Read the next chunk of data directly into the data buffer. At the end of the
+       * file, this reads zero bytes, which signals the end of the segment.
+       */
+      if (f_read(&binHandle->file, binHandle->dataBuf, BIN_DATA_BUFFER_SIZE,
+                 &bytesRead) == FR_OK)
+      {
+        /* Set the length and the result to the valid databuffer to indicate success. */
+        *len = (uint16_t)bytesRead;
+        result = binHandle->dataBuf;
+      }
+      else
+      {
+        /* Rewind the file pointer to retry the same chunk next time. */
+        (void)f_lseek(&binHandle->file, filePtr);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderSegmentGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Reads firmware data at a specific memory address. The file offset of the
+**            data follows directly from the memory address, so the data is read from
+**            the file without any searching. Reading from the opened segment afterwards
+**            continues where it left off.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
+**
+****************************************************************************************/
+static uint8_t BinReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                               uint8_t * data)
+{
+  tBinHandle * binHandle = instance;
+  uint8_t result = TBX_ERROR;
+  FSIZE_t restoreFPtr;
+  UINT    bytesRead = 0U;
+
+  /* Verify parameters. */
+  TBX_ASSERT((len > 0U) && (data != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((len > 0U) && (data != NULL))
+  {
+    /* Only continue if a file is actually opened and the range lies in the segment. */
+    if ( (binHandle->fileOpened == TBX_TRUE) && (address >= binHandle->addr) &&
+         ((address - binHandle->addr) < binHandle->len) &&
+         (len <= (binHandle->len - (address - binHandle->addr))) )
+    {
+      /* Read the data directly from its position in the file. */
+      restoreFPtr = f_tell(&binHandle->file);
+      if (f_lseek(&binHandle->file,
+                  binHandle->fptr + (address - binHandle->addr)) == FR_OK)
+      {
+        if ( (f_read(&binHandle->file, data, len, &bytesRead) == FR_OK) &&
+             (bytesRead == len) )
+        {
+          result = TBX_OK;
+        }
+      }
+      /* Continue reading from the opened segment where it left off. */
+      (void)f_lseek(&binHandle->file, restoreFPtr);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BinReaderReadAt ***/
+
+
+/************************************************************************************//**
+** \brief     Sets the memory address where the firmware data of a binary file without
+**            header should be programmed. For a binary file with header, the base
+**            address stored in the header is used instead. Should be called before
+**            opening the firmware file.
+** \param     instance Pointer to the reader instance, as created by BinReaderCreate().
+** \param     address Base memory address of the firmware data.
+**
+****************************************************************************************/
+static void BinReaderSetBaseAddress(void * instance, uint32_t address)
+{
+  tBinHandle * binHandle = instance;
+
+  /* Verify parameter. */
+  TBX_ASSERT(binHandle != NULL);
+
+  /* Only continue with valid parameter. */
+  if (binHandle != NULL)
+  {
+    /* Store the base address. */
+    binHandle->baseAddr = address;
+  }
+} /*** end of BinReaderSetBaseAddress ***/
+
+
+/*********************************** end of binreader.c ********************************/
@@ -0,0 +1,77 @@
+/************************************************************************************//**
+* \file         binreader.h
+* \brief        Binary firmware file reader header file.
+* \ingroup      BinReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   BinReader Binary reader
+* \brief      This module implements the binary firmware reader that can be linked
+*             to the Firmware module.
+* \ingroup    Firmware
+* \details
+* This binary reader module implements functionality for reading a firmware file that
+* holds the raw firmware data. Since the data is not encoded, it is read directly from
+* the file, without any parsing. Such a file holds exactly one segment. The memory
+* address of its first byte is set for each firmware context with
+* FirmwareSetBaseAddress(). Alternatively, the file can start with an 8 byte header: the
+* characters 'M', 'B', 'I', 'N', followed by the 32-bit base address in little endian
+* byte order. When present, the base address from the header takes precedence.
+****************************************************************************************/
+#ifndef BINREADER_H
+#define BINREADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Base address used for binary files without a header, until it is changed
+ *         with FirmwareSetBaseAddress().
+ */
+#ifndef BIN_DEFAULT_BASE_ADDRESS
+#define BIN_DEFAULT_BASE_ADDRESS       (0U)
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tFirmwareReader const * BinReaderGet(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BINREADER_H */
+/*********************************** end of binreader.h ********************************/
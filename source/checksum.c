@@ -0,0 +1,1412 @@
+/************************************************************************************//**
+* \file         checksum.c
+* \brief        Checksum module source file.
+* \ingroup      Checksum
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "checksum.h"                       /* Checksum module                         */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Mask to remove the byte order flag from the checksum type. */
+#define CHECKSUM_TYPE_MASK             ((uint8_t)0x7FU)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t  ChecksumGetWordSize(uint8_t type);
+static uint32_t ChecksumGetWord(uint8_t type, uint8_t const * word);
+static uint32_t ChecksumUpdateAddWords(tChecksum * checksum, uint8_t const * data,
+                                       uint32_t len);
+static uint32_t ChecksumUpdateCrc16(uint32_t crc, uint8_t const * data, uint32_t len);
+static uint32_t ChecksumUpdateCrc16Citt(uint32_t crc, uint8_t const * data,
+                                        uint32_t len);
+static uint32_t ChecksumUpdateCrc32(uint32_t crc, uint8_t const * data, uint32_t len);
+
+
+#if (CHECKSUM_CRC_TABLE_ENABLE > 0U)
+/****************************************************************************************
+* Local constant declarations
+****************************************************************************************/
+/** \brief Slicing-by-8 lookup tables for the CRC16 checksum type. The first table is the
+ *         regular byte-wise lookup table. Each next table holds the CRC contribution of
+ *         a byte that is located one byte further away from the end of an 8 byte block.
+ */
+static const uint16_t checksumCrc16Tbl[8][256] =
+{
+  {
+    0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U, 0xC601U,
+    0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U, 0xCC01U, 0x0CC0U,
+    0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U, 0x0A00U, 0xCAC1U, 0xCB81U,
+    0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U, 0xD801U, 0x18C0U, 0x1980U, 0xD941U,
+    0x1B00U, 0xDBC1U, 0xDA81U, 0x1A40U, 0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U,
+    0x1DC0U, 0x1C80U, 0xDC41U, 0x1400U, 0xD4C1U, 0xD581U, 0x1540U, 0xD701U, 0x17C0U,
+    0x1680U, 0xD641U, 0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U,
+    0x1040U, 0xF001U, 0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U,
+    0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U, 0x3480U, 0xF441U, 0x3C00U,
+    0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U, 0xFA01U, 0x3AC0U,
+    0x3B80U, 0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U, 0x2800U, 0xE8C1U, 0xE981U,
+    0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U, 0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U,
+    0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U, 0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U,
+    0xE7C1U, 0xE681U, 0x2640U, 0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U,
+    0x2080U, 0xE041U, 0xA001U, 0x60C0U, 0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U,
+    0x6240U, 0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U, 0xA441U,
+    0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U, 0xAA01U,
+    0x6AC0U, 0x6B80U, 0xAB41U, 0x6900U, 0xA9C1U, 0xA881U, 0x6840U, 0x7800U, 0xB8C1U,
+    0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U, 0xBE01U, 0x7EC0U, 0x7F80U,
+    0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U, 0xB401U, 0x74C0U, 0x7580U, 0xB541U,
+    0x7700U, 0xB7C1U, 0xB681U, 0x7640U, 0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U,
+    0x71C0U, 0x7080U, 0xB041U, 0x5000U, 0x90C1U, 0x9181U, 0x5140U, 0x9301U, 0x53C0U,
+    0x5280U, 0x9241U, 0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U,
+    0x5440U, 0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U,
+    0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U, 0x59C0U, 0x5880U, 0x9841U, 0x8801U,
+    0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U, 0x4E00U, 0x8EC1U,
+    0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U, 0x4400U, 0x84C1U, 0x8581U,
+    0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U, 0x8201U, 0x42C0U, 0x4380U, 0x8341U,
+    0x4100U, 0x81C1U, 0x8081U, 0x4040U
+  },
+  {
+    0x0000U, 0x9001U, 0x6001U, 0xF000U, 0xC002U, 0x5003U, 0xA003U, 0x3002U, 0xC007U,
+    0x5006U, 0xA006U, 0x3007U, 0x0005U, 0x9004U, 0x6004U, 0xF005U, 0xC00DU, 0x500CU,
+    0xA00CU, 0x300DU, 0x000FU, 0x900EU, 0x600EU, 0xF00FU, 0x000AU, 0x900BU, 0x600BU,
+    0xF00AU, 0xC008U, 0x5009U, 0xA009U, 0x3008U, 0xC019U, 0x5018U, 0xA018U, 0x3019U,
+    0x001BU, 0x901AU, 0x601AU, 0xF01BU, 0x001EU, 0x901FU, 0x601FU, 0xF01EU, 0xC01CU,
+    0x501DU, 0xA01DU, 0x301CU, 0x0014U, 0x9015U, 0x6015U, 0xF014U, 0xC016U, 0x5017U,
+    0xA017U, 0x3016U, 0xC013U, 0x5012U, 0xA012U, 0x3013U, 0x0011U, 0x9010U, 0x6010U,
+    0xF011U, 0xC031U, 0x5030U, 0xA030U, 0x3031U, 0x0033U, 0x9032U, 0x6032U, 0xF033U,
+    0x0036U, 0x9037U, 0x6037U, 0xF036U, 0xC034U, 0x5035U, 0xA035U, 0x3034U, 0x003CU,
+    0x903DU, 0x603DU, 0xF03CU, 0xC03EU, 0x503FU, 0xA03FU, 0x303EU, 0xC03BU, 0x503AU,
+    0xA03AU, 0x303BU, 0x0039U, 0x9038U, 0x6038U, 0xF039U, 0x0028U, 0x9029U, 0x6029U,
+    0xF028U, 0xC02AU, 0x502BU, 0xA02BU, 0x302AU, 0xC02FU, 0x502EU, 0xA02EU, 0x302FU,
+    0x002DU, 0x902CU, 0x602CU, 0xF02DU, 0xC025U, 0x5024U, 0xA024U, 0x3025U, 0x0027U,
+    0x9026U, 0x6026U, 0xF027U, 0x0022U, 0x9023U, 0x6023U, 0xF022U, 0xC020U, 0x5021U,
+    0xA021U, 0x3020U, 0xC061U, 0x5060U, 0xA060U, 0x3061U, 0x0063U, 0x9062U, 0x6062U,
+    0xF063U, 0x0066U, 0x9067U, 0x6067U, 0xF066U, 0xC064U, 0x5065U, 0xA065U, 0x3064U,
+    0x006CU, 0x906DU, 0x606DU, 0xF06CU, 0xC06EU, 0x506FU, 0xA06FU, 0x306EU, 0xC06BU,
+    0x506AU, 0xA06AU, 0x306BU, 0x0069U, 0x9068U, 0x6068U, 0xF069U, 0x0078U, 0x9079U,
+    0x6079U, 0xF078U, 0xC07AU, 0x507BU, 0xA07BU, 0x307AU, 0xC07FU, 0x507EU, 0xA07EU,
+    0x307FU, 0x007DU, 0x907CU, 0x607CU, 0xF07DU, 0xC075U, 0x5074U, 0xA074U, 0x3075U,
+    0x0077U, 0x9076U, 0x6076U, 0xF077U, 0x0072U, 0x9073U, 0x6073U, 0xF072U, 0xC070U,
+    0x5071U, 0xA071U, 0x3070U, 0x0050U, 0x9051U, 0x6051U, 0xF050U, 0xC052U, 0x5053U,
+    0xA053U, 0x3052U, 0xC057U, 0x5056U, 0xA056U, 0x3057U, 0x0055U, 0x9054U, 0x6054U,
+    0xF055U, 0xC05DU, 0x505CU, 0xA05CU, 0x305DU, 0x005FU, 0x905EU, 0x605EU, 0xF05FU,
+    0x005AU, 0x905BU, 0x605BU, 0xF05AU, 0xC058U, 0x5059U, 0xA059U, 0x3058U, 0xC049U,
+    0x5048U, 0xA048U, 0x3049U, 0x004BU, 0x904AU, 0x604AU, 0xF04BU, 0x004EU, 0x904FU,
+    0x604FU, 0xF04EU, 0xC04CU, 0x504DU, 0xA04DU, 0x304CU, 0x0044U, 0x9045U, 0x6045U,
+    0xF044U, 0xC046U, 0x5047U, 0xA047U, 0x3046U, 0xC043U, 0x5042U, 0xA042U, 0x3043U,
+    0x0041U, 0x9040U, 0x6040U, 0xF041U
+  },
+  {
+    0x0000U, 0xC051U, 0xC0A1U, 0x00F0U, 0xC141U, 0x0110U, 0x01E0U, 0xC1B1U, 0xC281U,
+    0x02D0U, 0x0220U, 0xC271U, 0x03C0U, 0xC391U, 0xC361U, 0x0330U, 0xC501U, 0x0550U,
+    0x05A0U, 0xC5F1U, 0x0440U, 0xC411U, 0xC4E1U, 0x04B0U, 0x0780U, 0xC7D1U, 0xC721U,
+    0x0770U, 0xC6C1U, 0x0690U, 0x0660U, 0xC631U, 0xCA01U, 0x0A50U, 0x0AA0U, 0xCAF1U,
+    0x0B40U, 0xCB11U, 0xCBE1U, 0x0BB0U, 0x0880U, 0xC8D1U, 0xC821U, 0x0870U, 0xC9C1U,
+    0x0990U, 0x0960U, 0xC931U, 0x0F00U, 0xCF51U, 0xCFA1U, 0x0FF0U, 0xCE41U, 0x0E10U,
+    0x0EE0U, 0xCEB1U, 0xCD81U, 0x0DD0U, 0x0D20U, 0xCD71U, 0x0CC0U, 0xCC91U, 0xCC61U,
+    0x0C30U, 0xD401U, 0x1450U, 0x14A0U, 0xD4F1U, 0x1540U, 0xD511U, 0xD5E1U, 0x15B0U,
+    0x1680U, 0xD6D1U, 0xD621U, 0x1670U, 0xD7C1U, 0x1790U, 0x1760U, 0xD731U, 0x1100U,
+    0xD151U, 0xD1A1U, 0x11F0U, 0xD041U, 0x1010U, 0x10E0U, 0xD0B1U, 0xD381U, 0x13D0U,
+    0x1320U, 0xD371U, 0x12C0U, 0xD291U, 0xD261U, 0x1230U, 0x1E00U, 0xDE51U, 0xDEA1U,
+    0x1EF0U, 0xDF41U, 0x1F10U, 0x1FE0U, 0xDFB1U, 0xDC81U, 0x1CD0U, 0x1C20U, 0xDC71U,
+    0x1DC0U, 0xDD91U, 0xDD61U, 0x1D30U, 0xDB01U, 0x1B50U, 0x1BA0U, 0xDBF1U, 0x1A40U,
+    0xDA11U, 0xDAE1U, 0x1AB0U, 0x1980U, 0xD9D1U, 0xD921U, 0x1970U, 0xD8C1U, 0x1890U,
+    0x1860U, 0xD831U, 0xE801U, 0x2850U, 0x28A0U, 0xE8F1U, 0x2940U, 0xE911U, 0xE9E1U,
+    0x29B0U, 0x2A80U, 0xEAD1U, 0xEA21U, 0x2A70U, 0xEBC1U, 0x2B90U, 0x2B60U, 0xEB31U,
+    0x2D00U, 0xED51U, 0xEDA1U, 0x2DF0U, 0xEC41U, 0x2C10U, 0x2CE0U, 0xECB1U, 0xEF81U,
+    0x2FD0U, 0x2F20U, 0xEF71U, 0x2EC0U, 0xEE91U, 0xEE61U, 0x2E30U, 0x2200U, 0xE251U,
+    0xE2A1U, 0x22F0U, 0xE341U, 0x2310U, 0x23E0U, 0xE3B1U, 0xE081U, 0x20D0U, 0x2020U,
+    0xE071U, 0x21C0U, 0xE191U, 0xE161U, 0x2130U, 0xE701U, 0x2750U, 0x27A0U, 0xE7F1U,
+    0x2640U, 0xE611U, 0xE6E1U, 0x26B0U, 0x2580U, 0xE5D1U, 0xE521U, 0x2570U, 0xE4C1U,
+    0x2490U, 0x2460U, 0xE431U, 0x3C00U, 0xFC51U, 0xFCA1U, 0x3CF0U, 0xFD41U, 0x3D10U,
+    0x3DE0U, 0xFDB1U, 0xFE81U, 0x3ED0U, 0x3E20U, 0xFE71U, 0x3FC0U, 0xFF91U, 0xFF61U,
+    0x3F30U, 0xF901U, 0x3950U, 0x39A0U, 0xF9F1U, 0x3840U, 0xF811U, 0xF8E1U, 0x38B0U,
+    0x3B80U, 0xFBD1U, 0xFB21U, 0x3B70U, 0xFAC1U, 0x3A90U, 0x3A60U, 0xFA31U, 0xF601U,
+    0x3650U, 0x36A0U, 0xF6F1U, 0x3740U, 0xF711U, 0xF7E1U, 0x37B0U, 0x3480U, 0xF4D1U,
+    0xF421U, 0x3470U, 0xF5C1U, 0x3590U, 0x3560U, 0xF531U, 0x3300U, 0xF351U, 0xF3A1U,
+    0x33F0U, 0xF241U, 0x3210U, 0x32E0U, 0xF2B1U, 0xF181U, 0x31D0U, 0x3120U, 0xF171U,
+    0x30C0U, 0xF091U, 0xF061U, 0x3030U
+  },
+  {
+    0x0000U, 0xFC01U, 0xB801U, 0x4400U, 0x3001U, 0xCC00U, 0x8800U, 0x7401U, 0x6002U,
+    0x9C03U, 0xD803U, 0x2402U, 0x5003U, 0xAC02U, 0xE802U, 0x1403U, 0xC004U, 0x3C05U,
+    0x7805U, 0x8404U, 0xF005U, 0x0C04U, 0x4804U, 0xB405U, 0xA006U, 0x5C07U, 0x1807U,
+    0xE406U, 0x9007U, 0x6C06U, 0x2806U, 0xD407U, 0xC00BU, 0x3C0AU, 0x780AU, 0x840BU,
+    0xF00AU, 0x0C0BU, 0x480BU, 0xB40AU, 0xA009U, 0x5C08U, 0x1808U, 0xE409U, 0x9008U,
+    0x6C09U, 0x2809U, 0xD408U, 0x000FU, 0xFC0EU, 0xB80EU, 0x440FU, 0x300EU, 0xCC0FU,
+    0x880FU, 0x740EU, 0x600DU, 0x9C0CU, 0xD80CU, 0x240DU, 0x500CU, 0xAC0DU, 0xE80DU,
+    0x140CU, 0xC015U, 0x3C14U, 0x7814U, 0x8415U, 0xF014U, 0x0C15U, 0x4815U, 0xB414U,
+    0xA017U, 0x5C16U, 0x1816U, 0xE417U, 0x9016U, 0x6C17U, 0x2817U, 0xD416U, 0x0011U,
+    0xFC10U, 0xB810U, 0x4411U, 0x3010U, 0xCC11U, 0x8811U, 0x7410U, 0x6013U, 0x9C12U,
+    0xD812U, 0x2413U, 0x5012U, 0xAC13U, 0xE813U, 0x1412U, 0x001EU, 0xFC1FU, 0xB81FU,
+    0x441EU, 0x301FU, 0xCC1EU, 0x881EU, 0x741FU, 0x601CU, 0x9C1DU, 0xD81DU, 0x241CU,
+    0x501DU, 0xAC1CU, 0xE81CU, 0x141DU, 0xC01AU, 0x3C1BU, 0x781BU, 0x841AU, 0xF01BU,
+    0x0C1AU, 0x481AU, 0xB41BU, 0xA018U, 0x5C19U, 0x1819U, 0xE418U, 0x9019U, 0x6C18U,
+    0x2818U, 0xD419U, 0xC029U, 0x3C28U, 0x7828U, 0x8429U, 0xF028U, 0x0C29U, 0x4829U,
+    0xB428U, 0xA02BU, 0x5C2AU, 0x182AU, 0xE42BU, 0x902AU, 0x6C2BU, 0x282BU, 0xD42AU,
+    0x002DU, 0xFC2CU, 0xB82CU, 0x442DU, 0x302CU, 0xCC2DU, 0x882DU, 0x742CU, 0x602FU,
+    0x9C2EU, 0xD82EU, 0x242FU, 0x502EU, 0xAC2FU, 0xE82FU, 0x142EU, 0x0022U, 0xFC23U,
+    0xB823U, 0x4422U, 0x3023U, 0xCC22U, 0x8822U, 0x7423U, 0x6020U, 0x9C21U, 0xD821U,
+    0x2420U, 0x5021U, 0xAC20U, 0xE820U, 0x1421U, 0xC026U, 0x3C27U, 0x7827U, 0x8426U,
+    0xF027U, 0x0C26U, 0x4826U, 0xB427U, 0xA024U, 0x5C25U, 0x1825U, 0xE424U, 0x9025U,
+    0x6C24U, 0x2824U, 0xD425U, 0x003CU, 0xFC3DU, 0xB83DU, 0x443CU, 0x303DU, 0xCC3CU,
+    0x883CU, 0x743DU, 0x603EU, 0x9C3FU, 0xD83FU, 0x243EU, 0x503FU, 0xAC3EU, 0xE83EU,
+    0x143FU, 0xC038U, 0x3C39U, 0x7839U, 0x8438U, 0xF039U, 0x0C38U, 0x4838U, 0xB439U,
+    0xA03AU, 0x5C3BU, 0x183BU, 0xE43AU, 0x903BU, 0x6C3AU, 0x283AU, 0xD43BU, 0xC037U,
+    0x3C36U, 0x7836U, 0x8437U, 0xF036U, 0x0C37U, 0x4837U, 0xB436U, 0xA035U, 0x5C34U,
+    0x1834U, 0xE435U, 0x9034U, 0x6C35U, 0x2835U, 0xD434U, 0x0033U, 0xFC32U, 0xB832U,
+    0x4433U, 0x3032U, 0xCC33U, 0x8833U, 0x7432U, 0x6031U, 0x9C30U, 0xD830U, 0x2431U,
+    0x5030U, 0xAC31U, 0xE831U, 0x1430U
+  },
+  {
+    0x0000U, 0xC03DU, 0xC079U, 0x0044U, 0xC0F1U, 0x00CCU, 0x0088U, 0xC0B5U, 0xC1E1U,
+    0x01DCU, 0x0198U, 0xC1A5U, 0x0110U, 0xC12DU, 0xC169U, 0x0154U, 0xC3C1U, 0x03FCU,
+    0x03B8U, 0xC385U, 0x0330U, 0xC30DU, 0xC349U, 0x0374U, 0x0220U, 0xC21DU, 0xC259U,
+    0x0264U, 0xC2D1U, 0x02ECU, 0x02A8U, 0xC295U, 0xC781U, 0x07BCU, 0x07F8U, 0xC7C5U,
+    0x0770U, 0xC74DU, 0xC709U, 0x0734U, 0x0660U, 0xC65DU, 0xC619U, 0x0624U, 0xC691U,
+    0x06ACU, 0x06E8U, 0xC6D5U, 0x0440U, 0xC47DU, 0xC439U, 0x0404U, 0xC4B1U, 0x048CU,
+    0x04C8U, 0xC4F5U, 0xC5A1U, 0x059CU, 0x05D8U, 0xC5E5U, 0x0550U, 0xC56DU, 0xC529U,
+    0x0514U, 0xCF01U, 0x0F3CU, 0x0F78U, 0xCF45U, 0x0FF0U, 0xCFCDU, 0xCF89U, 0x0FB4U,
+    0x0EE0U, 0xCEDDU, 0xCE99U, 0x0EA4U, 0xCE11U, 0x0E2CU, 0x0E68U, 0xCE55U, 0x0CC0U,
+    0xCCFDU, 0xCCB9U, 0x0C84U, 0xCC31U, 0x0C0CU, 0x0C48U, 0xCC75U, 0xCD21U, 0x0D1CU,
+    0x0D58U, 0xCD65U, 0x0DD0U, 0xCDEDU, 0xCDA9U, 0x0D94U, 0x0880U, 0xC8BDU, 0xC8F9U,
+    0x08C4U, 0xC871U, 0x084CU, 0x0808U, 0xC835U, 0xC961U, 0x095CU, 0x0918U, 0xC925U,
+    0x0990U, 0xC9ADU, 0xC9E9U, 0x09D4U, 0xCB41U, 0x0B7CU, 0x0B38U, 0xCB05U, 0x0BB0U,
+    0xCB8DU, 0xCBC9U, 0x0BF4U, 0x0AA0U, 0xCA9DU, 0xCAD9U, 0x0AE4U, 0xCA51U, 0x0A6CU,
+    0x0A28U, 0xCA15U, 0xDE01U, 0x1E3CU, 0x1E78U, 0xDE45U, 0x1EF0U, 0xDECDU, 0xDE89U,
+    0x1EB4U, 0x1FE0U, 0xDFDDU, 0xDF99U, 0x1FA4U, 0xDF11U, 0x1F2CU, 0x1F68U, 0xDF55U,
+    0x1DC0U, 0xDDFDU, 0xDDB9U, 0x1D84U, 0xDD31U, 0x1D0CU, 0x1D48U, 0xDD75U, 0xDC21U,
+    0x1C1CU, 0x1C58U, 0xDC65U, 0x1CD0U, 0xDCEDU, 0xDCA9U, 0x1C94U, 0x1980U, 0xD9BDU,
+    0xD9F9U, 0x19C4U, 0xD971U, 0x194CU, 0x1908U, 0xD935U, 0xD861U, 0x185CU, 0x1818U,
+    0xD825U, 0x1890U, 0xD8ADU, 0xD8E9U, 0x18D4U, 0xDA41U, 0x1A7CU, 0x1A38U, 0xDA05U,
+    0x1AB0U, 0xDA8DU, 0xDAC9U, 0x1AF4U, 0x1BA0U, 0xDB9DU, 0xDBD9U, 0x1BE4U, 0xDB51U,
+    0x1B6CU, 0x1B28U, 0xDB15U, 0x1100U, 0xD13DU, 0xD179U, 0x1144U, 0xD1F1U, 0x11CCU,
+    0x1188U, 0xD1B5U, 0xD0E1U, 0x10DCU, 0x1098U, 0xD0A5U, 0x1010U, 0xD02DU, 0xD069U,
+    0x1054U, 0xD2C1U, 0x12FCU, 0x12B8U, 0xD285U, 0x1230U, 0xD20DU, 0xD249U, 0x1274U,
+    0x1320U, 0xD31DU, 0xD359U, 0x1364U, 0xD3D1U, 0x13ECU, 0x13A8U, 0xD395U, 0xD681U,
+    0x16BCU, 0x16F8U, 0xD6C5U, 0x1670U, 0xD64DU, 0xD609U, 0x1634U, 0x1760U, 0xD75DU,
+    0xD719U, 0x1724U, 0xD791U, 0x17ACU, 0x17E8U, 0xD7D5U, 0x1540U, 0xD57DU, 0xD539U,
+    0x1504U, 0xD5B1U, 0x158CU, 0x15C8U, 0xD5F5U, 0xD4A1U, 0x149CU, 0x14D8U, 0xD4E5U,
+    0x1450U, 0xD46DU, 0xD429U, 0x1414U
+  },
+  {
+    0x0000U, 0xD101U, 0xE201U, 0x3300U, 0x8401U, 0x5500U, 0x6600U, 0xB701U, 0x4801U,
+    0x9900U, 0xAA00U, 0x7B01U, 0xCC00U, 0x1D01U, 0x2E01U, 0xFF00U, 0x9002U, 0x4103U,
+    0x7203U, 0xA302U, 0x1403U, 0xC502U, 0xF602U, 0x2703U, 0xD803U, 0x0902U, 0x3A02U,
+    0xEB03U, 0x5C02U, 0x8D03U, 0xBE03U, 0x6F02U, 0x6007U, 0xB106U, 0x8206U, 0x5307U,
+    0xE406U, 0x3507U, 0x0607U, 0xD706U, 0x2806U, 0xF907U, 0xCA07U, 0x1B06U, 0xAC07U,
+    0x7D06U, 0x4E06U, 0x9F07U, 0xF005U, 0x2104U, 0x1204U, 0xC305U, 0x7404U, 0xA505U,
+    0x9605U, 0x4704U, 0xB804U, 0x6905U, 0x5A05U, 0x8B04U, 0x3C05U, 0xED04U, 0xDE04U,
+    0x0F05U, 0xC00EU, 0x110FU, 0x220FU, 0xF30EU, 0x440FU, 0x950EU, 0xA60EU, 0x770FU,
+    0x880FU, 0x590EU, 0x6A0EU, 0xBB0FU, 0x0C0EU, 0xDD0FU, 0xEE0FU, 0x3F0EU, 0x500CU,
+    0x810DU, 0xB20DU, 0x630CU, 0xD40DU, 0x050CU, 0x360CU, 0xE70DU, 0x180DU, 0xC90CU,
+    0xFA0CU, 0x2B0DU, 0x9C0CU, 0x4D0DU, 0x7E0DU, 0xAF0CU, 0xA009U, 0x7108U, 0x4208U,
+    0x9309U, 0x2408U, 0xF509U, 0xC609U, 0x1708U, 0xE808U, 0x3909U, 0x0A09U, 0xDB08U,
+    0x6C09U, 0xBD08U, 0x8E08U, 0x5F09U, 0x300BU, 0xE10AU, 0xD20AU, 0x030BU, 0xB40AU,
+    0x650BU, 0x560BU, 0x870AU, 0x780AU, 0xA90BU, 0x9A0BU, 0x4B0AU, 0xFC0BU, 0x2D0AU,
+    0x1E0AU, 0xCF0BU, 0xC01FU, 0x111EU, 0x221EU, 0xF31FU, 0x441EU, 0x951FU, 0xA61FU,
+    0x771EU, 0x881EU, 0x591FU, 0x6A1FU, 0xBB1EU, 0x0C1FU, 0xDD1EU, 0xEE1EU, 0x3F1FU,
+    0x501DU, 0x811CU, 0xB21CU, 0x631DU, 0xD41CU, 0x051DU, 0x361DU, 0xE71CU, 0x181CU,
+    0xC91DU, 0xFA1DU, 0x2B1CU, 0x9C1DU, 0x4D1CU, 0x7E1CU, 0xAF1DU, 0xA018U, 0x7119U,
+    0x4219U, 0x9318U, 0x2419U, 0xF518U, 0xC618U, 0x1719U, 0xE819U, 0x3918U, 0x0A18U,
+    0xDB19U, 0x6C18U, 0xBD19U, 0x8E19U, 0x5F18U, 0x301AU, 0xE11BU, 0xD21BU, 0x031AU,
+    0xB41BU, 0x651AU, 0x561AU, 0x871BU, 0x781BU, 0xA91AU, 0x9A1AU, 0x4B1BU, 0xFC1AU,
+    0x2D1BU, 0x1E1BU, 0xCF1AU, 0x0011U, 0xD110U, 0xE210U, 0x3311U, 0x8410U, 0x5511U,
+    0x6611U, 0xB710U, 0x4810U, 0x9911U, 0xAA11U, 0x7B10U, 0xCC11U, 0x1D10U, 0x2E10U,
+    0xFF11U, 0x9013U, 0x4112U, 0x7212U, 0xA313U, 0x1412U, 0xC513U, 0xF613U, 0x2712U,
+    0xD812U, 0x0913U, 0x3A13U, 0xEB12U, 0x5C13U, 0x8D12U, 0xBE12U, 0x6F13U, 0x6016U,
+    0xB117U, 0x8217U, 0x5316U, 0xE417U, 0x3516U, 0x0616U, 0xD717U, 0x2817U, 0xF916U,
+    0xCA16U, 0x1B17U, 0xAC16U, 0x7D17U, 0x4E17U, 0x9F16U, 0xF014U, 0x2115U, 0x1215U,
+    0xC314U, 0x7415U, 0xA514U, 0x9614U, 0x4715U, 0xB815U, 0x6914U, 0x5A14U, 0x8B15U,
+    0x3C14U, 0xED15U, 0xDE15U, 0x0F14U
+  },
+  {
+    0x0000U, 0xC010U, 0xC023U, 0x0033U, 0xC045U, 0x0055U, 0x0066U, 0xC076U, 0xC089U,
+    0x0099U, 0x00AAU, 0xC0BAU, 0x00CCU, 0xC0DCU, 0xC0EFU, 0x00FFU, 0xC111U, 0x0101U,
+    0x0132U, 0xC122U, 0x0154U, 0xC144U, 0xC177U, 0x0167U, 0x0198U, 0xC188U, 0xC1BBU,
+    0x01ABU, 0xC1DDU, 0x01CDU, 0x01FEU, 0xC1EEU, 0xC221U, 0x0231U, 0x0202U, 0xC212U,
+    0x0264U, 0xC274U, 0xC247U, 0x0257U, 0x02A8U, 0xC2B8U, 0xC28BU, 0x029BU, 0xC2EDU,
+    0x02FDU, 0x02CEU, 0xC2DEU, 0x0330U, 0xC320U, 0xC313U, 0x0303U, 0xC375U, 0x0365U,
+    0x0356U, 0xC346U, 0xC3B9U, 0x03A9U, 0x039AU, 0xC38AU, 0x03FCU, 0xC3ECU, 0xC3DFU,
+    0x03CFU, 0xC441U, 0x0451U, 0x0462U, 0xC472U, 0x0404U, 0xC414U, 0xC427U, 0x0437U,
+    0x04C8U, 0xC4D8U, 0xC4EBU, 0x04FBU, 0xC48DU, 0x049DU, 0x04AEU, 0xC4BEU, 0x0550U,
+    0xC540U, 0xC573U, 0x0563U, 0xC515U, 0x0505U, 0x0536U, 0xC526U, 0xC5D9U, 0x05C9U,
+    0x05FAU, 0xC5EAU, 0x059CU, 0xC58CU, 0xC5BFU, 0x05AFU, 0x0660U, 0xC670U, 0xC643U,
+    0x0653U, 0xC625U, 0x0635U, 0x0606U, 0xC616U, 0xC6E9U, 0x06F9U, 0x06CAU, 0xC6DAU,
+    0x06ACU, 0xC6BCU, 0xC68FU, 0x069FU, 0xC771U, 0x0761U, 0x0752U, 0xC742U, 0x0734U,
+    0xC724U, 0xC717U, 0x0707U, 0x07F8U, 0xC7E8U, 0xC7DBU, 0x07CBU, 0xC7BDU, 0x07ADU,
+    0x079EU, 0xC78EU, 0xC881U, 0x0891U, 0x08A2U, 0xC8B2U, 0x08C4U, 0xC8D4U, 0xC8E7U,
+    0x08F7U, 0x0808U, 0xC818U, 0xC82BU, 0x083BU, 0xC84DU, 0x085DU, 0x086EU, 0xC87EU,
+    0x0990U, 0xC980U, 0xC9B3U, 0x09A3U, 0xC9D5U, 0x09C5U, 0x09F6U, 0xC9E6U, 0xC919U,
+    0x0909U, 0x093AU, 0xC92AU, 0x095CU, 0xC94CU, 0xC97FU, 0x096FU, 0x0AA0U, 0xCAB0U,
+    0xCA83U, 0x0A93U, 0xCAE5U, 0x0AF5U, 0x0AC6U, 0xCAD6U, 0xCA29U, 0x0A39U, 0x0A0AU,
+    0xCA1AU, 0x0A6CU, 0xCA7CU, 0xCA4FU, 0x0A5FU, 0xCBB1U, 0x0BA1U, 0x0B92U, 0xCB82U,
+    0x0BF4U, 0xCBE4U, 0xCBD7U, 0x0BC7U, 0x0B38U, 0xCB28U, 0xCB1BU, 0x0B0BU, 0xCB7DU,
+    0x0B6DU, 0x0B5EU, 0xCB4EU, 0x0CC0U, 0xCCD0U, 0xCCE3U, 0x0CF3U, 0xCC85U, 0x0C95U,
+    0x0CA6U, 0xCCB6U, 0xCC49U, 0x0C59U, 0x0C6AU, 0xCC7AU, 0x0C0CU, 0xCC1CU, 0xCC2FU,
+    0x0C3FU, 0xCDD1U, 0x0DC1U, 0x0DF2U, 0xCDE2U, 0x0D94U, 0xCD84U, 0xCDB7U, 0x0DA7U,
+    0x0D58U, 0xCD48U, 0xCD7BU, 0x0D6BU, 0xCD1DU, 0x0D0DU, 0x0D3EU, 0xCD2EU, 0xCEE1U,
+    0x0EF1U, 0x0EC2U, 0xCED2U, 0x0EA4U, 0xCEB4U, 0xCE87U, 0x0E97U, 0x0E68U, 0xCE78U,
+    0xCE4BU, 0x0E5BU, 0xCE2DU, 0x0E3DU, 0x0E0EU, 0xCE1EU, 0x0FF0U, 0xCFE0U, 0xCFD3U,
+    0x0FC3U, 0xCFB5U, 0x0FA5U, 0x0F96U, 0xCF86U, 0xCF79U, 0x0F69U, 0x0F5AU, 0xCF4AU,
+    0x0F3CU, 0xCF2CU, 0xCF1FU, 0x0F0FU
+  },
+  {
+    0x0000U, 0xCCC1U, 0xD981U, 0x1540U, 0xF301U, 0x3FC0U, 0x2A80U, 0xE641U, 0xA601U,
+    0x6AC0U, 0x7F80U, 0xB341U, 0x5500U, 0x99C1U, 0x8C81U, 0x4040U, 0x0C01U, 0xC0C0U,
+    0xD580U, 0x1941U, 0xFF00U, 0x33C1U, 0x2681U, 0xEA40U, 0xAA00U, 0x66C1U, 0x7381U,
+    0xBF40U, 0x5901U, 0x95C0U, 0x8080U, 0x4C41U, 0x1802U, 0xD4C3U, 0xC183U, 0x0D42U,
+    0xEB03U, 0x27C2U, 0x3282U, 0xFE43U, 0xBE03U, 0x72C2U, 0x6782U, 0xAB43U, 0x4D02U,
+    0x81C3U, 0x9483U, 0x5842U, 0x1403U, 0xD8C2U, 0xCD82U, 0x0143U, 0xE702U, 0x2BC3U,
+    0x3E83U, 0xF242U, 0xB202U, 0x7EC3U, 0x6B83U, 0xA742U, 0x4103U, 0x8DC2U, 0x9882U,
+    0x5443U, 0x3004U, 0xFCC5U, 0xE985U, 0x2544U, 0xC305U, 0x0FC4U, 0x1A84U, 0xD645U,
+    0x9605U, 0x5AC4U, 0x4F84U, 0x8345U, 0x6504U, 0xA9C5U, 0xBC85U, 0x7044U, 0x3C05U,
+    0xF0C4U, 0xE584U, 0x2945U, 0xCF04U, 0x03C5U, 0x1685U, 0xDA44U, 0x9A04U, 0x56C5U,
+    0x4385U, 0x8F44U, 0x6905U, 0xA5C4U, 0xB084U, 0x7C45U, 0x2806U, 0xE4C7U, 0xF187U,
+    0x3D46U, 0xDB07U, 0x17C6U, 0x0286U, 0xCE47U, 0x8E07U, 0x42C6U, 0x5786U, 0x9B47U,
+    0x7D06U, 0xB1C7U, 0xA487U, 0x6846U, 0x2407U, 0xE8C6U, 0xFD86U, 0x3147U, 0xD706U,
+    0x1BC7U, 0x0E87U, 0xC246U, 0x8206U, 0x4EC7U, 0x5B87U, 0x9746U, 0x7107U, 0xBDC6U,
+    0xA886U, 0x6447U, 0x6008U, 0xACC9U, 0xB989U, 0x7548U, 0x9309U, 0x5FC8U, 0x4A88U,
+    0x8649U, 0xC609U, 0x0AC8U, 0x1F88U, 0xD349U, 0x3508U, 0xF9C9U, 0xEC89U, 0x2048U,
+    0x6C09U, 0xA0C8U, 0xB588U, 0x7949U, 0x9F08U, 0x53C9U, 0x4689U, 0x8A48U, 0xCA08U,
+    0x06C9U, 0x1389U, 0xDF48U, 0x3909U, 0xF5C8U, 0xE088U, 0x2C49U, 0x780AU, 0xB4CBU,
+    0xA18BU, 0x6D4AU, 0x8B0BU, 0x47CAU, 0x528AU, 0x9E4BU, 0xDE0BU, 0x12CAU, 0x078AU,
+    0xCB4BU, 0x2D0AU, 0xE1CBU, 0xF48BU, 0x384AU, 0x740BU, 0xB8CAU, 0xAD8AU, 0x614BU,
+    0x870AU, 0x4BCBU, 0x5E8BU, 0x924AU, 0xD20AU, 0x1ECBU, 0x0B8BU, 0xC74AU, 0x210BU,
+    0xEDCAU, 0xF88AU, 0x344BU, 0x500CU, 0x9CCDU, 0x898DU, 0x454CU, 0xA30DU, 0x6FCCU,
+    0x7A8CU, 0xB64DU, 0xF60DU, 0x3ACCU, 0x2F8CU, 0xE34DU, 0x050CU, 0xC9CDU, 0xDC8DU,
+    0x104CU, 0x5C0DU, 0x90CCU, 0x858CU, 0x494DU, 0xAF0CU, 0x63CDU, 0x768DU, 0xBA4CU,
+    0xFA0CU, 0x36CDU, 0x238DU, 0xEF4CU, 0x090DU, 0xC5CCU, 0xD08CU, 0x1C4DU, 0x480EU,
+    0x84CFU, 0x918FU, 0x5D4EU, 0xBB0FU, 0x77CEU, 0x628EU, 0xAE4FU, 0xEE0FU, 0x22CEU,
+    0x378EU, 0xFB4FU, 0x1D0EU, 0xD1CFU, 0xC48FU, 0x084EU, 0x440FU, 0x88CEU, 0x9D8EU,
+    0x514FU, 0xB70EU, 0x7BCFU, 0x6E8FU, 0xA24EU, 0xE20EU, 0x2ECFU, 0x3B8FU, 0xF74EU,
+    0x110FU, 0xDDCEU, 0xC88EU, 0x044FU
+  }
+};
+
+/** \brief Slicing-by-8 lookup tables for the CRC16 CCITT checksum type. */
+static const uint16_t checksumCrc16CittTbl[8][256] =
+{
+  {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U, 0x8108U,
+    0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU, 0x1231U, 0x0210U,
+    0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U, 0x9339U, 0x8318U, 0xB37BU,
+    0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU, 0x2462U, 0x3443U, 0x0420U, 0x1401U,
+    0x64E6U, 0x74C7U, 0x44A4U, 0x5485U, 0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU,
+    0xF5CFU, 0xC5ACU, 0xD58DU, 0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U,
+    0x5695U, 0x46B4U, 0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU,
+    0xC7BCU, 0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU, 0x5AF5U,
+    0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U, 0xDBFDU, 0xCBDCU,
+    0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU, 0x6CA6U, 0x7C87U, 0x4CE4U,
+    0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U, 0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU,
+    0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U, 0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U,
+    0x2E32U, 0x1E51U, 0x0E70U, 0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU,
+    0x9F59U, 0x8F78U, 0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU,
+    0xE16FU, 0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU, 0x02B1U,
+    0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U, 0xB5EAU, 0xA5CBU,
+    0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU, 0x34E2U, 0x24C3U, 0x14A0U,
+    0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U, 0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U,
+    0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU, 0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U,
+    0x7676U, 0x4615U, 0x5634U, 0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U,
+    0xB98AU, 0xA9ABU, 0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U,
+    0x28A3U, 0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U, 0xFD2EU,
+    0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U, 0x7C26U, 0x6C07U,
+    0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U, 0xEF1FU, 0xFF3EU, 0xCF5DU,
+    0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U, 0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U,
+    0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+  },
+  {
+    0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U, 0x89A9U,
+    0xBA98U, 0xEFCBU, 0xDCFAU, 0x456DU, 0x765CU, 0x230FU, 0x103EU, 0x0373U, 0x3042U,
+    0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U, 0x8ADAU, 0xB9EBU, 0xECB8U,
+    0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU, 0x06E6U, 0x35D7U, 0x6084U, 0x53B5U,
+    0xCA22U, 0xF913U, 0xAC40U, 0x9F71U, 0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU,
+    0x70BAU, 0x25E9U, 0x16D8U, 0x0595U, 0x36A4U, 0x63F7U, 0x50C6U, 0xC951U, 0xFA60U,
+    0xAF33U, 0x9C02U, 0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU, 0x40F8U, 0x73C9U, 0x269AU,
+    0x15ABU, 0x0DCCU, 0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU,
+    0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U, 0x2EC3U, 0x1DF2U, 0x0EBFU,
+    0x3D8EU, 0x68DDU, 0x5BECU, 0xC27BU, 0xF14AU, 0xA419U, 0x9728U, 0x8716U, 0xB427U,
+    0xE174U, 0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U, 0x0B2AU, 0x381BU, 0x6D48U,
+    0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU, 0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U,
+    0x4E47U, 0x7D76U, 0x2825U, 0x1B14U, 0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU,
+    0xF7ACU, 0xA2FFU, 0x91CEU, 0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U,
+    0x2B56U, 0x1867U, 0x1B98U, 0x28A9U, 0x7DFAU, 0x4ECBU, 0xD75CU, 0xE46DU, 0xB13EU,
+    0x820FU, 0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U, 0x0BA6U,
+    0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU, 0x9142U,
+    0xA273U, 0xF720U, 0xC411U, 0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U, 0x1D7EU, 0x2E4FU,
+    0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U, 0x94D7U, 0xA7E6U, 0xF2B5U,
+    0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U, 0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU,
+    0xD2C9U, 0xE1F8U, 0xB4ABU, 0x879AU, 0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U,
+    0x6851U, 0x3D02U, 0x0E33U, 0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xDA90U, 0xE9A1U,
+    0xBCF2U, 0x8FC3U, 0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU, 0x5339U, 0x6008U, 0x355BU,
+    0x066AU, 0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U,
+    0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU, 0x637BU, 0x3628U, 0x0519U, 0x10B2U,
+    0x2383U, 0x76D0U, 0x45E1U, 0xDC76U, 0xEF47U, 0xBA14U, 0x8925U, 0x991BU, 0xAA2AU,
+    0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU, 0x13C1U, 0x20F0U, 0x75A3U,
+    0x4692U, 0xDF05U, 0xEC34U, 0xB967U, 0x8A56U, 0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU,
+    0x56ACU, 0x659DU, 0x30CEU, 0x03FFU
+  },
+  {
+    0x0000U, 0x3730U, 0x6E60U, 0x5950U, 0xDCC0U, 0xEBF0U, 0xB2A0U, 0x8590U, 0xA9A1U,
+    0x9E91U, 0xC7C1U, 0xF0F1U, 0x7561U, 0x4251U, 0x1B01U, 0x2C31U, 0x4363U, 0x7453U,
+    0x2D03U, 0x1A33U, 0x9FA3U, 0xA893U, 0xF1C3U, 0xC6F3U, 0xEAC2U, 0xDDF2U, 0x84A2U,
+    0xB392U, 0x3602U, 0x0132U, 0x5862U, 0x6F52U, 0x86C6U, 0xB1F6U, 0xE8A6U, 0xDF96U,
+    0x5A06U, 0x6D36U, 0x3466U, 0x0356U, 0x2F67U, 0x1857U, 0x4107U, 0x7637U, 0xF3A7U,
+    0xC497U, 0x9DC7U, 0xAAF7U, 0xC5A5U, 0xF295U, 0xABC5U, 0x9CF5U, 0x1965U, 0x2E55U,
+    0x7705U, 0x4035U, 0x6C04U, 0x5B34U, 0x0264U, 0x3554U, 0xB0C4U, 0x87F4U, 0xDEA4U,
+    0xE994U, 0x1DADU, 0x2A9DU, 0x73CDU, 0x44FDU, 0xC16DU, 0xF65DU, 0xAF0DU, 0x983DU,
+    0xB40CU, 0x833CU, 0xDA6CU, 0xED5CU, 0x68CCU, 0x5FFCU, 0x06ACU, 0x319CU, 0x5ECEU,
+    0x69FEU, 0x30AEU, 0x079EU, 0x820EU, 0xB53EU, 0xEC6EU, 0xDB5EU, 0xF76FU, 0xC05FU,
+    0x990FU, 0xAE3FU, 0x2BAFU, 0x1C9FU, 0x45CFU, 0x72FFU, 0x9B6BU, 0xAC5BU, 0xF50BU,
+    0xC23BU, 0x47ABU, 0x709BU, 0x29CBU, 0x1EFBU, 0x32CAU, 0x05FAU, 0x5CAAU, 0x6B9AU,
+    0xEE0AU, 0xD93AU, 0x806AU, 0xB75AU, 0xD808U, 0xEF38U, 0xB668U, 0x8158U, 0x04C8U,
+    0x33F8U, 0x6AA8U, 0x5D98U, 0x71A9U, 0x4699U, 0x1FC9U, 0x28F9U, 0xAD69U, 0x9A59U,
+    0xC309U, 0xF439U, 0x3B5AU, 0x0C6AU, 0x553AU, 0x620AU, 0xE79AU, 0xD0AAU, 0x89FAU,
+    0xBECAU, 0x92FBU, 0xA5CBU, 0xFC9BU, 0xCBABU, 0x4E3BU, 0x790BU, 0x205BU, 0x176BU,
+    0x7839U, 0x4F09U, 0x1659U, 0x2169U, 0xA4F9U, 0x93C9U, 0xCA99U, 0xFDA9U, 0xD198U,
+    0xE6A8U, 0xBFF8U, 0x88C8U, 0x0D58U, 0x3A68U, 0x6338U, 0x5408U, 0xBD9CU, 0x8AACU,
+    0xD3FCU, 0xE4CCU, 0x615CU, 0x566CU, 0x0F3CU, 0x380CU, 0x143DU, 0x230DU, 0x7A5DU,
+    0x4D6DU, 0xC8FDU, 0xFFCDU, 0xA69DU, 0x91ADU, 0xFEFFU, 0xC9CFU, 0x909FU, 0xA7AFU,
+    0x223FU, 0x150FU, 0x4C5FU, 0x7B6FU, 0x575EU, 0x606EU, 0x393EU, 0x0E0EU, 0x8B9EU,
+    0xBCAEU, 0xE5FEU, 0xD2CEU, 0x26F7U, 0x11C7U, 0x4897U, 0x7FA7U, 0xFA37U, 0xCD07U,
+    0x9457U, 0xA367U, 0x8F56U, 0xB866U, 0xE136U, 0xD606U, 0x5396U, 0x64A6U, 0x3DF6U,
+    0x0AC6U, 0x6594U, 0x52A4U, 0x0BF4U, 0x3CC4U, 0xB954U, 0x8E64U, 0xD734U, 0xE004U,
+    0xCC35U, 0xFB05U, 0xA255U, 0x9565U, 0x10F5U, 0x27C5U, 0x7E95U, 0x49A5U, 0xA031U,
+    0x9701U, 0xCE51U, 0xF961U, 0x7CF1U, 0x4BC1U, 0x1291U, 0x25A1U, 0x0990U, 0x3EA0U,
+    0x67F0U, 0x50C0U, 0xD550U, 0xE260U, 0xBB30U, 0x8C00U, 0xE352U, 0xD462U, 0x8D32U,
+    0xBA02U, 0x3F92U, 0x08A2U, 0x51F2U, 0x66C2U, 0x4AF3U, 0x7DC3U, 0x2493U, 0x13A3U,
+    0x9633U, 0xA103U, 0xF853U, 0xCF63U
+  },
+  {
+    0x0000U, 0x76B4U, 0xED68U, 0x9BDCU, 0xCAF1U, 0xBC45U, 0x2799U, 0x512DU, 0x85C3U,
+    0xF377U, 0x68ABU, 0x1E1FU, 0x4F32U, 0x3986U, 0xA25AU, 0xD4EEU, 0x1BA7U, 0x6D13U,
+    0xF6CFU, 0x807BU, 0xD156U, 0xA7E2U, 0x3C3EU, 0x4A8AU, 0x9E64U, 0xE8D0U, 0x730CU,
+    0x05B8U, 0x5495U, 0x2221U, 0xB9FDU, 0xCF49U, 0x374EU, 0x41FAU, 0xDA26U, 0xAC92U,
+    0xFDBFU, 0x8B0BU, 0x10D7U, 0x6663U, 0xB28DU, 0xC439U, 0x5FE5U, 0x2951U, 0x787CU,
+    0x0EC8U, 0x9514U, 0xE3A0U, 0x2CE9U, 0x5A5DU, 0xC181U, 0xB735U, 0xE618U, 0x90ACU,
+    0x0B70U, 0x7DC4U, 0xA92AU, 0xDF9EU, 0x4442U, 0x32F6U, 0x63DBU, 0x156FU, 0x8EB3U,
+    0xF807U, 0x6E9CU, 0x1828U, 0x83F4U, 0xF540U, 0xA46DU, 0xD2D9U, 0x4905U, 0x3FB1U,
+    0xEB5FU, 0x9DEBU, 0x0637U, 0x7083U, 0x21AEU, 0x571AU, 0xCCC6U, 0xBA72U, 0x753BU,
+    0x038FU, 0x9853U, 0xEEE7U, 0xBFCAU, 0xC97EU, 0x52A2U, 0x2416U, 0xF0F8U, 0x864CU,
+    0x1D90U, 0x6B24U, 0x3A09U, 0x4CBDU, 0xD761U, 0xA1D5U, 0x59D2U, 0x2F66U, 0xB4BAU,
+    0xC20EU, 0x9323U, 0xE597U, 0x7E4BU, 0x08FFU, 0xDC11U, 0xAAA5U, 0x3179U, 0x47CDU,
+    0x16E0U, 0x6054U, 0xFB88U, 0x8D3CU, 0x4275U, 0x34C1U, 0xAF1DU, 0xD9A9U, 0x8884U,
+    0xFE30U, 0x65ECU, 0x1358U, 0xC7B6U, 0xB102U, 0x2ADEU, 0x5C6AU, 0x0D47U, 0x7BF3U,
+    0xE02FU, 0x969BU, 0xDD38U, 0xAB8CU, 0x3050U, 0x46E4U, 0x17C9U, 0x617DU, 0xFAA1U,
+    0x8C15U, 0x58FBU, 0x2E4FU, 0xB593U, 0xC327U, 0x920AU, 0xE4BEU, 0x7F62U, 0x09D6U,
+    0xC69FU, 0xB02BU, 0x2BF7U, 0x5D43U, 0x0C6EU, 0x7ADAU, 0xE106U, 0x97B2U, 0x435CU,
+    0x35E8U, 0xAE34U, 0xD880U, 0x89ADU, 0xFF19U, 0x64C5U, 0x1271U, 0xEA76U, 0x9CC2U,
+    0x071EU, 0x71AAU, 0x2087U, 0x5633U, 0xCDEFU, 0xBB5BU, 0x6FB5U, 0x1901U, 0x82DDU,
+    0xF469U, 0xA544U, 0xD3F0U, 0x482CU, 0x3E98U, 0xF1D1U, 0x8765U, 0x1CB9U, 0x6A0DU,
+    0x3B20U, 0x4D94U, 0xD648U, 0xA0FCU, 0x7412U, 0x02A6U, 0x997AU, 0xEFCEU, 0xBEE3U,
+    0xC857U, 0x538BU, 0x253FU, 0xB3A4U, 0xC510U, 0x5ECCU, 0x2878U, 0x7955U, 0x0FE1U,
+    0x943DU, 0xE289U, 0x3667U, 0x40D3U, 0xDB0FU, 0xADBBU, 0xFC96U, 0x8A22U, 0x11FEU,
+    0x674AU, 0xA803U, 0xDEB7U, 0x456BU, 0x33DFU, 0x62F2U, 0x1446U, 0x8F9AU, 0xF92EU,
+    0x2DC0U, 0x5B74U, 0xC0A8U, 0xB61CU, 0xE731U, 0x9185U, 0x0A59U, 0x7CEDU, 0x84EAU,
+    0xF25EU, 0x6982U, 0x1F36U, 0x4E1BU, 0x38AFU, 0xA373U, 0xD5C7U, 0x0129U, 0x779DU,
+    0xEC41U, 0x9AF5U, 0xCBD8U, 0xBD6CU, 0x26B0U, 0x5004U, 0x9F4DU, 0xE9F9U, 0x7225U,
+    0x0491U, 0x55BCU, 0x2308U, 0xB8D4U, 0xCE60U, 0x1A8EU, 0x6C3AU, 0xF7E6U, 0x8152U,
+    0xD07FU, 0xA6CBU, 0x3D17U, 0x4BA3U
+  },
+  {
+    0x0000U, 0xAA51U, 0x4483U, 0xEED2U, 0x8906U, 0x2357U, 0xCD85U, 0x67D4U, 0x022DU,
+    0xA87CU, 0x46AEU, 0xECFFU, 0x8B2BU, 0x217AU, 0xCFA8U, 0x65F9U, 0x045AU, 0xAE0BU,
+    0x40D9U, 0xEA88U, 0x8D5CU, 0x270DU, 0xC9DFU, 0x638EU, 0x0677U, 0xAC26U, 0x42F4U,
+    0xE8A5U, 0x8F71U, 0x2520U, 0xCBF2U, 0x61A3U, 0x08B4U, 0xA2E5U, 0x4C37U, 0xE666U,
+    0x81B2U, 0x2BE3U, 0xC531U, 0x6F60U, 0x0A99U, 0xA0C8U, 0x4E1AU, 0xE44BU, 0x839FU,
+    0x29CEU, 0xC71CU, 0x6D4DU, 0x0CEEU, 0xA6BFU, 0x486DU, 0xE23CU, 0x85E8U, 0x2FB9U,
+    0xC16BU, 0x6B3AU, 0x0EC3U, 0xA492U, 0x4A40U, 0xE011U, 0x87C5U, 0x2D94U, 0xC346U,
+    0x6917U, 0x1168U, 0xBB39U, 0x55EBU, 0xFFBAU, 0x986EU, 0x323FU, 0xDCEDU, 0x76BCU,
+    0x1345U, 0xB914U, 0x57C6U, 0xFD97U, 0x9A43U, 0x3012U, 0xDEC0U, 0x7491U, 0x1532U,
+    0xBF63U, 0x51B1U, 0xFBE0U, 0x9C34U, 0x3665U, 0xD8B7U, 0x72E6U, 0x171FU, 0xBD4EU,
+    0x539CU, 0xF9CDU, 0x9E19U, 0x3448U, 0xDA9AU, 0x70CBU, 0x19DCU, 0xB38DU, 0x5D5FU,
+    0xF70EU, 0x90DAU, 0x3A8BU, 0xD459U, 0x7E08U, 0x1BF1U, 0xB1A0U, 0x5F72U, 0xF523U,
+    0x92F7U, 0x38A6U, 0xD674U, 0x7C25U, 0x1D86U, 0xB7D7U, 0x5905U, 0xF354U, 0x9480U,
+    0x3ED1U, 0xD003U, 0x7A52U, 0x1FABU, 0xB5FAU, 0x5B28U, 0xF179U, 0x96ADU, 0x3CFCU,
+    0xD22EU, 0x787FU, 0x22D0U, 0x8881U, 0x6653U, 0xCC02U, 0xABD6U, 0x0187U, 0xEF55U,
+    0x4504U, 0x20FDU, 0x8AACU, 0x647EU, 0xCE2FU, 0xA9FBU, 0x03AAU, 0xED78U, 0x4729U,
+    0x268AU, 0x8CDBU, 0x6209U, 0xC858U, 0xAF8CU, 0x05DDU, 0xEB0FU, 0x415EU, 0x24A7U,
+    0x8EF6U, 0x6024U, 0xCA75U, 0xADA1U, 0x07F0U, 0xE922U, 0x4373U, 0x2A64U, 0x8035U,
+    0x6EE7U, 0xC4B6U, 0xA362U, 0x0933U, 0xE7E1U, 0x4DB0U, 0x2849U, 0x8218U, 0x6CCAU,
+    0xC69BU, 0xA14FU, 0x0B1EU, 0xE5CCU, 0x4F9DU, 0x2E3EU, 0x846FU, 0x6ABDU, 0xC0ECU,
+    0xA738U, 0x0D69U, 0xE3BBU, 0x49EAU, 0x2C13U, 0x8642U, 0x6890U, 0xC2C1U, 0xA515U,
+    0x0F44U, 0xE196U, 0x4BC7U, 0x33B8U, 0x99E9U, 0x773BU, 0xDD6AU, 0xBABEU, 0x10EFU,
+    0xFE3DU, 0x546CU, 0x3195U, 0x9BC4U, 0x7516U, 0xDF47U, 0xB893U, 0x12C2U, 0xFC10U,
+    0x5641U, 0x37E2U, 0x9DB3U, 0x7361U, 0xD930U, 0xBEE4U, 0x14B5U, 0xFA67U, 0x5036U,
+    0x35CFU, 0x9F9EU, 0x714CU, 0xDB1DU, 0xBCC9U, 0x1698U, 0xF84AU, 0x521BU, 0x3B0CU,
+    0x915DU, 0x7F8FU, 0xD5DEU, 0xB20AU, 0x185BU, 0xF689U, 0x5CD8U, 0x3921U, 0x9370U,
+    0x7DA2U, 0xD7F3U, 0xB027U, 0x1A76U, 0xF4A4U, 0x5EF5U, 0x3F56U, 0x9507U, 0x7BD5U,
+    0xD184U, 0xB650U, 0x1C01U, 0xF2D3U, 0x5882U, 0x3D7BU, 0x972AU, 0x79F8U, 0xD3A9U,
+    0xB47DU, 0x1E2CU, 0xF0FEU, 0x5AAFU
+  },
+  {
+    0x0000U, 0x45A0U, 0x8B40U, 0xCEE0U, 0x06A1U, 0x4301U, 0x8DE1U, 0xC841U, 0x0D42U,
+    0x48E2U, 0x8602U, 0xC3A2U, 0x0BE3U, 0x4E43U, 0x80A3U, 0xC503U, 0x1A84U, 0x5F24U,
+    0x91C4U, 0xD464U, 0x1C25U, 0x5985U, 0x9765U, 0xD2C5U, 0x17C6U, 0x5266U, 0x9C86U,
+    0xD926U, 0x1167U, 0x54C7U, 0x9A27U, 0xDF87U, 0x3508U, 0x70A8U, 0xBE48U, 0xFBE8U,
+    0x33A9U, 0x7609U, 0xB8E9U, 0xFD49U, 0x384AU, 0x7DEAU, 0xB30AU, 0xF6AAU, 0x3EEBU,
+    0x7B4BU, 0xB5ABU, 0xF00BU, 0x2F8CU, 0x6A2CU, 0xA4CCU, 0xE16CU, 0x292DU, 0x6C8DU,
+    0xA26DU, 0xE7CDU, 0x22CEU, 0x676EU, 0xA98EU, 0xEC2EU, 0x246FU, 0x61CFU, 0xAF2FU,
+    0xEA8FU, 0x6A10U, 0x2FB0U, 0xE150U, 0xA4F0U, 0x6CB1U, 0x2911U, 0xE7F1U, 0xA251U,
+    0x6752U, 0x22F2U, 0xEC12U, 0xA9B2U, 0x61F3U, 0x2453U, 0xEAB3U, 0xAF13U, 0x7094U,
+    0x3534U, 0xFBD4U, 0xBE74U, 0x7635U, 0x3395U, 0xFD75U, 0xB8D5U, 0x7DD6U, 0x3876U,
+    0xF696U, 0xB336U, 0x7B77U, 0x3ED7U, 0xF037U, 0xB597U, 0x5F18U, 0x1AB8U, 0xD458U,
+    0x91F8U, 0x59B9U, 0x1C19U, 0xD2F9U, 0x9759U, 0x525AU, 0x17FAU, 0xD91AU, 0x9CBAU,
+    0x54FBU, 0x115BU, 0xDFBBU, 0x9A1BU, 0x459CU, 0x003CU, 0xCEDCU, 0x8B7CU, 0x433DU,
+    0x069DU, 0xC87DU, 0x8DDDU, 0x48DEU, 0x0D7EU, 0xC39EU, 0x863EU, 0x4E7FU, 0x0BDFU,
+    0xC53FU, 0x809FU, 0xD420U, 0x9180U, 0x5F60U, 0x1AC0U, 0xD281U, 0x9721U, 0x59C1U,
+    0x1C61U, 0xD962U, 0x9CC2U, 0x5222U, 0x1782U, 0xDFC3U, 0x9A63U, 0x5483U, 0x1123U,
+    0xCEA4U, 0x8B04U, 0x45E4U, 0x0044U, 0xC805U, 0x8DA5U, 0x4345U, 0x06E5U, 0xC3E6U,
+    0x8646U, 0x48A6U, 0x0D06U, 0xC547U, 0x80E7U, 0x4E07U, 0x0BA7U, 0xE128U, 0xA488U,
+    0x6A68U, 0x2FC8U, 0xE789U, 0xA229U, 0x6CC9U, 0x2969U, 0xEC6AU, 0xA9CAU, 0x672AU,
+    0x228AU, 0xEACBU, 0xAF6BU, 0x618BU, 0x242BU, 0xFBACU, 0xBE0CU, 0x70ECU, 0x354CU,
+    0xFD0DU, 0xB8ADU, 0x764DU, 0x33EDU, 0xF6EEU, 0xB34EU, 0x7DAEU, 0x380EU, 0xF04FU,
+    0xB5EFU, 0x7B0FU, 0x3EAFU, 0xBE30U, 0xFB90U, 0x3570U, 0x70D0U, 0xB891U, 0xFD31U,
+    0x33D1U, 0x7671U, 0xB372U, 0xF6D2U, 0x3832U, 0x7D92U, 0xB5D3U, 0xF073U, 0x3E93U,
+    0x7B33U, 0xA4B4U, 0xE114U, 0x2FF4U, 0x6A54U, 0xA215U, 0xE7B5U, 0x2955U, 0x6CF5U,
+    0xA9F6U, 0xEC56U, 0x22B6U, 0x6716U, 0xAF57U, 0xEAF7U, 0x2417U, 0x61B7U, 0x8B38U,
+    0xCE98U, 0x0078U, 0x45D8U, 0x8D99U, 0xC839U, 0x06D9U, 0x4379U, 0x867AU, 0xC3DAU,
+    0x0D3AU, 0x489AU, 0x80DBU, 0xC57BU, 0x0B9BU, 0x4E3BU, 0x91BCU, 0xD41CU, 0x1AFCU,
+    0x5F5CU, 0x971DU, 0xD2BDU, 0x1C5DU, 0x59FDU, 0x9CFEU, 0xD95EU, 0x17BEU, 0x521EU,
+    0x9A5FU, 0xDFFFU, 0x111FU, 0x54BFU
+  },
+  {
+    0x0000U, 0xB861U, 0x60E3U, 0xD882U, 0xC1C6U, 0x79A7U, 0xA125U, 0x1944U, 0x93ADU,
+    0x2BCCU, 0xF34EU, 0x4B2FU, 0x526BU, 0xEA0AU, 0x3288U, 0x8AE9U, 0x377BU, 0x8F1AU,
+    0x5798U, 0xEFF9U, 0xF6BDU, 0x4EDCU, 0x965EU, 0x2E3FU, 0xA4D6U, 0x1CB7U, 0xC435U,
+    0x7C54U, 0x6510U, 0xDD71U, 0x05F3U, 0xBD92U, 0x6EF6U, 0xD697U, 0x0E15U, 0xB674U,
+    0xAF30U, 0x1751U, 0xCFD3U, 0x77B2U, 0xFD5BU, 0x453AU, 0x9DB8U, 0x25D9U, 0x3C9DU,
+    0x84FCU, 0x5C7EU, 0xE41FU, 0x598DU, 0xE1ECU, 0x396EU, 0x810FU, 0x984BU, 0x202AU,
+    0xF8A8U, 0x40C9U, 0xCA20U, 0x7241U, 0xAAC3U, 0x12A2U, 0x0BE6U, 0xB387U, 0x6B05U,
+    0xD364U, 0xDDECU, 0x658DU, 0xBD0FU, 0x056EU, 0x1C2AU, 0xA44BU, 0x7CC9U, 0xC4A8U,
+    0x4E41U, 0xF620U, 0x2EA2U, 0x96C3U, 0x8F87U, 0x37E6U, 0xEF64U, 0x5705U, 0xEA97U,
+    0x52F6U, 0x8A74U, 0x3215U, 0x2B51U, 0x9330U, 0x4BB2U, 0xF3D3U, 0x793AU, 0xC15BU,
+    0x19D9U, 0xA1B8U, 0xB8FCU, 0x009DU, 0xD81FU, 0x607EU, 0xB31AU, 0x0B7BU, 0xD3F9U,
+    0x6B98U, 0x72DCU, 0xCABDU, 0x123FU, 0xAA5EU, 0x20B7U, 0x98D6U, 0x4054U, 0xF835U,
+    0xE171U, 0x5910U, 0x8192U, 0x39F3U, 0x8461U, 0x3C00U, 0xE482U, 0x5CE3U, 0x45A7U,
+    0xFDC6U, 0x2544U, 0x9D25U, 0x17CCU, 0xAFADU, 0x772FU, 0xCF4EU, 0xD60AU, 0x6E6BU,
+    0xB6E9U, 0x0E88U, 0xABF9U, 0x1398U, 0xCB1AU, 0x737BU, 0x6A3FU, 0xD25EU, 0x0ADCU,
+    0xB2BDU, 0x3854U, 0x8035U, 0x58B7U, 0xE0D6U, 0xF992U, 0x41F3U, 0x9971U, 0x2110U,
+    0x9C82U, 0x24E3U, 0xFC61U, 0x4400U, 0x5D44U, 0xE525U, 0x3DA7U, 0x85C6U, 0x0F2FU,
+    0xB74EU, 0x6FCCU, 0xD7ADU, 0xCEE9U, 0x7688U, 0xAE0AU, 0x166BU, 0xC50FU, 0x7D6EU,
+    0xA5ECU, 0x1D8DU, 0x04C9U, 0xBCA8U, 0x642AU, 0xDC4BU, 0x56A2U, 0xEEC3U, 0x3641U,
+    0x8E20U, 0x9764U, 0x2F05U, 0xF787U, 0x4FE6U, 0xF274U, 0x4A15U, 0x9297U, 0x2AF6U,
+    0x33B2U, 0x8BD3U, 0x5351U, 0xEB30U, 0x61D9U, 0xD9B8U, 0x013AU, 0xB95BU, 0xA01FU,
+    0x187EU, 0xC0FCU, 0x789DU, 0x7615U, 0xCE74U, 0x16F6U, 0xAE97U, 0xB7D3U, 0x0FB2U,
+    0xD730U, 0x6F51U, 0xE5B8U, 0x5DD9U, 0x855BU, 0x3D3AU, 0x247EU, 0x9C1FU, 0x449DU,
+    0xFCFCU, 0x416EU, 0xF90FU, 0x218DU, 0x99ECU, 0x80A8U, 0x38C9U, 0xE04BU, 0x582AU,
+    0xD2C3U, 0x6AA2U, 0xB220U, 0x0A41U, 0x1305U, 0xAB64U, 0x73E6U, 0xCB87U, 0x18E3U,
+    0xA082U, 0x7800U, 0xC061U, 0xD925U, 0x6144U, 0xB9C6U, 0x01A7U, 0x8B4EU, 0x332FU,
+    0xEBADU, 0x53CCU, 0x4A88U, 0xF2E9U, 0x2A6BU, 0x920AU, 0x2F98U, 0x97F9U, 0x4F7BU,
+    0xF71AU, 0xEE5EU, 0x563FU, 0x8EBDU, 0x36DCU, 0xBC35U, 0x0454U, 0xDCD6U, 0x64B7U,
+    0x7DF3U, 0xC592U, 0x1D10U, 0xA571U
+  },
+  {
+    0x0000U, 0x47D3U, 0x8FA6U, 0xC875U, 0x0F6DU, 0x48BEU, 0x80CBU, 0xC718U, 0x1EDAU,
+    0x5909U, 0x917CU, 0xD6AFU, 0x11B7U, 0x5664U, 0x9E11U, 0xD9C2U, 0x3DB4U, 0x7A67U,
+    0xB212U, 0xF5C1U, 0x32D9U, 0x750AU, 0xBD7FU, 0xFAACU, 0x236EU, 0x64BDU, 0xACC8U,
+    0xEB1BU, 0x2C03U, 0x6BD0U, 0xA3A5U, 0xE476U, 0x7B68U, 0x3CBBU, 0xF4CEU, 0xB31DU,
+    0x7405U, 0x33D6U, 0xFBA3U, 0xBC70U, 0x65B2U, 0x2261U, 0xEA14U, 0xADC7U, 0x6ADFU,
+    0x2D0CU, 0xE579U, 0xA2AAU, 0x46DCU, 0x010FU, 0xC97AU, 0x8EA9U, 0x49B1U, 0x0E62U,
+    0xC617U, 0x81C4U, 0x5806U, 0x1FD5U, 0xD7A0U, 0x9073U, 0x576BU, 0x10B8U, 0xD8CDU,
+    0x9F1EU, 0xF6D0U, 0xB103U, 0x7976U, 0x3EA5U, 0xF9BDU, 0xBE6EU, 0x761BU, 0x31C8U,
+    0xE80AU, 0xAFD9U, 0x67ACU, 0x207FU, 0xE767U, 0xA0B4U, 0x68C1U, 0x2F12U, 0xCB64U,
+    0x8CB7U, 0x44C2U, 0x0311U, 0xC409U, 0x83DAU, 0x4BAFU, 0x0C7CU, 0xD5BEU, 0x926DU,
+    0x5A18U, 0x1DCBU, 0xDAD3U, 0x9D00U, 0x5575U, 0x12A6U, 0x8DB8U, 0xCA6BU, 0x021EU,
+    0x45CDU, 0x82D5U, 0xC506U, 0x0D73U, 0x4AA0U, 0x9362U, 0xD4B1U, 0x1CC4U, 0x5B17U,
+    0x9C0FU, 0xDBDCU, 0x13A9U, 0x547AU, 0xB00CU, 0xF7DFU, 0x3FAAU, 0x7879U, 0xBF61U,
+    0xF8B2U, 0x30C7U, 0x7714U, 0xAED6U, 0xE905U, 0x2170U, 0x66A3U, 0xA1BBU, 0xE668U,
+    0x2E1DU, 0x69CEU, 0xFD81U, 0xBA52U, 0x7227U, 0x35F4U, 0xF2ECU, 0xB53FU, 0x7D4AU,
+    0x3A99U, 0xE35BU, 0xA488U, 0x6CFDU, 0x2B2EU, 0xEC36U, 0xABE5U, 0x6390U, 0x2443U,
+    0xC035U, 0x87E6U, 0x4F93U, 0x0840U, 0xCF58U, 0x888BU, 0x40FEU, 0x072DU, 0xDEEFU,
+    0x993CU, 0x5149U, 0x169AU, 0xD182U, 0x9651U, 0x5E24U, 0x19F7U, 0x86E9U, 0xC13AU,
+    0x094FU, 0x4E9CU, 0x8984U, 0xCE57U, 0x0622U, 0x41F1U, 0x9833U, 0xDFE0U, 0x1795U,
+    0x5046U, 0x975EU, 0xD08DU, 0x18F8U, 0x5F2BU, 0xBB5DU, 0xFC8EU, 0x34FBU, 0x7328U,
+    0xB430U, 0xF3E3U, 0x3B96U, 0x7C45U, 0xA587U, 0xE254U, 0x2A21U, 0x6DF2U, 0xAAEAU,
+    0xED39U, 0x254CU, 0x629FU, 0x0B51U, 0x4C82U, 0x84F7U, 0xC324U, 0x043CU, 0x43EFU,
+    0x8B9AU, 0xCC49U, 0x158BU, 0x5258U, 0x9A2DU, 0xDDFEU, 0x1AE6U, 0x5D35U, 0x9540U,
+    0xD293U, 0x36E5U, 0x7136U, 0xB943U, 0xFE90U, 0x3988U, 0x7E5BU, 0xB62EU, 0xF1FDU,
+    0x283FU, 0x6FECU, 0xA799U, 0xE04AU, 0x2752U, 0x6081U, 0xA8F4U, 0xEF27U, 0x7039U,
+    0x37EAU, 0xFF9FU, 0xB84CU, 0x7F54U, 0x3887U, 0xF0F2U, 0xB721U, 0x6EE3U, 0x2930U,
+    0xE145U, 0xA696U, 0x618EU, 0x265DU, 0xEE28U, 0xA9FBU, 0x4D8DU, 0x0A5EU, 0xC22BU,
+    0x85F8U, 0x42E0U, 0x0533U, 0xCD46U, 0x8A95U, 0x5357U, 0x1484U, 0xDCF1U, 0x9B22U,
+    0x5C3AU, 0x1BE9U, 0xD39CU, 0x944FU
+  }
+};
+
+/** \brief Slicing-by-8 lookup tables for the CRC32 checksum type. */
+static const uint32_t checksumCrc32Tbl[8][256] =
+{
+  {
+    0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL, 0x076DC419UL, 0x706AF48FUL,
+    0xE963A535UL, 0x9E6495A3UL, 0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL,
+    0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL, 0x1DB71064UL, 0x6AB020F2UL,
+    0xF3B97148UL, 0x84BE41DEUL, 0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+    0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL, 0x14015C4FUL, 0x63066CD9UL,
+    0xFA0F3D63UL, 0x8D080DF5UL, 0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL,
+    0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL, 0x35B5A8FAUL, 0x42B2986CUL,
+    0xDBBBC9D6UL, 0xACBCF940UL, 0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+    0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL, 0x21B4F4B5UL, 0x56B3C423UL,
+    0xCFBA9599UL, 0xB8BDA50FUL, 0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL,
+    0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL, 0x76DC4190UL, 0x01DB7106UL,
+    0x98D220BCUL, 0xEFD5102AUL, 0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+    0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL, 0x7F6A0DBBUL, 0x086D3D2DUL,
+    0x91646C97UL, 0xE6635C01UL, 0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL,
+    0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL, 0x65B0D9C6UL, 0x12B7E950UL,
+    0x8BBEB8EAUL, 0xFCB9887CUL, 0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+    0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL, 0x4ADFA541UL, 0x3DD895D7UL,
+    0xA4D1C46DUL, 0xD3D6F4FBUL, 0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL,
+    0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL, 0x5005713CUL, 0x270241AAUL,
+    0xBE0B1010UL, 0xC90C2086UL, 0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+    0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL, 0x59B33D17UL, 0x2EB40D81UL,
+    0xB7BD5C3BUL, 0xC0BA6CADUL, 0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL,
+    0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL, 0xE3630B12UL, 0x94643B84UL,
+    0x0D6D6A3EUL, 0x7A6A5AA8UL, 0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+    0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL, 0xF762575DUL, 0x806567CBUL,
+    0x196C3671UL, 0x6E6B06E7UL, 0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL,
+    0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL, 0xD6D6A3E8UL, 0xA1D1937EUL,
+    0x38D8C2C4UL, 0x4FDFF252UL, 0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+    0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL, 0xDF60EFC3UL, 0xA867DF55UL,
+    0x316E8EEFUL, 0x4669BE79UL, 0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL,
+    0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL, 0xC5BA3BBEUL, 0xB2BD0B28UL,
+    0x2BB45A92UL, 0x5CB36A04UL, 0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+    0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL, 0x9C0906A9UL, 0xEB0E363FUL,
+    0x72076785UL, 0x05005713UL, 0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL,
+    0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL, 0x86D3D2D4UL, 0xF1D4E242UL,
+    0x68DDB3F8UL, 0x1FDA836EUL, 0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+    0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL, 0x8F659EFFUL, 0xF862AE69UL,
+    0x616BFFD3UL, 0x166CCF45UL, 0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL,
+    0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL, 0xAED16A4AUL, 0xD9D65ADCUL,
+    0x40DF0B66UL, 0x37D83BF0UL, 0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+    0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL, 0xBAD03605UL, 0xCDD70693UL,
+    0x54DE5729UL, 0x23D967BFUL, 0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL,
+    0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+  },
+  {
+    0x00000000UL, 0x191B3141UL, 0x32366282UL, 0x2B2D53C3UL, 0x646CC504UL, 0x7D77F445UL,
+    0x565AA786UL, 0x4F4196C7UL, 0xC8D98A08UL, 0xD1C2BB49UL, 0xFAEFE88AUL, 0xE3F4D9CBUL,
+    0xACB54F0CUL, 0xB5AE7E4DUL, 0x9E832D8EUL, 0x87981CCFUL, 0x4AC21251UL, 0x53D92310UL,
+    0x78F470D3UL, 0x61EF4192UL, 0x2EAED755UL, 0x37B5E614UL, 0x1C98B5D7UL, 0x05838496UL,
+    0x821B9859UL, 0x9B00A918UL, 0xB02DFADBUL, 0xA936CB9AUL, 0xE6775D5DUL, 0xFF6C6C1CUL,
+    0xD4413FDFUL, 0xCD5A0E9EUL, 0x958424A2UL, 0x8C9F15E3UL, 0xA7B24620UL, 0xBEA97761UL,
+    0xF1E8E1A6UL, 0xE8F3D0E7UL, 0xC3DE8324UL, 0xDAC5B265UL, 0x5D5DAEAAUL, 0x44469FEBUL,
+    0x6F6BCC28UL, 0x7670FD69UL, 0x39316BAEUL, 0x202A5AEFUL, 0x0B07092CUL, 0x121C386DUL,
+    0xDF4636F3UL, 0xC65D07B2UL, 0xED705471UL, 0xF46B6530UL, 0xBB2AF3F7UL, 0xA231C2B6UL,
+    0x891C9175UL, 0x9007A034UL, 0x179FBCFBUL, 0x0E848DBAUL, 0x25A9DE79UL, 0x3CB2EF38UL,
+    0x73F379FFUL, 0x6AE848BEUL, 0x41C51B7DUL, 0x58DE2A3CUL, 0xF0794F05UL, 0xE9627E44UL,
+    0xC24F2D87UL, 0xDB541CC6UL, 0x94158A01UL, 0x8D0EBB40UL, 0xA623E883UL, 0xBF38D9C2UL,
+    0x38A0C50DUL, 0x21BBF44CUL, 0x0A96A78FUL, 0x138D96CEUL, 0x5CCC0009UL, 0x45D73148UL,
+    0x6EFA628BUL, 0x77E153CAUL, 0xBABB5D54UL, 0xA3A06C15UL, 0x888D3FD6UL, 0x91960E97UL,
+    0xDED79850UL, 0xC7CCA911UL, 0xECE1FAD2UL, 0xF5FACB93UL, 0x7262D75CUL, 0x6B79E61DUL,
+    0x4054B5DEUL, 0x594F849FUL, 0x160E1258UL, 0x0F152319UL, 0x243870DAUL, 0x3D23419BUL,
+    0x65FD6BA7UL, 0x7CE65AE6UL, 0x57CB0925UL, 0x4ED03864UL, 0x0191AEA3UL, 0x188A9FE2UL,
+    0x33A7CC21UL, 0x2ABCFD60UL, 0xAD24E1AFUL, 0xB43FD0EEUL, 0x9F12832DUL, 0x8609B26CUL,
+    0xC94824ABUL, 0xD05315EAUL, 0xFB7E4629UL, 0xE2657768UL, 0x2F3F79F6UL, 0x362448B7UL,
+    0x1D091B74UL, 0x04122A35UL, 0x4B53BCF2UL, 0x52488DB3UL, 0x7965DE70UL, 0x607EEF31UL,
+    0xE7E6F3FEUL, 0xFEFDC2BFUL, 0xD5D0917CUL, 0xCCCBA03DUL, 0x838A36FAUL, 0x9A9107BBUL,
+    0xB1BC5478UL, 0xA8A76539UL, 0x3B83984BUL, 0x2298A90AUL, 0x09B5FAC9UL, 0x10AECB88UL,
+    0x5FEF5D4FUL, 0x46F46C0EUL, 0x6DD93FCDUL, 0x74C20E8CUL, 0xF35A1243UL, 0xEA412302UL,
+    0xC16C70C1UL, 0xD8774180UL, 0x9736D747UL, 0x8E2DE606UL, 0xA500B5C5UL, 0xBC1B8484UL,
+    0x71418A1AUL, 0x685ABB5BUL, 0x4377E898UL, 0x5A6CD9D9UL, 0x152D4F1EUL, 0x0C367E5FUL,
+    0x271B2D9CUL, 0x3E001CDDUL, 0xB9980012UL, 0xA0833153UL, 0x8BAE6290UL, 0x92B553D1UL,
+    0xDDF4C516UL, 0xC4EFF457UL, 0xEFC2A794UL, 0xF6D996D5UL, 0xAE07BCE9UL, 0xB71C8DA8UL,
+    0x9C31DE6BUL, 0x852AEF2AUL, 0xCA6B79EDUL, 0xD37048ACUL, 0xF85D1B6FUL, 0xE1462A2EUL,
+    0x66DE36E1UL, 0x7FC507A0UL, 0x54E85463UL, 0x4DF36522UL, 0x02B2F3E5UL, 0x1BA9C2A4UL,
+    0x30849167UL, 0x299FA026UL, 0xE4C5AEB8UL, 0xFDDE9FF9UL, 0xD6F3CC3AUL, 0xCFE8FD7BUL,
+    0x80A96BBCUL, 0x99B25AFDUL, 0xB29F093EUL, 0xAB84387FUL, 0x2C1C24B0UL, 0x350715F1UL,
+    0x1E2A4632UL, 0x07317773UL, 0x4870E1B4UL, 0x516BD0F5UL, 0x7A468336UL, 0x635DB277UL,
+    0xCBFAD74EUL, 0xD2E1E60FUL, 0xF9CCB5CCUL, 0xE0D7848DUL, 0xAF96124AUL, 0xB68D230BUL,
+    0x9DA070C8UL, 0x84BB4189UL, 0x03235D46UL, 0x1A386C07UL, 0x31153FC4UL, 0x280E0E85UL,
+    0x674F9842UL, 0x7E54A903UL, 0x5579FAC0UL, 0x4C62CB81UL, 0x8138C51FUL, 0x9823F45EUL,
+    0xB30EA79DUL, 0xAA1596DCUL, 0xE554001BUL, 0xFC4F315AUL, 0xD7626299UL, 0xCE7953D8UL,
+    0x49E14F17UL, 0x50FA7E56UL, 0x7BD72D95UL, 0x62CC1CD4UL, 0x2D8D8A13UL, 0x3496BB52UL,
+    0x1FBBE891UL, 0x06A0D9D0UL, 0x5E7EF3ECUL, 0x4765C2ADUL, 0x6C48916EUL, 0x7553A02FUL,
+    0x3A1236E8UL, 0x230907A9UL, 0x0824546AUL, 0x113F652BUL, 0x96A779E4UL, 0x8FBC48A5UL,
+    0xA4911B66UL, 0xBD8A2A27UL, 0xF2CBBCE0UL, 0xEBD08DA1UL, 0xC0FDDE62UL, 0xD9E6EF23UL,
+    0x14BCE1BDUL, 0x0DA7D0FCUL, 0x268A833FUL, 0x3F91B27EUL, 0x70D024B9UL, 0x69CB15F8UL,
+    0x42E6463BUL, 0x5BFD777AUL, 0xDC656BB5UL, 0xC57E5AF4UL, 0xEE530937UL, 0xF7483876UL,
+    0xB809AEB1UL, 0xA1129FF0UL, 0x8A3FCC33UL, 0x9324FD72UL
+  },
+  {
+    0x00000000UL, 0x01C26A37UL, 0x0384D46EUL, 0x0246BE59UL, 0x0709A8DCUL, 0x06CBC2EBUL,
+    0x048D7CB2UL, 0x054F1685UL, 0x0E1351B8UL, 0x0FD13B8FUL, 0x0D9785D6UL, 0x0C55EFE1UL,
+    0x091AF964UL, 0x08D89353UL, 0x0A9E2D0AUL, 0x0B5C473DUL, 0x1C26A370UL, 0x1DE4C947UL,
+    0x1FA2771EUL, 0x1E601D29UL, 0x1B2F0BACUL, 0x1AED619BUL, 0x18ABDFC2UL, 0x1969B5F5UL,
+    0x1235F2C8UL, 0x13F798FFUL, 0x11B126A6UL, 0x10734C91UL, 0x153C5A14UL, 0x14FE3023UL,
+    0x16B88E7AUL, 0x177AE44DUL, 0x384D46E0UL, 0x398F2CD7UL, 0x3BC9928EUL, 0x3A0BF8B9UL,
+    0x3F44EE3CUL, 0x3E86840BUL, 0x3CC03A52UL, 0x3D025065UL, 0x365E1758UL, 0x379C7D6FUL,
+    0x35DAC336UL, 0x3418A901UL, 0x3157BF84UL, 0x3095D5B3UL, 0x32D36BEAUL, 0x331101DDUL,
+    0x246BE590UL, 0x25A98FA7UL, 0x27EF31FEUL, 0x262D5BC9UL, 0x23624D4CUL, 0x22A0277BUL,
+    0x20E69922UL, 0x2124F315UL, 0x2A78B428UL, 0x2BBADE1FUL, 0x29FC6046UL, 0x283E0A71UL,
+    0x2D711CF4UL, 0x2CB376C3UL, 0x2EF5C89AUL, 0x2F37A2ADUL, 0x709A8DC0UL, 0x7158E7F7UL,
+    0x731E59AEUL, 0x72DC3399UL, 0x7793251CUL, 0x76514F2BUL, 0x7417F172UL, 0x75D59B45UL,
+    0x7E89DC78UL, 0x7F4BB64FUL, 0x7D0D0816UL, 0x7CCF6221UL, 0x798074A4UL, 0x78421E93UL,
+    0x7A04A0CAUL, 0x7BC6CAFDUL, 0x6CBC2EB0UL, 0x6D7E4487UL, 0x6F38FADEUL, 0x6EFA90E9UL,
+    0x6BB5866CUL, 0x6A77EC5BUL, 0x68315202UL, 0x69F33835UL, 0x62AF7F08UL, 0x636D153FUL,
+    0x612BAB66UL, 0x60E9C151UL, 0x65A6D7D4UL, 0x6464BDE3UL, 0x662203BAUL, 0x67E0698DUL,
+    0x48D7CB20UL, 0x4915A117UL, 0x4B531F4EUL, 0x4A917579UL, 0x4FDE63FCUL, 0x4E1C09CBUL,
+    0x4C5AB792UL, 0x4D98DDA5UL, 0x46C49A98UL, 0x4706F0AFUL, 0x45404EF6UL, 0x448224C1UL,
+    0x41CD3244UL, 0x400F5873UL, 0x4249E62AUL, 0x438B8C1DUL, 0x54F16850UL, 0x55330267UL,
+    0x5775BC3EUL, 0x56B7D609UL, 0x53F8C08CUL, 0x523AAABBUL, 0x507C14E2UL, 0x51BE7ED5UL,
+    0x5AE239E8UL, 0x5B2053DFUL, 0x5966ED86UL, 0x58A487B1UL, 0x5DEB9134UL, 0x5C29FB03UL,
+    0x5E6F455AUL, 0x5FAD2F6DUL, 0xE1351B80UL, 0xE0F771B7UL, 0xE2B1CFEEUL, 0xE373A5D9UL,
+    0xE63CB35CUL, 0xE7FED96BUL, 0xE5B86732UL, 0xE47A0D05UL, 0xEF264A38UL, 0xEEE4200FUL,
+    0xECA29E56UL, 0xED60F461UL, 0xE82FE2E4UL, 0xE9ED88D3UL, 0xEBAB368AUL, 0xEA695CBDUL,
+    0xFD13B8F0UL, 0xFCD1D2C7UL, 0xFE976C9EUL, 0xFF5506A9UL, 0xFA1A102CUL, 0xFBD87A1BUL,
+    0xF99EC442UL, 0xF85CAE75UL, 0xF300E948UL, 0xF2C2837FUL, 0xF0843D26UL, 0xF1465711UL,
+    0xF4094194UL, 0xF5CB2BA3UL, 0xF78D95FAUL, 0xF64FFFCDUL, 0xD9785D60UL, 0xD8BA3757UL,
+    0xDAFC890EUL, 0xDB3EE339UL, 0xDE71F5BCUL, 0xDFB39F8BUL, 0xDDF521D2UL, 0xDC374BE5UL,
+    0xD76B0CD8UL, 0xD6A966EFUL, 0xD4EFD8B6UL, 0xD52DB281UL, 0xD062A404UL, 0xD1A0CE33UL,
+    0xD3E6706AUL, 0xD2241A5DUL, 0xC55EFE10UL, 0xC49C9427UL, 0xC6DA2A7EUL, 0xC7184049UL,
+    0xC25756CCUL, 0xC3953CFBUL, 0xC1D382A2UL, 0xC011E895UL, 0xCB4DAFA8UL, 0xCA8FC59FUL,
+    0xC8C97BC6UL, 0xC90B11F1UL, 0xCC440774UL, 0xCD866D43UL, 0xCFC0D31AUL, 0xCE02B92DUL,
+    0x91AF9640UL, 0x906DFC77UL, 0x922B422EUL, 0x93E92819UL, 0x96A63E9CUL, 0x976454ABUL,
+    0x9522EAF2UL, 0x94E080C5UL, 0x9FBCC7F8UL, 0x9E7EADCFUL, 0x9C381396UL, 0x9DFA79A1UL,
+    0x98B56F24UL, 0x99770513UL, 0x9B31BB4AUL, 0x9AF3D17DUL, 0x8D893530UL, 0x8C4B5F07UL,
+    0x8E0DE15EUL, 0x8FCF8B69UL, 0x8A809DECUL, 0x8B42F7DBUL, 0x89044982UL, 0x88C623B5UL,
+    0x839A6488UL, 0x82580EBFUL, 0x801EB0E6UL, 0x81DCDAD1UL, 0x8493CC54UL, 0x8551A663UL,
+    0x8717183AUL, 0x86D5720DUL, 0xA9E2D0A0UL, 0xA820BA97UL, 0xAA6604CEUL, 0xABA46EF9UL,
+    0xAEEB787CUL, 0xAF29124BUL, 0xAD6FAC12UL, 0xACADC625UL, 0xA7F18118UL, 0xA633EB2FUL,
+    0xA4755576UL, 0xA5B73F41UL, 0xA0F829C4UL, 0xA13A43F3UL, 0xA37CFDAAUL, 0xA2BE979DUL,
+    0xB5C473D0UL, 0xB40619E7UL, 0xB640A7BEUL, 0xB782CD89UL, 0xB2CDDB0CUL, 0xB30FB13BUL,
+    0xB1490F62UL, 0xB08B6555UL, 0xBBD72268UL, 0xBA15485FUL, 0xB853F606UL, 0xB9919C31UL,
+    0xBCDE8AB4UL, 0xBD1CE083UL, 0xBF5A5EDAUL, 0xBE9834EDUL
+  },
+  {
+    0x00000000UL, 0xB8BC6765UL, 0xAA09C88BUL, 0x12B5AFEEUL, 0x8F629757UL, 0x37DEF032UL,
+    0x256B5FDCUL, 0x9DD738B9UL, 0xC5B428EFUL, 0x7D084F8AUL, 0x6FBDE064UL, 0xD7018701UL,
+    0x4AD6BFB8UL, 0xF26AD8DDUL, 0xE0DF7733UL, 0x58631056UL, 0x5019579FUL, 0xE8A530FAUL,
+    0xFA109F14UL, 0x42ACF871UL, 0xDF7BC0C8UL, 0x67C7A7ADUL, 0x75720843UL, 0xCDCE6F26UL,
+    0x95AD7F70UL, 0x2D111815UL, 0x3FA4B7FBUL, 0x8718D09EUL, 0x1ACFE827UL, 0xA2738F42UL,
+    0xB0C620ACUL, 0x087A47C9UL, 0xA032AF3EUL, 0x188EC85BUL, 0x0A3B67B5UL, 0xB28700D0UL,
+    0x2F503869UL, 0x97EC5F0CUL, 0x8559F0E2UL, 0x3DE59787UL, 0x658687D1UL, 0xDD3AE0B4UL,
+    0xCF8F4F5AUL, 0x7733283FUL, 0xEAE41086UL, 0x525877E3UL, 0x40EDD80DUL, 0xF851BF68UL,
+    0xF02BF8A1UL, 0x48979FC4UL, 0x5A22302AUL, 0xE29E574FUL, 0x7F496FF6UL, 0xC7F50893UL,
+    0xD540A77DUL, 0x6DFCC018UL, 0x359FD04EUL, 0x8D23B72BUL, 0x9F9618C5UL, 0x272A7FA0UL,
+    0xBAFD4719UL, 0x0241207CUL, 0x10F48F92UL, 0xA848E8F7UL, 0x9B14583DUL, 0x23A83F58UL,
+    0x311D90B6UL, 0x89A1F7D3UL, 0x1476CF6AUL, 0xACCAA80FUL, 0xBE7F07E1UL, 0x06C36084UL,
+    0x5EA070D2UL, 0xE61C17B7UL, 0xF4A9B859UL, 0x4C15DF3CUL, 0xD1C2E785UL, 0x697E80E0UL,
+    0x7BCB2F0EUL, 0xC377486BUL, 0xCB0D0FA2UL, 0x73B168C7UL, 0x6104C729UL, 0xD9B8A04CUL,
+    0x446F98F5UL, 0xFCD3FF90UL, 0xEE66507EUL, 0x56DA371BUL, 0x0EB9274DUL, 0xB6054028UL,
+    0xA4B0EFC6UL, 0x1C0C88A3UL, 0x81DBB01AUL, 0x3967D77FUL, 0x2BD27891UL, 0x936E1FF4UL,
+    0x3B26F703UL, 0x839A9066UL, 0x912F3F88UL, 0x299358EDUL, 0xB4446054UL, 0x0CF80731UL,
+    0x1E4DA8DFUL, 0xA6F1CFBAUL, 0xFE92DFECUL, 0x462EB889UL, 0x549B1767UL, 0xEC277002UL,
+    0x71F048BBUL, 0xC94C2FDEUL, 0xDBF98030UL, 0x6345E755UL, 0x6B3FA09CUL, 0xD383C7F9UL,
+    0xC1366817UL, 0x798A0F72UL, 0xE45D37CBUL, 0x5CE150AEUL, 0x4E54FF40UL, 0xF6E89825UL,
+    0xAE8B8873UL, 0x1637EF16UL, 0x048240F8UL, 0xBC3E279DUL, 0x21E91F24UL, 0x99557841UL,
+    0x8BE0D7AFUL, 0x335CB0CAUL, 0xED59B63BUL, 0x55E5D15EUL, 0x47507EB0UL, 0xFFEC19D5UL,
+    0x623B216CUL, 0xDA874609UL, 0xC832E9E7UL, 0x708E8E82UL, 0x28ED9ED4UL, 0x9051F9B1UL,
+    0x82E4565FUL, 0x3A58313AUL, 0xA78F0983UL, 0x1F336EE6UL, 0x0D86C108UL, 0xB53AA66DUL,
+    0xBD40E1A4UL, 0x05FC86C1UL, 0x1749292FUL, 0xAFF54E4AUL, 0x322276F3UL, 0x8A9E1196UL,
+    0x982BBE78UL, 0x2097D91DUL, 0x78F4C94BUL, 0xC048AE2EUL, 0xD2FD01C0UL, 0x6A4166A5UL,
+    0xF7965E1CUL, 0x4F2A3979UL, 0x5D9F9697UL, 0xE523F1F2UL, 0x4D6B1905UL, 0xF5D77E60UL,
+    0xE762D18EUL, 0x5FDEB6EBUL, 0xC2098E52UL, 0x7AB5E937UL, 0x680046D9UL, 0xD0BC21BCUL,
+    0x88DF31EAUL, 0x3063568FUL, 0x22D6F961UL, 0x9A6A9E04UL, 0x07BDA6BDUL, 0xBF01C1D8UL,
+    0xADB46E36UL, 0x15080953UL, 0x1D724E9AUL, 0xA5CE29FFUL, 0xB77B8611UL, 0x0FC7E174UL,
+    0x9210D9CDUL, 0x2AACBEA8UL, 0x38191146UL, 0x80A57623UL, 0xD8C66675UL, 0x607A0110UL,
+    0x72CFAEFEUL, 0xCA73C99BUL, 0x57A4F122UL, 0xEF189647UL, 0xFDAD39A9UL, 0x45115ECCUL,
+    0x764DEE06UL, 0xCEF18963UL, 0xDC44268DUL, 0x64F841E8UL, 0xF92F7951UL, 0x41931E34UL,
+    0x5326B1DAUL, 0xEB9AD6BFUL, 0xB3F9C6E9UL, 0x0B45A18CUL, 0x19F00E62UL, 0xA14C6907UL,
+    0x3C9B51BEUL, 0x842736DBUL, 0x96929935UL, 0x2E2EFE50UL, 0x2654B999UL, 0x9EE8DEFCUL,
+    0x8C5D7112UL, 0x34E11677UL, 0xA9362ECEUL, 0x118A49ABUL, 0x033FE645UL, 0xBB838120UL,
+    0xE3E09176UL, 0x5B5CF613UL, 0x49E959FDUL, 0xF1553E98UL, 0x6C820621UL, 0xD43E6144UL,
+    0xC68BCEAAUL, 0x7E37A9CFUL, 0xD67F4138UL, 0x6EC3265DUL, 0x7C7689B3UL, 0xC4CAEED6UL,
+    0x591DD66FUL, 0xE1A1B10AUL, 0xF3141EE4UL, 0x4BA87981UL, 0x13CB69D7UL, 0xAB770EB2UL,
+    0xB9C2A15CUL, 0x017EC639UL, 0x9CA9FE80UL, 0x241599E5UL, 0x36A0360BUL, 0x8E1C516EUL,
+    0x866616A7UL, 0x3EDA71C2UL, 0x2C6FDE2CUL, 0x94D3B949UL, 0x090481F0UL, 0xB1B8E695UL,
+    0xA30D497BUL, 0x1BB12E1EUL, 0x43D23E48UL, 0xFB6E592DUL, 0xE9DBF6C3UL, 0x516791A6UL,
+    0xCCB0A91FUL, 0x740CCE7AUL, 0x66B96194UL, 0xDE0506F1UL
+  },
+  {
+    0x00000000UL, 0x3D6029B0UL, 0x7AC05360UL, 0x47A07AD0UL, 0xF580A6C0UL, 0xC8E08F70UL,
+    0x8F40F5A0UL, 0xB220DC10UL, 0x30704BC1UL, 0x0D106271UL, 0x4AB018A1UL, 0x77D03111UL,
+    0xC5F0ED01UL, 0xF890C4B1UL, 0xBF30BE61UL, 0x825097D1UL, 0x60E09782UL, 0x5D80BE32UL,
+    0x1A20C4E2UL, 0x2740ED52UL, 0x95603142UL, 0xA80018F2UL, 0xEFA06222UL, 0xD2C04B92UL,
+    0x5090DC43UL, 0x6DF0F5F3UL, 0x2A508F23UL, 0x1730A693UL, 0xA5107A83UL, 0x98705333UL,
+    0xDFD029E3UL, 0xE2B00053UL, 0xC1C12F04UL, 0xFCA106B4UL, 0xBB017C64UL, 0x866155D4UL,
+    0x344189C4UL, 0x0921A074UL, 0x4E81DAA4UL, 0x73E1F314UL, 0xF1B164C5UL, 0xCCD14D75UL,
+    0x8B7137A5UL, 0xB6111E15UL, 0x0431C205UL, 0x3951EBB5UL, 0x7EF19165UL, 0x4391B8D5UL,
+    0xA121B886UL, 0x9C419136UL, 0xDBE1EBE6UL, 0xE681C256UL, 0x54A11E46UL, 0x69C137F6UL,
+    0x2E614D26UL, 0x13016496UL, 0x9151F347UL, 0xAC31DAF7UL, 0xEB91A027UL, 0xD6F18997UL,
+    0x64D15587UL, 0x59B17C37UL, 0x1E1106E7UL, 0x23712F57UL, 0x58F35849UL, 0x659371F9UL,
+    0x22330B29UL, 0x1F532299UL, 0xAD73FE89UL, 0x9013D739UL, 0xD7B3ADE9UL, 0xEAD38459UL,
+    0x68831388UL, 0x55E33A38UL, 0x124340E8UL, 0x2F236958UL, 0x9D03B548UL, 0xA0639CF8UL,
+    0xE7C3E628UL, 0xDAA3CF98UL, 0x3813CFCBUL, 0x0573E67BUL, 0x42D39CABUL, 0x7FB3B51BUL,
+    0xCD93690BUL, 0xF0F340BBUL, 0xB7533A6BUL, 0x8A3313DBUL, 0x0863840AUL, 0x3503ADBAUL,
+    0x72A3D76AUL, 0x4FC3FEDAUL, 0xFDE322CAUL, 0xC0830B7AUL, 0x872371AAUL, 0xBA43581AUL,
+    0x9932774DUL, 0xA4525EFDUL, 0xE3F2242DUL, 0xDE920D9DUL, 0x6CB2D18DUL, 0x51D2F83DUL,
+    0x167282EDUL, 0x2B12AB5DUL, 0xA9423C8CUL, 0x9422153CUL, 0xD3826FECUL, 0xEEE2465CUL,
+    0x5CC29A4CUL, 0x61A2B3FCUL, 0x2602C92CUL, 0x1B62E09CUL, 0xF9D2E0CFUL, 0xC4B2C97FUL,
+    0x8312B3AFUL, 0xBE729A1FUL, 0x0C52460FUL, 0x31326FBFUL, 0x7692156FUL, 0x4BF23CDFUL,
+    0xC9A2AB0EUL, 0xF4C282BEUL, 0xB362F86EUL, 0x8E02D1DEUL, 0x3C220DCEUL, 0x0142247EUL,
+    0x46E25EAEUL, 0x7B82771EUL, 0xB1E6B092UL, 0x8C869922UL, 0xCB26E3F2UL, 0xF646CA42UL,
+    0x44661652UL, 0x79063FE2UL, 0x3EA64532UL, 0x03C66C82UL, 0x8196FB53UL, 0xBCF6D2E3UL,
+    0xFB56A833UL, 0xC6368183UL, 0x74165D93UL, 0x49767423UL, 0x0ED60EF3UL, 0x33B62743UL,
+    0xD1062710UL, 0xEC660EA0UL, 0xABC67470UL, 0x96A65DC0UL, 0x248681D0UL, 0x19E6A860UL,
+    0x5E46D2B0UL, 0x6326FB00UL, 0xE1766CD1UL, 0xDC164561UL, 0x9BB63FB1UL, 0xA6D61601UL,
+    0x14F6CA11UL, 0x2996E3A1UL, 0x6E369971UL, 0x5356B0C1UL, 0x70279F96UL, 0x4D47B626UL,
+    0x0AE7CCF6UL, 0x3787E546UL, 0x85A73956UL, 0xB8C710E6UL, 0xFF676A36UL, 0xC2074386UL,
+    0x4057D457UL, 0x7D37FDE7UL, 0x3A978737UL, 0x07F7AE87UL, 0xB5D77297UL, 0x88B75B27UL,
+    0xCF1721F7UL, 0xF2770847UL, 0x10C70814UL, 0x2DA721A4UL, 0x6A075B74UL, 0x576772C4UL,
+    0xE547AED4UL, 0xD8278764UL, 0x9F87FDB4UL, 0xA2E7D404UL, 0x20B743D5UL, 0x1DD76A65UL,
+    0x5A7710B5UL, 0x67173905UL, 0xD537E515UL, 0xE857CCA5UL, 0xAFF7B675UL, 0x92979FC5UL,
+    0xE915E8DBUL, 0xD475C16BUL, 0x93D5BBBBUL, 0xAEB5920BUL, 0x1C954E1BUL, 0x21F567ABUL,
+    0x66551D7BUL, 0x5B3534CBUL, 0xD965A31AUL, 0xE4058AAAUL, 0xA3A5F07AUL, 0x9EC5D9CAUL,
+    0x2CE505DAUL, 0x11852C6AUL, 0x562556BAUL, 0x6B457F0AUL, 0x89F57F59UL, 0xB49556E9UL,
+    0xF3352C39UL, 0xCE550589UL, 0x7C75D999UL, 0x4115F029UL, 0x06B58AF9UL, 0x3BD5A349UL,
+    0xB9853498UL, 0x84E51D28UL, 0xC34567F8UL, 0xFE254E48UL, 0x4C059258UL, 0x7165BBE8UL,
+    0x36C5C138UL, 0x0BA5E888UL, 0x28D4C7DFUL, 0x15B4EE6FUL, 0x521494BFUL, 0x6F74BD0FUL,
+    0xDD54611FUL, 0xE03448AFUL, 0xA794327FUL, 0x9AF41BCFUL, 0x18A48C1EUL, 0x25C4A5AEUL,
+    0x6264DF7EUL, 0x5F04F6CEUL, 0xED242ADEUL, 0xD044036EUL, 0x97E479BEUL, 0xAA84500EUL,
+    0x4834505DUL, 0x755479EDUL, 0x32F4033DUL, 0x0F942A8DUL, 0xBDB4F69DUL, 0x80D4DF2DUL,
+    0xC774A5FDUL, 0xFA148C4DUL, 0x78441B9CUL, 0x4524322CUL, 0x028448FCUL, 0x3FE4614CUL,
+    0x8DC4BD5CUL, 0xB0A494ECUL, 0xF704EE3CUL, 0xCA64C78CUL
+  },
+  {
+    0x00000000UL, 0xCB5CD3A5UL, 0x4DC8A10BUL, 0x869472AEUL, 0x9B914216UL, 0x50CD91B3UL,
+    0xD659E31DUL, 0x1D0530B8UL, 0xEC53826DUL, 0x270F51C8UL, 0xA19B2366UL, 0x6AC7F0C3UL,
+    0x77C2C07BUL, 0xBC9E13DEUL, 0x3A0A6170UL, 0xF156B2D5UL, 0x03D6029BUL, 0xC88AD13EUL,
+    0x4E1EA390UL, 0x85427035UL, 0x9847408DUL, 0x531B9328UL, 0xD58FE186UL, 0x1ED33223UL,
+    0xEF8580F6UL, 0x24D95353UL, 0xA24D21FDUL, 0x6911F258UL, 0x7414C2E0UL, 0xBF481145UL,
+    0x39DC63EBUL, 0xF280B04EUL, 0x07AC0536UL, 0xCCF0D693UL, 0x4A64A43DUL, 0x81387798UL,
+    0x9C3D4720UL, 0x57619485UL, 0xD1F5E62BUL, 0x1AA9358EUL, 0xEBFF875BUL, 0x20A354FEUL,
+    0xA6372650UL, 0x6D6BF5F5UL, 0x706EC54DUL, 0xBB3216E8UL, 0x3DA66446UL, 0xF6FAB7E3UL,
+    0x047A07ADUL, 0xCF26D408UL, 0x49B2A6A6UL, 0x82EE7503UL, 0x9FEB45BBUL, 0x54B7961EUL,
+    0xD223E4B0UL, 0x197F3715UL, 0xE82985C0UL, 0x23755665UL, 0xA5E124CBUL, 0x6EBDF76EUL,
+    0x73B8C7D6UL, 0xB8E41473UL, 0x3E7066DDUL, 0xF52CB578UL, 0x0F580A6CUL, 0xC404D9C9UL,
+    0x4290AB67UL, 0x89CC78C2UL, 0x94C9487AUL, 0x5F959BDFUL, 0xD901E971UL, 0x125D3AD4UL,
+    0xE30B8801UL, 0x28575BA4UL, 0xAEC3290AUL, 0x659FFAAFUL, 0x789ACA17UL, 0xB3C619B2UL,
+    0x35526B1CUL, 0xFE0EB8B9UL, 0x0C8E08F7UL, 0xC7D2DB52UL, 0x4146A9FCUL, 0x8A1A7A59UL,
+    0x971F4AE1UL, 0x5C439944UL, 0xDAD7EBEAUL, 0x118B384FUL, 0xE0DD8A9AUL, 0x2B81593FUL,
+    0xAD152B91UL, 0x6649F834UL, 0x7B4CC88CUL, 0xB0101B29UL, 0x36846987UL, 0xFDD8BA22UL,
+    0x08F40F5AUL, 0xC3A8DCFFUL, 0x453CAE51UL, 0x8E607DF4UL, 0x93654D4CUL, 0x58399EE9UL,
+    0xDEADEC47UL, 0x15F13FE2UL, 0xE4A78D37UL, 0x2FFB5E92UL, 0xA96F2C3CUL, 0x6233FF99UL,
+    0x7F36CF21UL, 0xB46A1C84UL, 0x32FE6E2AUL, 0xF9A2BD8FUL, 0x0B220DC1UL, 0xC07EDE64UL,
+    0x46EAACCAUL, 0x8DB67F6FUL, 0x90B34FD7UL, 0x5BEF9C72UL, 0xDD7BEEDCUL, 0x16273D79UL,
+    0xE7718FACUL, 0x2C2D5C09UL, 0xAAB92EA7UL, 0x61E5FD02UL, 0x7CE0CDBAUL, 0xB7BC1E1FUL,
+    0x31286CB1UL, 0xFA74BF14UL, 0x1EB014D8UL, 0xD5ECC77DUL, 0x5378B5D3UL, 0x98246676UL,
+    0x852156CEUL, 0x4E7D856BUL, 0xC8E9F7C5UL, 0x03B52460UL, 0xF2E396B5UL, 0x39BF4510UL,
+    0xBF2B37BEUL, 0x7477E41BUL, 0x6972D4A3UL, 0xA22E0706UL, 0x24BA75A8UL, 0xEFE6A60DUL,
+    0x1D661643UL, 0xD63AC5E6UL, 0x50AEB748UL, 0x9BF264EDUL, 0x86F75455UL, 0x4DAB87F0UL,
+    0xCB3FF55EUL, 0x006326FBUL, 0xF135942EUL, 0x3A69478BUL, 0xBCFD3525UL, 0x77A1E680UL,
+    0x6AA4D638UL, 0xA1F8059DUL, 0x276C7733UL, 0xEC30A496UL, 0x191C11EEUL, 0xD240C24BUL,
+    0x54D4B0E5UL, 0x9F886340UL, 0x828D53F8UL, 0x49D1805DUL, 0xCF45F2F3UL, 0x04192156UL,
+    0xF54F9383UL, 0x3E134026UL, 0xB8873288UL, 0x73DBE12DUL, 0x6EDED195UL, 0xA5820230UL,
+    0x2316709EUL, 0xE84AA33BUL, 0x1ACA1375UL, 0xD196C0D0UL, 0x5702B27EUL, 0x9C5E61DBUL,
+    0x815B5163UL, 0x4A0782C6UL, 0xCC93F068UL, 0x07CF23CDUL, 0xF6999118UL, 0x3DC542BDUL,
+    0xBB513013UL, 0x700DE3B6UL, 0x6D08D30EUL, 0xA65400ABUL, 0x20C07205UL, 0xEB9CA1A0UL,
+    0x11E81EB4UL, 0xDAB4CD11UL, 0x5C20BFBFUL, 0x977C6C1AUL, 0x8A795CA2UL, 0x41258F07UL,
+    0xC7B1FDA9UL, 0x0CED2E0CUL, 0xFDBB9CD9UL, 0x36E74F7CUL, 0xB0733DD2UL, 0x7B2FEE77UL,
+    0x662ADECFUL, 0xAD760D6AUL, 0x2BE27FC4UL, 0xE0BEAC61UL, 0x123E1C2FUL, 0xD962CF8AUL,
+    0x5FF6BD24UL, 0x94AA6E81UL, 0x89AF5E39UL, 0x42F38D9CUL, 0xC467FF32UL, 0x0F3B2C97UL,
+    0xFE6D9E42UL, 0x35314DE7UL, 0xB3A53F49UL, 0x78F9ECECUL, 0x65FCDC54UL, 0xAEA00FF1UL,
+    0x28347D5FUL, 0xE368AEFAUL, 0x16441B82UL, 0xDD18C827UL, 0x5B8CBA89UL, 0x90D0692CUL,
+    0x8DD55994UL, 0x46898A31UL, 0xC01DF89FUL, 0x0B412B3AUL, 0xFA1799EFUL, 0x314B4A4AUL,
+    0xB7DF38E4UL, 0x7C83EB41UL, 0x6186DBF9UL, 0xAADA085CUL, 0x2C4E7AF2UL, 0xE712A957UL,
+    0x15921919UL, 0xDECECABCUL, 0x585AB812UL, 0x93066BB7UL, 0x8E035B0FUL, 0x455F88AAUL,
+    0xC3CBFA04UL, 0x089729A1UL, 0xF9C19B74UL, 0x329D48D1UL, 0xB4093A7FUL, 0x7F55E9DAUL,
+    0x6250D962UL, 0xA90C0AC7UL, 0x2F987869UL, 0xE4C4ABCCUL
+  },
+  {
+    0x00000000UL, 0xA6770BB4UL, 0x979F1129UL, 0x31E81A9DUL, 0xF44F2413UL, 0x52382FA7UL,
+    0x63D0353AUL, 0xC5A73E8EUL, 0x33EF4E67UL, 0x959845D3UL, 0xA4705F4EUL, 0x020754FAUL,
+    0xC7A06A74UL, 0x61D761C0UL, 0x503F7B5DUL, 0xF64870E9UL, 0x67DE9CCEUL, 0xC1A9977AUL,
+    0xF0418DE7UL, 0x56368653UL, 0x9391B8DDUL, 0x35E6B369UL, 0x040EA9F4UL, 0xA279A240UL,
+    0x5431D2A9UL, 0xF246D91DUL, 0xC3AEC380UL, 0x65D9C834UL, 0xA07EF6BAUL, 0x0609FD0EUL,
+    0x37E1E793UL, 0x9196EC27UL, 0xCFBD399CUL, 0x69CA3228UL, 0x582228B5UL, 0xFE552301UL,
+    0x3BF21D8FUL, 0x9D85163BUL, 0xAC6D0CA6UL, 0x0A1A0712UL, 0xFC5277FBUL, 0x5A257C4FUL,
+    0x6BCD66D2UL, 0xCDBA6D66UL, 0x081D53E8UL, 0xAE6A585CUL, 0x9F8242C1UL, 0x39F54975UL,
+    0xA863A552UL, 0x0E14AEE6UL, 0x3FFCB47BUL, 0x998BBFCFUL, 0x5C2C8141UL, 0xFA5B8AF5UL,
+    0xCBB39068UL, 0x6DC49BDCUL, 0x9B8CEB35UL, 0x3DFBE081UL, 0x0C13FA1CUL, 0xAA64F1A8UL,
+    0x6FC3CF26UL, 0xC9B4C492UL, 0xF85CDE0FUL, 0x5E2BD5BBUL, 0x440B7579UL, 0xE27C7ECDUL,
+    0xD3946450UL, 0x75E36FE4UL, 0xB044516AUL, 0x16335ADEUL, 0x27DB4043UL, 0x81AC4BF7UL,
+    0x77E43B1EUL, 0xD19330AAUL, 0xE07B2A37UL, 0x460C2183UL, 0x83AB1F0DUL, 0x25DC14B9UL,
+    0x14340E24UL, 0xB2430590UL, 0x23D5E9B7UL, 0x85A2E203UL, 0xB44AF89EUL, 0x123DF32AUL,
+    0xD79ACDA4UL, 0x71EDC610UL, 0x4005DC8DUL, 0xE672D739UL, 0x103AA7D0UL, 0xB64DAC64UL,
+    0x87A5B6F9UL, 0x21D2BD4DUL, 0xE47583C3UL, 0x42028877UL, 0x73EA92EAUL, 0xD59D995EUL,
+    0x8BB64CE5UL, 0x2DC14751UL, 0x1C295DCCUL, 0xBA5E5678UL, 0x7FF968F6UL, 0xD98E6342UL,
+    0xE86679DFUL, 0x4E11726BUL, 0xB8590282UL, 0x1E2E0936UL, 0x2FC613ABUL, 0x89B1181FUL,
+    0x4C162691UL, 0xEA612D25UL, 0xDB8937B8UL, 0x7DFE3C0CUL, 0xEC68D02BUL, 0x4A1FDB9FUL,
+    0x7BF7C102UL, 0xDD80CAB6UL, 0x1827F438UL, 0xBE50FF8CUL, 0x8FB8E511UL, 0x29CFEEA5UL,
+    0xDF879E4CUL, 0x79F095F8UL, 0x48188F65UL, 0xEE6F84D1UL, 0x2BC8BA5FUL, 0x8DBFB1EBUL,
+    0xBC57AB76UL, 0x1A20A0C2UL, 0x8816EAF2UL, 0x2E61E146UL, 0x1F89FBDBUL, 0xB9FEF06FUL,
+    0x7C59CEE1UL, 0xDA2EC555UL, 0xEBC6DFC8UL, 0x4DB1D47CUL, 0xBBF9A495UL, 0x1D8EAF21UL,
+    0x2C66B5BCUL, 0x8A11BE08UL, 0x4FB68086UL, 0xE9C18B32UL, 0xD82991AFUL, 0x7E5E9A1BUL,
+    0xEFC8763CUL, 0x49BF7D88UL, 0x78576715UL, 0xDE206CA1UL, 0x1B87522FUL, 0xBDF0599BUL,
+    0x8C184306UL, 0x2A6F48B2UL, 0xDC27385BUL, 0x7A5033EFUL, 0x4BB82972UL, 0xEDCF22C6UL,
+    0x28681C48UL, 0x8E1F17FCUL, 0xBFF70D61UL, 0x198006D5UL, 0x47ABD36EUL, 0xE1DCD8DAUL,
+    0xD034C247UL, 0x7643C9F3UL, 0xB3E4F77DUL, 0x1593FCC9UL, 0x247BE654UL, 0x820CEDE0UL,
+    0x74449D09UL, 0xD23396BDUL, 0xE3DB8C20UL, 0x45AC8794UL, 0x800BB91AUL, 0x267CB2AEUL,
+    0x1794A833UL, 0xB1E3A387UL, 0x20754FA0UL, 0x86024414UL, 0xB7EA5E89UL, 0x119D553DUL,
+    0xD43A6BB3UL, 0x724D6007UL, 0x43A57A9AUL, 0xE5D2712EUL, 0x139A01C7UL, 0xB5ED0A73UL,
+    0x840510EEUL, 0x22721B5AUL, 0xE7D525D4UL, 0x41A22E60UL, 0x704A34FDUL, 0xD63D3F49UL,
+    0xCC1D9F8BUL, 0x6A6A943FUL, 0x5B828EA2UL, 0xFDF58516UL, 0x3852BB98UL, 0x9E25B02CUL,
+    0xAFCDAAB1UL, 0x09BAA105UL, 0xFFF2D1ECUL, 0x5985DA58UL, 0x686DC0C5UL, 0xCE1ACB71UL,
+    0x0BBDF5FFUL, 0xADCAFE4BUL, 0x9C22E4D6UL, 0x3A55EF62UL, 0xABC30345UL, 0x0DB408F1UL,
+    0x3C5C126CUL, 0x9A2B19D8UL, 0x5F8C2756UL, 0xF9FB2CE2UL, 0xC813367FUL, 0x6E643DCBUL,
+    0x982C4D22UL, 0x3E5B4696UL, 0x0FB35C0BUL, 0xA9C457BFUL, 0x6C636931UL, 0xCA146285UL,
+    0xFBFC7818UL, 0x5D8B73ACUL, 0x03A0A617UL, 0xA5D7ADA3UL, 0x943FB73EUL, 0x3248BC8AUL,
+    0xF7EF8204UL, 0x519889B0UL, 0x6070932DUL, 0xC6079899UL, 0x304FE870UL, 0x9638E3C4UL,
+    0xA7D0F959UL, 0x01A7F2EDUL, 0xC400CC63UL, 0x6277C7D7UL, 0x539FDD4AUL, 0xF5E8D6FEUL,
+    0x647E3AD9UL, 0xC209316DUL, 0xF3E12BF0UL, 0x55962044UL, 0x90311ECAUL, 0x3646157EUL,
+    0x07AE0FE3UL, 0xA1D90457UL, 0x579174BEUL, 0xF1E67F0AUL, 0xC00E6597UL, 0x66796E23UL,
+    0xA3DE50ADUL, 0x05A95B19UL, 0x34414184UL, 0x92364A30UL
+  },
+  {
+    0x00000000UL, 0xCCAA009EUL, 0x4225077DUL, 0x8E8F07E3UL, 0x844A0EFAUL, 0x48E00E64UL,
+    0xC66F0987UL, 0x0AC50919UL, 0xD3E51BB5UL, 0x1F4F1B2BUL, 0x91C01CC8UL, 0x5D6A1C56UL,
+    0x57AF154FUL, 0x9B0515D1UL, 0x158A1232UL, 0xD92012ACUL, 0x7CBB312BUL, 0xB01131B5UL,
+    0x3E9E3656UL, 0xF23436C8UL, 0xF8F13FD1UL, 0x345B3F4FUL, 0xBAD438ACUL, 0x767E3832UL,
+    0xAF5E2A9EUL, 0x63F42A00UL, 0xED7B2DE3UL, 0x21D12D7DUL, 0x2B142464UL, 0xE7BE24FAUL,
+    0x69312319UL, 0xA59B2387UL, 0xF9766256UL, 0x35DC62C8UL, 0xBB53652BUL, 0x77F965B5UL,
+    0x7D3C6CACUL, 0xB1966C32UL, 0x3F196BD1UL, 0xF3B36B4FUL, 0x2A9379E3UL, 0xE639797DUL,
+    0x68B67E9EUL, 0xA41C7E00UL, 0xAED97719UL, 0x62737787UL, 0xECFC7064UL, 0x205670FAUL,
+    0x85CD537DUL, 0x496753E3UL, 0xC7E85400UL, 0x0B42549EUL, 0x01875D87UL, 0xCD2D5D19UL,
+    0x43A25AFAUL, 0x8F085A64UL, 0x562848C8UL, 0x9A824856UL, 0x140D4FB5UL, 0xD8A74F2BUL,
+    0xD2624632UL, 0x1EC846ACUL, 0x9047414FUL, 0x5CED41D1UL, 0x299DC2EDUL, 0xE537C273UL,
+    0x6BB8C590UL, 0xA712C50EUL, 0xADD7CC17UL, 0x617DCC89UL, 0xEFF2CB6AUL, 0x2358CBF4UL,
+    0xFA78D958UL, 0x36D2D9C6UL, 0xB85DDE25UL, 0x74F7DEBBUL, 0x7E32D7A2UL, 0xB298D73CUL,
+    0x3C17D0DFUL, 0xF0BDD041UL, 0x5526F3C6UL, 0x998CF358UL, 0x1703F4BBUL, 0xDBA9F425UL,
+    0xD16CFD3CUL, 0x1DC6FDA2UL, 0x9349FA41UL, 0x5FE3FADFUL, 0x86C3E873UL, 0x4A69E8EDUL,
+    0xC4E6EF0EUL, 0x084CEF90UL, 0x0289E689UL, 0xCE23E617UL, 0x40ACE1F4UL, 0x8C06E16AUL,
+    0xD0EBA0BBUL, 0x1C41A025UL, 0x92CEA7C6UL, 0x5E64A758UL, 0x54A1AE41UL, 0x980BAEDFUL,
+    0x1684A93CUL, 0xDA2EA9A2UL, 0x030EBB0EUL, 0xCFA4BB90UL, 0x412BBC73UL, 0x8D81BCEDUL,
+    0x8744B5F4UL, 0x4BEEB56AUL, 0xC561B289UL, 0x09CBB217UL, 0xAC509190UL, 0x60FA910EUL,
+    0xEE7596EDUL, 0x22DF9673UL, 0x281A9F6AUL, 0xE4B09FF4UL, 0x6A3F9817UL, 0xA6959889UL,
+    0x7FB58A25UL, 0xB31F8ABBUL, 0x3D908D58UL, 0xF13A8DC6UL, 0xFBFF84DFUL, 0x37558441UL,
+    0xB9DA83A2UL, 0x7570833CUL, 0x533B85DAUL, 0x9F918544UL, 0x111E82A7UL, 0xDDB48239UL,
+    0xD7718B20UL, 0x1BDB8BBEUL, 0x95548C5DUL, 0x59FE8CC3UL, 0x80DE9E6FUL, 0x4C749EF1UL,
+    0xC2FB9912UL, 0x0E51998CUL, 0x04949095UL, 0xC83E900BUL, 0x46B197E8UL, 0x8A1B9776UL,
+    0x2F80B4F1UL, 0xE32AB46FUL, 0x6DA5B38CUL, 0xA10FB312UL, 0xABCABA0BUL, 0x6760BA95UL,
+    0xE9EFBD76UL, 0x2545BDE8UL, 0xFC65AF44UL, 0x30CFAFDAUL, 0xBE40A839UL, 0x72EAA8A7UL,
+    0x782FA1BEUL, 0xB485A120UL, 0x3A0AA6C3UL, 0xF6A0A65DUL, 0xAA4DE78CUL, 0x66E7E712UL,
+    0xE868E0F1UL, 0x24C2E06FUL, 0x2E07E976UL, 0xE2ADE9E8UL, 0x6C22EE0BUL, 0xA088EE95UL,
+    0x79A8FC39UL, 0xB502FCA7UL, 0x3B8DFB44UL, 0xF727FBDAUL, 0xFDE2F2C3UL, 0x3148F25DUL,
+    0xBFC7F5BEUL, 0x736DF520UL, 0xD6F6D6A7UL, 0x1A5CD639UL, 0x94D3D1DAUL, 0x5879D144UL,
+    0x52BCD85DUL, 0x9E16D8C3UL, 0x1099DF20UL, 0xDC33DFBEUL, 0x0513CD12UL, 0xC9B9CD8CUL,
+    0x4736CA6FUL, 0x8B9CCAF1UL, 0x8159C3E8UL, 0x4DF3C376UL, 0xC37CC495UL, 0x0FD6C40BUL,
+    0x7AA64737UL, 0xB60C47A9UL, 0x3883404AUL, 0xF42940D4UL, 0xFEEC49CDUL, 0x32464953UL,
+    0xBCC94EB0UL, 0x70634E2EUL, 0xA9435C82UL, 0x65E95C1CUL, 0xEB665BFFUL, 0x27CC5B61UL,
+    0x2D095278UL, 0xE1A352E6UL, 0x6F2C5505UL, 0xA386559BUL, 0x061D761CUL, 0xCAB77682UL,
+    0x44387161UL, 0x889271FFUL, 0x825778E6UL, 0x4EFD7878UL, 0xC0727F9BUL, 0x0CD87F05UL,
+    0xD5F86DA9UL, 0x19526D37UL, 0x97DD6AD4UL, 0x5B776A4AUL, 0x51B26353UL, 0x9D1863CDUL,
+    0x1397642EUL, 0xDF3D64B0UL, 0x83D02561UL, 0x4F7A25FFUL, 0xC1F5221CUL, 0x0D5F2282UL,
+    0x079A2B9BUL, 0xCB302B05UL, 0x45BF2CE6UL, 0x89152C78UL, 0x50353ED4UL, 0x9C9F3E4AUL,
+    0x121039A9UL, 0xDEBA3937UL, 0xD47F302EUL, 0x18D530B0UL, 0x965A3753UL, 0x5AF037CDUL,
+    0xFF6B144AUL, 0x33C114D4UL, 0xBD4E1337UL, 0x71E413A9UL, 0x7B211AB0UL, 0xB78B1A2EUL,
+    0x39041DCDUL, 0xF5AE1D53UL, 0x2C8E0FFFUL, 0xE0240F61UL, 0x6EAB0882UL, 0xA201081CUL,
+    0xA8C40105UL, 0x646E019BUL, 0xEAE10678UL, 0x264B06E6UL
+  }
+};
+#endif
+
+
+/************************************************************************************//**
+** \brief     Initializes the checksum calculation context for a new calculation.
+** \param     checksum Pointer to the checksum calculation context.
+** \param     type Checksum type. It should be a CHECKSUM_TYPE_xxx value, possibly
+**            combined with the CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     port Port whose optional CrcCalculate hook calculates the CRC with a
+**            hardware CRC unit. Set it to NULL to always calculate it in software.
+** \return    TBX_OK if successful, TBX_ERROR if the checksum type is not supported.
+**
+****************************************************************************************/
+uint8_t ChecksumInit(tChecksum * checksum, uint8_t type, tPort const * port)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(checksum != NULL);
+
+  /* Only continue with valid parameter and a supported checksum type. */
+  if ( (checksum != NULL) && ((type & CHECKSUM_TYPE_MASK) >= CHECKSUM_TYPE_ADD_11) &&
+       ((type & CHECKSUM_TYPE_MASK) <= CHECKSUM_TYPE_CRC_32) )
+  {
+    /* Initialize the context members. */
+    checksum->type = type;
+    checksum->wordLen = 0U;
+    checksum->port = port;
+    /* Set the initial value of the checksum. */
+    switch (type & CHECKSUM_TYPE_MASK)
+    {
+      case CHECKSUM_TYPE_CRC_16_CITT:
+        checksum->value = 0xFFFFU;
+        break;
+      case CHECKSUM_TYPE_CRC_32:
+        checksum->value = 0xFFFFFFFFUL;
+        break;
+      default:
+        checksum->value = 0U;
+        break;
+    }
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumInit ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a chunk of data to the checksum calculation. The data of one checksum
+**            calculation can be split in as many chunks as needed, each with an
+**            arbitrary length.
+** \param     checksum Pointer to the checksum calculation context.
+** \param     data Pointer to the byte array with data.
+** \param     len Number of bytes in the data.
+**
+****************************************************************************************/
+void ChecksumUpdate(tChecksum * checksum, uint8_t const * data, uint32_t len)
+{
+  uint32_t idx;
+  uint32_t value;
+  uint32_t crcValue;
+  uint8_t  crcDone;
+
+  /* Verify parameters. */
+  TBX_ASSERT((checksum != NULL) && ((data != NULL) || (len == 0U)));
+
+  /* Only continue with valid parameters. */
+  if ((checksum != NULL) && ((data != NULL) || (len == 0U)))
+  {
+    value = checksum->value;
+    switch (checksum->type & CHECKSUM_TYPE_MASK)
+    {
+      case CHECKSUM_TYPE_ADD_11:
+      case CHECKSUM_TYPE_ADD_12:
+      case CHECKSUM_TYPE_ADD_14:
+        /* Add the bytes. The result is truncated to the size of the checksum. */
+        for (idx = 0U; idx < len; idx++)
+        {
+          value += data[idx];
+        }
+        break;
+
+      case CHECKSUM_TYPE_CRC_16:
+      case CHECKSUM_TYPE_CRC_16_CITT:
+      case CHECKSUM_TYPE_CRC_32:
+        /* Give the port the opportunity to calculate the CRC with a hardware CRC unit.
+         * Otherwise calculate it in software.
+         */
+        crcDone = TBX_ERROR;
+        if ( (checksum->port != NULL) && (checksum->port->CrcCalculate != NULL) &&
+             (len > 0U) )
+        {
+          /* Pass a copy of the value to the port, so that it can only be updated when
+           * the port actually calculated the CRC.
+           */
+          crcValue = value;
+          crcDone = checksum->port->CrcCalculate(checksum->type & CHECKSUM_TYPE_MASK,
+                                                 &crcValue, data, len);
+          if (crcDone == TBX_OK)
+          {
+            value = crcValue;
+          }
+        }
+        if (crcDone != TBX_OK)
+        {
+          if ((checksum->type & CHECKSUM_TYPE_MASK) == CHECKSUM_TYPE_CRC_16)
+          {
+            value = ChecksumUpdateCrc16(value, data, len);
+          }
+          else if ((checksum->type & CHECKSUM_TYPE_MASK) == CHECKSUM_TYPE_CRC_16_CITT)
+          {
+            value = ChecksumUpdateCrc16Citt(value, data, len);
+          }
+          else
+          {
+            value = ChecksumUpdateCrc32(value, data, len);
+          }
+        }
+        break;
+
+      default:
+        /* The checksum types that add words. */
+        value = ChecksumUpdateAddWords(checksum, data, len);
+        break;
+    }
+    checksum->value = value;
+  }
+} /*** end of ChecksumUpdate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the result of the checksum calculation. The calculation can
+**            continue afterwards, if more data should be added.
+** \param     checksum Pointer to the checksum calculation context.
+** \return    The checksum value.
+**
+****************************************************************************************/
+uint32_t ChecksumGetResult(tChecksum const * checksum)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(checksum != NULL);
+
+  /* Only continue with valid parameter. */
+  if (checksum != NULL)
+  {
+    /* Truncate the value to the size of the checksum. */
+    switch (checksum->type & CHECKSUM_TYPE_MASK)
+    {
+      case CHECKSUM_TYPE_ADD_11:
+        result = checksum->value & 0xFFU;
+        break;
+      case CHECKSUM_TYPE_ADD_12:
+      case CHECKSUM_TYPE_ADD_22:
+      case CHECKSUM_TYPE_CRC_16:
+      case CHECKSUM_TYPE_CRC_16_CITT:
+        result = checksum->value & 0xFFFFU;
+        break;
+      case CHECKSUM_TYPE_CRC_32:
+        result = checksum->value ^ 0xFFFFFFFFUL;
+        break;
+      default:
+        result = checksum->value;
+        break;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumGetResult ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the size of the words that the checksum type adds.
+** \param     type Checksum type.
+** \return    Word size in bytes.
+**
+****************************************************************************************/
+static uint8_t ChecksumGetWordSize(uint8_t type)
+{
+  uint8_t result = 1U;
+
+  /* Determine the word size. */
+  switch (type & CHECKSUM_TYPE_MASK)
+  {
+    case CHECKSUM_TYPE_ADD_22:
+    case CHECKSUM_TYPE_ADD_24:
+      result = 2U;
+      break;
+    case CHECKSUM_TYPE_ADD_44:
+      result = 4U;
+      break;
+    default:
+      result = 1U;
+      break;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumGetWordSize ***/
+
+
+/************************************************************************************//**
+** \brief     Assembles the value of a word, taking into account its byte order.
+** \param     type Checksum type, including a possible CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     word Pointer to the bytes of the word.
+** \return    Value of the word.
+**
+****************************************************************************************/
+static uint32_t ChecksumGetWord(uint8_t type, uint8_t const * word)
+{
+  uint32_t result;
+
+  /* Assemble the word, taking into account its byte order. */
+  if ((type & CHECKSUM_TYPE_MASK) == CHECKSUM_TYPE_ADD_44)
+  {
+    if ((type & CHECKSUM_TYPE_BIG_ENDIAN) != 0U)
+    {
+      result = ((uint32_t)word[0] << 24U) | ((uint32_t)word[1] << 16U) |
+               ((uint32_t)word[2] << 8U) | (uint32_t)word[3];
+    }
+    else
+    {
+      result = ((uint32_t)word[3] << 24U) | ((uint32_t)word[2] << 16U) |
+               ((uint32_t)word[1] << 8U) | (uint32_t)word[0];
+    }
+  }
+  else
+  {
+    if ((type & CHECKSUM_TYPE_BIG_ENDIAN) != 0U)
+    {
+      result = ((uint32_t)word[0] << 8U) | (uint32_t)word[1];
+    }
+    else
+    {
+      result = ((uint32_t)word[1] << 8U) | (uint32_t)word[0];
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumGetWord ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the words in a chunk of data to the checksum, for the checksum types
+**            that add words. The bytes of a word that is split over two data chunks are
+**            collected in the context, until the word is complete.
+** \param     checksum Pointer to the checksum calculation context.
+** \param     data Pointer to the byte array with data.
+** \param     len Number of bytes in the data.
+** \return    The updated checksum value. It is not yet truncated to the size of the
+**            checksum.
+**
+****************************************************************************************/
+static uint32_t ChecksumUpdateAddWords(tChecksum * checksum, uint8_t const * data,
+                                       uint32_t len)
+{
+  uint32_t result;
+  uint32_t idx = 0U;
+  uint8_t  wordSize;
+
+  /* Verify parameters. */
+  TBX_ASSERT((checksum != NULL) && ((data != NULL) || (len == 0U)));
+
+  result = checksum->value;
+  wordSize = ChecksumGetWordSize(checksum->type);
+  /* First complete the word that was split over the previous and this data chunk. */
+  while ((checksum->wordLen > 0U) && (idx < len))
+  {
+    checksum->word[checksum->wordLen] = data[idx];
+    checksum->wordLen++;
+    idx++;
+    if (checksum->wordLen == wordSize)
+    {
+      result += ChecksumGetWord(checksum->type, checksum->word);
+      checksum->wordLen = 0U;
+    }
+  }
+  /* Add the complete words directly from the data. */
+  while ((len - idx) >= wordSize)
+  {
+    result += ChecksumGetWord(checksum->type, &data[idx]);
+    idx += wordSize;
+  }
+  /* Store the bytes of a word that continues in the next data chunk. */
+  while (idx < len)
+  {
+    checksum->word[checksum->wordLen] = data[idx];
+    checksum->wordLen++;
+    idx++;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumUpdateAddWords ***/
+
+
+/************************************************************************************//**
+** \brief     Continues the calculation of the CRC16 checksum type with a chunk of data.
+** \param     crc Intermediate CRC value.
+** \param     data Pointer to the byte array with data.
+** \param     len Number of bytes in the data.
+** \return    The updated intermediate CRC value.
+**
+****************************************************************************************/
+static uint32_t ChecksumUpdateCrc16(uint32_t crc, uint8_t const * data, uint32_t len)
+{
+  uint32_t result = crc;
+  uint32_t idx = 0U;
+#if (CHECKSUM_CRC_TABLE_ENABLE > 0U)
+  uint32_t blockCnt;
+
+  /* Process 8 bytes at a time with the slicing-by-8 tables. */
+  for (blockCnt = len / 8U; blockCnt > 0U; blockCnt--)
+  {
+    result ^= (uint32_t)data[idx] | ((uint32_t)data[idx + 1U] << 8U);
+    result = (uint32_t)checksumCrc16Tbl[7][result & 0xFFU] ^
+             (uint32_t)checksumCrc16Tbl[6][result >> 8U] ^
+             (uint32_t)checksumCrc16Tbl[5][data[idx + 2U]] ^
+             (uint32_t)checksumCrc16Tbl[4][data[idx + 3U]] ^
+             (uint32_t)checksumCrc16Tbl[3][data[idx + 4U]] ^
+             (uint32_t)checksumCrc16Tbl[2][data[idx + 5U]] ^
+             (uint32_t)checksumCrc16Tbl[1][data[idx + 6U]] ^
+             (uint32_t)checksumCrc16Tbl[0][data[idx + 7U]];
+    idx += 8U;
+  }
+  /* Process the remaining bytes one at a time. */
+  for (; idx < len; idx++)
+  {
+    result = (result >> 8U) ^
+             (uint32_t)checksumCrc16Tbl[0][(result ^ data[idx]) & 0xFFU];
+  }
+#else
+  uint8_t  bitIdx;
+
+  /* Process the bytes one bit at a time, with the reflected polynomial. */
+  for (; idx < len; idx++)
+  {
+    result ^= data[idx];
+    for (bitIdx = 0U; bitIdx < 8U; bitIdx++)
+    {
+      result = ((result & 1U) != 0U) ? ((result >> 1U) ^ 0xA001U) : (result >> 1U);
+    }
+  }
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumUpdateCrc16 ***/
+
+
+/************************************************************************************//**
+** \brief     Continues the calculation of the CRC16 CCITT checksum type with a chunk of
+**            data.
+** \param     crc Intermediate CRC value.
+** \param     data Pointer to the byte array with data.
+** \param     len Number of bytes in the data.
+** \return    The updated intermediate CRC value.
+**
+****************************************************************************************/
+static uint32_t ChecksumUpdateCrc16Citt(uint32_t crc, uint8_t const * data,
+                                        uint32_t len)
+{
+  uint32_t result = crc;
+  uint32_t idx = 0U;
+#if (CHECKSUM_CRC_TABLE_ENABLE > 0U)
+  uint32_t blockCnt;
+
+  /* Process 8 bytes at a time with the slicing-by-8 tables. */
+  for (blockCnt = len / 8U; blockCnt > 0U; blockCnt--)
+  {
+    result ^= ((uint32_t)data[idx] << 8U) | (uint32_t)data[idx + 1U];
+    result = (uint32_t)checksumCrc16CittTbl[7][result >> 8U] ^
+             (uint32_t)checksumCrc16CittTbl[6][result & 0xFFU] ^
+             (uint32_t)checksumCrc16CittTbl[5][data[idx + 2U]] ^
+             (uint32_t)checksumCrc16CittTbl[4][data[idx + 3U]] ^
+             (uint32_t)checksumCrc16CittTbl[3][data[idx + 4U]] ^
+             (uint32_t)checksumCrc16CittTbl[2][data[idx + 5U]] ^
+             (uint32_t)checksumCrc16CittTbl[1][data[idx + 6U]] ^
+             (uint32_t)checksumCrc16CittTbl[0][data[idx + 7U]];
+    idx += 8U;
+  }
+  /* Process the remaining bytes one at a time. */
+  for (; idx < len; idx++)
+  {
+    result = ((result << 8U) & 0xFFFFU) ^
+             (uint32_t)checksumCrc16CittTbl[0][(result >> 8U) ^ data[idx]];
+  }
+#else
+  uint8_t  bitIdx;
+
+  /* Process the bytes one bit at a time, most significant bit first. */
+  for (; idx < len; idx++)
+  {
+    result ^= (uint32_t)data[idx] << 8U;
+    for (bitIdx = 0U; bitIdx < 8U; bitIdx++)
+    {
+      result = ((result & 0x8000U) != 0U) ? ((result << 1U) ^ 0x1021U) : (result << 1U);
+    }
+    result &= 0xFFFFU;
+  }
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumUpdateCrc16Citt ***/
+
+
+/************************************************************************************//**
+** \brief     Continues the calculation of the CRC32 checksum type with a chunk of data.
+** \param     crc Intermediate CRC value, so before the final XOR.
+** \param     data Pointer to the byte array with data.
+** \param     len Number of bytes in the data.
+** \return    The updated intermediate CRC value.
+**
+****************************************************************************************/
+static uint32_t ChecksumUpdateCrc32(uint32_t crc, uint8_t const * data, uint32_t len)
+{
+  uint32_t result = crc;
+  uint32_t idx = 0U;
+#if (CHECKSUM_CRC_TABLE_ENABLE > 0U)
+  uint32_t blockCnt;
+  uint32_t high;
+
+  /* Process 8 bytes at a time with the slicing-by-8 tables. The bytes are assembled
+   * into words one at a time, so the data does not have to be aligned and the byte
+   * order of the CPU does not matter.
+   */
+  for (blockCnt = len / 8U; blockCnt > 0U; blockCnt--)
+  {
+    result ^= (uint32_t)data[idx] | ((uint32_t)data[idx + 1U] << 8U) |
+              ((uint32_t)data[idx + 2U] << 16U) | ((uint32_t)data[idx + 3U] << 24U);
+    high = (uint32_t)data[idx + 4U] | ((uint32_t)data[idx + 5U] << 8U) |
+           ((uint32_t)data[idx + 6U] << 16U) | ((uint32_t)data[idx + 7U] << 24U);
+    result = checksumCrc32Tbl[7][result & 0xFFU] ^
+             checksumCrc32Tbl[6][(result >> 8U) & 0xFFU] ^
+             checksumCrc32Tbl[5][(result >> 16U) & 0xFFU] ^
+             checksumCrc32Tbl[4][result >> 24U] ^
+             checksumCrc32Tbl[3][high & 0xFFU] ^
+             checksumCrc32Tbl[2][(high >> 8U) & 0xFFU] ^
+             checksumCrc32Tbl[1][(high >> 16U) & 0xFFU] ^
+             checksumCrc32Tbl[0][high >> 24U];
+    idx += 8U;
+  }
+  /* Process the remaining bytes one at a time. */
+  for (; idx < len; idx++)
+  {
+    result = (result >> 8U) ^ checksumCrc32Tbl[0][(result ^ data[idx]) & 0xFFU];
+  }
+#else
+  uint8_t  bitIdx;
+
+  /* Process the bytes one bit at a time, with the reflected polynomial. */
+  for (; idx < len; idx++)
+  {
+    result ^= data[idx];
+    for (bitIdx = 0U; bitIdx < 8U; bitIdx++)
+    {
+      result = ((result & 1U) != 0U) ? ((result >> 1U) ^ 0xEDB88320UL) : (result >> 1U);
+    }
+  }
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of ChecksumUpdateCrc32 ***/
+
+
+/*********************************** end of checksum.c *********************************/
@@ -0,0 +1,139 @@
+/************************************************************************************//**
+* \file         checksum.h
+* \brief        Checksum module header file.
+* \ingroup      Checksum
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Checksum Checksum Module
+* \brief      Module with functionality to calculate the checksums that a bootloader can
+*             build over its memory.
+* \ingroup    Library
+* \details
+* The Checksum module calculates the same checksums that the XCP BUILD_CHECKSUM command
+* supports, over data that is fed to it in chunks of arbitrary length. This makes it
+* possible to calculate the checksum of firmware data locally and to compare it with
+* the checksum that the bootloader calculated over the data in its memory.
+****************************************************************************************/
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Enables the table driven calculation of the CRC checksum types. It processes
+ *         8 bytes at a time with the slicing-by-8 algorithm, which is many times faster
+ *         than the bitwise calculation. The tables do take up 16 kB of constant data.
+ *         Set it to 0 to use the bitwise calculation instead.
+ */
+#ifndef CHECKSUM_CRC_TABLE_ENABLE
+#define CHECKSUM_CRC_TABLE_ENABLE      (1U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/* The values of the checksum types match the ones of the XCP BUILD_CHECKSUM command. */
+/** \brief Adds all bytes into a byte. */
+#define CHECKSUM_TYPE_ADD_11           ((uint8_t)0x01U)
+
+/** \brief Adds all bytes into a 16-bit word. */
+#define CHECKSUM_TYPE_ADD_12           ((uint8_t)0x02U)
+
+/** \brief Adds all bytes into a 32-bit word. */
+#define CHECKSUM_TYPE_ADD_14           ((uint8_t)0x03U)
+
+/** \brief Adds all 16-bit words into a 16-bit word. */
+#define CHECKSUM_TYPE_ADD_22           ((uint8_t)0x04U)
+
+/** \brief Adds all 16-bit words into a 32-bit word. */
+#define CHECKSUM_TYPE_ADD_24           ((uint8_t)0x05U)
+
+/** \brief Adds all 32-bit words into a 32-bit word. */
+#define CHECKSUM_TYPE_ADD_44           ((uint8_t)0x06U)
+
+/** \brief CRC16 with polynomial 0x8005, reflected, initial value 0x0000. */
+#define CHECKSUM_TYPE_CRC_16           ((uint8_t)0x07U)
+
+/** \brief CRC16 CCITT with polynomial 0x1021, initial value 0xFFFF. */
+#define CHECKSUM_TYPE_CRC_16_CITT      ((uint8_t)0x08U)
+
+/** \brief CRC32 with polynomial 0x04C11DB7, reflected, initial value 0xFFFFFFFF. */
+#define CHECKSUM_TYPE_CRC_32           ((uint8_t)0x09U)
+
+/** \brief Flag that can be combined with the ADD_22, ADD_24 and ADD_44 checksum types.
+ *         When set, the words are stored in big endian (Motorola) byte order. Otherwise
+ *         in little endian (Intel) byte order.
+ */
+#define CHECKSUM_TYPE_BIG_ENDIAN       ((uint8_t)0x80U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Checksum calculation context. */
+typedef struct
+{
+  /** \brief Checksum type, including a possible CHECKSUM_TYPE_BIG_ENDIAN flag. */
+  uint8_t  type;
+  /** \brief Intermediate checksum value. */
+  uint32_t value;
+  /** \brief Bytes of a word that was not yet complete at the end of the previous data
+   *         chunk. Only used by the checksum types that add words.
+   */
+  uint8_t  word[4];
+  /** \brief Number of bytes in the incomplete word. */
+  uint8_t  wordLen;
+  /** \brief Port with the optional CrcCalculate hook, or NULL to always calculate the
+   *         CRC in software.
+   */
+  tPort const * port;
+} tChecksum;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+uint8_t  ChecksumInit(tChecksum * checksum, uint8_t type, tPort const * port);
+void     ChecksumUpdate(tChecksum * checksum, uint8_t const * data, uint32_t len);
+uint32_t ChecksumGetResult(tChecksum const * checksum);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_H */
+/*********************************** end of checksum.h *********************************/
@@ -0,0 +1,661 @@
+/************************************************************************************//**
+* \file         delta.c
+* \brief        Differential update source file.
+* \ingroup      Delta
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
+#include "session.h"                        /* Communication session module            */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "checksum.h"                       /* Checksum module                         */
+#include "delta.h"                          /* Differential update module              */
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Delta context that groups all the information of a differential firmware
+ *         update.
+ */
+struct t_delta_context
+{
+  /** \brief Session context of the target that is being updated. */
+  tSessionContext  * session;
+  /** \brief Firmware context of the firmware file that is being programmed. */
+  tFirmwareContext * firmware;
+  /** \brief Total number of firmware data bytes in the sectors processed so far. Bytes
+   *         of a sector that is processed more than once, are only counted once.
+   */
+  uint32_t           coveredBytes;
+  /** \brief Address after the last byte of the sectors processed so far. */
+  uint32_t           coveredEnd;
+  /** \brief Buffer for reading firmware data from the file. */
+  uint8_t            buffer[DELTA_BUFFER_SIZE];
+};
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t  DeltaCompareSector(tDeltaContext * context, uint32_t address,
+                                   uint32_t size, uint8_t * match);
+static uint32_t DeltaFindSegment(tDeltaContext * context, uint32_t address);
+static uint8_t  DeltaGetOverlap(tDeltaContext * context, uint32_t segmentIdx,
+                                uint32_t address, uint32_t sectorEnd,
+                                uint32_t * overlapStart, uint32_t * overlapEnd);
+static uint8_t  DeltaCalculateChecksum(tDeltaContext * context, uint32_t address,
+                                       uint32_t size, uint32_t segmentIdx,
+                                       tChecksum * checksum);
+static void     DeltaFillChecksum(tDeltaContext * context, uint32_t len,
+                                  tChecksum * checksum);
+static uint8_t  DeltaProgramSector(tDeltaContext * context, uint32_t address,
+                                   uint32_t size, uint32_t segmentIdx);
+
+
+/************************************************************************************//**
+** \brief     Creates a delta context. Each differential firmware update that is in
+**            progress at the same time, needs its own delta context. The context is
+**            allocated from the memory pool.
+** \return    Pointer to the delta context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tDeltaContext * DeltaCreate(void)
+{
+  tDeltaContext * result;
+
+  /* Attempt to allocate the context. */
+  result = TbxMemPoolAllocate(sizeof(tDeltaContext));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (result == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tDeltaContext));
+    /* Allocation should now work. */
+    result = TbxMemPoolAllocate(sizeof(tDeltaContext));
+  }
+
+  /* Only continue if the context was allocated. */
+  if (result != NULL)
+  {
+    /* Initialize the context. It is not linked to any session or firmware yet. */
+    result->session = NULL;
+    result->firmware = NULL;
+    result->coveredBytes = 0U;
+    result->coveredEnd = 0U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a delta context.
+** \param     context The delta context, as created by DeltaCreate().
+**
+****************************************************************************************/
+void DeltaDestroy(tDeltaContext * context)
+{
+  /* Verify the delta context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid delta context. */
+  if (context != NULL)
+  {
+    /* Give the context back to the memory pool. */
+    TbxMemPoolRelease(context);
+  }
+} /*** end of DeltaDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Starts a differential firmware update. Make sure the firmware file is
+**            opened and the session is started, before calling this function. Next,
+**            call DeltaUpdateSector() for each flash sector on the target and finally
+**            DeltaStop().
+** \param     context The delta context, as created by DeltaCreate().
+** \param     session The session context of the target.
+** \param     firmware The firmware context of the firmware file.
+**
+****************************************************************************************/
+void DeltaStart(tDeltaContext * context, tSessionContext * session,
+                tFirmwareContext * firmware)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (session != NULL) && (firmware != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (session != NULL) && (firmware != NULL))
+  {
+    /* Store the contexts to operate on. */
+    context->session = session;
+    context->firmware = firmware;
+    /* Reset the number of firmware data bytes in the processed sectors. */
+    context->coveredBytes = 0U;
+    context->coveredEnd = 0U;
+  }
+} /*** end of DeltaStart ***/
+
+
+/************************************************************************************//**
+** \brief     Updates a flash sector on the target, but only if its contents differ
+**            from the firmware data in the sector. For this purpose the bootloader is
+**            requested to build checksums over the sector, which are then compared with
+**            the checksums of the firmware data in the sector. The checksum type is the
+**            one that the bootloader selected. If the bootloader cannot build the
+**            checksums, the sector is updated unconditionally. Process the sectors in
+**            the order of increasing address.
+** \param     context The delta context, as created by DeltaCreate().
+** \param     address Start address of the sector. It must be the start address of a
+**            sector in the target's flash memory.
+** \param     size Size of the sector in bytes. It must be the size of the sector in the
+**            target's flash memory, because the entire sector is erased upon update.
+** \return    DELTA_STATUS_UNCHANGED if the sector's contents already matched the
+**            firmware data or the sector does not hold firmware data,
+**            DELTA_STATUS_UPDATED if the sector was erased and programmed,
+**            DELTA_STATUS_FORCED if the sector was erased and programmed, because the
+**            bootloader could not build the checksums, DELTA_STATUS_ERROR in case of
+**            an error.
+**
+****************************************************************************************/
+uint8_t DeltaUpdateSector(tDeltaContext * context, uint32_t address, uint32_t size)
+{
+  uint8_t   result = DELTA_STATUS_ERROR;
+  uint32_t  sectorEnd;
+  uint32_t  segmentIdx;
+  uint32_t  coveredBytes = 0U;
+  uint32_t  newBytes = 0U;
+  uint32_t  overlapStart = 0U;
+  uint32_t  overlapEnd = 0U;
+  uint8_t   checksumValid;
+  uint8_t   checksumMatch = TBX_FALSE;
+
+  /* Verify parameters. Note that the sector end is the address after the sector, so
+   * the sector cannot include the last byte of the 32-bit address space.
+   */
+  TBX_ASSERT((context != NULL) && (size > 0U) && (address <= (0xFFFFFFFFU - size)));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (size > 0U) && (address <= (0xFFFFFFFFU - size)))
+  {
+    /* Set a positive result and only negate upon error detection from here on. */
+    result = DELTA_STATUS_UNCHANGED;
+    sectorEnd = address + size;
+
+    /* Determine the number of firmware data bytes in the sector and how many of them
+     * are located after the sectors that were already processed. Only the latter count
+     * towards the covered firmware data, such that processing a sector twice does not
+     * make up for a sector that was skipped.
+     */
+    segmentIdx = DeltaFindSegment(context, address);
+    while (DeltaGetOverlap(context, segmentIdx, address, sectorEnd, &overlapStart,
+                           &overlapEnd) == TBX_TRUE)
+    {
+      coveredBytes += overlapEnd - overlapStart;
+      if (overlapEnd > context->coveredEnd)
+      {
+        if (overlapStart < context->coveredEnd)
+        {
+          overlapStart = context->coveredEnd;
+        }
+        newBytes += overlapEnd - overlapStart;
+      }
+      segmentIdx++;
+    }
+
+    /* Only process the sector if it actually holds firmware data. */
+    if (coveredBytes > 0U)
+    {
+      segmentIdx = DeltaFindSegment(context, address);
+      /* Compare the sector's contents on the target with its firmware data. */
+      checksumValid = DeltaCompareSector(context, address, size, &checksumMatch);
+      /* Erase and program the sector, if its contents differ from the firmware data.
+       * This is also the case if the checksums could not be obtained.
+       */
+      if ((checksumValid != TBX_OK) || (checksumMatch == TBX_FALSE))
+      {
+        if (DeltaProgramSector(context, address, size, segmentIdx) != TBX_OK)
+        {
+          result = DELTA_STATUS_ERROR;
+        }
+        else if (checksumValid != TBX_OK)
+        {
+          result = DELTA_STATUS_FORCED;
+        }
+        else
+        {
+          result = DELTA_STATUS_UPDATED;
+        }
+      }
+      /* Keep track of the firmware data bytes, if the sector is now up-to-date. */
+      if (result != DELTA_STATUS_ERROR)
+      {
+        context->coveredBytes += newBytes;
+        if (sectorEnd > context->coveredEnd)
+        {
+          context->coveredEnd = sectorEnd;
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaUpdateSector ***/
+
+
+/************************************************************************************//**
+** \brief     Stops a differential firmware update. It verifies that the sectors that
+**            were processed with DeltaUpdateSector() covered all firmware data. This
+**            requires the sectors to be processed in the order of increasing address.
+** \param     context The delta context, as created by DeltaCreate().
+** \return    TBX_OK if all firmware data is now present on the target, TBX_ERROR
+**            otherwise.
+**
+****************************************************************************************/
+uint8_t DeltaStop(tDeltaContext * context)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t totalBytes = 0U;
+  uint32_t segmentCount;
+  uint32_t segmentIdx;
+  uint32_t segmentAddress = 0U;
+
+  /* Verify the delta context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid delta context. */
+  if (context != NULL)
+  {
+    /* Determine the total number of firmware data bytes. */
+    segmentCount = FirmwareSegmentGetCount(context->firmware);
+    for (segmentIdx = 0U; segmentIdx < segmentCount; segmentIdx++)
+    {
+      totalBytes += FirmwareSegmentGetInfo(context->firmware, segmentIdx,
+                                           &segmentAddress);
+    }
+    /* All firmware data is present on the target, if the processed sectors covered
+     * all of it.
+     */
+    if (context->coveredBytes == totalBytes)
+    {
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaStop ***/
+
+
+/************************************************************************************//**
+** \brief     Compares the contents of a sector on the target with the firmware data in
+**            the sector. The sector is compared in blocks of at most DELTA_BLOCK_SIZE
+**            bytes, to limit the time that the bootloader needs to build one checksum.
+**            For each block, the bootloader is first requested to build its checksum,
+**            such that the local checksum can be calculated with the same checksum type.
+**            Comparing stops at the first block that differs.
+** \param     context The delta context.
+** \param     address Start address of the sector.
+** \param     size Size of the sector in bytes.
+** \param     match TBX_TRUE is written to this pointer if all blocks match, TBX_FALSE
+**            otherwise.
+** \return    TBX_OK if the checksums could be obtained, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t DeltaCompareSector(tDeltaContext * context, uint32_t address,
+                                  uint32_t size, uint8_t * match)
+{
+  uint8_t   result = TBX_OK;
+  uint32_t  sectorEnd;
+  uint32_t  blockAddress;
+  uint32_t  blockLen;
+  uint8_t   checksumType = 0U;
+  uint32_t  checksumTarget = 0U;
+  tChecksum checksumLocal;
+
+  /* Verify parameter. */
+  TBX_ASSERT(match != NULL);
+
+  sectorEnd = address + size;
+  blockAddress = address;
+  *match = TBX_TRUE;
+  /* Compare the sector block by block, until a difference is detected. */
+  while ((result == TBX_OK) && (*match == TBX_TRUE) && (blockAddress < sectorEnd))
+  {
+    blockLen = sectorEnd - blockAddress;
+    if ((DELTA_BLOCK_SIZE > 0U) && (blockLen > DELTA_BLOCK_SIZE))
+    {
+      blockLen = DELTA_BLOCK_SIZE;
+    }
+    /* Request the checksum of the block from the target and calculate the checksum of
+     * the block's firmware data, using the same checksum type. The target can build the
+     * checksum over less bytes than requested, which then determines the block size.
+     */
+    if (SessionBuildChecksum(context->session, blockAddress, &blockLen, &checksumType,
+                             &checksumTarget) != TBX_OK)
+    {
+      /* Flag the error. */
+      result = TBX_ERROR;
+    }
+    else if (ChecksumInit(&checksumLocal, checksumType,
+                               SessionGetPort(context->session)) != TBX_OK)
+    {
+      /* Flag the error. */
+      result = TBX_ERROR;
+    }
+    else if (DeltaCalculateChecksum(context, blockAddress, blockLen,
+                                    DeltaFindSegment(context, blockAddress),
+                                    &checksumLocal) != TBX_OK)
+    {
+      /* Flag the error. */
+      result = TBX_ERROR;
+    }
+    else if (ChecksumGetResult(&checksumLocal) != checksumTarget)
+    {
+      /* Contents of the block differ from the firmware data. */
+      *match = TBX_FALSE;
+    }
+    else
+    {
+      blockAddress += blockLen;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaCompareSector ***/
+
+
+/************************************************************************************//**
+** \brief     Finds the first firmware segment that ends after the specified address.
+**            Firmware segments are sorted by address and do not overlap, so a binary
+**            search is used.
+** \param     context The delta context.
+** \param     address Memory address.
+** \return    Index of the segment, or the number of segments if no segment ends after
+**            the specified address.
+**
+****************************************************************************************/
+static uint32_t DeltaFindSegment(tDeltaContext * context, uint32_t address)
+{
+  uint32_t low = 0U;
+  uint32_t high;
+  uint32_t mid;
+  uint32_t segmentAddress = 0U;
+  uint32_t segmentLen;
+
+  /* Search for the first segment whose end address is greater than the address. */
+  high = FirmwareSegmentGetCount(context->firmware);
+  while (low < high)
+  {
+    mid = low + ((high - low) / 2U);
+    segmentLen = FirmwareSegmentGetInfo(context->firmware, mid, &segmentAddress);
+    if ((segmentAddress + segmentLen) <= address)
+    {
+      low = mid + 1U;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return low;
+} /*** end of DeltaFindSegment ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the part of a firmware segment that is located in a sector.
+** \param     context The delta context.
+** \param     segmentIdx Index of the segment. It must be a segment that ends after the
+**            sector start, or the number of segments.
+** \param     address Start address of the sector.
+** \param     sectorEnd Address after the last byte of the sector.
+** \param     overlapStart Start address of the part is written to this pointer.
+** \param     overlapEnd Address after the last byte of the part is written to this
+**            pointer.
+** \return    TBX_TRUE if the segment exists and is located in the sector, TBX_FALSE
+**            otherwise.
+**
+****************************************************************************************/
+static uint8_t DeltaGetOverlap(tDeltaContext * context, uint32_t segmentIdx,
+                               uint32_t address, uint32_t sectorEnd,
+                               uint32_t * overlapStart, uint32_t * overlapEnd)
+{
+  uint8_t  result = TBX_FALSE;
+  uint32_t segmentAddress = 0U;
+  uint32_t segmentLen;
+
+  /* Verify parameters. */
+  TBX_ASSERT((overlapStart != NULL) && (overlapEnd != NULL));
+
+  /* Only continue with valid parameters and an existing segment. */
+  if ((overlapStart != NULL) && (overlapEnd != NULL) &&
+      (segmentIdx < FirmwareSegmentGetCount(context->firmware)))
+  {
+    segmentLen = FirmwareSegmentGetInfo(context->firmware, segmentIdx, &segmentAddress);
+    /* Only located in the sector if the segment starts before the sector end. */
+    if (segmentAddress < sectorEnd)
+    {
+      *overlapStart = (segmentAddress > address) ? segmentAddress : address;
+      *overlapEnd = ((segmentAddress + segmentLen) < sectorEnd) ?
+                    (segmentAddress + segmentLen) : sectorEnd;
+      result = TBX_TRUE;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaGetOverlap ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the checksum over the contents that a block of the sector
+**            should have. This is the firmware data in the block, with the bytes that
+**            are not covered by firmware data set to the erased value.
+** \param     context The delta context.
+** \param     address Start address of the block.
+** \param     size Size of the block in bytes.
+** \param     segmentIdx Index of the first segment that ends after the block start.
+** \param     checksum Initialized checksum context to update.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t DeltaCalculateChecksum(tDeltaContext * context, uint32_t address,
+                                      uint32_t size, uint32_t segmentIdx,
+                                      tChecksum * checksum)
+{
+  uint8_t  result = TBX_OK;
+  uint32_t sectorEnd;
+  uint32_t currentAddress;
+  uint32_t overlapStart = 0U;
+  uint32_t overlapEnd = 0U;
+  uint32_t chunkLen;
+
+  /* Verify parameter. */
+  TBX_ASSERT(checksum != NULL);
+
+  sectorEnd = address + size;
+  currentAddress = address;
+  /* Process the firmware data of all segments located in the sector. */
+  while ((result == TBX_OK) &&
+         (DeltaGetOverlap(context, segmentIdx, address, sectorEnd, &overlapStart,
+                          &overlapEnd) == TBX_TRUE))
+  {
+    /* Bytes in the gap before the segment have the erased value. */
+    DeltaFillChecksum(context, overlapStart - currentAddress, checksum);
+    currentAddress = overlapStart;
+    /* Add the firmware data. */
+    while ((currentAddress < overlapEnd) && (result == TBX_OK))
+    {
+      chunkLen = overlapEnd - currentAddress;
+      if (chunkLen > DELTA_BUFFER_SIZE)
+      {
+        chunkLen = DELTA_BUFFER_SIZE;
+      }
+      if (FirmwareReadAt(context->firmware, currentAddress, chunkLen,
+                         context->buffer) == TBX_OK)
+      {
+        ChecksumUpdate(checksum, context->buffer, chunkLen);
+        currentAddress += chunkLen;
+      }
+      else
+      {
+        /* Could not read the firmware data. Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+    segmentIdx++;
+  }
+  /* Bytes after the last segment have the erased value. */
+  if (result == TBX_OK)
+  {
+    DeltaFillChecksum(context, sectorEnd - currentAddress, checksum);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaCalculateChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Updates the checksum with bytes that have the erased value.
+** \param     context The delta context.
+** \param     len Number of bytes.
+** \param     checksum Initialized checksum context to update.
+**
+****************************************************************************************/
+static void DeltaFillChecksum(tDeltaContext * context, uint32_t len,
+                              tChecksum * checksum)
+{
+  uint32_t idx;
+  uint32_t remaining = len;
+  uint32_t chunkLen;
+
+  /* Verify parameter. */
+  TBX_ASSERT(checksum != NULL);
+
+  /* Only continue if there is something to add. */
+  if (len > 0U)
+  {
+    /* Fill the buffer with erased values. */
+    for (idx = 0U; idx < DELTA_BUFFER_SIZE; idx++)
+    {
+      context->buffer[idx] = DELTA_ERASED_VALUE;
+    }
+    /* Add the erased values to the checksum, one buffer at a time. */
+    while (remaining > 0U)
+    {
+      chunkLen = (remaining < DELTA_BUFFER_SIZE) ? remaining : DELTA_BUFFER_SIZE;
+      ChecksumUpdate(checksum, context->buffer, chunkLen);
+      remaining -= chunkLen;
+    }
+  }
+} /*** end of DeltaFillChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Erases the sector on the target and programs the firmware data that is
+**            located in the sector.
+** \param     context The delta context.
+** \param     address Start address of the sector.
+** \param     size Size of the sector in bytes.
+** \param     segmentIdx Index of the first segment that ends after the sector start.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t DeltaProgramSector(tDeltaContext * context, uint32_t address,
+                                  uint32_t size, uint32_t segmentIdx)
+{
+  uint8_t  result = TBX_OK;
+  uint32_t sectorEnd;
+  uint32_t currentAddress;
+  uint32_t overlapStart = 0U;
+  uint32_t overlapEnd = 0U;
+  uint32_t chunkLen;
+
+  sectorEnd = address + size;
+  /* Erase the entire sector. */
+  if (SessionClearMemory(context->session, address, size) != TBX_OK)
+  {
+    /* Flag the error. */
+    result = TBX_ERROR;
+  }
+
+  /* Program the firmware data of all segments located in the sector. */
+  while ((result == TBX_OK) &&
+         (DeltaGetOverlap(context, segmentIdx, address, sectorEnd, &overlapStart,
+                          &overlapEnd) == TBX_TRUE))
+  {
+    currentAddress = overlapStart;
+    while ((currentAddress < overlapEnd) && (result == TBX_OK))
+    {
+      chunkLen = overlapEnd - currentAddress;
+      if (chunkLen > DELTA_BUFFER_SIZE)
+      {
+        chunkLen = DELTA_BUFFER_SIZE;
+      }
+      if (FirmwareReadAt(context->firmware, currentAddress, chunkLen,
+                         context->buffer) != TBX_OK)
+      {
+        /* Could not read the firmware data. Flag the error. */
+        result = TBX_ERROR;
+      }
+      else if (SessionWriteData(context->session, currentAddress, chunkLen,
+                                context->buffer) != TBX_OK)
+      {
+        /* Could not program the firmware data. Flag the error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        currentAddress += chunkLen;
+      }
+    }
+    segmentIdx++;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of DeltaProgramSector ***/
+
+
+/*********************************** end of delta.c ************************************/
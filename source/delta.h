@@ -0,0 +1,138 @@
+/************************************************************************************//**
+* \file         delta.h
+* \brief        Differential update header file.
+* \ingroup      Delta
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Delta Differential Update Module
+* \brief      Module with functionality to only update the sectors on the target, whose
+*             contents differ from the firmware file.
+* \ingroup    Library
+* \details
+* The Differential Update module requests the bootloader to build a checksum over the
+* contents of a flash sector and compares it with the checksum that it calculates
+* locally over the firmware data of the same sector. Only if the checksums differ, the
+* sector is erased and its firmware data is programmed. For firmware updates that only
+* change a small part of the firmware, this significantly reduces the update time.
+*
+* Sectors are compared in blocks of at most DELTA_BLOCK_SIZE bytes, with one checksum
+* request per block. If the bootloader cannot build a checksum, the sector is erased and
+* programmed anyway and DeltaUpdateSector() reports this with DELTA_STATUS_FORCED.
+*
+* The sectors passed to DeltaUpdateSector() must match the sectors of the target's flash
+* memory, because a sector is erased as a whole. Bytes inside a sector that are not
+* covered by firmware data are expected to have the erased value DELTA_ERASED_VALUE.
+* Process the sectors in the order of increasing address. DeltaStop() relies on this to
+* verify that the processed sectors covered all firmware data.
+*
+* All information about a differential firmware update is stored in a delta context, so
+* differential firmware updates of multiple targets can be in progress at the same time.
+****************************************************************************************/
+#ifndef DELTA_H
+#define DELTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Size of the buffer for reading firmware data from the file, while calculating
+ *         the checksum and programming the data of a sector.
+ */
+#ifndef DELTA_BUFFER_SIZE
+#define DELTA_BUFFER_SIZE              (256U)
+#endif
+
+/** \brief Maximum number of bytes that the bootloader builds a checksum over, with one
+ *         request. Sectors that are larger are compared in multiple blocks, which keeps
+ *         the time that the bootloader needs to build one checksum well within its
+ *         response timeout. Set it to 0 to compare each sector with a single request.
+ *         Note that for the checksum types that add words, the bootloader typically
+ *         requires the block size to be a multiple of the word size.
+ */
+#ifndef DELTA_BLOCK_SIZE
+#define DELTA_BLOCK_SIZE               (4096U)
+#endif
+
+/** \brief Value of a byte in erased flash memory on the target. */
+#ifndef DELTA_ERASED_VALUE
+#define DELTA_ERASED_VALUE             ((uint8_t)0xFFU)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Status of a sector whose contents already matched the firmware file. */
+#define DELTA_STATUS_UNCHANGED         ((uint8_t)0U)
+
+/** \brief Status of a sector that was erased and programmed. */
+#define DELTA_STATUS_UPDATED           ((uint8_t)1U)
+
+/** \brief Status of a sector that could not be updated, due to an error. */
+#define DELTA_STATUS_ERROR             ((uint8_t)2U)
+
+/** \brief Status of a sector that was erased and programmed without comparing its
+ *         contents, because the bootloader could not build a checksum.
+ */
+#define DELTA_STATUS_FORCED            ((uint8_t)3U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Delta context. It groups all the information of a differential firmware
+ *         update, such that multiple differential firmware updates can be in progress
+ *         at the same time. Its layout is private to the differential update module.
+ */
+typedef struct t_delta_context tDeltaContext;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tDeltaContext * DeltaCreate(void);
+void            DeltaDestroy(tDeltaContext * context);
+void            DeltaStart(tDeltaContext * context, tSessionContext * session,
+                           tFirmwareContext * firmware);
+uint8_t         DeltaUpdateSector(tDeltaContext * context, uint32_t address,
+                                  uint32_t size);
+uint8_t         DeltaStop(tDeltaContext * context);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DELTA_H */
+/*********************************** end of delta.h ************************************/
@@ -36,79 +36,280 @@
 * Include files
 ****************************************************************************************/
 #include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
 #include "firmware.h"                       /* Firmware reader module                  */
+#include "checksum.h"                       /* Checksum module                         */
+#include "stats.h"                          /* Statistics module                       */
 
 
 /****************************************************************************************
-* Local data declarations
+* Configuration check
 ****************************************************************************************/
-/** \brief Pointer to the firmware reader that is linked. */
-static tFirmwareReader const * readerPtr = NULL;
+#if (FIRMWARE_CHUNK_SIZE > 65535U)
+#error "FIRMWARE_CHUNK_SIZE must fit in 16 bits"
+#endif
+
+#if (FIRMWARE_CHUNK_ALIGNMENT > FIRMWARE_CHUNK_SIZE) && (FIRMWARE_CHUNK_SIZE > 0U)
+#error "FIRMWARE_CHUNK_ALIGNMENT must not be larger than FIRMWARE_CHUNK_SIZE"
+#endif
+
+#if (FIRMWARE_GAP_FILL_BYTE > 255U)
+#error "FIRMWARE_GAP_FILL_BYTE must fit in 8 bits"
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Maximum number of fill bytes in a chunk of firmware data, that outputs the gap
+ *         between two merged segments. Larger gaps are output in multiple chunks.
+ */
+#define FIRMWARE_GAP_FILL_CHUNK_SIZE   (64U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Information for combining the chunks of firmware data that the firmware file
+ *         reader outputs, into chunks of the configured size and alignment.
+ */
+typedef struct
+{
+  /** \brief Configured chunk size. Zero to pass the reader's chunks on unchanged. */
+  uint16_t        size;
+  /** \brief Configured alignment of the chunk boundaries. */
+  uint16_t        alignment;
+  /** \brief Buffer for combining the data of the reader's chunks. */
+  uint8_t       * buffer;
+  /** \brief Size of the allocated buffer. */
+  uint16_t        bufferSize;
+  /** \brief Not yet consumed data of the reader's last chunk. */
+  uint8_t const * srcData;
+  /** \brief Memory address of the not yet consumed data. */
+  uint32_t        srcAddress;
+  /** \brief Number of not yet consumed bytes. */
+  uint16_t        srcLen;
+  /** \brief TBX_TRUE when the reader reported the end of the segment. */
+  uint8_t         srcEnd;
+  /** \brief TBX_TRUE if the buffer could not be allocated. */
+  uint8_t         error;
+} tFirmwareChunker;
+
+/** \brief Information for merging the segments of the firmware file reader, that are
+ *         separated by small gaps, into one segment. A merged segment is identified by
+ *         the index of the reader's first segment in it. Looking up this index is done
+ *         by scanning from the last looked up merged segment, which is fast when the
+ *         segments are accessed in order.
+ */
+typedef struct
+{
+  /** \brief Configured maximum gap size. Zero to pass the reader's segments on
+   *         unchanged.
+   */
+  uint32_t maxGap;
+  /** \brief Configured value of the bytes that fill a gap. */
+  uint8_t  fillByte;
+  /** \brief Chunk of fill bytes, for outputting a gap. */
+  uint8_t  fill[FIRMWARE_GAP_FILL_CHUNK_SIZE];
+  /** \brief Number of merged segments. */
+  uint32_t count;
+  /** \brief Index of the merged segment that SegmentGetInfo() looked up last. */
+  uint32_t infoIdx;
+  /** \brief Index of the reader's first segment in the merged segment infoIdx. */
+  uint32_t infoFirst;
+  /** \brief Index of the merged segment that SegmentOpen() looked up last. This is
+   *         separate from infoIdx, such that the segment information can be obtained,
+   *         while another task reads the firmware data.
+   */
+  uint32_t openIdx;
+  /** \brief Index of the reader's first segment in the merged segment openIdx. */
+  uint32_t openFirst;
+  /** \brief Index of the reader's segment that is currently read. */
+  uint32_t readIdx;
+  /** \brief Index of the reader's last segment in the opened merged segment. */
+  uint32_t readLast;
+  /** \brief Memory address of the gap bytes that still need to be output. */
+  uint32_t gapAddress;
+  /** \brief Number of gap bytes that still need to be output. */
+  uint32_t gapLen;
+} tFirmwareMerger;
+
+/** \brief Firmware context that groups all the information of a firmware file that is
+ *         being read.
+ */
+struct t_firmware_context
+{
+  /** \brief Pointer to the firmware reader that is linked. */
+  tFirmwareReader const * reader;
+  /** \brief Instance of the firmware reader, as created by its Create function. */
+  void                  * instance;
+  /** \brief Chunk information. */
+  tFirmwareChunker        chunker;
+  /** \brief Segment merging information. */
+  tFirmwareMerger         merger;
+  /** \brief Firmware context that owns the firmware file that this context shares, or
+   *         NULL if this context opened the firmware file itself.
+   */
+  tFirmwareContext      * image;
+  /** \brief Number of firmware contexts that currently share the firmware file of this
+   *         context.
+   */
+  uint32_t                shareCount;
+  /** \brief Total time spent reading and parsing the firmware file in ms. The firmware
+   *         context is not tied to a communication session, so the time is taken from
+   *         the port that was linked with PortInit().
+   */
+  uint32_t                parseTime;
+};
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void            FirmwareChunkerOpen(tFirmwareContext * context);
+static uint8_t const * FirmwareChunkerGetNextData(tFirmwareContext * context,
+                                                  uint32_t * address, uint16_t * len);
+static uint16_t        FirmwareChunkerGetLimit(tFirmwareChunker const * chunker,
+                                               uint32_t address);
+static void            FirmwareMergerReset(tFirmwareContext * context);
+static uint32_t        FirmwareMergerGetLast(tFirmwareContext * context,
+                                             uint32_t first);
+static uint32_t        FirmwareMergerFind(tFirmwareContext * context, uint32_t idx,
+                                          uint32_t * cacheIdx, uint32_t * cacheFirst);
+static uint8_t const * FirmwareMergerGetNextData(tFirmwareContext * context,
+                                                 uint32_t * address, uint16_t * len);
+static uint8_t         FirmwareMergerReadAt(tFirmwareContext * context,
+                                            uint32_t address, uint32_t len,
+                                            uint8_t * data);
 
 
 /************************************************************************************//**
-** \brief     Initializes the module.
+** \brief     Creates a firmware context for the specified firmware file reader. The
+**            context is allocated from the memory pool.
 ** \param     reader The firmware file reader to link.
+** \return    Pointer to the firmware context if successful, NULL otherwise.
 **
 ****************************************************************************************/
-void FirmwareInit(tFirmwareReader const * reader)
+tFirmwareContext * FirmwareCreate(tFirmwareReader const * reader)
 {
+  tFirmwareContext * result = NULL;
+
   /* Verify parameter. */
   TBX_ASSERT(reader != NULL);
 
   /* Only continue with valid parameter. */
   if (reader != NULL)
   {
-    /* Link the firmware reader. */
-    readerPtr = reader;
-    /* Verify the reader's function pointer. */
-    TBX_ASSERT(readerPtr->Init != NULL);
-    /* Only continue with a valid function pointer. */
-    if (readerPtr->Init != NULL)
+    /* Verify the reader's function pointers. */
+    TBX_ASSERT((reader->Create != NULL) && (reader->Destroy != NULL));
+    /* Only continue with valid function pointers. */
+    if ((reader->Create != NULL) && (reader->Destroy != NULL))
     {
-      /* Initialize the reader. */
-      readerPtr->Init();
+      /* Attempt to allocate the context. */
+      result = TbxMemPoolAllocate(sizeof(tFirmwareContext));
+      /* Automatically create or increase the memory pool if it was too small. */
+      if (result == NULL)
+      {
+        /* No need to check the return value, because we'll attempt to allocate from
+         * the memory pool right way. That will tell us if the memory pool increase was
+         * successful.
+         */
+        (void)TbxMemPoolCreate(1U, sizeof(tFirmwareContext));
+        /* Allocation should now work. */
+        result = TbxMemPoolAllocate(sizeof(tFirmwareContext));
+      }
     }
   }
-} /*** end of FirmwareInit **/
+
+  /* Only continue if the context was allocated. */
+  if (result != NULL)
+  {
+    /* Initialize the chunk information. */
+    result->chunker.size = (uint16_t)FIRMWARE_CHUNK_SIZE;
+    result->chunker.alignment = (uint16_t)FIRMWARE_CHUNK_ALIGNMENT;
+    result->chunker.buffer = NULL;
+    result->chunker.bufferSize = 0U;
+    result->chunker.srcData = NULL;
+    result->chunker.srcAddress = 0U;
+    result->chunker.srcLen = 0U;
+    result->chunker.srcEnd = TBX_FALSE;
+    result->chunker.error = TBX_FALSE;
+    /* Initialize the sharing information. */
+    result->image = NULL;
+    result->shareCount = 0U;
+    result->parseTime = 0U;
+    /* Link the firmware reader and create its instance. */
+    result->reader = reader;
+    result->instance = reader->Create();
+    /* Clean up if the reader's instance could not be created. */
+    if (result->instance == NULL)
+    {
+      TbxMemPoolRelease(result);
+      result = NULL;
+    }
+    else
+    {
+      /* Initialize the segment merging information. */
+      FirmwareSetGapFill(result, FIRMWARE_GAP_FILL_MAX, (uint8_t)FIRMWARE_GAP_FILL_BYTE);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareCreate ***/
 
 
 /************************************************************************************//**
-** \brief     Terminates the module.
+** \brief     Releases a firmware context. A firmware file that is still opened, is
+**            closed first. This is refused, while other firmware contexts still share
+**            the firmware file of this firmware context.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \return    TBX_OK if successful, TBX_ERROR if the firmware context is still shared.
 **
 ****************************************************************************************/
-void FirmwareTerminate(void)
+uint8_t FirmwareDestroy(tFirmwareContext * context)
 {
-  /* Verify the firmware reader. */
-  TBX_ASSERT(readerPtr != NULL);
+  uint8_t result = TBX_ERROR;
+
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
 
-  /* Only continue with a valid firmware reader. */
-  if (readerPtr != NULL)
+  /* Only continue with a valid firmware context, that can be closed. Otherwise the
+   * firmware contexts that share its firmware file would access released memory.
+   */
+  if ((context != NULL) && (FirmwareFileClose(context) == TBX_OK))
   {
-    /* Verify the reader's function pointer. */
-    TBX_ASSERT(readerPtr->Terminate != NULL);
-    /* Only continue with a valid function pointer. */
-    if (readerPtr->Terminate != NULL)
+    result = TBX_OK;
+    /* Release the reader's instance. */
+    context->reader->Destroy(context->instance);
+    /* Give the chunk buffer back to the memory pool. */
+    if (context->chunker.buffer != NULL)
     {
-      /* Terminate the reader. */
-      readerPtr->Terminate();
+      TbxMemPoolRelease(context->chunker.buffer);
     }
-    /* Unlink the firmware reader. */
-    readerPtr = NULL;
+    /* Give the context back to the memory pool. */
+    TbxMemPoolRelease(context);
   }
-} /*** end of FirmwareTerminate ***/
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareDestroy ***/
 
 
 /************************************************************************************//**
 ** \brief     Opens the firmware file and browses through its contents to collect
-**            information about the firmware data segment it contains.
+**            information about the firmware data segment it contains. This is refused,
+**            while other firmware contexts still share the firmware file that this
+**            firmware context opened before.
+** \param     context The firmware context, as created by FirmwareCreate().
 ** \param     firmwareFile Firmware filename including its full path.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t FirmwareFileOpen(char const * firmwareFile)
+uint8_t FirmwareFileOpen(tFirmwareContext * context, char const * firmwareFile)
 {
-  uint8_t result = TBX_OK;
+  uint8_t  result = TBX_OK;
+  uint32_t startTime;
 
   /* Verify parameter. */
   TBX_ASSERT(firmwareFile != NULL);
@@ -116,19 +317,32 @@ uint8_t FirmwareFileOpen(char const * firmwareFile)
   /* Only continue with valid parameter. */
   if (firmwareFile != NULL)
   {
-    /* Verify the firmware reader. */
-    TBX_ASSERT(readerPtr != NULL);
+    /* Verify the firmware context. */
+    TBX_ASSERT(context != NULL);
 
-    /* Only continue with a valid firmware reader. */
-    if (readerPtr != NULL)
+    /* Only continue with a valid firmware context. */
+    if (context != NULL)
     {
       /* Verify the reader's function pointer. */
-      TBX_ASSERT(readerPtr->FileOpen != NULL);
+      TBX_ASSERT(context->reader->FileOpen != NULL);
       /* Only continue with a valid function pointer. */
-      if (readerPtr->FileOpen != NULL)
+      if (context->reader->FileOpen != NULL)
       {
-        /* Attempt to open the file. */
-        result = readerPtr->FileOpen(firmwareFile);
+        /* Make sure a possibly previously opened file is first closed. */
+        if (FirmwareFileClose(context) != TBX_OK)
+        {
+          /* Still shared, so the previously opened file must stay opened. */
+          result = TBX_ERROR;
+        }
+        else
+        {
+          /* Attempt to open the file. */
+          startTime = StatsGetTime(PortGet());
+          result = context->reader->FileOpen(context->instance, firmwareFile);
+          /* Determine the segments after merging. */
+          FirmwareMergerReset(context);
+          context->parseTime += StatsGetTime(PortGet()) - startTime;
+        }
       }
     }
   }
@@ -139,55 +353,271 @@ uint8_t FirmwareFileOpen(char const * firmwareFile)
 
 
 /************************************************************************************//**
-** \brief     Closes the previously opened firmware file.
+** \brief     Opens the firmware file that was already opened in another firmware
+**            context. The segment information is shared with the other firmware
+**            context, so the firmware file does not need to be scanned again. The
+**            firmware data is still read at its own file position. This way the same
+**            firmware file can be read for multiple nodes at the same time, while only
+**            paying the cost of scanning the firmware file once. The other firmware
+**            context must keep its firmware file opened, until all firmware contexts
+**            that share it, closed it again.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     image The firmware context that opened the firmware file. It must use the
+**            same firmware reader.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t FirmwareFileShare(tFirmwareContext * context, tFirmwareContext * image)
+{
+  uint8_t            result = TBX_ERROR;
+  tFirmwareContext * owner;
+
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (image != NULL) && (context != image));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (image != NULL) && (context != image))
+  {
+    /* Verify the firmware readers and the reader's function pointer. */
+    TBX_ASSERT((context->reader == image->reader) &&
+               (context->reader->FileShare != NULL));
+    /* Only continue with the same firmware reader and a valid function pointer. */
+    if ((context->reader == image->reader) && (context->reader->FileShare != NULL))
+    {
+      /* Make sure a possibly previously opened file is first closed. Attempt to share
+       * the file, if this worked.
+       */
+      if (FirmwareFileClose(context) == TBX_OK)
+      {
+        result = context->reader->FileShare(context->instance, image->instance);
+      }
+      /* Register the share with the firmware context that owns the file. */
+      if (result == TBX_OK)
+      {
+        owner = image;
+        if (image->image != NULL)
+        {
+          owner = image->image;
+        }
+        context->image = owner;
+        TbxCriticalSectionEnter();
+        owner->shareCount++;
+        TbxCriticalSectionExit();
+        /* Determine the segments after merging. */
+        FirmwareMergerReset(context);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareFileShare ***/
+
+
+/************************************************************************************//**
+** \brief     Closes the previously opened firmware file. This is refused, while other
+**            firmware contexts still share the firmware file. The firmware file then
+**            stays opened, because the other firmware contexts still use its segment
+**            information.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \return    TBX_OK if successful, TBX_ERROR if the firmware file is still shared.
 **
 ****************************************************************************************/
-void FirmwareFileClose(void)
+uint8_t FirmwareFileClose(tFirmwareContext * context)
 {
-  /* Verify the firmware reader. */
-  TBX_ASSERT(readerPtr != NULL);
+  uint8_t result = TBX_ERROR;
+
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
 
-  /* Only continue with a valid firmware reader. */
-  if (readerPtr != NULL)
+  /* Only continue with a valid firmware context that is not shared. */
+  if ((context != NULL) && (context->shareCount == 0U))
   {
+    result = TBX_OK;
     /* Verify the reader's function pointer. */
-    TBX_ASSERT(readerPtr->FileClose != NULL);
+    TBX_ASSERT(context->reader->FileClose != NULL);
     /* Only continue with a valid function pointer. */
-    if (readerPtr->FileClose != NULL)
+    if (context->reader->FileClose != NULL)
     {
       /* Close the file. */
-      readerPtr->FileClose();
+      context->reader->FileClose(context->instance);
+      /* There are no more segments to merge. */
+      FirmwareMergerReset(context);
+    }
+    /* Unregister the share with the firmware context that owns the file. */
+    if (context->image != NULL)
+    {
+      TbxCriticalSectionEnter();
+      context->image->shareCount--;
+      TbxCriticalSectionExit();
+      context->image = NULL;
     }
   }
+
+  /* Give the result back to the caller. */
+  return result;
 } /*** end of FirmwareFileClose ***/
 
 
+/************************************************************************************//**
+** \brief     Sets the memory address where the firmware data of a firmware file without
+**            address information should be programmed, such as a binary file without
+**            header. Only the firmware file readers that need it, use the base address.
+**            Should be called before opening the firmware file.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     address Base memory address of the firmware data.
+**
+****************************************************************************************/
+void FirmwareSetBaseAddress(tFirmwareContext * context, uint32_t address)
+{
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid firmware context. */
+  if (context != NULL)
+  {
+    /* Pass the base address on to the reader's instance, if the reader uses it. */
+    if (context->reader->SetBaseAddress != NULL)
+    {
+      context->reader->SetBaseAddress(context->instance, address);
+    }
+  }
+} /*** end of FirmwareSetBaseAddress ***/
+
+
+/************************************************************************************//**
+** \brief     Configures the size of the firmware data chunks that
+**            FirmwareSegmentGetNextData() outputs. The chunks of the firmware file
+**            reader are combined into chunks of this size. If an alignment is
+**            specified, the chunk boundaries are aligned to it, such that each chunk
+**            covers whole flash pages on the target. Only a segment's first and last
+**            chunk can be smaller. Should be called before opening a segment.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     chunkSize Chunk size in bytes. Zero to output the chunks exactly as the
+**            firmware file reader outputs them.
+** \param     alignment Alignment of the chunk boundaries, typically the flash page size
+**            of the target. Zero or one to not align the chunk boundaries. Cannot be
+**            larger than the chunk size.
+**
+****************************************************************************************/
+void FirmwareSetChunkSize(tFirmwareContext * context, uint16_t chunkSize,
+                          uint16_t alignment)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && ((chunkSize == 0U) || (alignment <= chunkSize)));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && ((chunkSize == 0U) || (alignment <= chunkSize)))
+  {
+    /* Store the chunk configuration. The buffer is (re)allocated when a segment is
+     * opened.
+     */
+    context->chunker.size = chunkSize;
+    context->chunker.alignment = alignment;
+  }
+} /*** end of FirmwareSetChunkSize ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the size of the firmware data chunks that
+**            FirmwareSegmentGetNextData() outputs, as configured with
+**            FirmwareSetChunkSize().
+** \param     context The firmware context, as created by FirmwareCreate().
+** \return    Chunk size in bytes. Zero if the chunks are output exactly as the firmware
+**            file reader outputs them.
+**
+****************************************************************************************/
+uint16_t FirmwareGetChunkSize(tFirmwareContext const * context)
+{
+  uint16_t result = 0U;
+
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid firmware context. */
+  if (context != NULL)
+  {
+    result = context->chunker.size;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareGetChunkSize ***/
+
+
+/************************************************************************************//**
+** \brief     Configures the merging of segments that are separated by small gaps.
+**            Segments with a gap of at most maxGap bytes in between, are merged into
+**            one segment. The bytes in the gap are filled with the fill byte. This
+**            reduces the number of segments to erase and program, at the expense of
+**            programming the fill bytes. Especially useful for firmware files with many
+**            small segments that are nearly adjacent. The merged segments are what the
+**            segment functions and FirmwareReadAt() operate on. Should be called before
+**            obtaining segment information.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     maxGap Maximum size of the gap between two segments, for which the
+**            segments are merged. Zero to not merge segments.
+** \param     fillByte Value of the bytes that fill the gap, typically the value of
+**            erased flash memory on the target.
+**
+****************************************************************************************/
+void FirmwareSetGapFill(tFirmwareContext * context, uint32_t maxGap, uint8_t fillByte)
+{
+  uint16_t idx;
+
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid firmware context. */
+  if (context != NULL)
+  {
+    /* Store the configuration and prepare the chunk of fill bytes. */
+    context->merger.maxGap = maxGap;
+    context->merger.fillByte = fillByte;
+    for (idx = 0U; idx < FIRMWARE_GAP_FILL_CHUNK_SIZE; idx++)
+    {
+      context->merger.fill[idx] = fillByte;
+    }
+    /* Determine the segments after merging. */
+    FirmwareMergerReset(context);
+  }
+} /*** end of FirmwareSetGapFill ***/
+
+
 /************************************************************************************//**
 ** \brief     Obtains the total number of firmware data segments encountered in the
 **            firmware file. A firmware data segment consists of a consecutive block
 **            of firmware data. A firmware file always has at least one segment. However,
 **            it can have more as well. For example if there is a gap between the vector
 **            table and the other program data.
+** \param     context The firmware context, as created by FirmwareCreate().
 ** \return    Total number of firmware data segments present in the firmware file.
 **
 ****************************************************************************************/
-uint8_t FirmwareSegmentGetCount(void)
+uint32_t FirmwareSegmentGetCount(tFirmwareContext * context)
 {
-  uint8_t result = 0U;
+  uint32_t result = 0U;
 
-  /* Verify the firmware reader. */
-  TBX_ASSERT(readerPtr != NULL);
+  /* Verify the firmware context. */
+  TBX_ASSERT(context != NULL);
 
-  /* Only continue with a valid firmware reader. */
-  if (readerPtr != NULL)
+  /* Only continue with a valid firmware context. */
+  if (context != NULL)
   {
     /* Verify the reader's function pointer. */
-    TBX_ASSERT(readerPtr->SegmentGetCount != NULL);
+    TBX_ASSERT(context->reader->SegmentGetCount != NULL);
     /* Only continue with a valid function pointer. */
-    if (readerPtr->SegmentGetCount != NULL)
+    if (context->reader->SegmentGetCount != NULL)
     {
-      /* Obtains the segment count. */
-      result = readerPtr->SegmentGetCount();
+      /* Obtains the segment count. Segments that are merged count as one. */
+      if (context->merger.maxGap > 0U)
+      {
+        result = context->merger.count;
+      }
+      else
+      {
+        result = context->reader->SegmentGetCount(context->instance);
+      }
     }
   }
 
@@ -200,6 +630,7 @@ uint8_t FirmwareSegmentGetCount(void)
 ** \brief     Obtains information about the specified segment, such as the base memory
 **            address that its data belongs to and the total number of data bytes in the
 **            segment.
+** \param     context The firmware context, as created by FirmwareCreate().
 ** \param     idx Zero-based segment index. Valid values are between 0 and
 **            (SegmentGetCount() - 1).
 ** \param     address The base memory address of the segment's data is written to this
@@ -207,29 +638,47 @@ uint8_t FirmwareSegmentGetCount(void)
 ** \return    The total number of data bytes inside this segment.
 **
 ****************************************************************************************/
-uint32_t FirmwareSegmentGetInfo(uint8_t idx, uint32_t * address)
+uint32_t FirmwareSegmentGetInfo(tFirmwareContext * context, uint32_t idx,
+                                uint32_t * address)
 {
   uint32_t result = 0U;
+  uint32_t first;
+  uint32_t last;
+  uint32_t lastAddress = 0U;
 
   /* Verify parameters. */
-  TBX_ASSERT((idx < FirmwareSegmentGetCount()) && (address != NULL));
+  TBX_ASSERT((idx < FirmwareSegmentGetCount(context)) && (address != NULL));
 
   /* Only continue with valid parameters. */
-  if ((idx < FirmwareSegmentGetCount()) && (address != NULL))
+  if ((idx < FirmwareSegmentGetCount(context)) && (address != NULL))
   {
-    /* Verify the firmware reader. */
-    TBX_ASSERT(readerPtr != NULL);
+    /* Verify the firmware context. */
+    TBX_ASSERT(context != NULL);
 
-    /* Only continue with a valid firmware reader. */
-    if (readerPtr != NULL)
+    /* Only continue with a valid firmware context. */
+    if (context != NULL)
     {
       /* Verify the reader's function pointer. */
-      TBX_ASSERT(readerPtr->SegmentGetInfo != NULL);
+      TBX_ASSERT(context->reader->SegmentGetInfo != NULL);
       /* Only continue with a valid function pointer. */
-      if (readerPtr->SegmentGetInfo != NULL)
+      if (context->reader->SegmentGetInfo != NULL)
       {
         /* Obtains the segment info. */
-        result = readerPtr->SegmentGetInfo(idx, address);
+        if (context->merger.maxGap > 0U)
+        {
+          /* A merged segment spans from its first to its last segment of the reader. */
+          first = FirmwareMergerFind(context, idx, &context->merger.infoIdx,
+                                     &context->merger.infoFirst);
+          last = FirmwareMergerGetLast(context, first);
+          (void)context->reader->SegmentGetInfo(context->instance, first, address);
+          result = context->reader->SegmentGetInfo(context->instance, last,
+                                                   &lastAddress);
+          result += lastAddress - *address;
+        }
+        else
+        {
+          result = context->reader->SegmentGetInfo(context->instance, idx, address);
+        }
       }
     }
   }
@@ -242,31 +691,53 @@ uint32_t FirmwareSegmentGetInfo(uint8_t idx, uint32_t * address)
 /************************************************************************************//**
 ** \brief     Opens the firmware data segment for reading. This should always be called
 **            before calling the SegmentGetNextData() function.
+** \param     context The firmware context, as created by FirmwareCreate().
 ** \param     idx Zero-based segment index. Valid values are between 0 and
 **            (SegmentGetCount() - 1).
 **
 ****************************************************************************************/
-void FirmwareSegmentOpen(uint8_t idx)
+void FirmwareSegmentOpen(tFirmwareContext * context, uint32_t idx)
 {
+  uint32_t first;
+
   /* Verify parameter. */
-  TBX_ASSERT(idx < FirmwareSegmentGetCount());
+  TBX_ASSERT(idx < FirmwareSegmentGetCount(context));
 
   /* Only continue with valid parameter. */
-  if (idx < FirmwareSegmentGetCount())
+  if (idx < FirmwareSegmentGetCount(context))
   {
-    /* Verify the firmware reader. */
-    TBX_ASSERT(readerPtr != NULL);
+    /* Verify the firmware context. */
+    TBX_ASSERT(context != NULL);
 
-    /* Only continue with a valid firmware reader. */
-    if (readerPtr != NULL)
+    /* Only continue with a valid firmware context. */
+    if (context != NULL)
     {
       /* Verify the reader's function pointer. */
-      TBX_ASSERT(readerPtr->SegmentOpen != NULL);
+      TBX_ASSERT(context->reader->SegmentOpen != NULL);
       /* Only continue with a valid function pointer. */
-      if (readerPtr->SegmentOpen != NULL)
+      if (context->reader->SegmentOpen != NULL)
       {
-        /* Open the segment. */
-        readerPtr->SegmentOpen(idx);
+        /* Open the segment. A merged segment is read starting with its first segment
+         * of the reader.
+         */
+        if (context->merger.maxGap > 0U)
+        {
+          first = FirmwareMergerFind(context, idx, &context->merger.openIdx,
+                                     &context->merger.openFirst);
+          context->merger.readIdx = first;
+          context->merger.readLast = FirmwareMergerGetLast(context, first);
+          context->merger.gapLen = 0U;
+          context->reader->SegmentOpen(context->instance, first);
+        }
+        else
+        {
+          context->reader->SegmentOpen(context->instance, idx);
+        }
+        /* Prepare for combining the reader's chunks, if configured. */
+        if (context->chunker.size > 0U)
+        {
+          FirmwareChunkerOpen(context);
+        }
       }
     }
   }
@@ -279,6 +750,7 @@ void FirmwareSegmentOpen(uint8_t idx)
 **            open the segment and afterwards you can keep calling this function to
 **            read out the segment's firmware data. When all data is read, len will be
 **            set to zero and a non-NULL pointer is returned.
+** \param     context The firmware context, as created by FirmwareCreate().
 ** \param     address The starting memory address of this chunk of firmware data is
 **            written to this pointer.
 ** \param     len  The length of the firmware data chunk is written to this pointer.
@@ -291,9 +763,11 @@ void FirmwareSegmentOpen(uint8_t idx)
 **            3) A NULL pointer is returned. This happens only when an error occurred.
 **
 ****************************************************************************************/
-uint8_t const * FirmwareSegmentGetNextData(uint32_t * address, uint16_t * len)
+uint8_t const * FirmwareSegmentGetNextData(tFirmwareContext * context,
+                                           uint32_t * address, uint16_t * len)
 {
   uint8_t const * result = NULL;
+  uint32_t        startTime;
 
   /* Verify parameters. */
   TBX_ASSERT((address != NULL) && (len != NULL));
@@ -301,19 +775,29 @@ uint8_t const * FirmwareSegmentGetNextData(uint32_t * address, uint16_t * len)
   /* Only continue with valid parameters. */
   if ((address != NULL) && (len != NULL))
   {
-    /* Verify the firmware reader. */
-    TBX_ASSERT(readerPtr != NULL);
+    /* Verify the firmware context. */
+    TBX_ASSERT(context != NULL);
 
-    /* Only continue with a valid firmware reader. */
-    if (readerPtr != NULL)
+    /* Only continue with a valid firmware context. */
+    if (context != NULL)
     {
       /* Verify the reader's function pointer. */
-      TBX_ASSERT(readerPtr->SegmentGetNextData != NULL);
+      TBX_ASSERT(context->reader->SegmentGetNextData != NULL);
       /* Only continue with a valid function pointer. */
-      if (readerPtr->SegmentGetNextData != NULL)
+      if (context->reader->SegmentGetNextData != NULL)
       {
-        /* Attempt to read the next chunk of firmware data from the opened segment. */
-        result = readerPtr->SegmentGetNextData(address, len);
+        startTime = StatsGetTime(PortGet());
+        /* Combine the reader's chunks, if configured. */
+        if (context->chunker.size > 0U)
+        {
+          result = FirmwareChunkerGetNextData(context, address, len);
+        }
+        else
+        {
+          /* Attempt to read the next chunk of firmware data from the opened segment. */
+          result = FirmwareMergerGetNextData(context, address, len);
+        }
+        context->parseTime += StatsGetTime(PortGet()) - startTime;
       }
     }
   }
@@ -323,4 +807,650 @@ uint8_t const * FirmwareSegmentGetNextData(uint32_t * address, uint16_t * len)
 } /*** end of FirmwareSegmentGetNextData ***/
 
 
+/************************************************************************************//**
+** \brief     Reads firmware data at a specific memory address, without having to read
+**            through the segment from its start. It does not affect reading from the
+**            segment that was opened with SegmentOpen(). Can be called once the firmware
+**            file is opened.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
+**
+****************************************************************************************/
+uint8_t FirmwareReadAt(tFirmwareContext * context, uint32_t address, uint32_t len,
+                       uint8_t * data)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t startTime;
+
+  /* Verify parameters. */
+  TBX_ASSERT((len > 0U) && (data != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((len > 0U) && (data != NULL))
+  {
+    /* Verify the firmware context. */
+    TBX_ASSERT(context != NULL);
+
+    /* Only continue with a valid firmware context. */
+    if (context != NULL)
+    {
+      /* Verify the reader's function pointer. */
+      TBX_ASSERT(context->reader->ReadAt != NULL);
+      /* Only continue with a valid function pointer. */
+      if (context->reader->ReadAt != NULL)
+      {
+        /* Attempt to read the firmware data. The gaps of merged segments are filled. */
+        startTime = StatsGetTime(PortGet());
+        if (context->merger.maxGap > 0U)
+        {
+          result = FirmwareMergerReadAt(context, address, len, data);
+        }
+        else
+        {
+          result = context->reader->ReadAt(context->instance, address, len, data);
+        }
+        context->parseTime += StatsGetTime(PortGet()) - startTime;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareReadAt ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates a checksum over all firmware data in the firmware file. The
+**            firmware data of the segments is added in the order of their memory
+**            addresses. Gaps between segments are not part of the checksum, unless they
+**            are filled, because the segments are merged. Useful for
+**            fingerprinting the firmware. Note that it reads the firmware data with
+**            FirmwareSegmentOpen() and FirmwareSegmentGetNextData().
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     type Checksum type. It should be a CHECKSUM_TYPE_xxx value, possibly
+**            combined with the CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t FirmwareCalculateChecksum(tFirmwareContext * context, uint8_t type,
+                                  uint32_t * checksum)
+{
+  uint8_t         result = TBX_ERROR;
+  tChecksum       checksumCtx;
+  uint32_t        segmentIdx;
+  uint8_t const * chunkData;
+  uint32_t        chunkAddress = 0U;
+  uint16_t        chunkLen = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(checksum != NULL);
+
+  /* Only continue with valid parameter and a supported checksum type. */
+  if ((checksum != NULL) && (ChecksumInit(&checksumCtx, type, PortGet()) == TBX_OK))
+  {
+    /* Set a positive result and only negate upon error detection from here on. */
+    result = TBX_OK;
+    /* Add the firmware data of all segments, one chunk at a time. */
+    for (segmentIdx = 0U; segmentIdx < FirmwareSegmentGetCount(context); segmentIdx++)
+    {
+      if (result == TBX_OK)
+      {
+        FirmwareSegmentOpen(context, segmentIdx);
+        do
+        {
+          chunkData = FirmwareSegmentGetNextData(context, &chunkAddress, &chunkLen);
+          if (chunkData == NULL)
+          {
+            /* Could not read the firmware data. Flag the error. */
+            result = TBX_ERROR;
+          }
+          else
+          {
+            ChecksumUpdate(&checksumCtx, chunkData, chunkLen);
+          }
+        }
+        while ((result == TBX_OK) && (chunkLen > 0U));
+      }
+    }
+    /* Store the checksum value. */
+    if (result == TBX_OK)
+    {
+      *checksum = ChecksumGetResult(&checksumCtx);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareCalculateChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total time spent reading and parsing the firmware file, since
+**            the firmware context was created or the time was last reset.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \return    The total time in milliseconds.
+**
+****************************************************************************************/
+uint32_t FirmwareGetParseTime(tFirmwareContext const * context)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
+  {
+    result = context->parseTime;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareGetParseTime ***/
+
+
+/************************************************************************************//**
+** \brief     Resets the total time spent reading and parsing the firmware file.
+** \param     context The firmware context, as created by FirmwareCreate().
+**
+****************************************************************************************/
+void FirmwareResetParseTime(tFirmwareContext * context)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
+  {
+    context->parseTime = 0U;
+  }
+} /*** end of FirmwareResetParseTime ***/
+
+
+/************************************************************************************//**
+** \brief     Prepares for combining the chunks of the segment that was just opened. It
+**            makes sure a buffer of the configured chunk size is allocated.
+** \param     context The firmware context, as created by FirmwareCreate().
+**
+****************************************************************************************/
+static void FirmwareChunkerOpen(tFirmwareContext * context)
+{
+  tFirmwareChunker * chunker = &context->chunker;
+
+  /* Reset the state of the reader's chunks. */
+  chunker->srcData = NULL;
+  chunker->srcAddress = 0U;
+  chunker->srcLen = 0U;
+  chunker->srcEnd = TBX_FALSE;
+  chunker->error = TBX_FALSE;
+
+  /* Allocate a new buffer if the chunk size changed. */
+  if ((chunker->buffer == NULL) || (chunker->bufferSize != chunker->size))
+  {
+    /* Give the old buffer back to the memory pool. */
+    if (chunker->buffer != NULL)
+    {
+      TbxMemPoolRelease(chunker->buffer);
+      chunker->buffer = NULL;
+      chunker->bufferSize = 0U;
+    }
+    /* Attempt to allocate the buffer. */
+    chunker->buffer = TbxMemPoolAllocate(chunker->size);
+    /* Automatically create or increase the memory pool if it was too small. */
+    if (chunker->buffer == NULL)
+    {
+      /* No need to check the return value, because we'll attempt to allocate from the
+       * memory pool right way. That will tell us if the memory pool increase was
+       * successful.
+       */
+      (void)TbxMemPoolCreate(1U, chunker->size);
+      /* Allocation should now work. */
+      chunker->buffer = TbxMemPoolAllocate(chunker->size);
+    }
+    /* Check the allocation result. */
+    if (chunker->buffer == NULL)
+    {
+      chunker->error = TBX_TRUE;
+    }
+    else
+    {
+      chunker->bufferSize = chunker->size;
+    }
+  }
+} /*** end of FirmwareChunkerOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the next chunk of firmware data in the opened segment, with the
+**            configured chunk size and alignment. It combines the data of as many of
+**            the reader's chunks as needed. If the reader's data already covers the
+**            entire chunk, it is output directly, without copying it to the buffer.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successul, NULL otherwise.
+**
+****************************************************************************************/
+static uint8_t const * FirmwareChunkerGetNextData(tFirmwareContext * context,
+                                                  uint32_t * address, uint16_t * len)
+{
+  tFirmwareChunker * chunker = &context->chunker;
+  uint8_t const * result = NULL;
+  uint16_t        limit = 0U;
+  uint16_t        copyLen;
+  uint16_t        idx;
+  uint8_t         done = TBX_FALSE;
+
+  /* Only continue if the buffer is available. */
+  if (chunker->error == TBX_FALSE)
+  {
+    result = chunker->buffer;
+    *address = 0U;
+    *len = 0U;
+
+    /* Keep collecting data until the chunk is complete or the segment end is reached. */
+    while (done == TBX_FALSE)
+    {
+      /* Read the reader's next chunk, if all its data was consumed. */
+      if ((chunker->srcLen == 0U) && (chunker->srcEnd == TBX_FALSE))
+      {
+        chunker->srcData = FirmwareMergerGetNextData(context, &chunker->srcAddress,
+                                                     &chunker->srcLen);
+        if (chunker->srcData == NULL)
+        {
+          /* Reading error. */
+          chunker->srcLen = 0U;
+          result = NULL;
+          done = TBX_TRUE;
+        }
+        else if (chunker->srcLen == 0U)
+        {
+          /* Segment end reached. */
+          chunker->srcEnd = TBX_TRUE;
+        }
+        else
+        {
+          /* Nothing to do here. Data was read. */
+        }
+      }
+
+      /* Check if the chunk is complete. */
+      if ( (done == TBX_TRUE) || (chunker->srcLen == 0U) ||
+           ((*len > 0U) && ((*len == limit) ||
+                            (chunker->srcAddress != (*address + *len)))) )
+      {
+        done = TBX_TRUE;
+      }
+      /* Start of a new chunk? */
+      else if (*len == 0U)
+      {
+        *address = chunker->srcAddress;
+        limit = FirmwareChunkerGetLimit(chunker, *address);
+        /* Output the reader's data directly, if it covers the entire chunk. */
+        if (chunker->srcLen >= limit)
+        {
+          result = chunker->srcData;
+          *len = limit;
+          chunker->srcData = &chunker->srcData[limit];
+          chunker->srcAddress += limit;
+          chunker->srcLen = (uint16_t)(chunker->srcLen - limit);
+          done = TBX_TRUE;
+        }
+      }
+      else
+      {
+        /* Nothing to do here. Continue with copying the data. */
+      }
+
+      /* Copy as much data to the buffer as fits in the chunk. */
+      if (done == TBX_FALSE)
+      {
+        copyLen = (uint16_t)(limit - *len);
+        if (copyLen > chunker->srcLen)
+        {
+          copyLen = chunker->srcLen;
+        }
+        for (idx = 0U; idx < copyLen; idx++)
+        {
+          chunker->buffer[*len + idx] = chunker->srcData[idx];
+        }
+        *len = (uint16_t)(*len + copyLen);
+        chunker->srcData = &chunker->srcData[copyLen];
+        chunker->srcAddress += copyLen;
+        chunker->srcLen = (uint16_t)(chunker->srcLen - copyLen);
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareChunkerGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the maximum length of a chunk that starts at the specified
+**            address. The chunk ends at the last alignment boundary that still fits in
+**            the configured chunk size. This means that only a chunk starting at an
+**            unaligned address is smaller than the chunk size.
+** \param     chunker Chunk information.
+** \param     address Memory address of the chunk's first byte.
+** \return    Maximum length of the chunk.
+**
+****************************************************************************************/
+static uint16_t FirmwareChunkerGetLimit(tFirmwareChunker const * chunker,
+                                        uint32_t address)
+{
+  uint16_t result = chunker->size;
+  uint32_t endOffset;
+
+  /* Only align the chunk's end if an alignment is configured. */
+  if (chunker->alignment > 1U)
+  {
+    /* Determine how far the chunk's end would be past an alignment boundary. Computed
+     * in parts to prevent an overflow of the end address.
+     */
+    endOffset = ((address % chunker->alignment) + (chunker->size % chunker->alignment)) %
+                chunker->alignment;
+    result -= (uint16_t)endOffset;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareChunkerGetLimit ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the number of segments after merging and invalidates the
+**            looked up merged segments. Should be called each time the reader's
+**            segments or the merge configuration changed.
+** \param     context The firmware context, as created by FirmwareCreate().
+**
+****************************************************************************************/
+static void FirmwareMergerReset(tFirmwareContext * context)
+{
+  tFirmwareMerger * merger = &context->merger;
+  uint32_t          segmentCount;
+  uint32_t          first = 0U;
+
+  /* Reset the looked up merged segments and the reading state. */
+  merger->count = 0U;
+  merger->infoIdx = 0U;
+  merger->infoFirst = 0U;
+  merger->openIdx = 0U;
+  merger->openFirst = 0U;
+  merger->readIdx = 0U;
+  merger->readLast = 0U;
+  merger->gapAddress = 0U;
+  merger->gapLen = 0U;
+
+  /* Count the merged segments, if segments are merged. */
+  if (merger->maxGap > 0U)
+  {
+    segmentCount = context->reader->SegmentGetCount(context->instance);
+    while (first < segmentCount)
+    {
+      merger->count++;
+      first = FirmwareMergerGetLast(context, first) + 1U;
+    }
+  }
+} /*** end of FirmwareMergerReset ***/
+
+
+/************************************************************************************//**
+** \brief     Determines the last segment of the reader that is merged with the
+**            specified segment of the reader. Segments are merged as long as the gap to
+**            the next segment is not larger than the configured maximum gap.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     first Index of the reader's first segment in the merged segment.
+** \return    Index of the reader's last segment in the merged segment.
+**
+****************************************************************************************/
+static uint32_t FirmwareMergerGetLast(tFirmwareContext * context, uint32_t first)
+{
+  uint32_t result = first;
+  uint32_t segmentCount;
+  uint32_t address = 0U;
+  uint32_t len;
+  uint32_t nextAddress = 0U;
+  uint32_t nextLen;
+  uint8_t  done = TBX_FALSE;
+
+  segmentCount = context->reader->SegmentGetCount(context->instance);
+  len = context->reader->SegmentGetInfo(context->instance, first, &address);
+  /* Keep merging the next segment, while its gap is small enough. Note that the
+   * segments are sorted on their address and do not overlap.
+   */
+  while ((done == TBX_FALSE) && ((result + 1U) < segmentCount))
+  {
+    nextLen = context->reader->SegmentGetInfo(context->instance, result + 1U,
+                                              &nextAddress);
+    if ((nextAddress - address - len) > context->merger.maxGap)
+    {
+      done = TBX_TRUE;
+    }
+    else
+    {
+      result++;
+      address = nextAddress;
+      len = nextLen;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareMergerGetLast ***/
+
+
+/************************************************************************************//**
+** \brief     Looks up the reader's first segment in the specified merged segment. It
+**            continues from the previously looked up merged segment, which makes it fast
+**            to look up the merged segments in order.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     idx Index of the merged segment.
+** \param     cacheIdx Index of the previously looked up merged segment. Updated to idx.
+** \param     cacheFirst Index of the reader's first segment in the previously looked up
+**            merged segment. Updated to the one of idx.
+** \return    Index of the reader's first segment in the merged segment.
+**
+****************************************************************************************/
+static uint32_t FirmwareMergerFind(tFirmwareContext * context, uint32_t idx,
+                                   uint32_t * cacheIdx, uint32_t * cacheFirst)
+{
+  /* Start from the first merged segment, if the requested one comes before the
+   * previously looked up one.
+   */
+  if (idx < *cacheIdx)
+  {
+    *cacheIdx = 0U;
+    *cacheFirst = 0U;
+  }
+  /* Skip merged segments until the requested one is reached. */
+  while (*cacheIdx < idx)
+  {
+    *cacheFirst = FirmwareMergerGetLast(context, *cacheFirst) + 1U;
+    (*cacheIdx)++;
+  }
+
+  /* Give the result back to the caller. */
+  return *cacheFirst;
+} /*** end of FirmwareMergerFind ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the next chunk of firmware data in the opened segment. If segments
+**            are merged, it continues with the gap and the next segment of the reader,
+**            when the end of a reader's segment is reached. The gap is output as chunks
+**            of fill bytes.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successul, NULL otherwise.
+**
+****************************************************************************************/
+static uint8_t const * FirmwareMergerGetNextData(tFirmwareContext * context,
+                                                 uint32_t * address, uint16_t * len)
+{
+  tFirmwareMerger * merger = &context->merger;
+  uint8_t const   * result = NULL;
+  uint8_t           done = TBX_FALSE;
+  uint32_t          segmentAddress = 0U;
+  uint32_t          segmentLen;
+  uint32_t          nextAddress = 0U;
+
+  while (done == TBX_FALSE)
+  {
+    /* Output the next part of the gap, if there still is one. */
+    if (merger->gapLen > 0U)
+    {
+      *address = merger->gapAddress;
+      *len = FIRMWARE_GAP_FILL_CHUNK_SIZE;
+      if (merger->gapLen < FIRMWARE_GAP_FILL_CHUNK_SIZE)
+      {
+        *len = (uint16_t)merger->gapLen;
+      }
+      merger->gapAddress += *len;
+      merger->gapLen -= *len;
+      result = merger->fill;
+      done = TBX_TRUE;
+    }
+    else
+    {
+      /* Attempt to read the next chunk of firmware data from the reader's segment. */
+      result = context->reader->SegmentGetNextData(context->instance, address, len);
+      done = TBX_TRUE;
+      /* End of the reader's segment reached, while more segments are merged? */
+      if ( (merger->maxGap > 0U) && (result != NULL) && (*len == 0U) &&
+           (merger->readIdx < merger->readLast) )
+      {
+        /* Continue with the gap up to the next segment and then with its data. */
+        segmentLen = context->reader->SegmentGetInfo(context->instance,
+                                                     merger->readIdx, &segmentAddress);
+        merger->readIdx++;
+        (void)context->reader->SegmentGetInfo(context->instance, merger->readIdx,
+                                              &nextAddress);
+        merger->gapAddress = segmentAddress + segmentLen;
+        merger->gapLen = nextAddress - merger->gapAddress;
+        context->reader->SegmentOpen(context->instance, merger->readIdx);
+        done = TBX_FALSE;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareMergerGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Reads firmware data at a specific memory address, while filling the gaps
+**            between merged segments. It reads the firmware data with the reader, one
+**            segment at a time.
+** \param     context The firmware context, as created by FirmwareCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or fill bytes, or in case of a read error.
+**
+****************************************************************************************/
+static uint8_t FirmwareMergerReadAt(tFirmwareContext * context, uint32_t address,
+                                    uint32_t len, uint8_t * data)
+{
+  uint8_t  result = TBX_OK;
+  uint32_t segmentCount;
+  uint32_t low;
+  uint32_t high;
+  uint32_t mid;
+  uint32_t segmentAddress = 0U;
+  uint32_t segmentLen;
+  uint32_t prevAddress = 0U;
+  uint32_t prevLen;
+  uint32_t partLen = 0U;
+  uint32_t idx;
+
+  segmentCount = context->reader->SegmentGetCount(context->instance);
+  while ((result == TBX_OK) && (len > 0U))
+  {
+    /* Binary search for the reader's first segment that ends after the address. */
+    low = 0U;
+    high = segmentCount;
+    while (low < high)
+    {
+      mid = low + ((high - low) / 2U);
+      segmentLen = context->reader->SegmentGetInfo(context->instance, mid,
+                                                   &segmentAddress);
+      if ((address >= segmentAddress) && ((address - segmentAddress) >= segmentLen))
+      {
+        low = mid + 1U;
+      }
+      else
+      {
+        high = mid;
+      }
+    }
+    /* Flag an error if there is no such segment. */
+    if (low >= segmentCount)
+    {
+      result = TBX_ERROR;
+    }
+    else
+    {
+      segmentLen = context->reader->SegmentGetInfo(context->instance, low,
+                                                   &segmentAddress);
+      /* Is the address inside the segment? */
+      if (address >= segmentAddress)
+      {
+        /* Read the firmware data up to the end of the segment. */
+        partLen = segmentLen - (address - segmentAddress);
+        if (partLen > len)
+        {
+          partLen = len;
+        }
+        result = context->reader->ReadAt(context->instance, address, partLen, data);
+      }
+      else
+      {
+        /* The address is in the gap before the segment. It is only filled if the
+         * segment is merged with the previous one.
+         */
+        result = TBX_ERROR;
+        if (low > 0U)
+        {
+          prevLen = context->reader->SegmentGetInfo(context->instance, low - 1U,
+                                                    &prevAddress);
+          if ((segmentAddress - prevAddress - prevLen) <= context->merger.maxGap)
+          {
+            /* Fill the gap up to the start of the segment. */
+            partLen = segmentAddress - address;
+            if (partLen > len)
+            {
+              partLen = len;
+            }
+            for (idx = 0U; idx < partLen; idx++)
+            {
+              data[idx] = context->merger.fillByte;
+            }
+            result = TBX_OK;
+          }
+        }
+      }
+      /* Continue after the part that was read. */
+      address += partLen;
+      len -= partLen;
+      data = &data[partLen];
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of FirmwareMergerReadAt ***/
+
+
 /*********************************** end of firmware.c *********************************/
@@ -40,6 +40,19 @@
 * It contains an interface for linking firmware file parsers that handle the parsing
 * of firmware data from a file in the correct format. For example the Motorola S-record
 * format.
+*
+* All information about a firmware file that is being read, is stored in a firmware
+* context. Multiple firmware contexts can exist at the same time, for example to read
+* a different firmware file for each node in a multi-node system. When the same
+* firmware file is read for multiple nodes, the firmware contexts can share the firmware
+* file that one of them opened. This way the firmware file is only scanned once, while
+* each firmware context still reads the firmware data at its own file position.
+*
+* Firmware files often contain many small segments, separated by small gaps. Each
+* segment costs extra communication with the target, for setting the memory address
+* and for erasing. Segments that are separated by a gap of at most a configured size
+* can therefore be merged into one segment. The bytes in the gap are then filled with a
+* configured fill byte, typically the value of erased flash memory.
 ****************************************************************************************/
 #ifndef FIRMWARE_H
 #define FIRMWARE_H
@@ -48,6 +61,41 @@
 extern "C" {
 #endif
 
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Default size of the firmware data chunks that FirmwareSegmentGetNextData()
+ *         outputs. Zero passes the chunks on exactly as the firmware file reader outputs
+ *         them. Can be changed at runtime with FirmwareSetChunkSize().
+ */
+#ifndef FIRMWARE_CHUNK_SIZE
+#define FIRMWARE_CHUNK_SIZE            (0U)
+#endif
+
+/** \brief Default alignment of the firmware data chunk boundaries, typically the size of
+ *         a flash page on the target. Zero or one disables the alignment. Can be changed
+ *         at runtime with FirmwareSetChunkSize().
+ */
+#ifndef FIRMWARE_CHUNK_ALIGNMENT
+#define FIRMWARE_CHUNK_ALIGNMENT       (0U)
+#endif
+
+/** \brief Default maximum size of a gap between two segments, for which the segments are
+ *         merged into one segment. Zero disables the merging of segments. Can be changed
+ *         at runtime with FirmwareSetGapFill().
+ */
+#ifndef FIRMWARE_GAP_FILL_MAX
+#define FIRMWARE_GAP_FILL_MAX          (0U)
+#endif
+
+/** \brief Default value of the bytes that fill the gap between merged segments. Can be
+ *         changed at runtime with FirmwareSetGapFill().
+ */
+#ifndef FIRMWARE_GAP_FILL_BYTE
+#define FIRMWARE_GAP_FILL_BYTE         (0xFFU)
+#endif
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
@@ -56,43 +104,82 @@ extern "C" {
  */
 typedef struct
 {
-  /** \brief Initializes the firmware reader. */
-  void            (* Init) (void);
+  /** \brief Creates an instance of the firmware reader. */
+  void          * (* Create) (void);
 
-  /** \brief Terminates the firmware reader. */
-  void            (* Terminate) (void);
+  /** \brief Releases an instance of the firmware reader. */
+  void            (* Destroy) (void * instance);
 
   /** \brief Opens the firmware file for reading. */
-  uint8_t         (* FileOpen) (char const * firmwareFile);
+  uint8_t         (* FileOpen) (void * instance, char const * firmwareFile);
+
+  /** \brief Opens the firmware file that another instance opened, sharing its segment
+   *         information.
+   */
+  uint8_t         (* FileShare) (void * instance, void const * image);
 
   /** \brief Closes an opened firmware file. */
-  void            (* FileClose) (void);
+  void            (* FileClose) (void * instance);
 
   /** \brief Obtain the number of firmware data segments detected in the file. */
-  uint8_t         (* SegmentGetCount) (void);
+  uint32_t        (* SegmentGetCount) (void * instance);
 
   /** \brief Obtain start address and length of a specific segment. */
-  uint32_t        (* SegmentGetInfo) (uint8_t idx, uint32_t * address);
+  uint32_t        (* SegmentGetInfo) (void * instance, uint32_t idx, uint32_t * address);
 
   /** \brief Opens a firmware data segment for reading. */
-  void            (* SegmentOpen) (uint8_t idx);
+  void            (* SegmentOpen) (void * instance, uint32_t idx);
 
   /** \brief Obtains a data point to the segment's next chunk of firmware data. */
-  uint8_t const * (* SegmentGetNextData) (uint32_t * address, uint16_t * len);
+  uint8_t const * (* SegmentGetNextData) (void * instance, uint32_t * address,
+                                          uint16_t * len);
+
+  /** \brief Reads firmware data at a specific memory address. */
+  uint8_t         (* ReadAt) (void * instance, uint32_t address, uint32_t len,
+                              uint8_t * data);
+
+  /** \brief Sets the base memory address of firmware files that do not hold address
+   *         information themselves. Optional, so NULL if the reader does not need it.
+   */
+  void            (* SetBaseAddress) (void * instance, uint32_t address);
 } tFirmwareReader;
 
+/** \brief Firmware context. It groups all the information of a firmware file that is
+ *         being read, such that multiple firmware files can be read at the same time.
+ *         Its contents are private to the firmware reader module.
+ */
+typedef struct t_firmware_context tFirmwareContext;
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-void            FirmwareInit(tFirmwareReader const * reader);
-void            FirmwareTerminate(void);
-uint8_t         FirmwareFileOpen(char const * firmwareFile);
-void            FirmwareFileClose(void);
-uint8_t         FirmwareSegmentGetCount(void);
-uint32_t        FirmwareSegmentGetInfo(uint8_t idx, uint32_t * address);
-void            FirmwareSegmentOpen(uint8_t idx);
-uint8_t const * FirmwareSegmentGetNextData(uint32_t * address, uint16_t * len);
+tFirmwareContext * FirmwareCreate(tFirmwareReader const * reader);
+uint8_t            FirmwareDestroy(tFirmwareContext * context);
+uint8_t            FirmwareFileOpen(tFirmwareContext * context,
+                                    char const * firmwareFile);
+uint8_t            FirmwareFileShare(tFirmwareContext * context,
+                                     tFirmwareContext * image);
+uint8_t            FirmwareFileClose(tFirmwareContext * context);
+void               FirmwareSetBaseAddress(tFirmwareContext * context,
+                                          uint32_t address);
+void               FirmwareSetChunkSize(tFirmwareContext * context, uint16_t chunkSize,
+                                        uint16_t alignment);
+uint16_t           FirmwareGetChunkSize(tFirmwareContext const * context);
+void               FirmwareSetGapFill(tFirmwareContext * context, uint32_t maxGap,
+                                      uint8_t fillByte);
+uint32_t           FirmwareSegmentGetCount(tFirmwareContext * context);
+uint32_t           FirmwareSegmentGetInfo(tFirmwareContext * context, uint32_t idx,
+                                          uint32_t * address);
+void               FirmwareSegmentOpen(tFirmwareContext * context, uint32_t idx);
+uint8_t const    * FirmwareSegmentGetNextData(tFirmwareContext * context,
+                                              uint32_t * address, uint16_t * len);
+uint8_t            FirmwareReadAt(tFirmwareContext * context, uint32_t address,
+                                  uint32_t len, uint8_t * data);
+uint8_t            FirmwareCalculateChecksum(tFirmwareContext * context, uint8_t type,
+                                             uint32_t * checksum);
+uint32_t           FirmwareGetParseTime(tFirmwareContext const * context);
+void               FirmwareResetParseTime(tFirmwareContext * context);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,1082 @@
+/************************************************************************************//**
+* \file         hexreader.c
+* \brief        Intel HEX firmware file reader source file.
+* \ingroup      HexReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "linereader.h"                     /* Line reader                             */
+#include "segtable.h"                       /* Segment table                           */
+#include "hexreader.h"                      /* Intel HEX firmware file reader          */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Size of the byte buffer for storing a line from the Intel HEX file. */
+#define HEX_LINE_BUFFER_SIZE          (256)
+
+/** \brief Size of the byte buffer to store firmware data extracted from a HEX file. */
+#define HEX_DATA_BUFFER_SIZE          (512)
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+/* The current implementation assumes that char's are 1 byte in size. Verify that FatFS
+ * is configured accordingly.
+ */
+#if (_LFN_UNICODE > 0)     /* Unicode (UTF-16) string */
+#error "Unicode (UTF-16) mode currently not supported (_LFN_UNICODE must be 0)"
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Structure that represents the handle to the Intel HEX file, which groups all
+ *         its relevent data.
+ */
+typedef struct
+{
+  /** \brief Boolean flag to keep track if a file is opened or not. */
+  uint8_t              fileOpened;
+  /** \brief Boolean flag to keep track if the opened file and its segment information
+   *         are shared with another reader instance, which owns them.
+   */
+  uint8_t              fileShared;
+  /** \brief FatFS file object handle. */
+  FIL                  file;
+  /** \brief Line reader for reading the lines from the file in large blocks. */
+  tLineReader          lineReader;
+  /** \brief Byte buffer for storing a line from the Intel HEX file. */
+  char                 lineBuf[HEX_LINE_BUFFER_SIZE];
+  /** \brief Byte buffer for storing the data from a HEX record with the help of function
+   *         HexReaderParseLine().
+   */
+  uint8_t              lineDataBuf[HEX_LINE_BUFFER_SIZE/2];
+  /** \brief Byte buffer for storing data extracted from HEX records with the help of
+   *         function HexReaderSegmentGetNextData().
+   */
+  uint8_t              dataBuf[HEX_DATA_BUFFER_SIZE];
+  /** \brief Boolean flag to keep track if the pending line holds data. This is the
+   *         data of the line that was already read and parsed by function
+   *         HexReaderSegmentGetNextData(), but that did not fit in the data buffer or
+   *         belongs to a different segment. It is still in lineDataBuf and the next call
+   *         of HexReaderSegmentGetNextData() continues with it.
+   */
+  uint8_t              linePending;
+  /** \brief Memory address of the pending line's data. */
+  uint32_t             pendingAddr;
+  /** \brief Number of data bytes of the pending line. */
+  uint8_t              pendingLen;
+  /** \brief File pointer inside the firmware file where the pending line starts. */
+  FSIZE_t              pendingFPtr;
+  /** \brief Table with the segments, sorted on their base memory address. */
+  tSegTable            segmentTable;
+  /** \brief Pointer to the currently opened segment. */
+  tSegment const     * openedSegment;
+  /** \brief Read index with checkpoints, sorted on their base memory address. Each
+   *         checkpoint holds the file pointer of a line, the extended address in effect
+   *         at that line and the number of data bytes in the consecutive lines that
+   *         follow it.
+   */
+  tSegTable            readIndex;
+  /** \brief Extended address, as set by the most recently parsed extended segment
+   *         address (02) or extended linear address (04) record. It is added to the
+   *         16-bit address offset of each data (00) record.
+   */
+  uint32_t             addrBase;
+} tHexHandle;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void          * HexReaderCreate(void);
+static void            HexReaderDestroy(void * instance);
+static uint8_t         HexReaderFileOpen(void * instance, char const * firmwareFile);
+static uint8_t         HexReaderFileShare(void * instance, void const * image);
+static void            HexReaderFileClose(void * instance);
+static uint32_t        HexReaderSegmentGetCount(void * instance);
+static uint32_t        HexReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                               uint32_t * address);
+static void            HexReaderSegmentOpen(void * instance, uint32_t idx);
+static uint8_t const * HexReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                   uint16_t * len);
+static uint8_t         HexReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                                       uint8_t * data);
+static uint8_t         HexReaderParseLine(tHexHandle * hexHandle, char const * line,
+                                          uint32_t * address, uint8_t * len,
+                                          uint8_t * data);
+
+
+/***********************************************************************************//**
+** \brief     Obtains a pointer to the reader structure, so that it can be linked to the
+**            firmware reader module.
+** \return    Pointer to firmware reader structure.
+**
+****************************************************************************************/
+tFirmwareReader const * HexReaderGet(void)
+{
+  /** \brief File reader structure filled with Intel HEX parsing specifics. */
+  static const tFirmwareReader hexReader =
+  {
+    .Create = HexReaderCreate,
+    .Destroy = HexReaderDestroy,
+    .FileOpen = HexReaderFileOpen,
+    .FileShare = HexReaderFileShare,
+    .FileClose = HexReaderFileClose,
+    .SegmentGetCount = HexReaderSegmentGetCount,
+    .SegmentGetInfo = HexReaderSegmentGetInfo,
+    .SegmentOpen = HexReaderSegmentOpen,
+    .SegmentGetNextData = HexReaderSegmentGetNextData,
+    .ReadAt = HexReaderReadAt
+  };
+
+  /* Give the pointer to the firmware reader back to the caller. */
+  return &hexReader;
+} /*** end of HexReaderGet ***/
+
+
+/************************************************************************************//**
+** \brief     Creates an instance of the Intel HEX reader. The instance is allocated
+**            from the memory pool.
+** \return    Pointer to the reader instance if successful, NULL otherwise.
+**
+****************************************************************************************/
+static void * HexReaderCreate(void)
+{
+  tHexHandle * hexHandle;
+
+  /* Attempt to allocate the handle. */
+  hexHandle = TbxMemPoolAllocate(sizeof(tHexHandle));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (hexHandle == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tHexHandle));
+    /* Allocation should now work. */
+    hexHandle = TbxMemPoolAllocate(sizeof(tHexHandle));
+  }
+
+  /* Only continue if the handle was allocated. */
+  if (hexHandle != NULL)
+  {
+    /* Initialize the HEX handle members. */
+    hexHandle->fileOpened = TBX_FALSE;
+    hexHandle->fileShared = TBX_FALSE;
+    SegTableInit(&hexHandle->segmentTable);
+    hexHandle->openedSegment = NULL;
+    SegTableInit(&hexHandle->readIndex);
+    hexHandle->linePending = TBX_FALSE;
+    hexHandle->addrBase = 0U;
+  }
+
+  /* Give the reader instance back to the caller. */
+  return hexHandle;
+} /*** end of HexReaderCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases an instance of the Intel HEX reader.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+**
+****************************************************************************************/
+static void HexReaderDestroy(void * instance)
+{
+  /* Make sure a possibly previously opened file is closed. */
+  HexReaderFileClose(instance);
+  /* Give the handle back to the memory pool. */
+  TbxMemPoolRelease(instance);
+} /*** end of HexReaderDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file and browses through its contents to collect
+**            information about the firmware data segment it contains.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t HexReaderFileOpen(void * instance, char const * firmwareFile)
+{
+  tHexHandle   * hexHandle = instance;
+  uint8_t        result = TBX_OK;
+  uint32_t       lineAddress = 0U;
+  uint8_t        lineDataLen = 0U;
+  uint8_t        parseResult;
+  uint8_t        stopLineLoop = TBX_FALSE;
+  FSIZE_t        lineFPtr;
+
+  /* Verify parameter. */
+  TBX_ASSERT(firmwareFile != NULL);
+
+  /* Only continue with valid parameter. */
+  if (firmwareFile != NULL)
+  {
+    /* Make sure a possibly previously opened file is first closed. */
+    HexReaderFileClose(hexHandle);
+    /* Open the file for reading. */
+    if (f_open(&hexHandle->file, firmwareFile, FA_READ) != FR_OK)
+    {
+      /* Could not open the file. Update the result to flag this problem. */
+      result = TBX_ERROR;
+    }
+    /* File successfully opened. */
+    else
+    {
+      /* Update the flag that tracks the file opened state. */
+      hexHandle->fileOpened = TBX_TRUE;
+      /* Initialize the line reader for the opened file. */
+      LineReaderInit(&hexHandle->lineReader, &hexHandle->file);
+    }
+
+    /* Only continue if the file was successfully opened. */
+    if (result == TBX_OK)
+    {
+      /* Addresses are relative to zero, until the first extended address record. */
+      hexHandle->addrBase = 0U;
+      /* Loop to read all the lines in the file one at a time. */
+      while (stopLineLoop != TBX_TRUE)
+      {
+        /* Store the file pointer of the current line. Needed later on in case this
+         * is a new segment.
+         */
+        lineFPtr = LineReaderTell(&hexHandle->lineReader);
+        /* Attempt to read the next line from the file */
+        if (LineReaderGets(&hexHandle->lineReader, hexHandle->lineBuf,
+                           HEX_LINE_BUFFER_SIZE) == NULL)
+        {
+          /* An error occured or we reached the end of the file. Was it an error? */
+          if (LineReaderGetError(&hexHandle->lineReader) == TBX_TRUE)
+          {
+            result = TBX_ERROR;
+          }
+          /* Stop looping when an error occurred or we reached the end of the file. */
+          stopLineLoop = TBX_TRUE;
+          continue;
+        }
+        /* Attempt to extract data from the HEX record line. */
+        parseResult = HexReaderParseLine(hexHandle, hexHandle->lineBuf, &lineAddress,
+                                          &lineDataLen, NULL);
+        /* Did an error occur during line parsing? */
+        if (parseResult != TBX_OK)
+        {
+          result = TBX_ERROR;
+          stopLineLoop = TBX_TRUE;
+          continue;
+        }
+        /* Still here so parsing was okay, but only continue if data was actually
+         * extracted. In the case of a non-data record the parsing can still be
+         * successful, but did not yield any extracted data bytes.
+         */
+        if (lineDataLen > 0U)
+        {
+          /* Add the data to the segment table. It extends the current segment, if it
+           * fits at its end. Otherwise a new segment is created.
+           */
+          if (SegTableAddData(&hexHandle->segmentTable, lineAddress, lineDataLen,
+                              lineFPtr, hexHandle->addrBase) != TBX_OK)
+          {
+            /* No memory could be allocated. The heap is probably configured too
+             * small. Increase TBX_CONF_HEAP_SIZE to resolve the problem. All we can do
+             * now is flag the error.
+             */
+            result = TBX_ERROR;
+            stopLineLoop = TBX_TRUE;
+            continue;
+          }
+#if (HEX_READ_INDEX_INTERVAL > 0U)
+          /* Add the data to the read index as well. It gets a new checkpoint once the
+           * current one holds HEX_READ_INDEX_INTERVAL bytes.
+           */
+          if (SegTableAddDataLimited(&hexHandle->readIndex, lineAddress, lineDataLen,
+                                     lineFPtr, hexHandle->addrBase,
+                                     HEX_READ_INDEX_INTERVAL) != TBX_OK)
+          {
+            /* Could not allocate memory for the checkpoint. */
+            result = TBX_ERROR;
+            stopLineLoop = TBX_TRUE;
+            continue;
+          }
+#endif
+        }
+      }
+    }
+
+    /* Sort the segments on their base memory address, if all went okay so far. This
+     * is also where firmware data that overlaps with another segment is rejected.
+     */
+    if (result == TBX_OK)
+    {
+      result = SegTableSort(&hexHandle->segmentTable);
+    }
+#if (HEX_READ_INDEX_INTERVAL > 0U)
+    if (result == TBX_OK)
+    {
+      result = SegTableSort(&hexHandle->readIndex);
+    }
+#endif
+
+    /* Perform cleanup in case the file could not be properly opened. */
+    if (result != TBX_OK)
+    {
+      /* Make sure the file is closed. This includes the release of the segments. */
+      HexReaderFileClose(hexHandle);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderFileOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file that another reader instance already opened. The
+**            segment information is shared with the other instance, so the firmware
+**            file does not need to be scanned again. This instance does get its own file
+**            object, such that it can read the firmware data independent from the other
+**            instance. The other instance must keep its firmware file opened, until this
+**            instance closed it.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     image Pointer to the reader instance that opened the firmware file.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t HexReaderFileShare(void * instance, void const * image)
+{
+  tHexHandle       * hexHandle = instance;
+  tHexHandle const * imageHandle = image;
+  uint8_t           result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(image != NULL);
+
+  /* Only continue with valid parameter. */
+  if (image != NULL)
+  {
+    /* Make sure a possibly previously opened file is first closed. */
+    HexReaderFileClose(hexHandle);
+    /* Only continue if the other instance actually opened a file. */
+    if (imageHandle->fileOpened == TBX_TRUE)
+    {
+      /* Duplicate the file object. This gives this instance its own file pointer, just
+       * like opening the file again for reading would. The duplicate is never closed
+       * with f_close(), because it did not open the file itself.
+       */
+      hexHandle->file = imageHandle->file;
+      LineReaderInit(&hexHandle->lineReader, &hexHandle->file);
+      /* Share the segment table and the read index. These are no longer modified after
+       * the file was opened, so they can be read by both instances at the same time.
+       */
+      hexHandle->segmentTable = imageHandle->segmentTable;
+      hexHandle->readIndex = imageHandle->readIndex;
+      /* Update the flags that track the file opened state. */
+      hexHandle->fileOpened = TBX_TRUE;
+      hexHandle->fileShared = TBX_TRUE;
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderFileShare ***/
+
+
+/************************************************************************************//**
+** \brief     Closes the previously opened firmware file.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+**
+****************************************************************************************/
+static void HexReaderFileClose(void * instance)
+{
+  tHexHandle * hexHandle = instance;
+
+  /* Only close the file if one is actually opened. */
+  if (hexHandle->fileOpened == TBX_TRUE)
+  {
+    /* Reset the flag. */
+    hexHandle->fileOpened = TBX_FALSE;
+    /* Was the file opened by sharing it with another instance? */
+    if (hexHandle->fileShared == TBX_TRUE)
+    {
+      /* Reset the flag. */
+      hexHandle->fileShared = TBX_FALSE;
+      /* The other instance owns the file and the segments. Only forget about them. */
+      SegTableInit(&hexHandle->segmentTable);
+      SegTableInit(&hexHandle->readIndex);
+    }
+    else
+    {
+      /* Close the file. */
+      (void)f_close(&hexHandle->file);
+      /* Release the segments and the read index. */
+      SegTableClear(&hexHandle->segmentTable);
+      SegTableClear(&hexHandle->readIndex);
+    }
+    /* Reset the opened segment. */
+    hexHandle->openedSegment = NULL;
+    /* Discard a possibly pending line. */
+    hexHandle->linePending = TBX_FALSE;
+  }
+} /*** end of HexReaderFileClose ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of firmware data segments encountered in the
+**            firmware file. A firmware data segment consists of a consecutive block
+**            of firmware data. A firmware file always has at least one segment. However,
+**            it can have more as well. For example if there is a gap between the vector
+**            table and the other program data.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \return    Total number of firmware data segments present in the firmware file.
+**
+****************************************************************************************/
+static uint32_t HexReaderSegmentGetCount(void * instance)
+{
+  tHexHandle * hexHandle = instance;
+  uint32_t result = 0U;
+
+  /* Only continue if a file is actually opened. */
+  if (hexHandle->fileOpened == TBX_TRUE)
+  {
+    /* Obtain the number of segments in the segment table. */
+    result = SegTableGetCount(&hexHandle->segmentTable);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderSegmentGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains information about the specified segment, such as the base memory
+**            address that its data belongs to and the total number of data bytes in the
+**            segment.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (SegmentGetCount() - 1).
+** \param     address The base memory address of the segment's data is written to this
+**            pointer.
+** \return    The total number of data bytes inside this segment.
+**
+****************************************************************************************/
+static uint32_t HexReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                        uint32_t * address)
+{
+  tHexHandle * hexHandle = instance;
+  uint32_t result = 0U;
+  tSegment const * segment;
+
+  /* Verify parameters. */
+  TBX_ASSERT((idx < HexReaderSegmentGetCount(hexHandle)) && (address != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((idx < HexReaderSegmentGetCount(hexHandle)) && (address != NULL))
+  {
+    /* Only continue if a file is actually opened. */
+    if (hexHandle->fileOpened == TBX_TRUE)
+    {
+      /* Obtain the segment specified by the index. */
+      segment = SegTableGet(&hexHandle->segmentTable, idx);
+      /* Make sure a valid segment was found. */
+      if (segment != NULL)
+      {
+        /* Store the base memory address of the data in this segment. */
+        *address = segment->addr;
+        /* Update the result to hold the total number of bytse inside this segment. */
+        result = segment->len;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderSegmentGetInfo ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware data segment for reading. This should always be called
+**            before calling the SegmentGetNextData() function.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (SegmentGetCount() - 1).
+**
+****************************************************************************************/
+static void HexReaderSegmentOpen(void * instance, uint32_t idx)
+{
+  tHexHandle     * hexHandle = instance;
+  tSegment const * segment;
+
+  /* Verify parameter. */
+  TBX_ASSERT(idx < HexReaderSegmentGetCount(hexHandle));
+
+  /* Only continue with valid parameter. */
+  if (idx < HexReaderSegmentGetCount(hexHandle))
+  {
+    /* Only continue if a file is actually opened. */
+    if (hexHandle->fileOpened == TBX_TRUE)
+    {
+      /* Obtain the segment specified by the index. */
+      segment = SegTableGet(&hexHandle->segmentTable, idx);
+      /* Make sure a valid segment was found. */
+      if (segment != NULL)
+      {
+        /* Keep track of the currently openeded segment. */
+        hexHandle->openedSegment = segment;
+        /* A possibly pending line belongs to the previously opened segment. */
+        hexHandle->linePending = TBX_FALSE;
+        /* Restore the extended address that is in effect at the start of this
+         * segment.
+         */
+        hexHandle->addrBase = segment->base;
+        /* Set the file pointer to the HEX record line where this segment starts. */
+        (void)LineReaderSeek(&hexHandle->lineReader, segment->fptr);
+      }
+    }
+  }
+} /*** end of HexReaderSegmentOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains a data pointer to the next chunk of firmware data in the segment
+**            that was opened with function SegmentOpen(). The idea is that you first
+**            open the segment and afterwards you can keep calling this function to
+**            read out the segment's firmware data. When all data is read, len will be
+**            set to zero and a non-NULL pointer is returned.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successul, NULL otherwise.
+** \attention There are three possible outsomes when calling this function:
+**            1) len > 0 and a non-NULL pointer is returned. This means valid data was
+**               read.
+**            2) len = 0 and a non-NULL pointer is returned. This means the end of the
+**               segment is reached and therefore no new data was actually read.
+**            3) A NULL pointer is returned. This happens only when an error occurred.
+**
+****************************************************************************************/
+static uint8_t const * HexReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                   uint16_t * len)
+{
+  tHexHandle     * hexHandle = instance;
+  uint8_t  const * result = NULL;
+  uint8_t          dataReadDone = TBX_FALSE;
+  uint8_t          parseResult;
+  uint32_t         lineAddress;
+  uint8_t          lineDataLen;
+  FSIZE_t          lineFPtr;
+  uint8_t          byteIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((address != NULL) && (len != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((address != NULL) && (len != NULL))
+  {
+    /* Only continue if a file is actually opened and a segment was actually opened. */
+    if ( (hexHandle->fileOpened == TBX_TRUE) && (hexHandle->openedSegment != NULL) )
+    {
+      /* Set the result to the valid databuffer, which indicates success. From now on
+       * only set it to NULL, in case an error was detected.
+       */
+      result = hexHandle->dataBuf;
+
+      /* Initialize the lenght output parameter, since we plan on using it as a data
+       * buffer indexer as well.
+       */
+      *len = 0U;
+
+      /* Loop to read as much data from this segment that will with in the internal
+       * data buffer.
+       */
+      while (dataReadDone != TBX_TRUE)
+      {
+        /* Is there a pending line, left over from the previous call? */
+        if (hexHandle->linePending == TBX_TRUE)
+        {
+          /* Continue with its already extracted data, instead of reading and parsing
+           * the same line again.
+           */
+          hexHandle->linePending = TBX_FALSE;
+          lineFPtr = hexHandle->pendingFPtr;
+          lineAddress = hexHandle->pendingAddr;
+          lineDataLen = hexHandle->pendingLen;
+        }
+        else
+        {
+          /* Store the file pointer of the current line. Might need it to rewind. */
+          lineFPtr = LineReaderTell(&hexHandle->lineReader);
+          /* Attempt to read the next line from the file. */
+          if (LineReaderGets(&hexHandle->lineReader, hexHandle->lineBuf,
+                             HEX_LINE_BUFFER_SIZE) == NULL)
+          {
+            /* An error occured or we reached the end of the file. Was it an error? */
+            if (LineReaderGetError(&hexHandle->lineReader) == TBX_TRUE)
+            {
+              /* Flag the error by updating the result and resetting the length. */
+              *len = 0;
+              result = NULL;
+              /* Rewind the file pointer as well. */
+              (void)LineReaderSeek(&hexHandle->lineReader, lineFPtr);
+            }
+            /* Stop looping when an error occurred or we reached the end of the file. */
+            dataReadDone = TBX_TRUE;
+            continue;
+          }
+
+          /* Still here, so a line was read fron the file. Attempt to extract data from
+           * the HEX record line.
+           */
+          parseResult = HexReaderParseLine(hexHandle, hexHandle->lineBuf, &lineAddress,
+                                            &lineDataLen, hexHandle->lineDataBuf);
+          /* Did an error occur during line parsing? */
+          if (parseResult != TBX_OK)
+          {
+            /* Flag the error by updating the result and resetting the length. */
+            *len = 0;
+            result = NULL;
+            /* Rewind the file pointer as well. */
+            (void)LineReaderSeek(&hexHandle->lineReader, lineFPtr);
+            dataReadDone = TBX_TRUE;
+            continue;
+          }
+        }
+
+        /* Still here so parsing was okay, but only continue if data was actually
+         * extracted. In the case of a non-data record the parsing can still be
+         * successful, but did not yield any extracted data bytes.
+         */
+        if (lineDataLen > 0U)
+        {
+          /* Was this the first chunk of data? */
+          if (*len == 0U)
+          {
+            /* Set the base address of the data. */
+            *address = lineAddress;
+          }
+          /* Does this newly read data still belong to the same segment? */
+          if ( (lineAddress < hexHandle->openedSegment->addr) ||
+               ((lineAddress + lineDataLen) >
+               (hexHandle->openedSegment->addr + hexHandle->openedSegment->len)) )
+          {
+            /* The data read from this line belongs to the a different segment. This
+             * means we are done and should not copy the data. Keep the line pending,
+             * because the data hasn't actually been processed.
+             */
+            hexHandle->linePending = TBX_TRUE;
+            hexHandle->pendingFPtr = lineFPtr;
+            hexHandle->pendingAddr = lineAddress;
+            hexHandle->pendingLen = lineDataLen;
+            dataReadDone = TBX_TRUE;
+            continue;
+          }
+          /* Data does belong to this segment. This means that it should fit right after
+           * the previously read data. Do a quick sanity check to make sure this is the
+           * case.
+           */
+          if (lineAddress != (*address + *len))
+          {
+            /* Flag the error by updating the result and resetting the length. */
+            *len = 0;
+            result = NULL;
+            /* Rewind the file pointer as well. */
+            (void)LineReaderSeek(&hexHandle->lineReader, lineFPtr);
+            dataReadDone = TBX_TRUE;
+            continue;
+
+          }
+          /* Still here so the newly read data does belong to the same segment, but we
+           * can only copy it, if there is still space in the data buffer.
+           */
+          if ((*len + lineDataLen) > (uint16_t)HEX_DATA_BUFFER_SIZE)
+          {
+            /* Data won't fit in the data buffer. This means we are done, but need to
+             * make sure to keep the line pending for the next time this function is
+             * called.
+             */
+            hexHandle->linePending = TBX_TRUE;
+            hexHandle->pendingFPtr = lineFPtr;
+            hexHandle->pendingAddr = lineAddress;
+            hexHandle->pendingLen = lineDataLen;
+            dataReadDone = TBX_TRUE;
+            continue;
+          }
+          /* Still here so we know that the data belongs to the same segment and that
+           * is will also still fit in the data buffer. Time to copy the data to the
+           * data buffer.
+           */
+          for (byteIdx = 0U; byteIdx < lineDataLen; byteIdx++)
+          {
+            hexHandle->dataBuf[*len + byteIdx] = hexHandle->lineDataBuf[byteIdx];
+          }
+          /* Update the data length. */
+          *len += lineDataLen;
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderSegmentGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Reads firmware data at a specific memory address. The read index is used to
+**            find the line closest before the address, so that only a few lines need to
+**            be parsed. Reading from the opened segment afterwards continues where it
+**            left off.
+** \param     instance Pointer to the reader instance, as created by HexReaderCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
+**
+****************************************************************************************/
+static uint8_t HexReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                               uint8_t * data)
+{
+  tHexHandle      * hexHandle = instance;
+  uint8_t           result = TBX_ERROR;
+  tSegTable const * readIndex;
+  tSegment const  * checkpoint;
+  FSIZE_t           restoreFPtr;
+  uint32_t          restoreAddrBase;
+  uint32_t          lineAddress;
+  uint8_t           lineDataLen;
+  uint32_t          checkpointOffset;
+  uint32_t          dataIdx = 0U;
+  uint32_t          copyOffset;
+  uint32_t          copyLen;
+  uint32_t          byteIdx;
+
+  /* Verify parameters. */
+  TBX_ASSERT((len > 0U) && (data != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((len > 0U) && (data != NULL))
+  {
+    /* Only continue if a file is actually opened. */
+    if (hexHandle->fileOpened == TBX_TRUE)
+    {
+      /* Determine where reading from the opened segment should continue afterwards. A
+       * pending line must be read again, because its data gets overwritten.
+       */
+      if (hexHandle->linePending == TBX_TRUE)
+      {
+        restoreFPtr = hexHandle->pendingFPtr;
+        hexHandle->linePending = TBX_FALSE;
+      }
+      else
+      {
+        restoreFPtr = LineReaderTell(&hexHandle->lineReader);
+      }
+      restoreAddrBase = hexHandle->addrBase;
+      /* Use the read index, if it was built. Otherwise reading starts at the first line
+       * of the segment.
+       */
+      readIndex = &hexHandle->readIndex;
+      if (SegTableGetCount(readIndex) == 0U)
+      {
+        readIndex = &hexHandle->segmentTable;
+      }
+      /* Set the result to success and only negate upon error detection from here on. */
+      result = TBX_OK;
+      /* Loop until all requested data is read. */
+      while ((dataIdx < len) && (result == TBX_OK))
+      {
+        /* Find the checkpoint with the line closest before the address and move the
+         * file pointer to this line.
+         */
+        checkpoint = SegTableFind(readIndex, address + dataIdx);
+        if ( (checkpoint == NULL) ||
+             (LineReaderSeek(&hexHandle->lineReader, checkpoint->fptr) != TBX_OK) )
+        {
+          /* No firmware data at this address or a read error. */
+          result = TBX_ERROR;
+          continue;
+        }
+        /* Restore the extended address that is in effect at this line. */
+        hexHandle->addrBase = checkpoint->base;
+        /* Read the checkpoint's lines, until all requested data in it is copied. */
+        checkpointOffset = 0U;
+        while ( (checkpointOffset < checkpoint->len) && (dataIdx < len) &&
+                (result == TBX_OK) )
+        {
+          /* Attempt to read and parse the next line. */
+          if ( (LineReaderGets(&hexHandle->lineReader, hexHandle->lineBuf,
+                               HEX_LINE_BUFFER_SIZE) == NULL) ||
+               (HexReaderParseLine(hexHandle, hexHandle->lineBuf, &lineAddress,
+                                   &lineDataLen, hexHandle->lineDataBuf) != TBX_OK) )
+          {
+            result = TBX_ERROR;
+            continue;
+          }
+          /* Only continue if data was actually extracted. */
+          if (lineDataLen > 0U)
+          {
+            /* The checkpoint's data is stored in consecutive lines. */
+            if (lineAddress != (checkpoint->addr + checkpointOffset))
+            {
+              result = TBX_ERROR;
+              continue;
+            }
+            checkpointOffset += lineDataLen;
+            /* Copy the line's data, starting at the next address that is requested. */
+            if ((lineAddress + lineDataLen) > (address + dataIdx))
+            {
+              copyOffset = (address + dataIdx) - lineAddress;
+              copyLen = lineDataLen - copyOffset;
+              if (copyLen > (len - dataIdx))
+              {
+                copyLen = len - dataIdx;
+              }
+              for (byteIdx = 0U; byteIdx < copyLen; byteIdx++)
+              {
+                data[dataIdx + byteIdx] = hexHandle->lineDataBuf[copyOffset + byteIdx];
+              }
+              dataIdx += copyLen;
+            }
+          }
+        }
+      }
+      /* Continue reading from the opened segment where it left off. */
+      hexHandle->addrBase = restoreAddrBase;
+      (void)LineReaderSeek(&hexHandle->lineReader, restoreFPtr);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderReadAt ***/
+
+
+/************************************************************************************//**
+** \brief     Parses an Intel HEX record line by extracting the address, length and
+**            data. Extended segment address (02) and extended linear address (04)
+**            records update the extended address in the handle, which is then added to
+**            the 16-bit address offset of all data (00) records that follow.
+** \param     hexHandle Pointer to the Intel HEX file handle.
+** \param     line    An Intel HEX record line.
+** \param     address Memory address of the data, including the extended address.
+** \param     len     Number of data bytes extracted from the data record.
+** \param     data    Byte array where the data bytes from the data record are stored.
+** \return    TBX_OK if the line was successfully parsed. TBX_ERROR if an error was
+**            detected during the line parsing. For example when the line contains an
+**            invalid checksum. Note that if the line was not a data record, then TBX_OK
+**            is still returned, but len will be set to 0 because no data was present
+**            and consequently extracted.
+** \attention If a NULL pointer is passed for the data parameter, the actual data
+**            extraction and storage in the data byte array is skipped.
+**
+****************************************************************************************/
+static uint8_t HexReaderParseLine(tHexHandle * hexHandle, char const * line,
+                                  uint32_t * address, uint8_t * len, uint8_t * data)
+{
+  uint8_t  result = TBX_ERROR;
+  uint8_t  charIdx = 1U; /* Point to the byte count value. */
+  uint8_t  byteIdx;
+  uint8_t  bytesOnLine = 0U;
+  uint8_t  recordType = 0U;
+  uint8_t  byteValue = 0U;
+  uint8_t  checksum;
+  uint16_t addressOffset = 0U;
+  uint32_t recordValue = 0U;
+
+  /* Verify parameters. Note that a NULL pointer for data is allowed. */
+  TBX_ASSERT((line != NULL) && (address != NULL) && (len != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((line != NULL) && (address != NULL) && (len != NULL))
+  {
+    /* All okay so far. Update the result accordingly and from now on only set an error
+     * value upon detection of a problem.
+     */
+    result = TBX_OK;
+    /* Default to no data being extracted. */
+    *len = 0U;
+
+    /* Only continue if the line starts with the ':' record mark. Other lines, such as
+     * empty lines at the end of the file, do not hold data to extract, which is not an
+     * error. The bytes on the line are decoded in a single pass, which extracts the
+     * address, record type and data, while calculating the checksum.
+     */
+    if (line[0] == ':')
+    {
+      /* Read out the number of data bytes on the line. */
+      if (LineReaderHexStringToByte(&line[charIdx], &bytesOnLine) != TBX_OK)
+      {
+        /* Invalid character detected on the line. Flag error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        /* Checksum starts with the byte count. */
+        checksum = bytesOnLine;
+        /* Extract the 16-bit address offset, which is stored in big endian byte order,
+         * followed by the record type.
+         */
+        for (byteIdx = 0U; (byteIdx < 3U) && (result == TBX_OK); byteIdx++)
+        {
+          /* Move character index two characters forward to the next byte. */
+          charIdx += 2U;
+          if (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK)
+          {
+            /* Invalid character detected on the line. Flag error. */
+            result = TBX_ERROR;
+          }
+          else if (byteIdx < 2U)
+          {
+            addressOffset = (uint16_t)((addressOffset << 8U) | byteValue);
+            checksum += byteValue;
+          }
+          else
+          {
+            recordType = byteValue;
+            checksum += byteValue;
+          }
+        }
+        /* Extract the data bytes. Skip the copying if a NULL pointer was passed for
+         * data, or if this is not a data record. Note that the data bytes still need
+         * to be decoded for the checksum.
+         */
+        for (byteIdx = 0U; (byteIdx < bytesOnLine) && (result == TBX_OK); byteIdx++)
+        {
+          /* Move character index two characters forward to the next byte. */
+          charIdx += 2U;
+          if (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK)
+          {
+            /* Invalid character detected on the line. Flag error. */
+            result = TBX_ERROR;
+          }
+          else
+          {
+            checksum += byteValue;
+            recordValue = (recordValue << 8U) | byteValue;
+            if ((data != NULL) && (recordType == 0U))
+            {
+              data[byteIdx] = byteValue;
+            }
+          }
+        }
+        /* Only continue if all bytes were successfully decoded. */
+        if (result == TBX_OK)
+        {
+          /* The checksum is the 2-complement of the least significant byte of the sum
+           * of all the other bytes on the line. This means that the sum of all bytes,
+           * including the checksum itself, must be zero.
+           */
+          charIdx += 2U;
+          if (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK)
+          {
+            /* Invalid character detected on the line. Flag error. */
+            result = TBX_ERROR;
+          }
+          else
+          {
+            checksum += byteValue;
+            if (checksum != 0U)
+            {
+              /* Flag error due to incorrect checksum on the record line. */
+              result = TBX_ERROR;
+            }
+          }
+        }
+      }
+
+      /* Only process the record contents if it was successfully decoded. */
+      if (result == TBX_OK)
+      {
+        switch (recordType)
+        {
+          /* Data record. */
+          case 0U:
+            *address = hexHandle->addrBase + addressOffset;
+            *len = bytesOnLine;
+            break;
+          /* Extended segment address record. Holds bits 4..19 of the address. */
+          case 2U:
+            if (bytesOnLine != 2U)
+            {
+              result = TBX_ERROR;
+            }
+            else
+            {
+              hexHandle->addrBase = recordValue << 4U;
+            }
+            break;
+          /* Extended linear address record. Holds bits 16..31 of the address. */
+          case 4U:
+            if (bytesOnLine != 2U)
+            {
+              result = TBX_ERROR;
+            }
+            else
+            {
+              hexHandle->addrBase = recordValue << 16U;
+            }
+            break;
+          /* End of file, start segment address and start linear address records. These
+           * do not hold data to extract.
+           */
+          case 1U:
+          case 3U:
+          case 5U:
+            break;
+          /* Unknown record type. */
+          default:
+            result = TBX_ERROR;
+            break;
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of HexReaderParseLine ***/
+
+
+/*********************************** end of hexreader.c ********************************/
@@ -0,0 +1,76 @@
+/************************************************************************************//**
+* \file         hexreader.h
+* \brief        Intel HEX firmware file reader header file.
+* \ingroup      HexReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HexReader Intel HEX reader
+* \brief      This module implements the Intel HEX firmware reader that can be linked
+*             to the Firmware module.
+* \ingroup    Firmware
+* \details
+* This Intel HEX reader module implements functionality for parsing a firmware file in
+* the Intel HEX format. Both the extended segment address and the extended linear
+* address records are supported, so 20-bit and 32-bit addresses can be used.
+****************************************************************************************/
+#ifndef HEXREADER_H
+#define HEXREADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Maximum number of firmware data bytes between two checkpoints of the read
+ *         index. The read index is built when opening a firmware file and stores the
+ *         file pointer of a line for every so many bytes of firmware data. A smaller
+ *         value speeds up reading data at a specific memory address, at the expense of
+ *         more RAM for the read index. Set it to 0 to disable the read index.
+ */
+#ifndef HEX_READ_INDEX_INTERVAL
+#define HEX_READ_INDEX_INTERVAL        (4096U)
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tFirmwareReader const * HexReaderGet(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEXREADER_H */
+/*********************************** end of hexreader.h ********************************/
@@ -0,0 +1,404 @@
+/************************************************************************************//**
+* \file         linereader.c
+* \brief        Line reader source file.
+* \ingroup      LineReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "linereader.h"                     /* Line reader                             */
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (LINE_READER_BLOCK_SIZE == 0U) || (LINE_READER_BLOCK_SIZE > 32768U)
+#error "LINE_READER_BLOCK_SIZE must be in the range 1..32768"
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t LineReaderFill(tLineReader * reader);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Lookup table to convert a hexadecimal ASCII character to its 4-bit value. The
+ *         table is indexed by the character value. Characters that are not hexadecimal
+ *         digits map to 0xFF. This is a lot faster than searching through a table with
+ *         character and value pairs.
+ */
+static const uint8_t lineHexNibbleTbl[256] =
+{
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U,
+  0x08U, 0x09U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
+
+/************************************************************************************//**
+** \brief     Initializes the line reader for the specified file. Should be called after
+**            opening the file. Reading starts at the current file pointer.
+** \param     reader Pointer to the line reader.
+** \param     file Pointer to the FatFS file object handle of the opened file.
+**
+****************************************************************************************/
+void LineReaderInit(tLineReader * reader, FIL * file)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((reader != NULL) && (file != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((reader != NULL) && (file != NULL))
+  {
+    /* Initialize the line reader members. The block buffer starts out empty. */
+    reader->file = file;
+    reader->blockFPtr = f_tell(file);
+    reader->blockLen = 0U;
+    reader->blockIdx = 0U;
+    reader->error = TBX_FALSE;
+  }
+} /*** end of LineReaderInit ***/
+
+
+/************************************************************************************//**
+** \brief     Reads the next line from the file. Works similar to FatFS function
+**            f_gets(). Reading stops after the newline character was stored or when
+**            the line buffer is full. The line is always terminated with a null
+**            character.
+** \param     reader Pointer to the line reader.
+** \param     line Pointer to the line buffer.
+** \param     size Size of the line buffer in bytes.
+** \return    Pointer to the line buffer if successful, NULL when an error occurred or
+**            the end of the file was reached. Use LineReaderGetError() to find out which
+**            one of the two it was.
+**
+****************************************************************************************/
+char * LineReaderGets(tLineReader * reader, char * line, uint16_t size)
+{
+  char     * result = NULL;
+  uint16_t   charIdx = 0U;
+  uint8_t    done = TBX_FALSE;
+  char       character;
+
+  /* Verify parameters. */
+  TBX_ASSERT((reader != NULL) && (line != NULL) && (size > 0U));
+
+  /* Only continue with valid parameters. */
+  if ((reader != NULL) && (line != NULL) && (size > 0U))
+  {
+    /* Set the result to the valid line buffer, which indicates success. From now on
+     * only set it to NULL, in case an error was detected.
+     */
+    result = line;
+    /* Copy characters until the line buffer is full. */
+    while ((charIdx < (size - 1U)) && (done == TBX_FALSE))
+    {
+      /* Refill the block buffer when all its bytes were read. */
+      if (reader->blockIdx >= reader->blockLen)
+      {
+        if (LineReaderFill(reader) != TBX_OK)
+        {
+          /* Read error. Flag it. */
+          result = NULL;
+          done = TBX_TRUE;
+        }
+        /* Stop at the end of the file. */
+        else if (reader->blockLen == 0U)
+        {
+          done = TBX_TRUE;
+        }
+        else
+        {
+          /* Block buffer refilled. Nothing else to do here. */
+        }
+      }
+      /* Copy the next character to the line buffer, if one is available. */
+      if (done == TBX_FALSE)
+      {
+        character = (char)reader->block[reader->blockIdx];
+        reader->blockIdx++;
+        line[charIdx] = character;
+        charIdx++;
+        /* Stop once the end of the line was reached. */
+        if (character == '\n')
+        {
+          done = TBX_TRUE;
+        }
+      }
+    }
+    /* Terminate the line. */
+    line[charIdx] = '\0';
+    /* Nothing read means the end of the file was reached. */
+    if (charIdx == 0U)
+    {
+      result = NULL;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderGets ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the file pointer of the next byte to read, for example the start of
+**            the next line. This does not involve FatFS.
+** \param     reader Pointer to the line reader.
+** \return    File pointer of the next byte to read.
+**
+****************************************************************************************/
+FSIZE_t LineReaderTell(tLineReader const * reader)
+{
+  FSIZE_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(reader != NULL);
+
+  /* Only continue with valid parameter. */
+  if (reader != NULL)
+  {
+    result = reader->blockFPtr + reader->blockIdx;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderTell ***/
+
+
+/************************************************************************************//**
+** \brief     Sets the file pointer of the next byte to read. In case this file pointer
+**            lies within the current block buffer, then FatFS is not involved.
+**            Otherwise the block that holds the file pointer is read.
+** \param     reader Pointer to the line reader.
+** \param     fptr File pointer of the next byte to read.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t LineReaderSeek(tLineReader * reader, FSIZE_t fptr)
+{
+  uint8_t result = TBX_ERROR;
+  FSIZE_t blockStart;
+
+  /* Verify parameter. */
+  TBX_ASSERT(reader != NULL);
+
+  /* Only continue with valid parameter. */
+  if (reader != NULL)
+  {
+    /* Does the file pointer lie within the current block buffer? */
+    if ( (fptr >= reader->blockFPtr) &&
+         (fptr <= (reader->blockFPtr + reader->blockLen)) )
+    {
+      /* Only the index needs to be updated. */
+      reader->blockIdx = (uint16_t)(fptr - reader->blockFPtr);
+      result = TBX_OK;
+    }
+    else
+    {
+      /* Move the file pointer to the start of the block that holds the new file
+       * pointer.
+       */
+      blockStart = fptr - (fptr % LINE_READER_BLOCK_SIZE);
+      if (f_lseek(reader->file, blockStart) == FR_OK)
+      {
+        /* Empty the block buffer, such that the refill starts at the block start. */
+        reader->blockFPtr = blockStart;
+        reader->blockLen = 0U;
+        reader->blockIdx = 0U;
+        /* Read the block. */
+        result = LineReaderFill(reader);
+        if (result == TBX_OK)
+        {
+          /* Position the index on the new file pointer. */
+          if ((fptr - blockStart) <= reader->blockLen)
+          {
+            reader->blockIdx = (uint16_t)(fptr - blockStart);
+          }
+          /* The file pointer lies past the end of the file. */
+          else
+          {
+            result = TBX_ERROR;
+          }
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderSeek ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if a file read error occurred since the line reader was
+**            initialized.
+** \param     reader Pointer to the line reader.
+** \return    TBX_TRUE if a read error occurred, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+uint8_t LineReaderGetError(tLineReader const * reader)
+{
+  uint8_t result = TBX_TRUE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(reader != NULL);
+
+  /* Only continue with valid parameter. */
+  if (reader != NULL)
+  {
+    result = reader->error;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderGetError ***/
+
+
+/************************************************************************************//**
+** \brief     Converts a sequence of 2 characters that represent a hexadecimal value
+**            to the actual byte value. Shared by the firmware file readers for text
+**            based firmware file formats.
+**              Example: LineReaderHexStringToByte("2f", &value)  --> value is 47.
+** \param     hexstring String beginning with 2 characters that represent a hexa-
+**            decimal value.
+** \param     value Pointer where the resulting byte value is stored.
+** \return    TBX_OK if both characters are hexadecimal digits, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t LineReaderHexStringToByte(char const * hexstring, uint8_t * value)
+{
+  uint8_t result = TBX_ERROR;
+  uint8_t highNibble;
+  uint8_t lowNibble;
+
+  /* Verify parameters. */
+  TBX_ASSERT((hexstring != NULL) && (value != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((hexstring != NULL) && (value != NULL))
+  {
+    /* Convert the first hexadecimal ASCII character to its 4-bit value. Note that the
+     * typecast to an unsigned 8-bit value is needed to index the lookup table.
+     */
+    highNibble = lineHexNibbleTbl[(uint8_t)hexstring[0]];
+    /* Only look at the second character if the first one is valid. This prevents
+     * reading past the string's terminating character.
+     */
+    if (highNibble <= 0x0FU)
+    {
+      lowNibble = lineHexNibbleTbl[(uint8_t)hexstring[1]];
+      if (lowNibble <= 0x0FU)
+      {
+        /* Construct the actual resulting byte value from the nibbles. */
+        *value = (uint8_t)(highNibble << 4U) | lowNibble;
+        result = TBX_OK;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderHexStringToByte ***/
+
+
+/************************************************************************************//**
+** \brief     Reads the next block from the file into the block buffer. At the end of
+**            the file the block buffer is empty afterwards.
+** \param     reader Pointer to the line reader.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t LineReaderFill(tLineReader * reader)
+{
+  uint8_t result = TBX_OK;
+  UINT    bytesRead = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(reader != NULL);
+
+  /* The next block starts directly after the current one. */
+  reader->blockFPtr += reader->blockLen;
+  reader->blockLen = 0U;
+  reader->blockIdx = 0U;
+  /* Read the block. */
+  if (f_read(reader->file, reader->block, LINE_READER_BLOCK_SIZE, &bytesRead) != FR_OK)
+  {
+    /* Flag the error. */
+    reader->error = TBX_TRUE;
+    result = TBX_ERROR;
+  }
+  else
+  {
+    reader->blockLen = (uint16_t)bytesRead;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of LineReaderFill ***/
+
+
+/*********************************** end of linereader.c *******************************/
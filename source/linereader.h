@@ -0,0 +1,106 @@
+/************************************************************************************//**
+* \file         linereader.h
+* \brief        Line reader header file.
+* \ingroup      LineReader
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   LineReader Line reader
+* \brief      This module implements block buffered reading of lines from a text file.
+* \ingroup    Firmware
+* \details
+* The firmware file readers for text based firmware file formats, such as S-record and
+* Intel HEX, process the firmware file one line at a time. Reading the lines with the
+* FatFS function f_gets() results in a call to f_read() for each individual character.
+* This line reader module reads the file in large blocks instead and splits the lines in
+* memory. It keeps track of the file pointer itself, such that obtaining the file
+* pointer of a line does not involve FatFS and rewinding to a line that is still in the
+* block buffer does not involve FatFS either. The blocks are aligned to the block size,
+* so with a block size that is a multiple of the sector size, FatFS can transfer entire
+* sectors directly. The module also offers the conversion of hexadecimal characters to
+* byte values, which both these firmware file formats need for parsing a line.
+****************************************************************************************/
+#ifndef LINEREADER_H
+#define LINEREADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Size of the block buffer in bytes. Each firmware file reader that uses the
+ *         line reader has its own block buffer. Preferably a multiple of the sector
+ *         size, for example in the range from 512 to 4096 bytes.
+ */
+#ifndef LINE_READER_BLOCK_SIZE
+#define LINE_READER_BLOCK_SIZE         (512U)
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Structure that groups all the information of a line reader. */
+typedef struct
+{
+  /** \brief Pointer to the FatFS file object handle of the opened file. */
+  FIL      * file;
+  /** \brief File pointer inside the file of the first byte in the block buffer. */
+  FSIZE_t    blockFPtr;
+  /** \brief Number of valid bytes in the block buffer. */
+  uint16_t   blockLen;
+  /** \brief Index into the block buffer of the next byte to read. */
+  uint16_t   blockIdx;
+  /** \brief Boolean flag to keep track of a file read error. */
+  uint8_t    error;
+  /** \brief Block buffer with data read from the file. */
+  uint8_t    block[LINE_READER_BLOCK_SIZE];
+} tLineReader;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void    LineReaderInit(tLineReader * reader, FIL * file);
+char  * LineReaderGets(tLineReader * reader, char * line, uint16_t size);
+FSIZE_t LineReaderTell(tLineReader const * reader);
+uint8_t LineReaderSeek(tLineReader * reader, FSIZE_t fptr);
+uint8_t LineReaderGetError(tLineReader const * reader);
+uint8_t LineReaderHexStringToByte(char const * hexstring, uint8_t * value);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LINEREADER_H */
+/*********************************** end of linereader.h *******************************/
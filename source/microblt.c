@@ -41,6 +41,37 @@
 #include "xcploader.h"                      /* XCP loader module                       */
 #include "firmware.h"                       /* Firmware reader module                  */
 #include "srecreader.h"                     /* S-record firmware file reader           */
+#include "hexreader.h"                      /* Intel HEX firmware file reader          */
+#include "binreader.h"                      /* Binary firmware file reader             */
+#include "pipeline.h"                       /* Firmware update pipeline module         */
+#include "delta.h"                          /* Differential update module              */
+#include "verify.h"                         /* Firmware verification module            */
+#include "scheduler.h"                      /* Multi-node update scheduler module      */
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Default session context that the BltSessionXxx() functions operate on. */
+static tBltSessionCtx  * bltSession = NULL;
+
+/** \brief Default firmware context that the BltFirmwareXxx() functions operate on. */
+static tBltFirmwareCtx * bltFirmware = NULL;
+
+/** \brief Default pipeline context that the BltPipelineXxx() functions operate on. It is
+ *         created upon first use.
+ */
+static tBltPipelineCtx * bltPipeline = NULL;
+
+/** \brief Default delta context that the BltDeltaXxx() functions operate on. It is
+ *         created upon first use.
+ */
+static tBltDeltaCtx * bltDelta = NULL;
+
+/** \brief Default scheduler context that the BltSchedulerXxx() functions operate on. It
+ *         is created upon first use.
+ */
+static tBltSchedulerCtx * bltScheduler = NULL;
 
 
 /****************************************************************************************
@@ -82,7 +113,9 @@ void BltPortTerminate(void)
 /************************************************************************************//**
 ** \brief     Initializes the firmware update session for a specific communication
 **            protocol. This function is typically called once at the start of the
-**            firmware update.
+**            firmware update. It creates the default session context, which all other
+**            BltSessionXxx() functions operate on. It communicates through the port
+**            that was linked with BltPortInit().
 ** \param     type The communication protocol to use for this session. It should
 **            be a BLT_SESSION_xxx value.
 ** \param     settings Pointer to a structure with communication protocol specific
@@ -91,34 +124,10 @@ void BltPortTerminate(void)
 ****************************************************************************************/
 void BltSessionInit(uint32_t type, void const * settings)
 {
-  /* Check parameters. Note that the settings-pointers are allowed to be NULL in case
-   * no additional settings are needed for the specified session or transport type.
-   */
-  TBX_ASSERT(type == BLT_SESSION_XCP_V10);
-
-  /* Initialize the correct session. */
-  if (type == BLT_SESSION_XCP_V10)
-  {
-    /* Verify settings parameter because the XCP loader requires them. */
-    TBX_ASSERT(settings != NULL);
-    /* Only continue if the settings parameter is valid. */
-    if (settings != NULL)
-    {
-      /* Cast session settings to the correct type. */
-      tBltSessionSettingsXcpV10 const * bltSessionSettingsXcpV10Ptr = settings;
-      /* Convert session settings to the format supported by the XCP loader module. */
-      tXcpLoaderSettings xcpLoaderSettings;
-      xcpLoaderSettings.timeoutT1   = bltSessionSettingsXcpV10Ptr->timeoutT1;
-      xcpLoaderSettings.timeoutT3   = bltSessionSettingsXcpV10Ptr->timeoutT3;
-      xcpLoaderSettings.timeoutT4   = bltSessionSettingsXcpV10Ptr->timeoutT4;
-      xcpLoaderSettings.timeoutT5   = bltSessionSettingsXcpV10Ptr->timeoutT5;
-      xcpLoaderSettings.timeoutT6   = bltSessionSettingsXcpV10Ptr->timeoutT6;
-      xcpLoaderSettings.timeoutT7   = bltSessionSettingsXcpV10Ptr->timeoutT7;
-      xcpLoaderSettings.connectMode = bltSessionSettingsXcpV10Ptr->connectMode;
-      /* Perform actual session initialization. */
-      SessionInit(XcpLoaderGetProtocol(), &xcpLoaderSettings);
-    }
-  }
+  /* Release the default session context, in case it was already created. */
+  BltSessionTerminate();
+  /* Create the default session context. */
+  bltSession = BltSessionCtxCreate(type, settings, NULL);
 } /*** end of BltSessionInit ***/
 
 
@@ -129,8 +138,12 @@ void BltSessionInit(uint32_t type, void const * settings)
 ****************************************************************************************/
 void BltSessionTerminate(void)
 {
-  /* Terminate the session. */
-  SessionTerminate();
+  /* Release the default session context, if it was created. */
+  if (bltSession != NULL)
+  {
+    BltSessionCtxDestroy(bltSession);
+    bltSession = NULL;
+  }
 } /*** end of BltSessionTerminate ***/
 
 
@@ -143,13 +156,8 @@ void BltSessionTerminate(void)
 ****************************************************************************************/
 uint8_t BltSessionStart(void)
 {
-  uint8_t result;
-
-  /* Attempt to start the session. */
-  result = SessionStart();
-
-  /* Give the result back to the caller. */
-  return result;
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxStart(bltSession);
 } /*** end of BltSessionStart ***/
 
 
@@ -160,8 +168,8 @@ uint8_t BltSessionStart(void)
 ****************************************************************************************/
 void BltSessionStop(void)
 {
-  /* Stop the session. */
-  SessionStop();
+  /* Pass the request on to the default session context. */
+  BltSessionCtxStop(bltSession);
 } /*** end of BltSessionStop ***/
 
 
@@ -178,19 +186,8 @@ void BltSessionStop(void)
 ****************************************************************************************/
 uint8_t BltSessionClearMemory(uint32_t address, uint32_t len)
 {
-  uint8_t result = TBX_OK;
-
-  /* Check parameters. */
-  TBX_ASSERT(len > 0U);
-
-  /* Only continue if the parameters are valid. */
-  if (len > 0U)
-  {
-    /* Pass the request on to the session module. */
-    result = SessionClearMemory(address, len);
-  }
-  /* Give the result back to the caller. */
-  return result;
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxClearMemory(bltSession, address, len);
 } /*** end of BltSessionClearMemory ***/
 
 
@@ -206,19 +203,8 @@ uint8_t BltSessionClearMemory(uint32_t address, uint32_t len)
 ****************************************************************************************/
 uint8_t BltSessionWriteData(uint32_t address, uint32_t len, uint8_t const * data)
 {
-  uint8_t result = TBX_ERROR;
-
-  /* Check parameters. */
-  TBX_ASSERT((data != NULL) && (len > 0U));
-
-  /* Only continue if the parameters are valid. */
-  if ((data != NULL) && (len > 0U))
-  {
-    /* Pass the request on to the session module. */
-    result = SessionWriteData(address, len, data);
-  }
-  /* Give the result back to the caller. */
-  return result;
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxWriteData(bltSession, address, len, data);
 } /*** end of BltSessionWriteData ***/
 
 
@@ -234,193 +220,1741 @@ uint8_t BltSessionWriteData(uint32_t address, uint32_t len, uint8_t const * data
 ****************************************************************************************/
 uint8_t BltSessionReadData(uint32_t address, uint32_t len, uint8_t * data)
 {
-  uint8_t result = TBX_ERROR;
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxReadData(bltSession, address, len, data);
+} /*** end of BltSessionReadData ***/
 
-  /* Check parameters. */
-  TBX_ASSERT((data != NULL) && (len > 0U));
 
-  /* Only continue if the parameters are valid. */
-  if ((data != NULL) && (len > 0U))
-  {
-    /* Pass the request on to the session module. */
-    result = SessionReadData(address, len, data);
-  }
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of BltSessionReadData ***/
+/************************************************************************************//**
+** \brief     Starts the asynchronous programming of the specified data to memory. This
+**            function does not block. Call BltSessionTask() continuously to progress the
+**            operation, until it no longer reports BLT_SESSION_STATUS_BUSY. Note that it
+**            is the responsibility of the application to make sure the memory range was
+**            erased beforehand.
+** \param     address The starting memory address for the write operation.
+** \param     len The number of bytes in the data buffer that should be written.
+** \param     data Pointer to the byte array with data to write. It must stay valid until
+**            the operation completed.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionWriteDataAsync(uint32_t address, uint32_t len, uint8_t const * data)
+{
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxWriteDataAsync(bltSession, address, len, data);
+} /*** end of BltSessionWriteDataAsync ***/
 
 
-/****************************************************************************************
-*             F I R M W A R E   F I L E   R E A D E R
+/************************************************************************************//**
+** \brief     Starts the asynchronous erase of the specified range of memory on the
+**            target. This function does not block. Call BltSessionTask() continuously
+**            to progress the operation, until it no longer reports
+**            BLT_SESSION_STATUS_BUSY. This way the application can do other work, such
+**            as reading firmware data, while the target erases its memory.
+** \param     address The starting memory address for the erase operation.
+** \param     len The total number of bytes to erase from memory.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
 ****************************************************************************************/
+uint8_t BltSessionClearMemoryAsync(uint32_t address, uint32_t len)
+{
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxClearMemoryAsync(bltSession, address, len);
+} /*** end of BltSessionClearMemoryAsync ***/
+
+
 /************************************************************************************//**
-** \brief     Initializes the firmware reader module for a specified firmware file
-**            reader. Typically called once upon application initialization.
-** \param     readerType The firmware file reader to use in this module. It should be a
-**            BLT_FIRMWARE_READER_xxx value.
+** \brief     Continues the asynchronous operation that is in progress. This function
+**            does not block and should be called continuously, for example from the
+**            application's main loop, until it no longer reports
+**            BLT_SESSION_STATUS_BUSY.
+** \return    BLT_SESSION_STATUS_BUSY while the operation is in progress,
+**            BLT_SESSION_STATUS_DONE when it completed successfully and
+**            BLT_SESSION_STATUS_ERROR when it completed with an error.
 **
 ****************************************************************************************/
-void BltFirmwareInit(uint8_t readerType)
+uint8_t BltSessionTask(void)
 {
-  tFirmwareReader const * firmwareReader;
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxTask(bltSession);
+} /*** end of BltSessionTask ***/
 
-  /* Process the reader type. */
-  switch (readerType)
-  {
-    /* Reader for S-record firmware files. */
-    case BLT_FIRMWARE_READER_SRECORD:
-      firmwareReader = SRecReaderGet();
-      break;
-      /* Unsupported reader type specified. */
-    default:
-      firmwareReader = NULL;
-      break;
-  }
 
-  /* Verify that a valid firmware reader was set. */
-  TBX_ASSERT(firmwareReader != NULL)
+/************************************************************************************//**
+** \brief     Requests the target to build a checksum over the specified range of
+**            memory. The target selects the checksum type. The function fails if the
+**            range exceeds the maximum number of bytes that the target builds a
+**            checksum over.
+** \param     address The starting memory address of the range.
+** \param     len The number of bytes in the range.
+** \param     type The checksum type that the target used, is written to this pointer.
+**            It is one of the BLT_CHECKSUM_TYPE_xxx values, possibly combined with the
+**            BLT_CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionBuildChecksum(uint32_t address, uint32_t len, uint8_t * type,
+                                uint32_t * checksum)
+{
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxBuildChecksum(bltSession, address, len, type, checksum);
+} /*** end of BltSessionBuildChecksum ***/
 
-  /* Only continue if a valid firmware reader was set. */
-  if (firmwareReader != NULL)
-  {
-    /* Initialize the firmware reader module by linking the firmware file reader. */
-    FirmwareInit(firmwareReader);
-  }
-} /*** end of BltFirmwareInit ***/
+
+/************************************************************************************//**
+** \brief     Verifies that the firmware data on the target matches the firmware data in
+**            the opened firmware file. Instead of reading back all firmware data, the
+**            target builds a checksum over each segment, which is compared with the
+**            checksum of the segment's firmware data in the file. Make sure the
+**            firmware file is opened and the session is started, before calling this
+**            function.
+** \return    TBX_OK if the firmware data matches, TBX_ERROR if it does not match or the
+**            target could not build the checksums.
+**
+****************************************************************************************/
+uint8_t BltSessionVerify(void)
+{
+  /* Pass the request on to the default session and firmware contexts. */
+  return BltSessionCtxVerify(bltSession, bltFirmware);
+} /*** end of BltSessionVerify ***/
 
 
 /************************************************************************************//**
-** \brief     Terminates the firmware reader module. Typically called at the end of the
-**            application when the firmware reader module is no longer needed.
+** \brief     Obtains the statistics that were collected since the last reset. Per
+**            command that was sent to the target, they hold the number of packets,
+**            bytes, negative responses and timeouts, and the round-trip latency. They
+**            also hold the total time spent on erasing and programming, and the time
+**            that the default firmware context spent on parsing the firmware file.
+** \param     stats Pointer to where the statistics are copied to.
 **
 ****************************************************************************************/
-void BltFirmwareTerminate(void)
+void BltSessionGetStats(tStats * stats)
 {
-  /* Pass the request on to the firmware reader module. */
-  FirmwareTerminate();
-} /*** end of BltFirmwareTerminate ***/
+  /* Pass the request on to the default session context. */
+  BltSessionCtxGetStats(bltSession, stats);
+  /* Add the parse time of the default firmware context, if it was created. */
+  if ((stats != NULL) && (bltFirmware != NULL))
+  {
+    stats->parseTime = FirmwareGetParseTime(bltFirmware);
+  }
+} /*** end of BltSessionGetStats ***/
 
 
 /************************************************************************************//**
-** \brief     Opens the firmware file and browses through its contents to collect
-**            information about the firmware data segments it contains.
-** \param     firmwareFile Firmware filename including its full path.
-** \return    TBX_OK if successful, TBX_ERROR otherwise.
+** \brief     Resets the collected statistics and empties the trace ring buffer. Call it
+**            right before the firmware update to only collect statistics about the
+**            firmware update.
 **
 ****************************************************************************************/
-uint8_t BltFirmwareFileOpen(char const * firmwareFile)
+void BltSessionResetStats(void)
 {
-  /* Pass the request on to the firmware reader module. */
-  return FirmwareFileOpen(firmwareFile);
-} /*** end of BltFirmwareFileOpen ***/
+  /* Pass the request on to the default session context. */
+  BltSessionCtxResetStats(bltSession);
+  /* Also reset the parse time of the default firmware context, if it was created. */
+  if (bltFirmware != NULL)
+  {
+    FirmwareResetParseTime(bltFirmware);
+  }
+} /*** end of BltSessionResetStats ***/
 
 
 /************************************************************************************//**
-** \brief     Closes the previously opened firmware file.
+** \brief     Writes the contents of the trace ring buffer to a file, as comma separated
+**            values. Tracing is enabled by setting macro STATS_TRACE_SIZE to the number
+**            of packet exchanges to keep in the trace ring buffer.
+** \param     file Path of the file to create. An existing file is overwritten.
+** \return    TBX_OK if successful, TBX_ERROR if tracing is disabled or the file could
+**            not be written.
 **
 ****************************************************************************************/
-void BltFirmwareFileClose(void)
+uint8_t BltSessionTraceDump(char const * file)
 {
-  /* Pass the request on to the firmware reader module. */
-  FirmwareFileClose();
-} /*** end of BltFirmwareFileClose ***/
+  /* Pass the request on to the default session context. */
+  return BltSessionCtxTraceDump(bltSession, file);
+} /*** end of BltSessionTraceDump ***/
 
 
 /************************************************************************************//**
-** \brief     Obtains the total number of data bytes present in all segments of the
-**            firmware file.
-** \return    Total number of data bytes.
+** \brief     Creates a session context for a specific communication protocol. Unlike
+**            the default session context of BltSessionInit(), multiple session
+**            contexts can exist at the same time, each with their own port. This makes
+**            it possible to perform a firmware update on multiple targets concurrently.
+**            The session context is allocated from the memory pool.
+** \param     type The communication protocol to use for this session. It should
+**            be a BLT_SESSION_xxx value.
+** \param     settings Pointer to a structure with communication protocol specific
+**            settings.
+** \param     port The port to communicate with the target through. It must stay valid
+**            as long as the session context exists. NULL to use the port that was
+**            linked with BltPortInit().
+** \return    Pointer to the session context if successful, NULL otherwise.
 **
 ****************************************************************************************/
-uint32_t BltFirmwareGetTotalSize(void)
+tBltSessionCtx * BltSessionCtxCreate(uint32_t type, void const * settings,
+                                     tPort const * port)
 {
-  uint32_t result = 0U;
-  uint8_t  segmentIdx;
-  uint32_t segmentAddress = 0U;
+  tBltSessionCtx * result = NULL;
+  tPort const    * sessionPort = port;
 
-  /* Loop through all segments. */
-  for (segmentIdx = 0; segmentIdx < BltFirmwareSegmentGetCount(); segmentIdx++)
+  /* Check parameters. Note that the settings-pointers are allowed to be NULL in case
+   * no additional settings are needed for the specified session or transport type.
+   */
+  TBX_ASSERT(type == BLT_SESSION_XCP_V10);
+
+  /* Use the port that was linked with BltPortInit(), if none was specified. */
+  if (sessionPort == NULL)
   {
-    /* Obtain info about the next segment and add the segment's length to the result. */
-    result += BltFirmwareSegmentGetInfo(segmentIdx, &segmentAddress);
+    sessionPort = PortGet();
   }
 
+  /* Create the correct session. */
+  if (type == BLT_SESSION_XCP_V10)
+  {
+    /* Verify settings parameter because the XCP loader requires them. */
+    TBX_ASSERT(settings != NULL);
+    /* Only continue if the settings parameter is valid. */
+    if (settings != NULL)
+    {
+      /* Cast session settings to the correct type. */
+      tBltSessionSettingsXcpV10 const * bltSessionSettingsXcpV10Ptr = settings;
+      /* Convert session settings to the format supported by the XCP loader module. */
+      tXcpLoaderSettings xcpLoaderSettings;
+      xcpLoaderSettings.timeoutT1   = bltSessionSettingsXcpV10Ptr->timeoutT1;
+      xcpLoaderSettings.timeoutT3   = bltSessionSettingsXcpV10Ptr->timeoutT3;
+      xcpLoaderSettings.timeoutT4   = bltSessionSettingsXcpV10Ptr->timeoutT4;
+      xcpLoaderSettings.timeoutT5   = bltSessionSettingsXcpV10Ptr->timeoutT5;
+      xcpLoaderSettings.timeoutT6   = bltSessionSettingsXcpV10Ptr->timeoutT6;
+      xcpLoaderSettings.timeoutT7   = bltSessionSettingsXcpV10Ptr->timeoutT7;
+      xcpLoaderSettings.connectMode = bltSessionSettingsXcpV10Ptr->connectMode;
+      /* Perform actual session creation. */
+      result = SessionCreate(XcpLoaderGetProtocol(), &xcpLoaderSettings, sessionPort);
+    }
+  }
   /* Give the result back to the caller. */
   return result;
-} /*** end of BltFirmwareGetTotalSize ***/
+} /*** end of BltSessionCtxCreate ***/
 
 
 /************************************************************************************//**
-** \brief     Obtains the total number of firmware data segments encountered in the
-**            firmware file. A firmware data segment consists of a consecutive block
-**            of firmware data. A firmware file always has at least one segment. However,
-**            it can have more as well. For example if there is a gap between the vector
-**            table and the other program data.
-** \return    Total number of firmware data segments present in the firmware file.
+** \brief     Releases a session context. A session that is still in progress is
+**            stopped first.
+** \param     session The session context, as created by BltSessionCtxCreate().
 **
 ****************************************************************************************/
-uint8_t BltFirmwareSegmentGetCount(void)
+void BltSessionCtxDestroy(tBltSessionCtx * session)
 {
-  /* Pass the request on to the firmware reader module. */
-  return FirmwareSegmentGetCount();
-} /*** end of BltFirmwareSegmentGetCount ***/
+  /* Pass the request on to the session module. */
+  SessionDestroy(session);
+} /*** end of BltSessionCtxDestroy ***/
 
 
 /************************************************************************************//**
-** \brief     Obtains information about the specified segment, such as the base memory
-**            address that its data belongs to and the total number of data bytes in the
-**            segment.
-** \param     idx Zero-based segment index. Valid values are between 0 and
-**            (BltFirmwareSegmentGetCount() - 1).
-** \param     address The base memory address of the segment's data is written to this
-**            pointer.
-** \return    The total number of data bytes inside this segment.
+** \brief     Same as BltSessionStart(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint32_t BltFirmwareSegmentGetInfo(uint8_t idx, uint32_t * address)
+uint8_t BltSessionCtxStart(tBltSessionCtx * session)
 {
-  /* Pass the request on to the firmware reader module. */
-  return FirmwareSegmentGetInfo(idx, address);
-} /*** end of BltFirmwareSegmentGetInfo ***/
+  /* Pass the request on to the session module. */
+  return SessionStart(session);
+} /*** end of BltSessionCtxStart ***/
 
 
 /************************************************************************************//**
-** \brief     Opens the firmware data segment for reading. This should always be called
-**            before calling the BltFirmwareSegmentGetNextData() function.
-** \param     idx Zero-based segment index. Valid values are between 0 and
-**            (BltFirmwareSegmentGetCount() - 1).
+** \brief     Same as BltSessionStop(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
 **
 ****************************************************************************************/
-void BltFirmwareSegmentOpen(uint8_t idx)
+void BltSessionCtxStop(tBltSessionCtx * session)
 {
-  /* Pass the request on to the firmware reader module. */
-  FirmwareSegmentOpen(idx);
-} /*** end of BltFirmwareSegmentOpen ***/
+  /* Pass the request on to the session module. */
+  SessionStop(session);
+} /*** end of BltSessionCtxStop ***/
 
 
 /************************************************************************************//**
-** \brief     Obtains a data pointer to the next chunk of firmware data in the segment
-**            that was opened with function SegmentOpen(). The idea is that you first
-**            open the segment and afterwards you can keep calling this function to
-**            read out the segment's firmware data. When all data is read, len will be
-**            set to zero and a non-NULL pointer is returned.
-** \param     address The starting memory address of this chunk of firmware data is
-**            written to this pointer.
-** \param     len  The length of the firmware data chunk is written to this pointer.
-** \return    Data pointer to the read firmware if successful, NULL otherwise.
-** \attention There are three possible outcomes when calling this function:
-**            1) len > 0 and a non-NULL pointer is returned. This means valid data was
-**               read.
-**            2) len = 0 and a non-NULL pointer is returned. This means the end of the
-**               segment is reached and therefore no new data was actually read.
-**            3) A NULL pointer is returned. This happens only when an error occurred.
+** \brief     Same as BltSessionClearMemory(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address for the erase operation.
+** \param     len The total number of bytes to erase from memory.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t const * BltFirmwareSegmentGetNextData(uint32_t * address, uint16_t * len)
+uint8_t BltSessionCtxClearMemory(tBltSessionCtx * session, uint32_t address,
+                                 uint32_t len)
 {
-  /* Pass the request on to the firmware reader module. */
-  return FirmwareSegmentGetNextData(address, len);
-} /*** end of BltFirmwareSegmentGetNextData ***/
+  uint8_t result = TBX_OK;
+
+  /* Check parameters. */
+  TBX_ASSERT(len > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if (len > 0U)
+  {
+    /* Pass the request on to the session module. */
+    result = SessionClearMemory(session, address, len);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxClearMemory ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionWriteData(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address for the write operation.
+** \param     len The number of bytes in the data buffer that should be written.
+** \param     data Pointer to the byte array with data to write.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxWriteData(tBltSessionCtx * session, uint32_t address, uint32_t len,
+                               uint8_t const * data)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((data != NULL) && (len > 0U))
+  {
+    /* Pass the request on to the session module. */
+    result = SessionWriteData(session, address, len, data);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxWriteData ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionReadData(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address for the read operation.
+** \param     len The number of bytes to upload from the target and store in the data
+**            buffer.
+** \param     data Pointer to the byte array where the uploaded data should be stored.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxReadData(tBltSessionCtx * session, uint32_t address, uint32_t len,
+                              uint8_t * data)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((data != NULL) && (len > 0U))
+  {
+    /* Pass the request on to the session module. */
+    result = SessionReadData(session, address, len, data);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxReadData ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionWriteDataAsync(), but for the specified session context.
+**            Call BltSessionCtxTask() with the same session context to progress the
+**            operation.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address for the write operation.
+** \param     len The number of bytes in the data buffer that should be written.
+** \param     data Pointer to the byte array with data to write. It must stay valid until
+**            the operation completed.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxWriteDataAsync(tBltSessionCtx * session, uint32_t address,
+                                    uint32_t len, uint8_t const * data)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((data != NULL) && (len > 0U))
+  {
+    /* Pass the request on to the session module. */
+    result = SessionWriteDataAsync(session, address, len, data);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxWriteDataAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionClearMemoryAsync(), but for the specified session
+**            context. Call BltSessionCtxTask() with the same session context to
+**            progress the operation.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address for the erase operation.
+** \param     len The total number of bytes to erase from memory.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxClearMemoryAsync(tBltSessionCtx * session, uint32_t address,
+                                      uint32_t len)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT(len > 0U);
+
+  /* Only continue if the parameters are valid. */
+  if (len > 0U)
+  {
+    /* Pass the request on to the session module. */
+    result = SessionClearMemoryAsync(session, address, len);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxClearMemoryAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionTask(), but for the specified session context. Because
+**            it does not block, the asynchronous operations of multiple session
+**            contexts can be progressed from the same task.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \return    BLT_SESSION_STATUS_BUSY while the operation is in progress,
+**            BLT_SESSION_STATUS_DONE when it completed successfully and
+**            BLT_SESSION_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxTask(tBltSessionCtx * session)
+{
+  /* Pass the request on to the session module. Note that its SESSION_STATUS_xxx values
+   * are the same as the BLT_SESSION_STATUS_xxx values.
+   */
+  return SessionTask(session, TBX_FALSE);
+} /*** end of BltSessionCtxTask ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionBuildChecksum(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     address The starting memory address of the range.
+** \param     len The number of bytes in the range.
+** \param     type The checksum type that the target used, is written to this pointer.
+**            It is one of the BLT_CHECKSUM_TYPE_xxx values, possibly combined with the
+**            BLT_CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxBuildChecksum(tBltSessionCtx * session, uint32_t address,
+                                   uint32_t len, uint8_t * type, uint32_t * checksum)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t builtLen = len;
+
+  /* Check parameters. */
+  TBX_ASSERT((len > 0U) && (type != NULL) && (checksum != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((len > 0U) && (type != NULL) && (checksum != NULL))
+  {
+    /* Pass the request on to the session module. Note that its CHECKSUM_TYPE_xxx
+     * values are the same as the BLT_CHECKSUM_TYPE_xxx values.
+     */
+    result = SessionBuildChecksum(session, address, &builtLen, type, checksum);
+    /* The checksum is only of use, if it was built over the entire range. */
+    if (builtLen != len)
+    {
+      result = TBX_ERROR;
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxBuildChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionVerify(), but for the specified session and firmware
+**            contexts.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    TBX_OK if the firmware data matches, TBX_ERROR if it does not match or the
+**            target could not build the checksums.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxVerify(tBltSessionCtx * session, tBltFirmwareCtx * firmware)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((session != NULL) && (firmware != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((session != NULL) && (firmware != NULL))
+  {
+    /* Pass the request on to the firmware verification module. */
+    result = VerifyFirmware(session, firmware);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxVerify ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionGetStats(), but for the specified session context. Each
+**            session context collects its own statistics. A session context does not
+**            know which firmware context it is updated from, so the parse time is
+**            always zero. Use BltFirmwareCtxGetParseTime() for this.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     stats Pointer to where the statistics are copied to.
+**
+****************************************************************************************/
+void BltSessionCtxGetStats(tBltSessionCtx * session, tStats * stats)
+{
+  /* Check parameters. */
+  TBX_ASSERT((session != NULL) && (stats != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((session != NULL) && (stats != NULL))
+  {
+    /* Pass the request on to the statistics module. */
+    StatsGet(SessionGetStats(session), stats);
+  }
+} /*** end of BltSessionCtxGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionResetStats(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+**
+****************************************************************************************/
+void BltSessionCtxResetStats(tBltSessionCtx * session)
+{
+  /* Check parameter. */
+  TBX_ASSERT(session != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (session != NULL)
+  {
+    /* Pass the request on to the statistics module. */
+    StatsReset(SessionGetStats(session));
+  }
+} /*** end of BltSessionCtxResetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSessionTraceDump(), but for the specified session context.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     file Path of the file to create. An existing file is overwritten.
+** \return    TBX_OK if successful, TBX_ERROR if tracing is disabled or the file could
+**            not be written.
+**
+****************************************************************************************/
+uint8_t BltSessionCtxTraceDump(tBltSessionCtx * session, char const * file)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((session != NULL) && (file != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((session != NULL) && (file != NULL))
+  {
+    /* Pass the request on to the statistics module. */
+    result = StatsTraceDump(SessionGetStats(session), file);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltSessionCtxTraceDump ***/
+
+
+/****************************************************************************************
+*             F I R M W A R E   F I L E   R E A D E R
+****************************************************************************************/
+/************************************************************************************//**
+** \brief     Initializes the firmware reader module for a specified firmware file
+**            reader. Typically called once upon application initialization. It creates
+**            the default firmware context, which all other BltFirmwareXxx() functions
+**            operate on.
+** \param     readerType The firmware file reader to use in this module. It should be a
+**            BLT_FIRMWARE_READER_xxx value.
+**
+****************************************************************************************/
+void BltFirmwareInit(uint8_t readerType)
+{
+  /* Release the default firmware context, in case it was already created. */
+  BltFirmwareTerminate();
+  /* Create the default firmware context. */
+  bltFirmware = BltFirmwareCtxCreate(readerType);
+} /*** end of BltFirmwareInit ***/
+
+
+/************************************************************************************//**
+** \brief     Terminates the firmware reader module. Typically called at the end of the
+**            application when the firmware reader module is no longer needed.
+**
+****************************************************************************************/
+void BltFirmwareTerminate(void)
+{
+  /* Release the default firmware context, if it was created. */
+  if (bltFirmware != NULL)
+  {
+    (void)BltFirmwareCtxDestroy(bltFirmware);
+    bltFirmware = NULL;
+  }
+} /*** end of BltFirmwareTerminate ***/
+
+
+/************************************************************************************//**
+** \brief     Sets the memory address where the firmware data of a binary firmware file
+**            should be programmed. Only applicable to the BLT_FIRMWARE_READER_BINARY
+**            firmware file reader and only for files without a header. Should be called
+**            before opening the firmware file.
+** \param     address Base memory address of the firmware data.
+**
+****************************************************************************************/
+void BltFirmwareSetBaseAddress(uint32_t address)
+{
+  /* Pass the request on to the default firmware context. */
+  BltFirmwareCtxSetBaseAddress(bltFirmware, address);
+} /*** end of BltFirmwareSetBaseAddress ***/
+
+
+/************************************************************************************//**
+** \brief     Configures the size of the firmware data chunks that
+**            BltFirmwareSegmentGetNextData() outputs. The chunk boundaries can be
+**            aligned to the flash page size of the target, such that each call to
+**            BltSessionWriteData() programs whole flash pages. Only a segment's first
+**            and last chunk can be smaller. Should be called before opening a segment.
+** \param     chunkSize Chunk size in bytes. Zero to output the chunks exactly as the
+**            firmware file reader outputs them, which is the default.
+** \param     alignment Alignment of the chunk boundaries, typically the flash page size
+**            of the target. Zero or one to not align the chunk boundaries. Cannot be
+**            larger than the chunk size.
+**
+****************************************************************************************/
+void BltFirmwareSetChunkSize(uint16_t chunkSize, uint16_t alignment)
+{
+  /* Pass the request on to the default firmware context. */
+  BltFirmwareCtxSetChunkSize(bltFirmware, chunkSize, alignment);
+} /*** end of BltFirmwareSetChunkSize ***/
+
+
+/************************************************************************************//**
+** \brief     Configures the merging of segments that are separated by small gaps.
+**            Segments with a gap of at most maxGap bytes in between, are merged into
+**            one segment, with the bytes in the gap set to the fill byte. This reduces
+**            the number of segments and therefore the number of erase and SET MTA
+**            commands, at the expense of programming the fill bytes. Should be called
+**            before obtaining segment information.
+** \param     maxGap Maximum size of the gap between two segments, for which the
+**            segments are merged. Zero to not merge segments, which is the default.
+** \param     fillByte Value of the bytes that fill the gap, typically the value of
+**            erased flash memory on the target.
+**
+****************************************************************************************/
+void BltFirmwareSetGapFill(uint32_t maxGap, uint8_t fillByte)
+{
+  /* Pass the request on to the default firmware context. */
+  BltFirmwareCtxSetGapFill(bltFirmware, maxGap, fillByte);
+} /*** end of BltFirmwareSetGapFill ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file and browses through its contents to collect
+**            information about the firmware data segments it contains.
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltFirmwareFileOpen(char const * firmwareFile)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxFileOpen(bltFirmware, firmwareFile);
+} /*** end of BltFirmwareFileOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Closes the previously opened firmware file.
+**
+****************************************************************************************/
+void BltFirmwareFileClose(void)
+{
+  /* Pass the request on to the default firmware context. It is never shared. */
+  (void)BltFirmwareCtxFileClose(bltFirmware);
+} /*** end of BltFirmwareFileClose ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of data bytes present in all segments of the
+**            firmware file.
+** \return    Total number of data bytes.
+**
+****************************************************************************************/
+uint32_t BltFirmwareGetTotalSize(void)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxGetTotalSize(bltFirmware);
+} /*** end of BltFirmwareGetTotalSize ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of firmware data segments encountered in the
+**            firmware file. A firmware data segment consists of a consecutive block
+**            of firmware data. A firmware file always has at least one segment. However,
+**            it can have more as well. For example if there is a gap between the vector
+**            table and the other program data.
+** \return    Total number of firmware data segments present in the firmware file. Zero
+**            if there are more than 255 segments, which also triggers an assertion. Use
+**            BltFirmwareSegmentGetCountWide() to support firmware files with more
+**            segments.
+**
+****************************************************************************************/
+uint8_t BltFirmwareSegmentGetCount(void)
+{
+  uint8_t  result = 0U;
+  uint32_t segmentCount;
+
+  /* Pass the request on to the default firmware context. */
+  segmentCount = BltFirmwareCtxSegmentGetCount(bltFirmware);
+  /* A firmware file with more segments requires the Wide functions. */
+  TBX_ASSERT(segmentCount <= (uint32_t)UINT8_MAX);
+  /* Only update the result if the number of segments fits in it. */
+  if (segmentCount <= (uint32_t)UINT8_MAX)
+  {
+    result = (uint8_t)segmentCount;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltFirmwareSegmentGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains information about the specified segment, such as the base memory
+**            address that its data belongs to and the total number of data bytes in the
+**            segment.
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareSegmentGetCount() - 1).
+** \param     address The base memory address of the segment's data is written to this
+**            pointer.
+** \return    The total number of data bytes inside this segment.
+**
+****************************************************************************************/
+uint32_t BltFirmwareSegmentGetInfo(uint8_t idx, uint32_t * address)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxSegmentGetInfo(bltFirmware, idx, address);
+} /*** end of BltFirmwareSegmentGetInfo ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware data segment for reading. This should always be called
+**            before calling the BltFirmwareSegmentGetNextData() function.
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareSegmentGetCount() - 1).
+**
+****************************************************************************************/
+void BltFirmwareSegmentOpen(uint8_t idx)
+{
+  /* Pass the request on to the default firmware context. */
+  BltFirmwareCtxSegmentOpen(bltFirmware, idx);
+} /*** end of BltFirmwareSegmentOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of firmware data segments encountered in the
+**            firmware file. Same as BltFirmwareSegmentGetCount(), but supports firmware
+**            files with more than 255 segments.
+** \return    Total number of firmware data segments present in the firmware file.
+**
+****************************************************************************************/
+uint32_t BltFirmwareSegmentGetCountWide(void)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxSegmentGetCount(bltFirmware);
+} /*** end of BltFirmwareSegmentGetCountWide ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains information about the specified segment, such as the base memory
+**            address that its data belongs to and the total number of data bytes in the
+**            segment. Same as BltFirmwareSegmentGetInfo(), but supports firmware files
+**            with more than 255 segments.
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareSegmentGetCountWide() - 1).
+** \param     address The base memory address of the segment's data is written to this
+**            pointer.
+** \return    The total number of data bytes inside this segment.
+**
+****************************************************************************************/
+uint32_t BltFirmwareSegmentGetInfoWide(uint32_t idx, uint32_t * address)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxSegmentGetInfo(bltFirmware, idx, address);
+} /*** end of BltFirmwareSegmentGetInfoWide ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware data segment for reading. This should always be called
+**            before calling the BltFirmwareSegmentGetNextData() function. Same as
+**            BltFirmwareSegmentOpen(), but supports firmware files with more than 255
+**            segments.
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareSegmentGetCountWide() - 1).
+**
+****************************************************************************************/
+void BltFirmwareSegmentOpenWide(uint32_t idx)
+{
+  /* Pass the request on to the default firmware context. */
+  BltFirmwareCtxSegmentOpen(bltFirmware, idx);
+} /*** end of BltFirmwareSegmentOpenWide ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains a data pointer to the next chunk of firmware data in the segment
+**            that was opened with function SegmentOpen(). The idea is that you first
+**            open the segment and afterwards you can keep calling this function to
+**            read out the segment's firmware data. When all data is read, len will be
+**            set to zero and a non-NULL pointer is returned.
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successful, NULL otherwise.
+** \attention There are three possible outcomes when calling this function:
+**            1) len > 0 and a non-NULL pointer is returned. This means valid data was
+**               read.
+**            2) len = 0 and a non-NULL pointer is returned. This means the end of the
+**               segment is reached and therefore no new data was actually read.
+**            3) A NULL pointer is returned. This happens only when an error occurred.
+**
+****************************************************************************************/
+uint8_t const * BltFirmwareSegmentGetNextData(uint32_t * address, uint16_t * len)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxSegmentGetNextData(bltFirmware, address, len);
+} /*** end of BltFirmwareSegmentGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Reads firmware data at a specific memory address, without having to read
+**            through the segment from its start. Useful for verifying the programmed
+**            data or comparing the firmware data of a specific flash sector. It does not
+**            affect reading from the segment that was opened with
+**            BltFirmwareSegmentOpen(). Can be called once the firmware file is opened.
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
+**
+****************************************************************************************/
+uint8_t BltFirmwareReadAt(uint32_t address, uint32_t len, uint8_t * data)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxReadAt(bltFirmware, address, len, data);
+} /*** end of BltFirmwareReadAt ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates a checksum over all firmware data in the firmware file, for
+**            example to fingerprint the firmware. The firmware data of the segments is
+**            added in the order of their memory addresses. Gaps between segments are not
+**            part of the checksum. Can be called once the firmware file is opened. Note
+**            that it reads the firmware data with BltFirmwareSegmentOpen() and
+**            BltFirmwareSegmentGetNextData().
+** \param     type Checksum type. It should be a BLT_CHECKSUM_TYPE_xxx value, possibly
+**            combined with the BLT_CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCalculateChecksum(uint8_t type, uint32_t * checksum)
+{
+  /* Pass the request on to the default firmware context. */
+  return BltFirmwareCtxCalculateChecksum(bltFirmware, type, checksum);
+} /*** end of BltFirmwareCalculateChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a firmware context for a specified firmware file reader. Unlike
+**            the default firmware context of BltFirmwareInit(), multiple firmware
+**            contexts can exist at the same time. This makes it possible to read a
+**            different firmware file for each target, when performing a firmware update
+**            on multiple targets concurrently. The firmware context is allocated from
+**            the memory pool.
+** \param     readerType The firmware file reader to use. It should be a
+**            BLT_FIRMWARE_READER_xxx value.
+** \return    Pointer to the firmware context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tBltFirmwareCtx * BltFirmwareCtxCreate(uint8_t readerType)
+{
+  tBltFirmwareCtx       * result = NULL;
+  tFirmwareReader const * firmwareReader;
+
+  /* Process the reader type. */
+  switch (readerType)
+  {
+    /* Reader for S-record firmware files. */
+    case BLT_FIRMWARE_READER_SRECORD:
+      firmwareReader = SRecReaderGet();
+      break;
+    /* Reader for Intel HEX firmware files. */
+    case BLT_FIRMWARE_READER_INTELHEX:
+      firmwareReader = HexReaderGet();
+      break;
+    /* Reader for binary firmware files. */
+    case BLT_FIRMWARE_READER_BINARY:
+      firmwareReader = BinReaderGet();
+      break;
+      /* Unsupported reader type specified. */
+    default:
+      firmwareReader = NULL;
+      break;
+  }
+
+  /* Verify that a valid firmware reader was set. */
+  TBX_ASSERT(firmwareReader != NULL)
+
+  /* Only continue if a valid firmware reader was set. */
+  if (firmwareReader != NULL)
+  {
+    /* Create the firmware context by linking the firmware file reader. */
+    result = FirmwareCreate(firmwareReader);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltFirmwareCtxCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a firmware context. A firmware file that is still opened, is
+**            closed first. This is refused, while other firmware contexts still share
+**            the firmware file of this firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    TBX_OK if successful, TBX_ERROR if the firmware context is still shared.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxDestroy(tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareDestroy(firmware);
+} /*** end of BltFirmwareCtxDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSetBaseAddress(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     address Base memory address of the firmware data.
+**
+****************************************************************************************/
+void BltFirmwareCtxSetBaseAddress(tBltFirmwareCtx * firmware, uint32_t address)
+{
+  /* Pass the request on to the firmware reader module. */
+  FirmwareSetBaseAddress(firmware, address);
+} /*** end of BltFirmwareCtxSetBaseAddress ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSetChunkSize(), but for the specified firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     chunkSize Chunk size in bytes. Zero to output the chunks exactly as the
+**            firmware file reader outputs them, which is the default.
+** \param     alignment Alignment of the chunk boundaries, typically the flash page size
+**            of the target. Zero or one to not align the chunk boundaries. Cannot be
+**            larger than the chunk size.
+**
+****************************************************************************************/
+void BltFirmwareCtxSetChunkSize(tBltFirmwareCtx * firmware, uint16_t chunkSize,
+                                uint16_t alignment)
+{
+  /* Pass the request on to the firmware reader module. */
+  FirmwareSetChunkSize(firmware, chunkSize, alignment);
+} /*** end of BltFirmwareCtxSetChunkSize ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSetGapFill(), but for the specified firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     maxGap Maximum size of the gap between two segments, for which the
+**            segments are merged. Zero to not merge segments, which is the default.
+** \param     fillByte Value of the bytes that fill the gap, typically the value of
+**            erased flash memory on the target.
+**
+****************************************************************************************/
+void BltFirmwareCtxSetGapFill(tBltFirmwareCtx * firmware, uint32_t maxGap,
+                              uint8_t fillByte)
+{
+  /* Pass the request on to the firmware reader module. */
+  FirmwareSetGapFill(firmware, maxGap, fillByte);
+} /*** end of BltFirmwareCtxSetGapFill ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareFileOpen(), but for the specified firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxFileOpen(tBltFirmwareCtx * firmware, char const * firmwareFile)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareFileOpen(firmware, firmwareFile);
+} /*** end of BltFirmwareCtxFileOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Opens the firmware file that was already opened in another firmware
+**            context. Both firmware contexts share the segment information, so the
+**            firmware file is only scanned once. Each firmware context still reads the
+**            firmware data at its own file position. This makes it possible to update
+**            multiple nodes with the same firmware file at the same time. The other
+**            firmware context must keep its firmware file opened, until all firmware
+**            contexts that share it, closed it again.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     image The firmware context that opened the firmware file. It must be
+**            created for the same firmware reader type.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxFileShare(tBltFirmwareCtx * firmware, tBltFirmwareCtx * image)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareFileShare(firmware, image);
+} /*** end of BltFirmwareCtxFileShare ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareFileClose(), but for the specified firmware context.
+**            Closing is refused, while other firmware contexts still share the
+**            firmware file of this firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    TBX_OK if successful, TBX_ERROR if the firmware file is still shared.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxFileClose(tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareFileClose(firmware);
+} /*** end of BltFirmwareCtxFileClose ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareGetTotalSize(), but for the specified firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    Total number of data bytes.
+**
+****************************************************************************************/
+uint32_t BltFirmwareCtxGetTotalSize(tBltFirmwareCtx * firmware)
+{
+  uint32_t result = 0U;
+  uint32_t segmentIdx;
+  uint32_t segmentCount;
+  uint32_t segmentAddress = 0U;
+
+  /* Loop through all segments. */
+  segmentCount = FirmwareSegmentGetCount(firmware);
+  for (segmentIdx = 0U; segmentIdx < segmentCount; segmentIdx++)
+  {
+    /* Obtain info about the next segment and add the segment's length to the result. */
+    result += FirmwareSegmentGetInfo(firmware, segmentIdx, &segmentAddress);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of BltFirmwareCtxGetTotalSize ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSegmentGetCountWide(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    Total number of firmware data segments present in the firmware file.
+**
+****************************************************************************************/
+uint32_t BltFirmwareCtxSegmentGetCount(tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareSegmentGetCount(firmware);
+} /*** end of BltFirmwareCtxSegmentGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSegmentGetInfoWide(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareCtxSegmentGetCount() - 1).
+** \param     address The base memory address of the segment's data is written to this
+**            pointer.
+** \return    The total number of data bytes inside this segment.
+**
+****************************************************************************************/
+uint32_t BltFirmwareCtxSegmentGetInfo(tBltFirmwareCtx * firmware, uint32_t idx,
+                                      uint32_t * address)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareSegmentGetInfo(firmware, idx, address);
+} /*** end of BltFirmwareCtxSegmentGetInfo ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSegmentOpenWide(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     idx Zero-based segment index. Valid values are between 0 and
+**            (BltFirmwareCtxSegmentGetCount() - 1).
+**
+****************************************************************************************/
+void BltFirmwareCtxSegmentOpen(tBltFirmwareCtx * firmware, uint32_t idx)
+{
+  /* Pass the request on to the firmware reader module. */
+  FirmwareSegmentOpen(firmware, idx);
+} /*** end of BltFirmwareCtxSegmentOpen ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareSegmentGetNextData(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     address The starting memory address of this chunk of firmware data is
+**            written to this pointer.
+** \param     len  The length of the firmware data chunk is written to this pointer.
+** \return    Data pointer to the read firmware if successful, NULL otherwise.
+**
+****************************************************************************************/
+uint8_t const * BltFirmwareCtxSegmentGetNextData(tBltFirmwareCtx * firmware,
+                                                 uint32_t * address, uint16_t * len)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareSegmentGetNextData(firmware, address, len);
+} /*** end of BltFirmwareCtxSegmentGetNextData ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareReadAt(), but for the specified firmware context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxReadAt(tBltFirmwareCtx * firmware, uint32_t address, uint32_t len,
+                             uint8_t * data)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareReadAt(firmware, address, len, data);
+} /*** end of BltFirmwareCtxReadAt ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltFirmwareCalculateChecksum(), but for the specified firmware
+**            context.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \param     type Checksum type. It should be a BLT_CHECKSUM_TYPE_xxx value, possibly
+**            combined with the BLT_CHECKSUM_TYPE_BIG_ENDIAN flag.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltFirmwareCtxCalculateChecksum(tBltFirmwareCtx * firmware, uint8_t type,
+                                        uint32_t * checksum)
+{
+  /* Pass the request on to the firmware reader module. Note that its CHECKSUM_TYPE_xxx
+   * values are the same as the BLT_CHECKSUM_TYPE_xxx values.
+   */
+  return FirmwareCalculateChecksum(firmware, type, checksum);
+} /*** end of BltFirmwareCtxCalculateChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total time that the firmware context spent on reading and
+**            parsing the firmware file, since it was created or the time was last
+**            reset. For the default firmware context, this time is part of the
+**            statistics of BltSessionGetStats().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    The total time in milliseconds.
+**
+****************************************************************************************/
+uint32_t BltFirmwareCtxGetParseTime(tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the firmware reader module. */
+  return FirmwareGetParseTime(firmware);
+} /*** end of BltFirmwareCtxGetParseTime ***/
+
+
+/************************************************************************************//**
+** \brief     Resets the total time that the firmware context spent on reading and
+**            parsing the firmware file.
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+**
+****************************************************************************************/
+void BltFirmwareCtxResetParseTime(tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the firmware reader module. */
+  FirmwareResetParseTime(firmware);
+} /*** end of BltFirmwareCtxResetParseTime ***/
+
+
+/****************************************************************************************
+*             F I R M W A R E   U P D A T E   P I P E L I N E
+****************************************************************************************/
+/************************************************************************************//**
+** \brief     Starts the firmware update pipeline, which programs all firmware data of
+**            the opened firmware file on the target. Make sure the firmware file is
+**            opened, the session is started and the memory on the target is erased,
+**            before calling this function.
+**
+****************************************************************************************/
+void BltPipelineStart(void)
+{
+  /* Create the default pipeline context upon first use. */
+  if (bltPipeline == NULL)
+  {
+    bltPipeline = BltPipelineCtxCreate();
+  }
+  /* Pass the request on to the default pipeline, session and firmware contexts. */
+  BltPipelineCtxStart(bltPipeline, bltSession, bltFirmware);
+} /*** end of BltPipelineStart ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineStart(), but the pipeline first erases the memory on
+**            the target that the firmware data covers. While the target erases, the
+**            pipeline already reads ahead the first chunks of firmware data, such that
+**            programming starts right after the erase completed. Make sure the
+**            firmware file is opened and the session is started, before calling this
+**            function.
+**
+****************************************************************************************/
+void BltPipelineStartWithErase(void)
+{
+  /* Create the default pipeline context upon first use. */
+  if (bltPipeline == NULL)
+  {
+    bltPipeline = BltPipelineCtxCreate();
+  }
+  /* Pass the request on to the default pipeline, session and firmware contexts. */
+  BltPipelineCtxStartWithErase(bltPipeline, bltSession, bltFirmware);
+} /*** end of BltPipelineStartWithErase ***/
+
+
+/************************************************************************************//**
+** \brief     Runs the producer stage of the firmware update pipeline. It reads the next
+**            chunk of firmware data from the file, if a slot buffer is free. Meant to
+**            be called continuously from a separate task, in combination with
+**            BltPipelineConsume(), until it is no longer busy.
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was read,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineProduce(void)
+{
+  /* Pass the request on to the default pipeline context. */
+  return BltPipelineCtxProduce(bltPipeline);
+} /*** end of BltPipelineProduce ***/
+
+
+/************************************************************************************//**
+** \brief     Runs the consumer stage of the firmware update pipeline. It programs the
+**            next chunk of firmware data on the target, if one was read by the
+**            producer stage. When started with BltPipelineStartWithErase(), it first
+**            erases one segment per call. Meant to be called continuously from a
+**            separate task, in combination with BltPipelineProduce(), until it is no
+**            longer busy.
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineConsume(void)
+{
+  /* Pass the request on to the default pipeline context. */
+  return BltPipelineCtxConsume(bltPipeline);
+} /*** end of BltPipelineConsume ***/
+
+
+/************************************************************************************//**
+** \brief     Runs both stages of the firmware update pipeline from a single task. It
+**            reads the next chunk of firmware data from the file, while the target
+**            erases or programs the current one. This function does not block and
+**            should be called continuously, until it is no longer busy.
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineTask(void)
+{
+  /* Pass the request on to the default pipeline context. */
+  return BltPipelineCtxTask(bltPipeline);
+} /*** end of BltPipelineTask ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineTask(), but it blocks while the target erases or
+**            programs, when there is nothing else to do. That is when all slot buffers
+**            are filled or all firmware data was read. Meant for calling from an RTOS
+**            task. If the port implements XcpReceivePacketTimeout, the task does not use
+**            the CPU while it waits for the target.
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineTaskWait(void)
+{
+  /* Pass the request on to the default pipeline context. */
+  return BltPipelineCtxTaskWait(bltPipeline);
+} /*** end of BltPipelineTaskWait ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a pipeline context. Contrary to the default pipeline context of
+**            the BltPipelineXxx() functions, multiple pipeline contexts can exist at the
+**            same time. This makes it possible to pipeline the firmware update of
+**            multiple targets concurrently, for example each from their own task. The
+**            pipeline context is allocated from the memory pool.
+** \return    Pointer to the pipeline context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tBltPipelineCtx * BltPipelineCtxCreate(void)
+{
+  /* Pass the request on to the pipeline module. */
+  return PipelineCreate();
+} /*** end of BltPipelineCtxCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a pipeline context. Make sure the pipeline is no longer running,
+**            before calling this function.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+**
+****************************************************************************************/
+void BltPipelineCtxDestroy(tBltPipelineCtx * pipeline)
+{
+  /* Pass the request on to the pipeline module. */
+  PipelineDestroy(pipeline);
+} /*** end of BltPipelineCtxDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineStart(), but for the specified pipeline, session and
+**            firmware contexts.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+**
+****************************************************************************************/
+void BltPipelineCtxStart(tBltPipelineCtx * pipeline, tBltSessionCtx * session,
+                         tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the pipeline module. */
+  PipelineStart(pipeline, session, firmware);
+} /*** end of BltPipelineCtxStart ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineStartWithErase(), but for the specified pipeline,
+**            session and firmware contexts.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+**
+****************************************************************************************/
+void BltPipelineCtxStartWithErase(tBltPipelineCtx * pipeline, tBltSessionCtx * session,
+                                  tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the pipeline module. */
+  PipelineStartWithErase(pipeline, session, firmware);
+} /*** end of BltPipelineCtxStartWithErase ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineProduce(), but for the specified pipeline context.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was read,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineCtxProduce(tBltPipelineCtx * pipeline)
+{
+  /* Pass the request on to the pipeline module. Note that its PIPELINE_STATUS_xxx
+   * values are the same as the BLT_PIPELINE_STATUS_xxx values.
+   */
+  return PipelineProduce(pipeline);
+} /*** end of BltPipelineCtxProduce ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineConsume(), but for the specified pipeline context.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineCtxConsume(tBltPipelineCtx * pipeline)
+{
+  /* Pass the request on to the pipeline module. */
+  return PipelineConsume(pipeline);
+} /*** end of BltPipelineCtxConsume ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineTask(), but for the specified pipeline context. Because
+**            it does not block, the pipelines of multiple targets can be progressed
+**            from the same task.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineCtxTask(tBltPipelineCtx * pipeline)
+{
+  /* Pass the request on to the pipeline module. */
+  return PipelineTask(pipeline, TBX_FALSE);
+} /*** end of BltPipelineCtxTask ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltPipelineTaskWait(), but for the specified pipeline context.
+** \param     pipeline The pipeline context, as created by BltPipelineCtxCreate().
+** \return    BLT_PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            BLT_PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            BLT_PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t BltPipelineCtxTaskWait(tBltPipelineCtx * pipeline)
+{
+  /* Pass the request on to the pipeline module. */
+  return PipelineTask(pipeline, TBX_TRUE);
+} /*** end of BltPipelineCtxTaskWait ***/
+
+
+/****************************************************************************************
+*             D I F F E R E N T I A L   U P D A T E
+****************************************************************************************/
+/************************************************************************************//**
+** \brief     Starts a differential firmware update. Instead of erasing and programming
+**            all firmware data, only the flash sectors whose contents differ from the
+**            firmware file are updated. Make sure the firmware file is opened and the
+**            session is started, before calling this function. Next, call
+**            BltDeltaUpdateSector() for each flash sector on the target and finally
+**            BltDeltaStop(). Note that the bootloader must support the XCP
+**            BUILD_CHECKSUM command. Otherwise all sectors are updated.
+**
+****************************************************************************************/
+void BltDeltaStart(void)
+{
+  /* Create the default delta context upon first use. */
+  if (bltDelta == NULL)
+  {
+    bltDelta = BltDeltaCtxCreate();
+  }
+  /* Pass the request on to the default delta, session and firmware contexts. */
+  BltDeltaCtxStart(bltDelta, bltSession, bltFirmware);
+} /*** end of BltDeltaStart ***/
+
+
+/************************************************************************************//**
+** \brief     Updates a flash sector on the target, but only if its contents differ
+**            from the firmware data in the sector. The bootloader builds checksums over
+**            blocks of the sector, which are compared with the checksums of the firmware
+**            data in the same blocks. Bytes in the sector that are not covered by
+**            firmware data are expected to be erased (0xFF). Process the sectors in the
+**            order of increasing address.
+** \param     address Start address of the sector. It must be the start address of a
+**            sector in the target's flash memory.
+** \param     size Size of the sector in bytes. It must be the size of the sector in the
+**            target's flash memory, because the entire sector is erased upon update.
+** \return    BLT_DELTA_STATUS_UNCHANGED if the sector's contents already matched the
+**            firmware data or the sector does not hold firmware data,
+**            BLT_DELTA_STATUS_UPDATED if the sector was erased and programmed,
+**            BLT_DELTA_STATUS_FORCED if the sector was erased and programmed, because
+**            the bootloader could not build the checksums, BLT_DELTA_STATUS_ERROR in
+**            case of an error.
+**
+****************************************************************************************/
+uint8_t BltDeltaUpdateSector(uint32_t address, uint32_t size)
+{
+  /* Pass the request on to the default delta context. */
+  return BltDeltaCtxUpdateSector(bltDelta, address, size);
+} /*** end of BltDeltaUpdateSector ***/
+
+
+/************************************************************************************//**
+** \brief     Stops a differential firmware update. It verifies that the sectors that
+**            were processed with BltDeltaUpdateSector() covered all firmware data.
+** \return    TBX_OK if all firmware data is now present on the target, TBX_ERROR
+**            otherwise.
+**
+****************************************************************************************/
+uint8_t BltDeltaStop(void)
+{
+  /* Pass the request on to the default delta context. */
+  return BltDeltaCtxStop(bltDelta);
+} /*** end of BltDeltaStop ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a delta context. Contrary to the default delta context of the
+**            BltDeltaXxx() functions, multiple delta contexts can exist at the same
+**            time. This makes it possible to perform a differential firmware update on
+**            multiple targets concurrently. The delta context is allocated from the
+**            memory pool.
+** \return    Pointer to the delta context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tBltDeltaCtx * BltDeltaCtxCreate(void)
+{
+  /* Pass the request on to the differential update module. */
+  return DeltaCreate();
+} /*** end of BltDeltaCtxCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a delta context.
+** \param     delta The delta context, as created by BltDeltaCtxCreate().
+**
+****************************************************************************************/
+void BltDeltaCtxDestroy(tBltDeltaCtx * delta)
+{
+  /* Pass the request on to the differential update module. */
+  DeltaDestroy(delta);
+} /*** end of BltDeltaCtxDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltDeltaStart(), but for the specified delta, session and firmware
+**            contexts.
+** \param     delta The delta context, as created by BltDeltaCtxCreate().
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+**
+****************************************************************************************/
+void BltDeltaCtxStart(tBltDeltaCtx * delta, tBltSessionCtx * session,
+                      tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the differential update module. */
+  DeltaStart(delta, session, firmware);
+} /*** end of BltDeltaCtxStart ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltDeltaUpdateSector(), but for the specified delta context.
+** \param     delta The delta context, as created by BltDeltaCtxCreate().
+** \param     address Start address of the sector.
+** \param     size Size of the sector in bytes.
+** \return    BLT_DELTA_STATUS_UNCHANGED if the sector's contents already matched the
+**            firmware data or the sector does not hold firmware data,
+**            BLT_DELTA_STATUS_UPDATED if the sector was erased and programmed,
+**            BLT_DELTA_STATUS_FORCED if the sector was erased and programmed, because
+**            the bootloader could not build the checksums, BLT_DELTA_STATUS_ERROR in
+**            case of an error.
+**
+****************************************************************************************/
+uint8_t BltDeltaCtxUpdateSector(tBltDeltaCtx * delta, uint32_t address, uint32_t size)
+{
+  /* Pass the request on to the differential update module. Note that its
+   * DELTA_STATUS_xxx values are the same as the BLT_DELTA_STATUS_xxx values.
+   */
+  return DeltaUpdateSector(delta, address, size);
+} /*** end of BltDeltaCtxUpdateSector ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltDeltaStop(), but for the specified delta context.
+** \param     delta The delta context, as created by BltDeltaCtxCreate().
+** \return    TBX_OK if all firmware data is now present on the target, TBX_ERROR
+**            otherwise.
+**
+****************************************************************************************/
+uint8_t BltDeltaCtxStop(tBltDeltaCtx * delta)
+{
+  /* Pass the request on to the differential update module. */
+  return DeltaStop(delta);
+} /*** end of BltDeltaCtxStop ***/
+
+
+/****************************************************************************************
+*             M U L T I - N O D E   U P D A T E   S C H E D U L E R
+****************************************************************************************/
+/************************************************************************************//**
+** \brief     Starts the multi-node update scheduler, which updates the firmware of
+**            multiple nodes at the same time from a single task. While one node is busy
+**            erasing or programming its memory, the scheduler communicates with the
+**            other nodes. Add the nodes with BltSchedulerAddNode() and afterwards call
+**            BltSchedulerTask() continuously, until it is no longer busy.
+**
+****************************************************************************************/
+void BltSchedulerStart(void)
+{
+  /* Create the default scheduler context upon first use. */
+  if (bltScheduler == NULL)
+  {
+    bltScheduler = BltSchedulerCtxCreate();
+  }
+  /* Pass the request on to the default scheduler context. */
+  BltSchedulerCtxStart(bltScheduler);
+} /*** end of BltSchedulerStart ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a node to the multi-node update scheduler. Make sure the firmware
+**            file is opened and the session is started, before calling this function.
+**            The memory on the node should not be erased upfront. Each node needs its
+**            own session context, with a port that only receives the response packets
+**            of this node, and its own firmware context. Use BltFirmwareCtxFileShare()
+**            if the nodes receive the same firmware.
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSchedulerAddNode(tBltSessionCtx * session, tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the default scheduler context. */
+  return BltSchedulerCtxAddNode(bltScheduler, session, firmware);
+} /*** end of BltSchedulerAddNode ***/
+
+
+/************************************************************************************//**
+** \brief     Progresses the firmware update of all nodes. This function does not block
+**            and should be called continuously, until it is no longer busy.
+** \return    BLT_SCHEDULER_STATUS_BUSY as long as not all nodes completed,
+**            BLT_SCHEDULER_STATUS_DONE when all nodes completed successfully,
+**            BLT_SCHEDULER_STATUS_ERROR when all nodes completed, but at least one of
+**            them with an error.
+**
+****************************************************************************************/
+uint8_t BltSchedulerTask(void)
+{
+  /* Pass the request on to the default scheduler context. */
+  return BltSchedulerCtxTask(bltScheduler);
+} /*** end of BltSchedulerTask ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the status of the firmware update of a specific node.
+** \param     idx Zero-based index of the node, in the order that the nodes were added.
+** \return    BLT_SCHEDULER_STATUS_BUSY as long as the node's update is in progress,
+**            BLT_SCHEDULER_STATUS_DONE when it completed successfully,
+**            BLT_SCHEDULER_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+uint8_t BltSchedulerGetNodeStatus(uint8_t idx)
+{
+  /* Pass the request on to the default scheduler context. */
+  return BltSchedulerCtxGetNodeStatus(bltScheduler, idx);
+} /*** end of BltSchedulerGetNodeStatus ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a scheduler context. Contrary to the default scheduler context of
+**            the BltSchedulerXxx() functions, multiple scheduler contexts can exist at
+**            the same time. This makes it possible to run a scheduler for each bus, for
+**            example each from their own task. The scheduler context is allocated from
+**            the memory pool.
+** \return    Pointer to the scheduler context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tBltSchedulerCtx * BltSchedulerCtxCreate(void)
+{
+  /* Pass the request on to the scheduler module. */
+  return SchedulerCreate();
+} /*** end of BltSchedulerCtxCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a scheduler context.
+** \param     scheduler The scheduler context, as created by BltSchedulerCtxCreate().
+**
+****************************************************************************************/
+void BltSchedulerCtxDestroy(tBltSchedulerCtx * scheduler)
+{
+  /* Pass the request on to the scheduler module. */
+  SchedulerDestroy(scheduler);
+} /*** end of BltSchedulerCtxDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSchedulerStart(), but for the specified scheduler context.
+** \param     scheduler The scheduler context, as created by BltSchedulerCtxCreate().
+**
+****************************************************************************************/
+void BltSchedulerCtxStart(tBltSchedulerCtx * scheduler)
+{
+  /* Pass the request on to the scheduler module. */
+  SchedulerStart(scheduler);
+} /*** end of BltSchedulerCtxStart ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSchedulerAddNode(), but for the specified scheduler context.
+**            Note that a session context or firmware context can only be used by one
+**            node at a time.
+** \param     scheduler The scheduler context, as created by BltSchedulerCtxCreate().
+** \param     session The session context, as created by BltSessionCtxCreate().
+** \param     firmware The firmware context, as created by BltFirmwareCtxCreate().
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t BltSchedulerCtxAddNode(tBltSchedulerCtx * scheduler, tBltSessionCtx * session,
+                               tBltFirmwareCtx * firmware)
+{
+  /* Pass the request on to the scheduler module. */
+  return SchedulerAddNode(scheduler, session, firmware);
+} /*** end of BltSchedulerCtxAddNode ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSchedulerTask(), but for the specified scheduler context.
+** \param     scheduler The scheduler context, as created by BltSchedulerCtxCreate().
+** \return    BLT_SCHEDULER_STATUS_BUSY as long as not all nodes completed,
+**            BLT_SCHEDULER_STATUS_DONE when all nodes completed successfully,
+**            BLT_SCHEDULER_STATUS_ERROR when all nodes completed, but at least one of
+**            them with an error.
+**
+****************************************************************************************/
+uint8_t BltSchedulerCtxTask(tBltSchedulerCtx * scheduler)
+{
+  /* Pass the request on to the scheduler module. Note that its SCHEDULER_STATUS_xxx
+   * values are the same as the BLT_SCHEDULER_STATUS_xxx values.
+   */
+  return SchedulerTask(scheduler);
+} /*** end of BltSchedulerCtxTask ***/
+
+
+/************************************************************************************//**
+** \brief     Same as BltSchedulerGetNodeStatus(), but for the specified scheduler
+**            context.
+** \param     scheduler The scheduler context, as created by BltSchedulerCtxCreate().
+** \param     idx Zero-based index of the node, in the order that the nodes were added.
+** \return    BLT_SCHEDULER_STATUS_BUSY as long as the node's update is in progress,
+**            BLT_SCHEDULER_STATUS_DONE when it completed successfully,
+**            BLT_SCHEDULER_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+uint8_t BltSchedulerCtxGetNodeStatus(tBltSchedulerCtx * scheduler, uint8_t idx)
+{
+  /* Pass the request on to the scheduler module. */
+  return SchedulerGetNodeStatus(scheduler, idx);
+} /*** end of BltSchedulerCtxGetNodeStatus ***/
 
 
 /*********************************** end of microblt.c *********************************/
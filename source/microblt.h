@@ -80,6 +80,12 @@ void BltPortTerminate(void);
 /****************************************************************************************
 *             S E S S I O N   L A Y E R S
 ****************************************************************************************/
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include "stats.h"                          /* Statistics module                       */
+
+
 /****************************************************************************************
 * Macro definitions
 ****************************************************************************************/
@@ -90,6 +96,49 @@ void BltPortTerminate(void);
  */
 #define BLT_SESSION_XCP_V10                 ((uint32_t)0U)
 
+/** \brief Status of an asynchronous session operation that is still in progress. */
+#define BLT_SESSION_STATUS_BUSY             ((uint8_t)0U)
+
+/** \brief Status of an asynchronous session operation that completed successfully. This
+ *         is also the status when no asynchronous operation was started.
+ */
+#define BLT_SESSION_STATUS_DONE             ((uint8_t)1U)
+
+/** \brief Status of an asynchronous session operation that completed with an error. */
+#define BLT_SESSION_STATUS_ERROR            ((uint8_t)2U)
+
+/** \brief Checksum type that adds all bytes into a byte. */
+#define BLT_CHECKSUM_TYPE_ADD_11            ((uint8_t)0x01U)
+
+/** \brief Checksum type that adds all bytes into a 16-bit word. */
+#define BLT_CHECKSUM_TYPE_ADD_12            ((uint8_t)0x02U)
+
+/** \brief Checksum type that adds all bytes into a 32-bit word. */
+#define BLT_CHECKSUM_TYPE_ADD_14            ((uint8_t)0x03U)
+
+/** \brief Checksum type that adds all 16-bit words into a 16-bit word. */
+#define BLT_CHECKSUM_TYPE_ADD_22            ((uint8_t)0x04U)
+
+/** \brief Checksum type that adds all 16-bit words into a 32-bit word. */
+#define BLT_CHECKSUM_TYPE_ADD_24            ((uint8_t)0x05U)
+
+/** \brief Checksum type that adds all 32-bit words into a 32-bit word. */
+#define BLT_CHECKSUM_TYPE_ADD_44            ((uint8_t)0x06U)
+
+/** \brief Checksum type CRC16 with polynomial 0x8005, reflected, initial value 0. */
+#define BLT_CHECKSUM_TYPE_CRC_16            ((uint8_t)0x07U)
+
+/** \brief Checksum type CRC16 CCITT with polynomial 0x1021, initial value 0xFFFF. */
+#define BLT_CHECKSUM_TYPE_CRC_16_CITT       ((uint8_t)0x08U)
+
+/** \brief Checksum type CRC32 with polynomial 0x04C11DB7, reflected. */
+#define BLT_CHECKSUM_TYPE_CRC_32            ((uint8_t)0x09U)
+
+/** \brief Flag combined with the checksum type, if the target adds its words in big
+ *         endian (Motorola) byte order.
+ */
+#define BLT_CHECKSUM_TYPE_BIG_ENDIAN        ((uint8_t)0x80U)
+
 
 /****************************************************************************************
 * Type definitions
@@ -106,6 +155,36 @@ typedef struct
   uint8_t  connectMode;          /**< Connection mode parameter in XCP connect command.*/
 } tBltSessionSettingsXcpV10;
 
+/** \brief Session context. It groups all the information of the firmware update session
+ *         with one target, such that firmware updates can be performed on multiple
+ *         targets concurrently. Its contents are private to the library.
+ */
+typedef struct t_session_context tBltSessionCtx;
+
+/** \brief Firmware context. It groups all the information of a firmware file that is
+ *         being read, such that multiple firmware files can be read at the same time.
+ *         Its contents are private to the library.
+ */
+typedef struct t_firmware_context tBltFirmwareCtx;
+
+/** \brief Pipeline context. It groups all the information of a firmware update
+ *         pipeline, such that firmware updates can be pipelined on multiple targets
+ *         concurrently. Its contents are private to the library.
+ */
+typedef struct t_pipeline_context tBltPipelineCtx;
+
+/** \brief Delta context. It groups all the information of a differential firmware
+ *         update, such that differential firmware updates can be performed on multiple
+ *         targets concurrently. Its contents are private to the library.
+ */
+typedef struct t_delta_context tBltDeltaCtx;
+
+/** \brief Scheduler context. It groups all the information of the nodes that are
+ *         updated by a multi-node update scheduler, such that multiple schedulers can
+ *         run concurrently. Its contents are private to the library.
+ */
+typedef struct t_scheduler_context tBltSchedulerCtx;
+
 
 /****************************************************************************************
 * Function prototypes
@@ -117,6 +196,40 @@ void    BltSessionStop(void);
 uint8_t BltSessionClearMemory(uint32_t address, uint32_t len);
 uint8_t BltSessionWriteData(uint32_t address, uint32_t len, uint8_t const * data);
 uint8_t BltSessionReadData(uint32_t address, uint32_t len, uint8_t * data);
+uint8_t BltSessionWriteDataAsync(uint32_t address, uint32_t len, uint8_t const * data);
+uint8_t BltSessionClearMemoryAsync(uint32_t address, uint32_t len);
+uint8_t BltSessionTask(void);
+uint8_t BltSessionBuildChecksum(uint32_t address, uint32_t len, uint8_t * type,
+                                uint32_t * checksum);
+uint8_t BltSessionVerify(void);
+void    BltSessionGetStats(tStats * stats);
+void    BltSessionResetStats(void);
+uint8_t BltSessionTraceDump(char const * file);
+
+tBltSessionCtx * BltSessionCtxCreate(uint32_t type, void const * settings,
+                                     tPort const * port);
+void             BltSessionCtxDestroy(tBltSessionCtx * session);
+uint8_t          BltSessionCtxStart(tBltSessionCtx * session);
+void             BltSessionCtxStop(tBltSessionCtx * session);
+uint8_t          BltSessionCtxClearMemory(tBltSessionCtx * session, uint32_t address,
+                                          uint32_t len);
+uint8_t          BltSessionCtxWriteData(tBltSessionCtx * session, uint32_t address,
+                                        uint32_t len, uint8_t const * data);
+uint8_t          BltSessionCtxReadData(tBltSessionCtx * session, uint32_t address,
+                                       uint32_t len, uint8_t * data);
+uint8_t          BltSessionCtxWriteDataAsync(tBltSessionCtx * session, uint32_t address,
+                                             uint32_t len, uint8_t const * data);
+uint8_t          BltSessionCtxClearMemoryAsync(tBltSessionCtx * session,
+                                               uint32_t address, uint32_t len);
+uint8_t          BltSessionCtxTask(tBltSessionCtx * session);
+uint8_t          BltSessionCtxBuildChecksum(tBltSessionCtx * session, uint32_t address,
+                                            uint32_t len, uint8_t * type,
+                                            uint32_t * checksum);
+uint8_t          BltSessionCtxVerify(tBltSessionCtx * session,
+                                     tBltFirmwareCtx * firmware);
+void             BltSessionCtxGetStats(tBltSessionCtx * session, tStats * stats);
+void             BltSessionCtxResetStats(tBltSessionCtx * session);
+uint8_t          BltSessionCtxTraceDump(tBltSessionCtx * session, char const * file);
 
 
 /****************************************************************************************
@@ -132,19 +245,179 @@ uint8_t BltSessionReadData(uint32_t address, uint32_t len, uint8_t * data);
  */
 #define BLT_FIRMWARE_READER_SRECORD         ((uint8_t)0U)
 
+/** \brief The Intel HEX reader enables reading firmware data from a file formatted as
+ *         Intel HEX. Both the extended segment address and the extended linear address
+ *         records are supported.
+ */
+#define BLT_FIRMWARE_READER_INTELHEX        ((uint8_t)1U)
+
+/** \brief The binary reader enables reading firmware data from a file that holds the
+ *         raw firmware data. The data is read directly from the file without any
+ *         parsing. The memory address of the first byte is set with function
+ *         BltFirmwareSetBaseAddress() or comes from an optional 8 byte header.
+ */
+#define BLT_FIRMWARE_READER_BINARY          ((uint8_t)2U)
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
 void            BltFirmwareInit(uint8_t readerType);
 void            BltFirmwareTerminate(void);
+void            BltFirmwareSetBaseAddress(uint32_t address);
+void            BltFirmwareSetChunkSize(uint16_t chunkSize, uint16_t alignment);
+void            BltFirmwareSetGapFill(uint32_t maxGap, uint8_t fillByte);
 uint8_t         BltFirmwareFileOpen(char const * firmwareFile);
 void            BltFirmwareFileClose(void);
 uint32_t        BltFirmwareGetTotalSize(void);
 uint8_t         BltFirmwareSegmentGetCount(void);
 uint32_t        BltFirmwareSegmentGetInfo(uint8_t idx, uint32_t * address);
 void            BltFirmwareSegmentOpen(uint8_t idx);
+uint32_t        BltFirmwareSegmentGetCountWide(void);
+uint32_t        BltFirmwareSegmentGetInfoWide(uint32_t idx, uint32_t * address);
+void            BltFirmwareSegmentOpenWide(uint32_t idx);
 uint8_t const * BltFirmwareSegmentGetNextData(uint32_t * address, uint16_t * len);
+uint8_t         BltFirmwareReadAt(uint32_t address, uint32_t len, uint8_t * data);
+uint8_t         BltFirmwareCalculateChecksum(uint8_t type, uint32_t * checksum);
+
+tBltFirmwareCtx * BltFirmwareCtxCreate(uint8_t readerType);
+uint8_t           BltFirmwareCtxDestroy(tBltFirmwareCtx * firmware);
+void              BltFirmwareCtxSetBaseAddress(tBltFirmwareCtx * firmware,
+                                               uint32_t address);
+void              BltFirmwareCtxSetChunkSize(tBltFirmwareCtx * firmware,
+                                             uint16_t chunkSize, uint16_t alignment);
+void              BltFirmwareCtxSetGapFill(tBltFirmwareCtx * firmware, uint32_t maxGap,
+                                           uint8_t fillByte);
+uint8_t           BltFirmwareCtxFileOpen(tBltFirmwareCtx * firmware,
+                                         char const * firmwareFile);
+uint8_t           BltFirmwareCtxFileShare(tBltFirmwareCtx * firmware,
+                                          tBltFirmwareCtx * image);
+uint8_t           BltFirmwareCtxFileClose(tBltFirmwareCtx * firmware);
+uint32_t          BltFirmwareCtxGetTotalSize(tBltFirmwareCtx * firmware);
+uint32_t          BltFirmwareCtxSegmentGetCount(tBltFirmwareCtx * firmware);
+uint32_t          BltFirmwareCtxSegmentGetInfo(tBltFirmwareCtx * firmware, uint32_t idx,
+                                               uint32_t * address);
+void              BltFirmwareCtxSegmentOpen(tBltFirmwareCtx * firmware, uint32_t idx);
+uint8_t const   * BltFirmwareCtxSegmentGetNextData(tBltFirmwareCtx * firmware,
+                                                   uint32_t * address, uint16_t * len);
+uint8_t           BltFirmwareCtxReadAt(tBltFirmwareCtx * firmware, uint32_t address,
+                                       uint32_t len, uint8_t * data);
+uint8_t           BltFirmwareCtxCalculateChecksum(tBltFirmwareCtx * firmware,
+                                                  uint8_t type, uint32_t * checksum);
+uint32_t          BltFirmwareCtxGetParseTime(tBltFirmwareCtx * firmware);
+void              BltFirmwareCtxResetParseTime(tBltFirmwareCtx * firmware);
+
+
+/****************************************************************************************
+*             F I R M W A R E   U P D A T E   P I P E L I N E
+****************************************************************************************/
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Status of the firmware update pipeline when it is still busy. */
+#define BLT_PIPELINE_STATUS_BUSY            ((uint8_t)0U)
+
+/** \brief Status of the firmware update pipeline when it completed successfully. */
+#define BLT_PIPELINE_STATUS_DONE            ((uint8_t)1U)
+
+/** \brief Status of the firmware update pipeline when it completed with an error. */
+#define BLT_PIPELINE_STATUS_ERROR           ((uint8_t)2U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void    BltPipelineStart(void);
+void    BltPipelineStartWithErase(void);
+uint8_t BltPipelineProduce(void);
+uint8_t BltPipelineConsume(void);
+uint8_t BltPipelineTask(void);
+uint8_t BltPipelineTaskWait(void);
+
+tBltPipelineCtx * BltPipelineCtxCreate(void);
+void              BltPipelineCtxDestroy(tBltPipelineCtx * pipeline);
+void              BltPipelineCtxStart(tBltPipelineCtx * pipeline,
+                                      tBltSessionCtx * session,
+                                      tBltFirmwareCtx * firmware);
+void              BltPipelineCtxStartWithErase(tBltPipelineCtx * pipeline,
+                                               tBltSessionCtx * session,
+                                               tBltFirmwareCtx * firmware);
+uint8_t           BltPipelineCtxProduce(tBltPipelineCtx * pipeline);
+uint8_t           BltPipelineCtxConsume(tBltPipelineCtx * pipeline);
+uint8_t           BltPipelineCtxTask(tBltPipelineCtx * pipeline);
+uint8_t           BltPipelineCtxTaskWait(tBltPipelineCtx * pipeline);
+
+
+/****************************************************************************************
+*             D I F F E R E N T I A L   U P D A T E
+****************************************************************************************/
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Status of a sector whose contents already matched the firmware file. */
+#define BLT_DELTA_STATUS_UNCHANGED          ((uint8_t)0U)
+
+/** \brief Status of a sector that was erased and programmed. */
+#define BLT_DELTA_STATUS_UPDATED            ((uint8_t)1U)
+
+/** \brief Status of a sector that could not be updated, due to an error. */
+#define BLT_DELTA_STATUS_ERROR              ((uint8_t)2U)
+
+/** \brief Status of a sector that was erased and programmed without comparing its
+ *         contents, because the bootloader could not build a checksum.
+ */
+#define BLT_DELTA_STATUS_FORCED             ((uint8_t)3U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void    BltDeltaStart(void);
+uint8_t BltDeltaUpdateSector(uint32_t address, uint32_t size);
+uint8_t BltDeltaStop(void);
+
+tBltDeltaCtx * BltDeltaCtxCreate(void);
+void           BltDeltaCtxDestroy(tBltDeltaCtx * delta);
+void           BltDeltaCtxStart(tBltDeltaCtx * delta, tBltSessionCtx * session,
+                                tBltFirmwareCtx * firmware);
+uint8_t        BltDeltaCtxUpdateSector(tBltDeltaCtx * delta, uint32_t address,
+                                       uint32_t size);
+uint8_t        BltDeltaCtxStop(tBltDeltaCtx * delta);
+
+
+/****************************************************************************************
+*             M U L T I - N O D E   U P D A T E   S C H E D U L E R
+****************************************************************************************/
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Status of the scheduler or a node, when it is still busy. */
+#define BLT_SCHEDULER_STATUS_BUSY           ((uint8_t)0U)
+
+/** \brief Status of the scheduler or a node, when it completed successfully. */
+#define BLT_SCHEDULER_STATUS_DONE           ((uint8_t)1U)
+
+/** \brief Status of the scheduler or a node, when it completed with an error. */
+#define BLT_SCHEDULER_STATUS_ERROR          ((uint8_t)2U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void    BltSchedulerStart(void);
+uint8_t BltSchedulerAddNode(tBltSessionCtx * session, tBltFirmwareCtx * firmware);
+uint8_t BltSchedulerTask(void);
+uint8_t BltSchedulerGetNodeStatus(uint8_t idx);
+
+tBltSchedulerCtx * BltSchedulerCtxCreate(void);
+void               BltSchedulerCtxDestroy(tBltSchedulerCtx * scheduler);
+void               BltSchedulerCtxStart(tBltSchedulerCtx * scheduler);
+uint8_t            BltSchedulerCtxAddNode(tBltSchedulerCtx * scheduler,
+                                          tBltSessionCtx * session,
+                                          tBltFirmwareCtx * firmware);
+uint8_t            BltSchedulerCtxTask(tBltSchedulerCtx * scheduler);
+uint8_t            BltSchedulerCtxGetNodeStatus(tBltSchedulerCtx * scheduler,
+                                                uint8_t idx);
 
 
 #ifdef __cplusplus
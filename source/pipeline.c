@@ -0,0 +1,684 @@
+/************************************************************************************//**
+* \file         pipeline.c
+* \brief        Firmware update pipeline source file.
+* \ingroup      Pipeline
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
+#include "session.h"                        /* Communication session module            */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "pipeline.h"                       /* Firmware update pipeline module         */
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (FIRMWARE_CHUNK_SIZE > PIPELINE_SLOT_DATA_SIZE)
+#error "PIPELINE_SLOT_DATA_SIZE must be at least equal to FIRMWARE_CHUNK_SIZE"
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Slot buffer for storing one chunk of firmware data. */
+typedef struct
+{
+  uint32_t address;                             /**< Memory address of the chunk.      */
+  uint16_t len;                                 /**< Number of bytes in the chunk.     */
+  uint8_t  data[PIPELINE_SLOT_DATA_SIZE];       /**< Data of the chunk.                */
+} tPipelineSlot;
+
+/** \brief Pipeline context that groups all the information of a firmware update
+ *         pipeline.
+ */
+struct t_pipeline_context
+{
+  /** \brief Session context of the target that is being updated. */
+  tSessionContext  * session;
+  /** \brief Firmware context of the firmware file that is being programmed. */
+  tFirmwareContext * firmware;
+  /** \brief Ring of slot buffers. */
+  tPipelineSlot      slots[PIPELINE_SLOT_COUNT];
+  /** \brief Index of the slot that the producer fills next. */
+  uint8_t            head;
+  /** \brief Index of the slot that the consumer programs next. */
+  uint8_t            tail;
+  /** \brief Number of filled slots. Shared by the producer and the consumer, so only
+   *         modify it inside a critical section.
+   */
+  uint8_t            count;
+  /** \brief Index of the segment that the producer currently reads. */
+  uint32_t           segmentIdx;
+  /** \brief TBX_TRUE if the segment with index segmentIdx was opened for reading. */
+  uint8_t            segmentOpened;
+  /** \brief TBX_TRUE when the producer read all firmware data from the file. */
+  uint8_t            produceDone;
+  /** \brief TBX_TRUE when the consumer started an asynchronous write of the tail. */
+  uint8_t            writeBusy;
+  /** \brief Index of the segment that the consumer erases next. */
+  uint32_t           eraseIdx;
+  /** \brief TBX_TRUE when the consumer erased the memory of all segments. Also
+   *         TBX_TRUE when the pipeline does not need to erase at all.
+   */
+  uint8_t            eraseDone;
+  /** \brief TBX_TRUE when the consumer started an asynchronous erase. */
+  uint8_t            eraseBusy;
+  /** \brief TBX_TRUE when either one of the stages detected an error. */
+  uint8_t            error;
+};
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t PipelineEraseNext(tPipelineContext * context, uint8_t async);
+static void    PipelineReleaseSlot(tPipelineContext * context);
+static void    PipelineSetError(tPipelineContext * context);
+static uint8_t PipelineGetStatus(tPipelineContext * context);
+
+
+/************************************************************************************//**
+** \brief     Creates a pipeline context. Each firmware update that runs at the same
+**            time, needs its own pipeline context. The context is allocated from the
+**            memory pool.
+** \return    Pointer to the pipeline context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tPipelineContext * PipelineCreate(void)
+{
+  tPipelineContext * result;
+
+  /* Attempt to allocate the context. */
+  result = TbxMemPoolAllocate(sizeof(tPipelineContext));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (result == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tPipelineContext));
+    /* Allocation should now work. */
+    result = TbxMemPoolAllocate(sizeof(tPipelineContext));
+  }
+
+  /* Only continue if the context was allocated. */
+  if (result != NULL)
+  {
+    /* Initialize the pipeline, such that it reports an error until it is started. */
+    result->session = NULL;
+    result->firmware = NULL;
+    result->head = 0U;
+    result->tail = 0U;
+    result->count = 0U;
+    result->segmentIdx = 0U;
+    result->segmentOpened = TBX_FALSE;
+    result->produceDone = TBX_FALSE;
+    result->writeBusy = TBX_FALSE;
+    result->eraseIdx = 0U;
+    result->eraseDone = TBX_TRUE;
+    result->eraseBusy = TBX_FALSE;
+    result->error = TBX_TRUE;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a pipeline context. Make sure none of the pipeline's stages still
+**            run, before calling this function.
+** \param     context The pipeline context, as created by PipelineCreate().
+**
+****************************************************************************************/
+void PipelineDestroy(tPipelineContext * context)
+{
+  /* Verify the pipeline context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid pipeline context. */
+  if (context != NULL)
+  {
+    /* Give the context back to the memory pool. */
+    TbxMemPoolRelease(context);
+  }
+} /*** end of PipelineDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the pipeline. Make sure the firmware file is opened, the session
+**            is started and the memory on the target is erased, before calling this
+**            function. Afterwards call PipelineProduce() and PipelineConsume(), each
+**            from their own task, or call PipelineTask() from a single task, until the
+**            pipeline is no longer busy. The pipeline completes with an error right
+**            away, if the chunk size of the firmware context is larger than a slot
+**            buffer.
+** \param     context The pipeline context, as created by PipelineCreate().
+** \param     session The session context of the target.
+** \param     firmware The firmware context of the firmware file.
+**
+****************************************************************************************/
+void PipelineStart(tPipelineContext * context, tSessionContext * session,
+                   tFirmwareContext * firmware)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (session != NULL) && (firmware != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (session != NULL) && (firmware != NULL))
+  {
+    /* Reset the pipeline and store the contexts to operate on. */
+    TbxCriticalSectionEnter();
+    context->session = session;
+    context->firmware = firmware;
+    context->head = 0U;
+    context->tail = 0U;
+    context->count = 0U;
+    context->segmentIdx = 0U;
+    context->segmentOpened = TBX_FALSE;
+    context->produceDone = TBX_FALSE;
+    context->writeBusy = TBX_FALSE;
+    context->eraseIdx = 0U;
+    context->eraseDone = TBX_TRUE;
+    context->eraseBusy = TBX_FALSE;
+    context->error = TBX_FALSE;
+    /* Each chunk of firmware data must fit in a slot buffer. */
+    if (FirmwareGetChunkSize(firmware) > PIPELINE_SLOT_DATA_SIZE)
+    {
+      context->error = TBX_TRUE;
+    }
+    TbxCriticalSectionExit();
+  }
+} /*** end of PipelineStart ***/
+
+
+/************************************************************************************//**
+** \brief     Same as PipelineStart(), but the consumer stage first erases the memory of
+**            all segments on the target. While the target erases, the producer stage
+**            already reads ahead, until all slot buffers are filled. So there is no need
+**            to erase the memory on the target before calling this function. Note that
+**            all segments are erased before programming starts, because the target
+**            aligns the erase to its flash sectors and segments can share a sector.
+** \param     context The pipeline context, as created by PipelineCreate().
+** \param     session The session context of the target.
+** \param     firmware The firmware context of the firmware file.
+**
+****************************************************************************************/
+void PipelineStartWithErase(tPipelineContext * context, tSessionContext * session,
+                            tFirmwareContext * firmware)
+{
+  /* Reset the pipeline and store the contexts to operate on. */
+  PipelineStart(context, session, firmware);
+  /* Let the consumer start by erasing the segments. */
+  if ((context != NULL) && (session != NULL) && (firmware != NULL))
+  {
+    TbxCriticalSectionEnter();
+    context->eraseDone = TBX_FALSE;
+    TbxCriticalSectionExit();
+  }
+} /*** end of PipelineStartWithErase ***/
+
+
+/************************************************************************************//**
+** \brief     Runs the producer stage of the pipeline. It reads the next chunk of
+**            firmware data from the file and stores it in a free slot buffer. It does
+**            nothing if no slot buffer is free, so it never blocks on the consumer.
+** \param     context The pipeline context, as created by PipelineCreate().
+** \return    PIPELINE_STATUS_BUSY as long as not all firmware data was read,
+**            PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t PipelineProduce(tPipelineContext * context)
+{
+  uint8_t         result = PIPELINE_STATUS_ERROR;
+  uint8_t         slotFree;
+  uint8_t const * chunkData;
+  uint32_t        chunkBase = 0U;
+  uint16_t        chunkLen = 0U;
+  uint16_t        idx;
+  tPipelineSlot * slot;
+
+  /* Verify the pipeline context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid pipeline context. */
+  if (context != NULL)
+  {
+    /* Determine if a slot buffer is free. */
+    TbxCriticalSectionEnter();
+    slotFree = TBX_FALSE;
+    if (context->count < PIPELINE_SLOT_COUNT)
+    {
+      slotFree = TBX_TRUE;
+    }
+    TbxCriticalSectionExit();
+
+    /* Only continue if there is still data to read and a slot buffer is free. */
+    if ( (context->error == TBX_FALSE) && (context->produceDone == TBX_FALSE) &&
+         (slotFree == TBX_TRUE) )
+    {
+      /* Open the next segment, if needed. */
+      if (context->segmentOpened == TBX_FALSE)
+      {
+        /* All segments read? */
+        if (context->segmentIdx >= FirmwareSegmentGetCount(context->firmware))
+        {
+          /* All firmware data was read. */
+          context->produceDone = TBX_TRUE;
+        }
+        else
+        {
+          /* Open the segment for reading. */
+          FirmwareSegmentOpen(context->firmware, context->segmentIdx);
+          context->segmentOpened = TBX_TRUE;
+        }
+      }
+
+      /* Only continue if a segment is opened for reading. */
+      if (context->segmentOpened == TBX_TRUE)
+      {
+        /* Attempt to read the next chunk of data in this segment. */
+        chunkData = FirmwareSegmentGetNextData(context->firmware, &chunkBase, &chunkLen);
+        /* Did an error occur or does the chunk not fit in the slot buffer? */
+        if ( (chunkData == NULL) || (chunkLen > PIPELINE_SLOT_DATA_SIZE) )
+        {
+          /* Flag the error. */
+          PipelineSetError(context);
+        }
+        /* Segment end reached? */
+        else if (chunkLen == 0U)
+        {
+          /* Continue with the next segment. */
+          context->segmentOpened = TBX_FALSE;
+          context->segmentIdx++;
+        }
+        /* New data chunk was read. */
+        else
+        {
+          /* Copy the chunk to the free slot buffer. Note that the consumer does not
+           * access the slot buffer at the head, until count is incremented.
+           */
+          slot = &context->slots[context->head];
+          slot->address = chunkBase;
+          slot->len = chunkLen;
+          for (idx = 0U; idx < chunkLen; idx++)
+          {
+            slot->data[idx] = chunkData[idx];
+          }
+          context->head = (uint8_t)((context->head + 1U) % PIPELINE_SLOT_COUNT);
+          /* Hand the slot buffer over to the consumer. */
+          TbxCriticalSectionEnter();
+          context->count++;
+          TbxCriticalSectionExit();
+        }
+      }
+    }
+
+    /* Determine the overall status. */
+    result = PipelineGetStatus(context);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineProduce ***/
+
+
+/************************************************************************************//**
+** \brief     Runs the consumer stage of the pipeline. It programs the oldest filled
+**            slot buffer on the target, in a blocking manner. It does nothing if no slot
+**            buffer is filled, so it never blocks on the producer. If the pipeline was
+**            started with PipelineStartWithErase(), it first erases one segment per
+**            call, while the producer fills the slot buffers.
+** \param     context The pipeline context, as created by PipelineCreate().
+** \return    PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t PipelineConsume(tPipelineContext * context)
+{
+  uint8_t         result = PIPELINE_STATUS_ERROR;
+  uint8_t         slotFilled;
+  tPipelineSlot * slot;
+
+  /* Verify the pipeline context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid pipeline context. */
+  if (context != NULL)
+  {
+    /* Determine if a slot buffer is filled. */
+    TbxCriticalSectionEnter();
+    slotFilled = TBX_FALSE;
+    if (context->count > 0U)
+    {
+      slotFilled = TBX_TRUE;
+    }
+    TbxCriticalSectionExit();
+
+    /* Erase the next segment, if not all segments were erased yet. */
+    if ( (context->error == TBX_FALSE) && (context->eraseDone == TBX_FALSE) )
+    {
+      if (PipelineEraseNext(context, TBX_FALSE) != TBX_OK)
+      {
+        /* Flag the error. */
+        PipelineSetError(context);
+      }
+    }
+    /* Only continue if no error was detected and a slot buffer is filled. */
+    else if ( (context->error == TBX_FALSE) && (slotFilled == TBX_TRUE) )
+    {
+      /* Program the data of the slot buffer. */
+      slot = &context->slots[context->tail];
+      if (SessionWriteData(context->session, slot->address, slot->len,
+                           slot->data) == TBX_OK)
+      {
+        /* Hand the slot buffer back to the producer. */
+        PipelineReleaseSlot(context);
+      }
+      else
+      {
+        /* Flag the error. */
+        PipelineSetError(context);
+      }
+    }
+
+    /* Determine the overall status. */
+    result = PipelineGetStatus(context);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineConsume ***/
+
+
+/************************************************************************************//**
+** \brief     Runs both stages of the pipeline from a single task. The consumer stage
+**            uses the asynchronous session API, such that the producer stage can read
+**            the next chunk of firmware data, while the target programs the current
+**            one. Likewise, the producer stage reads ahead while the target erases, if
+**            the pipeline was started with PipelineStartWithErase(). Without waiting,
+**            this function does not block and should be called continuously, until it
+**            is no longer busy. With waiting, it blocks while the target erases or
+**            programs, if the producer stage cannot read ahead, because all slot buffers
+**            are filled or all firmware data was read. This way the task does not keep
+**            the CPU busy, while there is nothing else to do for it.
+** \param     context The pipeline context, as created by PipelineCreate().
+** \param     wait TBX_TRUE to wait for the target when there is nothing else to do,
+**            TBX_FALSE to never wait.
+** \return    PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+uint8_t PipelineTask(tPipelineContext * context, uint8_t wait)
+{
+  uint8_t         result = PIPELINE_STATUS_ERROR;
+  uint8_t         sessionStatus;
+  uint8_t         sessionWait = TBX_FALSE;
+  tPipelineSlot * slot;
+
+  /* Verify the pipeline context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid pipeline context. */
+  if (context != NULL)
+  {
+    /* Only wait for the target, if requested and if the producer cannot read ahead.
+     * Note that no critical section is needed for accessing count, because the
+     * producer runs in the same task.
+     */
+    if ( (wait == TBX_TRUE) &&
+         ((context->count >= PIPELINE_SLOT_COUNT) ||
+          (context->produceDone == TBX_TRUE)) )
+    {
+      sessionWait = TBX_TRUE;
+    }
+
+    /* Continue the erasing of a segment, if one is in progress. */
+    if (context->eraseBusy == TBX_TRUE)
+    {
+      sessionStatus = SessionTask(context->session, sessionWait);
+      if (sessionStatus != SESSION_STATUS_BUSY)
+      {
+        context->eraseBusy = TBX_FALSE;
+        /* Erase completed successfully? */
+        if (sessionStatus == SESSION_STATUS_DONE)
+        {
+          /* Continue with the next segment. */
+          context->eraseIdx++;
+        }
+        else
+        {
+          /* Flag the error. */
+          PipelineSetError(context);
+        }
+      }
+    }
+
+    /* Continue the programming of the tail slot buffer, if one is in progress. */
+    if (context->writeBusy == TBX_TRUE)
+    {
+      sessionStatus = SessionTask(context->session, sessionWait);
+      if (sessionStatus != SESSION_STATUS_BUSY)
+      {
+        context->writeBusy = TBX_FALSE;
+        /* Programming completed successfully? */
+        if (sessionStatus == SESSION_STATUS_DONE)
+        {
+          /* Hand the slot buffer back to the producer. */
+          PipelineReleaseSlot(context);
+        }
+        else
+        {
+          /* Flag the error. */
+          PipelineSetError(context);
+        }
+      }
+    }
+
+    /* Read the next chunk of firmware data, if a slot buffer is free. */
+    (void)PipelineProduce(context);
+
+    /* Start erasing the next segment, if not all segments were erased yet and the
+     * erasing of the previous one completed.
+     */
+    if ( (context->error == TBX_FALSE) && (context->eraseDone == TBX_FALSE) &&
+         (context->eraseBusy == TBX_FALSE) )
+    {
+      if (PipelineEraseNext(context, TBX_TRUE) != TBX_OK)
+      {
+        /* Flag the error. */
+        PipelineSetError(context);
+      }
+    }
+
+    /* Start programming the tail slot buffer, if it is filled and the programming of
+     * the previous one completed. Note that no critical section is needed for accessing
+     * count, because the producer runs in the same task.
+     */
+    if ( (context->error == TBX_FALSE) && (context->eraseDone == TBX_TRUE) &&
+         (context->writeBusy == TBX_FALSE) && (context->count > 0U) )
+    {
+      slot = &context->slots[context->tail];
+      if (SessionWriteDataAsync(context->session, slot->address, slot->len,
+                                slot->data) == TBX_OK)
+      {
+        context->writeBusy = TBX_TRUE;
+      }
+      else
+      {
+        /* Flag the error. */
+        PipelineSetError(context);
+      }
+    }
+
+    /* Determine the overall status. */
+    result = PipelineGetStatus(context);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineTask ***/
+
+
+/************************************************************************************//**
+** \brief     Erases the memory of the next segment on the target. Once all segments
+**            are erased, it flags that erasing is done instead. Note that it only reads
+**            the segment information from the firmware context, which is safe to do
+**            while the producer reads firmware data from it.
+** \param     context The pipeline context.
+** \param     async TBX_TRUE to only start the erase with the asynchronous session API,
+**            TBX_FALSE to erase in a blocking manner.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t PipelineEraseNext(tPipelineContext * context, uint8_t async)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t segmentBase = 0U;
+  uint32_t segmentLen;
+
+  /* All segments erased? */
+  if (context->eraseIdx >= FirmwareSegmentGetCount(context->firmware))
+  {
+    /* Allow the consumer to start programming. */
+    TbxCriticalSectionEnter();
+    context->eraseDone = TBX_TRUE;
+    TbxCriticalSectionExit();
+    result = TBX_OK;
+  }
+  else
+  {
+    /* Obtain the memory range of the segment. */
+    segmentLen = FirmwareSegmentGetInfo(context->firmware, context->eraseIdx,
+                                        &segmentBase);
+    /* Only continue if the segment actually holds data. */
+    if (segmentLen > 0U)
+    {
+      if (async == TBX_TRUE)
+      {
+        /* Start the erase. PipelineTask() continues it. */
+        result = SessionClearMemoryAsync(context->session, segmentBase, segmentLen);
+        if (result == TBX_OK)
+        {
+          context->eraseBusy = TBX_TRUE;
+        }
+      }
+      else
+      {
+        /* Erase and continue with the next segment. */
+        result = SessionClearMemory(context->session, segmentBase, segmentLen);
+        if (result == TBX_OK)
+        {
+          context->eraseIdx++;
+        }
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineEraseNext ***/
+
+
+/************************************************************************************//**
+** \brief     Hands the tail slot buffer, which was programmed, back to the producer.
+** \param     context The pipeline context.
+**
+****************************************************************************************/
+static void PipelineReleaseSlot(tPipelineContext * context)
+{
+  /* Advance to the next slot buffer. */
+  context->tail = (uint8_t)((context->tail + 1U) % PIPELINE_SLOT_COUNT);
+  TbxCriticalSectionEnter();
+  context->count--;
+  TbxCriticalSectionExit();
+} /*** end of PipelineReleaseSlot ***/
+
+
+/************************************************************************************//**
+** \brief     Flags that an error was detected, which stops both stages.
+** \param     context The pipeline context.
+**
+****************************************************************************************/
+static void PipelineSetError(tPipelineContext * context)
+{
+  TbxCriticalSectionEnter();
+  context->error = TBX_TRUE;
+  TbxCriticalSectionExit();
+} /*** end of PipelineSetError ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the overall status of the pipeline.
+** \param     context The pipeline context.
+** \return    PIPELINE_STATUS_BUSY as long as not all firmware data was programmed,
+**            PIPELINE_STATUS_DONE when all firmware data was read and programmed,
+**            PIPELINE_STATUS_ERROR in case of an error.
+**
+****************************************************************************************/
+static uint8_t PipelineGetStatus(tPipelineContext * context)
+{
+  uint8_t result = PIPELINE_STATUS_BUSY;
+
+  TbxCriticalSectionEnter();
+  /* Did one of the stages detect an error? */
+  if (context->error == TBX_TRUE)
+  {
+    result = PIPELINE_STATUS_ERROR;
+  }
+  /* All data read and programmed? */
+  else if ( (context->produceDone == TBX_TRUE) && (context->count == 0U) &&
+            (context->writeBusy == TBX_FALSE) && (context->eraseDone == TBX_TRUE) )
+  {
+    result = PIPELINE_STATUS_DONE;
+  }
+  else
+  {
+    /* Still busy. */
+  }
+  TbxCriticalSectionExit();
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of PipelineGetStatus ***/
+
+
+/*********************************** end of pipeline.c *********************************/
@@ -0,0 +1,131 @@
+/************************************************************************************//**
+* \file         pipeline.h
+* \brief        Firmware update pipeline header file.
+* \ingroup      Pipeline
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Pipeline Firmware Update Pipeline Module
+* \brief      Module with functionality to overlap the reading of firmware data with its
+*             programming on the target.
+* \ingroup    Library
+* \details
+* The Firmware Update Pipeline module programs all firmware data of the opened firmware
+* file on the target. It consists of a producer stage, which reads chunks of firmware
+* data from the file and stores them in a ring of slot buffers, and a consumer stage,
+* which programs the buffered chunks on the target. This way the reading and parsing of
+* the next chunk overlaps with the programming of the current chunk. The stages can run
+* in two separate RTOS tasks. Alternatively, PipelineTask() runs both stages in a single
+* thread, with the help of the asynchronous session API. When the producer stage cannot
+* read ahead any further, PipelineTask() can optionally block until the target
+* completed, instead of returning right away.
+*
+* When started with PipelineStartWithErase(), the consumer stage first erases the memory
+* of all segments on the target. Erasing flash memory takes a long time. The producer
+* stage already fills the slot buffers in the meantime, such that programming can start
+* right after the erase completed.
+*
+* All information about a pipeline is stored in a pipeline context. Multiple pipeline
+* contexts can exist at the same time, for example to update multiple targets, each from
+* their own task.
+****************************************************************************************/
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of slot buffers in the ring. Two is enough to read the next chunk while
+ *         programming the current one. More slots can absorb variations in the file
+ *         reading speed and hold more chunks that are read ahead while the target
+ *         erases, at the expense of RAM.
+ */
+#ifndef PIPELINE_SLOT_COUNT
+#define PIPELINE_SLOT_COUNT            (2U)
+#endif
+
+/** \brief Size of the data buffer in each slot. It must be at least equal to the largest
+ *         chunk of firmware data that the firmware file reader outputs. So at least
+ *         equal to the chunk size, if one is configured with FirmwareSetChunkSize().
+ *         Defaults to FIRMWARE_CHUNK_SIZE, if that one is larger than 512.
+ */
+#ifndef PIPELINE_SLOT_DATA_SIZE
+#if defined(FIRMWARE_CHUNK_SIZE) && (FIRMWARE_CHUNK_SIZE > 512U)
+#define PIPELINE_SLOT_DATA_SIZE        (FIRMWARE_CHUNK_SIZE)
+#else
+#define PIPELINE_SLOT_DATA_SIZE        (512U)
+#endif
+#endif
+
+/** \brief Status of the pipeline when it is still busy. */
+#define PIPELINE_STATUS_BUSY           ((uint8_t)0U)
+
+/** \brief Status of the pipeline when it completed successfully. */
+#define PIPELINE_STATUS_DONE           ((uint8_t)1U)
+
+/** \brief Status of the pipeline when it completed with an error. */
+#define PIPELINE_STATUS_ERROR          ((uint8_t)2U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Pipeline context. It groups all the information of a firmware update
+ *         pipeline, such that multiple pipelines can run at the same time. Its layout
+ *         is private to the pipeline module.
+ */
+typedef struct t_pipeline_context tPipelineContext;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tPipelineContext * PipelineCreate(void);
+void               PipelineDestroy(tPipelineContext * context);
+void               PipelineStart(tPipelineContext * context, tSessionContext * session,
+                                 tFirmwareContext * firmware);
+void               PipelineStartWithErase(tPipelineContext * context,
+                                          tSessionContext * session,
+                                          tFirmwareContext * firmware);
+uint8_t            PipelineProduce(tPipelineContext * context);
+uint8_t            PipelineConsume(tPipelineContext * context);
+uint8_t            PipelineTask(tPipelineContext * context, uint8_t wait);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PIPELINE_H */
+/*********************************** end of pipeline.h *********************************/
@@ -92,6 +92,28 @@ typedef struct
    */
   uint8_t  (* XcpComputeKeyFromSeed) (uint8_t seedLen, uint8_t const * seedPtr,
                                       uint8_t * keyLenPtr, uint8_t * keyPtr);
+
+  /** \brief Optional. Attempts to receive an XCP packet using the transport layer
+   *         implemented by the port, while blocking for at most the specified timeout
+   *         in milliseconds. The function should return TBX_TRUE if a packet was
+   *         received, TBX_FALSE otherwise. A newly received packet should be stored in
+   *         the rxPacket parameter. When set, the library uses it instead of polling
+   *         XcpReceivePacket while waiting for a response packet. This makes it possible
+   *         to wait for an RTOS event, such that the CPU can idle in the meantime. Set
+   *         it to NULL if not supported.
+   */
+  uint8_t  (* XcpReceivePacketTimeout) (tPortXcpPacket * rxPacket, uint32_t timeout);
+
+  /** \brief Optional. Continues a CRC calculation with the help of a hardware CRC unit.
+   *         The type parameter is 0x07 for CRC16, 0x08 for CRC16 CCITT and 0x09 for
+   *         CRC32, as defined by the XCP BUILD_CHECKSUM command. The crc parameter
+   *         holds the intermediate CRC value, which should be updated with the data.
+   *         For CRC32 this is the value before the final XOR with 0xFFFFFFFF. The
+   *         function should return TBX_OK if it calculated the CRC, TBX_ERROR to let
+   *         the library calculate it in software. Set it to NULL if not supported.
+   */
+  uint8_t  (* CrcCalculate) (uint8_t type, uint32_t * crc, uint8_t const * data,
+                             uint32_t len);
 } tPort;
 
 
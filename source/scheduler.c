@@ -0,0 +1,495 @@
+/************************************************************************************//**
+* \file         scheduler.c
+* \brief        Multi-node update scheduler source file.
+* \ingroup      Scheduler
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
+#include "session.h"                        /* Communication session module            */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "scheduler.h"                      /* Multi-node update scheduler module      */
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Enumeration with the states of a node's update state machine. */
+typedef enum
+{
+  SCHEDULER_STATE_ERASE,                         /**< Ready to erase the next segment. */
+  SCHEDULER_STATE_ERASE_BUSY,                    /**< Waiting for the erase to finish. */
+  SCHEDULER_STATE_PROGRAM,                       /**< Ready to program the next chunk. */
+  SCHEDULER_STATE_PROGRAM_BUSY,                  /**< Waiting for the program to end.  */
+  SCHEDULER_STATE_DONE,                          /**< Update completed successfully.   */
+  SCHEDULER_STATE_ERROR                          /**< Update completed with an error.  */
+} tSchedulerState;
+
+/** \brief Information about a node that is being updated. */
+typedef struct
+{
+  /** \brief Session context of the node. */
+  tSessionContext  * session;
+  /** \brief Firmware context of the firmware file that is programmed on the node. */
+  tFirmwareContext * firmware;
+  /** \brief Current state of the node's update state machine. */
+  tSchedulerState    state;
+  /** \brief Index of the segment that is currently erased or programmed. */
+  uint32_t           segmentIdx;
+  /** \brief TBX_TRUE if the segment with index segmentIdx was opened for reading. */
+  uint8_t            segmentOpened;
+} tSchedulerNode;
+
+/** \brief Scheduler context that groups all the information of the nodes that are
+ *         being updated.
+ */
+struct t_scheduler_context
+{
+  /** \brief Information about the nodes that are being updated. */
+  tSchedulerNode nodes[SCHEDULER_NODES_MAX];
+  /** \brief Number of used elements in the nodes array. */
+  uint8_t        nodeCount;
+};
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void    SchedulerProcessNode(tSchedulerNode * node);
+static uint8_t SchedulerStartErase(tSchedulerNode * node);
+static uint8_t SchedulerStartProgram(tSchedulerNode * node);
+
+
+/************************************************************************************//**
+** \brief     Creates a scheduler context without any nodes. The context is allocated
+**            from the memory pool.
+** \return    Pointer to the scheduler context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tSchedulerContext * SchedulerCreate(void)
+{
+  tSchedulerContext * result;
+
+  /* Attempt to allocate the context. */
+  result = TbxMemPoolAllocate(sizeof(tSchedulerContext));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (result == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tSchedulerContext));
+    /* Allocation should now work. */
+    result = TbxMemPoolAllocate(sizeof(tSchedulerContext));
+  }
+
+  /* Only continue if the context was allocated. */
+  if (result != NULL)
+  {
+    /* Start without any nodes. */
+    result->nodeCount = 0U;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a scheduler context.
+** \param     context The scheduler context, as created by SchedulerCreate().
+**
+****************************************************************************************/
+void SchedulerDestroy(tSchedulerContext * context)
+{
+  /* Verify the scheduler context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid scheduler context. */
+  if (context != NULL)
+  {
+    /* Give the context back to the memory pool. */
+    TbxMemPoolRelease(context);
+  }
+} /*** end of SchedulerDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the scheduler without any nodes. Add the nodes to update with
+**            SchedulerAddNode() and afterwards call SchedulerTask() continuously, until
+**            it is no longer busy.
+** \param     context The scheduler context, as created by SchedulerCreate().
+**
+****************************************************************************************/
+void SchedulerStart(tSchedulerContext * context)
+{
+  /* Verify the scheduler context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid scheduler context. */
+  if (context != NULL)
+  {
+    /* Remove all nodes. */
+    context->nodeCount = 0U;
+  }
+} /*** end of SchedulerStart ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a node to the scheduler. Make sure the firmware file is opened and the
+**            session is started, before calling this function. The memory on the node
+**            should not be erased upfront, because the scheduler takes care of this.
+** \param     context The scheduler context, as created by SchedulerCreate().
+** \param     session The session context of the node.
+** \param     firmware The firmware context of the firmware file to program on the node.
+**            Each node needs its own firmware context.
+** \return    TBX_OK if successful, TBX_ERROR if the maximum number of nodes was reached
+**            or the session or firmware context is already used by another node.
+**
+****************************************************************************************/
+uint8_t SchedulerAddNode(tSchedulerContext * context, tSessionContext * session,
+                         tFirmwareContext * firmware)
+{
+  uint8_t          result = TBX_ERROR;
+  uint8_t          idx;
+  tSchedulerNode * node;
+
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (session != NULL) && (firmware != NULL));
+
+  /* Only continue with valid parameters and if there is space for another node. */
+  if ( (context != NULL) && (session != NULL) && (firmware != NULL) &&
+       (context->nodeCount < SCHEDULER_NODES_MAX) )
+  {
+    /* Set a positive result and only negate upon error detection from here on. */
+    result = TBX_OK;
+    /* Make sure the contexts are not already used by another node. */
+    for (idx = 0U; idx < context->nodeCount; idx++)
+    {
+      if ( (context->nodes[idx].session == session) ||
+           (context->nodes[idx].firmware == firmware) )
+      {
+        result = TBX_ERROR;
+      }
+    }
+    /* Add the node, if all is okay so far. */
+    if (result == TBX_OK)
+    {
+      node = &context->nodes[context->nodeCount];
+      node->session = session;
+      node->firmware = firmware;
+      node->state = SCHEDULER_STATE_ERASE;
+      node->segmentIdx = 0U;
+      node->segmentOpened = TBX_FALSE;
+      context->nodeCount++;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerAddNode ***/
+
+
+/************************************************************************************//**
+** \brief     Progresses the update of all nodes. For each node, it first erases the
+**            memory of all segments and then programs their firmware data. A node that
+**            waits for a response from its target, does not hold up the other nodes.
+**            Neither does a node that completed with an error. This function does not
+**            block and should be called continuously, until it is no longer busy.
+** \param     context The scheduler context, as created by SchedulerCreate().
+** \return    SCHEDULER_STATUS_BUSY as long as not all nodes completed,
+**            SCHEDULER_STATUS_DONE when all nodes completed successfully,
+**            SCHEDULER_STATUS_ERROR when all nodes completed, but at least one of them
+**            with an error. Use SchedulerGetNodeStatus() to find out which one.
+**
+****************************************************************************************/
+uint8_t SchedulerTask(tSchedulerContext * context)
+{
+  uint8_t result = SCHEDULER_STATUS_ERROR;
+  uint8_t idx;
+  uint8_t nodeStatus;
+
+  /* Verify the scheduler context. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with a valid scheduler context. */
+  if (context != NULL)
+  {
+    /* Give each node the chance to progress its update. */
+    for (idx = 0U; idx < context->nodeCount; idx++)
+    {
+      SchedulerProcessNode(&context->nodes[idx]);
+    }
+
+    /* Determine the overall status. Busy takes precedence over an error. */
+    result = SCHEDULER_STATUS_DONE;
+    for (idx = 0U; idx < context->nodeCount; idx++)
+    {
+      nodeStatus = SchedulerGetNodeStatus(context, idx);
+      if (nodeStatus == SCHEDULER_STATUS_BUSY)
+      {
+        result = SCHEDULER_STATUS_BUSY;
+      }
+      else if ( (nodeStatus == SCHEDULER_STATUS_ERROR) &&
+                (result == SCHEDULER_STATUS_DONE) )
+      {
+        result = SCHEDULER_STATUS_ERROR;
+      }
+      else
+      {
+        /* Node completed successfully or the overall status is already known. */
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerTask ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the status of the update of a specific node.
+** \param     context The scheduler context, as created by SchedulerCreate().
+** \param     idx Zero-based index of the node, in the order that the nodes were added.
+** \return    SCHEDULER_STATUS_BUSY as long as the node's update is in progress,
+**            SCHEDULER_STATUS_DONE when it completed successfully,
+**            SCHEDULER_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+uint8_t SchedulerGetNodeStatus(tSchedulerContext * context, uint8_t idx)
+{
+  uint8_t result = SCHEDULER_STATUS_ERROR;
+
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (idx < context->nodeCount));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (idx < context->nodeCount))
+  {
+    if (context->nodes[idx].state == SCHEDULER_STATE_DONE)
+    {
+      result = SCHEDULER_STATUS_DONE;
+    }
+    else if (context->nodes[idx].state != SCHEDULER_STATE_ERROR)
+    {
+      result = SCHEDULER_STATUS_BUSY;
+    }
+    else
+    {
+      /* Node completed with an error. */
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerGetNodeStatus ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the update state machine of a node. It keeps going until the
+**            node needs to wait for its target or until its update completed.
+** \param     node Pointer to the node.
+**
+****************************************************************************************/
+static void SchedulerProcessNode(tSchedulerNode * node)
+{
+  uint8_t continueLoop = TBX_TRUE;
+  uint8_t sessionStatus;
+
+  while (continueLoop == TBX_TRUE)
+  {
+    switch (node->state)
+    {
+      /* Ready to erase the next segment. */
+      case SCHEDULER_STATE_ERASE:
+        /* All segments erased? */
+        if (node->segmentIdx >= FirmwareSegmentGetCount(node->firmware))
+        {
+          /* Continue by programming the segments, starting with the first one. */
+          node->segmentIdx = 0U;
+          node->state = SCHEDULER_STATE_PROGRAM;
+        }
+        else if (SchedulerStartErase(node) == TBX_OK)
+        {
+          node->state = SCHEDULER_STATE_ERASE_BUSY;
+        }
+        else
+        {
+          node->state = SCHEDULER_STATE_ERROR;
+        }
+        break;
+
+      /* Ready to program the next chunk of firmware data. */
+      case SCHEDULER_STATE_PROGRAM:
+        /* Note that this also detects the end of the firmware data. */
+        if (SchedulerStartProgram(node) != TBX_OK)
+        {
+          node->state = SCHEDULER_STATE_ERROR;
+        }
+        break;
+
+      /* Waiting for the erase or program operation to finish. */
+      case SCHEDULER_STATE_ERASE_BUSY:
+      case SCHEDULER_STATE_PROGRAM_BUSY:
+        sessionStatus = SessionTask(node->session, TBX_FALSE);
+        if (sessionStatus == SESSION_STATUS_BUSY)
+        {
+          /* Give the other nodes a chance, while this target is busy. */
+          continueLoop = TBX_FALSE;
+        }
+        else if (sessionStatus == SESSION_STATUS_ERROR)
+        {
+          node->state = SCHEDULER_STATE_ERROR;
+        }
+        else if (node->state == SCHEDULER_STATE_ERASE_BUSY)
+        {
+          /* Continue with the next segment to erase. */
+          node->segmentIdx++;
+          node->state = SCHEDULER_STATE_ERASE;
+        }
+        else
+        {
+          /* Continue with the next chunk to program. */
+          node->state = SCHEDULER_STATE_PROGRAM;
+        }
+        break;
+
+      /* Update completed. */
+      case SCHEDULER_STATE_DONE:
+      case SCHEDULER_STATE_ERROR:
+      default:
+        continueLoop = TBX_FALSE;
+        break;
+    }
+  }
+} /*** end of SchedulerProcessNode ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the asynchronous erase of the segment with index segmentIdx.
+** \param     node Pointer to the node.
+** \return    TBX_OK if the erase operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SchedulerStartErase(tSchedulerNode * node)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t segmentBase = 0U;
+  uint32_t segmentLen;
+
+  /* Obtain the memory range of the segment. */
+  segmentLen = FirmwareSegmentGetInfo(node->firmware, node->segmentIdx, &segmentBase);
+  /* Only continue if the segment actually holds data. */
+  if (segmentLen > 0U)
+  {
+    result = SessionClearMemoryAsync(node->session, segmentBase, segmentLen);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerStartErase ***/
+
+
+/************************************************************************************//**
+** \brief     Reads the next chunk of firmware data and starts its asynchronous
+**            programming. It moves on to the next segment, when the end of the current
+**            one is reached, and completes the node's update after the last segment.
+**            The chunk is programmed directly from the firmware context. This is okay,
+**            because the chunk stays valid until the next one is read from the same
+**            firmware context.
+** \param     node Pointer to the node.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SchedulerStartProgram(tSchedulerNode * node)
+{
+  uint8_t         result = TBX_OK;
+  uint8_t const * chunkData;
+  uint32_t        chunkBase = 0U;
+  uint16_t        chunkLen = 0U;
+
+  /* Open the next segment, if needed. */
+  if (node->segmentOpened == TBX_FALSE)
+  {
+    /* All segments programmed? */
+    if (node->segmentIdx >= FirmwareSegmentGetCount(node->firmware))
+    {
+      /* The node's update completed successfully. */
+      node->state = SCHEDULER_STATE_DONE;
+    }
+    else
+    {
+      /* Open the segment for reading. */
+      FirmwareSegmentOpen(node->firmware, node->segmentIdx);
+      node->segmentOpened = TBX_TRUE;
+    }
+  }
+
+  /* Only continue if a segment is opened for reading. */
+  if (node->segmentOpened == TBX_TRUE)
+  {
+    /* Attempt to read the next chunk of data in this segment. */
+    chunkData = FirmwareSegmentGetNextData(node->firmware, &chunkBase, &chunkLen);
+    /* Did an error occur? */
+    if (chunkData == NULL)
+    {
+      result = TBX_ERROR;
+    }
+    /* Segment end reached? */
+    else if (chunkLen == 0U)
+    {
+      /* Continue with the next segment. */
+      node->segmentOpened = TBX_FALSE;
+      node->segmentIdx++;
+    }
+    /* Start programming the new data chunk. */
+    else if (SessionWriteDataAsync(node->session, chunkBase, chunkLen,
+                                   chunkData) == TBX_OK)
+    {
+      node->state = SCHEDULER_STATE_PROGRAM_BUSY;
+    }
+    else
+    {
+      result = TBX_ERROR;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SchedulerStartProgram ***/
+
+
+/********************************* end of scheduler.c **********************************/
@@ -0,0 +1,112 @@
+/************************************************************************************//**
+* \file         scheduler.h
+* \brief        Multi-node update scheduler header file.
+* \ingroup      Scheduler
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Scheduler Multi-Node Update Scheduler Module
+* \brief      Module with functionality to update the firmware of multiple nodes at the
+*             same time.
+* \ingroup    Library
+* \details
+* The Multi-Node Update Scheduler module erases the memory of multiple nodes and programs
+* the firmware data of their firmware files, all from a single task. With a protocol
+* such as XCP, the master waits for the response of each command before it sends the
+* next one. While a node is busy erasing or programming its memory, the communication
+* link would therefore be idle. The scheduler fills this time with the commands for the
+* other nodes, with the help of the asynchronous session API. This makes the total time
+* for updating multiple nodes on the same bus much shorter than updating them one after
+* the other.
+*
+* Each node is formed by a session context and a firmware context. Each node needs its
+* own firmware context, because the firmware data that is being programmed is read
+* directly from the firmware context. When the nodes receive the same firmware, the
+* firmware contexts can share the firmware file with FirmwareFileShare(), so it is only
+* scanned once. Each session context needs its own port, which only receives the
+* response packets of its own node. For example by filtering on the CAN identifier.
+*
+* All information about the nodes is stored in a scheduler context. Multiple scheduler
+* contexts can exist at the same time, for example one for each bus.
+****************************************************************************************/
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Maximum number of nodes that the scheduler can update at the same time. */
+#ifndef SCHEDULER_NODES_MAX
+#define SCHEDULER_NODES_MAX            (8U)
+#endif
+
+/** \brief Status of the scheduler or a node, when it is still busy. */
+#define SCHEDULER_STATUS_BUSY          ((uint8_t)0U)
+
+/** \brief Status of the scheduler or a node, when it completed successfully. */
+#define SCHEDULER_STATUS_DONE          ((uint8_t)1U)
+
+/** \brief Status of the scheduler or a node, when it completed with an error. */
+#define SCHEDULER_STATUS_ERROR         ((uint8_t)2U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Scheduler context. It groups all the information of the nodes that are being
+ *         updated, such that multiple schedulers can run at the same time. Its layout
+ *         is private to the scheduler module.
+ */
+typedef struct t_scheduler_context tSchedulerContext;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+tSchedulerContext * SchedulerCreate(void);
+void                SchedulerDestroy(tSchedulerContext * context);
+void                SchedulerStart(tSchedulerContext * context);
+uint8_t             SchedulerAddNode(tSchedulerContext * context,
+                                     tSessionContext * session,
+                                     tFirmwareContext * firmware);
+uint8_t             SchedulerTask(tSchedulerContext * context);
+uint8_t             SchedulerGetNodeStatus(tSchedulerContext * context, uint8_t idx);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H */
+/********************************* end of scheduler.h **********************************/
@@ -0,0 +1,644 @@
+/************************************************************************************//**
+* \file         segtable.c
+* \brief        Segment table source file.
+* \ingroup      SegTable
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "segtable.h"                       /* Segment table                           */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of block pointers that the array with block pointers initially has
+ *         space for. The space is doubled each time the array is full.
+ */
+#define SEG_TABLE_BLOCKS_INITIAL_CAPACITY  (4U)
+
+
+/****************************************************************************************
+* Configuration check
+****************************************************************************************/
+#if (SEG_TABLE_BLOCK_SIZE == 0U)
+#error "SEG_TABLE_BLOCK_SIZE must be larger than 0"
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static tSegment * SegTableEntry(tSegTable const * table, uint32_t idx);
+static void     * SegTableAllocate(size_t size);
+static uint8_t    SegTableGrow(tSegTable * table);
+static void       SegTableSiftDown(tSegTable * table, uint32_t root, uint32_t count);
+static void       SegTableSwap(tSegTable * table, uint32_t idxA, uint32_t idxB);
+
+
+/************************************************************************************//**
+** \brief     Initializes the segment table. The table starts out empty.
+** \param     table Pointer to the segment table.
+**
+****************************************************************************************/
+void SegTableInit(tSegTable * table)
+{
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    /* Initialize the segment table members. */
+    table->blocks = NULL;
+    table->blockCount = 0U;
+    table->blockCapacity = 0U;
+    table->count = 0U;
+    table->current = 0U;
+    table->sorted = TBX_TRUE;
+  }
+} /*** end of SegTableInit ***/
+
+
+/************************************************************************************//**
+** \brief     Removes all segments from the segment table and releases its memory.
+** \param     table Pointer to the segment table.
+**
+****************************************************************************************/
+void SegTableClear(tSegTable * table)
+{
+  uint32_t blockIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    /* Give the allocated memory for the blocks and the array with block pointers back
+     * to the memory pool.
+     */
+    if (table->blocks != NULL)
+    {
+      for (blockIdx = 0U; blockIdx < table->blockCount; blockIdx++)
+      {
+        TbxMemPoolRelease(table->blocks[blockIdx]);
+      }
+      TbxMemPoolRelease(table->blocks);
+    }
+    /* Reset the segment table members. */
+    SegTableInit(table);
+  }
+} /*** end of SegTableClear ***/
+
+
+/************************************************************************************//**
+** \brief     Adds firmware data to the segment table. If the data directly follows the
+**            previously added data, both in memory and in the firmware file, it extends
+**            the segment of the previously added data. Otherwise a new segment is
+**            created for it. Call SegTableSort() once all data was added.
+** \param     table Pointer to the segment table.
+** \param     addr Base memory address of the data.
+** \param     len Length of the data in bytes.
+** \param     fptr File pointer inside the firmware file where the data starts.
+** \param     base Firmware file reader specific value for a newly created segment.
+** \return    TBX_OK if successful, TBX_ERROR if no memory could be allocated.
+**
+****************************************************************************************/
+uint8_t SegTableAddData(tSegTable * table, uint32_t addr, uint32_t len, FSIZE_t fptr,
+                        uint32_t base)
+{
+  /* Add the data without limiting the length of the segments. */
+  return SegTableAddDataLimited(table, addr, len, fptr, base, 0U);
+} /*** end of SegTableAddData ***/
+
+
+/************************************************************************************//**
+** \brief     Adds firmware data to the segment table. Same as SegTableAddData(), except
+**            that a segment is only extended as long as its length is less than the
+**            specified maximum length. This makes it possible to build an index with
+**            a file pointer for every so many bytes of firmware data.
+** \param     table Pointer to the segment table.
+** \param     addr Base memory address of the data.
+** \param     len Length of the data in bytes.
+** \param     fptr File pointer inside the firmware file where the data starts.
+** \param     base Firmware file reader specific value for a newly created segment.
+** \param     maxLen Length from which on a segment is no longer extended. Zero to not
+**            limit the length.
+** \return    TBX_OK if successful, TBX_ERROR if no memory could be allocated.
+**
+****************************************************************************************/
+uint8_t SegTableAddDataLimited(tSegTable * table, uint32_t addr, uint32_t len,
+                               FSIZE_t fptr, uint32_t base, uint32_t maxLen)
+{
+  uint8_t    result = TBX_ERROR;
+  tSegment * segment;
+
+  /* Verify parameters. */
+  TBX_ASSERT((table != NULL) && (len > 0U));
+
+  /* Only continue with valid parameters. */
+  if ((table != NULL) && (len > 0U))
+  {
+    /* Does the data fit at the end of the segment that the previously added data was
+     * stored in? The caller adds the data in the order of the firmware file, so it
+     * then also directly follows it in the firmware file.
+     */
+    segment = NULL;
+    if (table->current < table->count)
+    {
+      segment = SegTableEntry(table, table->current);
+      if ( (addr != (segment->addr + segment->len)) ||
+           ((maxLen > 0U) && (segment->len >= maxLen)) )
+      {
+        segment = NULL;
+      }
+    }
+    /* Extend the segment, if the data fits at its end. This is always the last
+     * segment in the table, so it cannot start to overlap with a segment after it.
+     */
+    if (segment != NULL)
+    {
+      segment->len += len;
+      result = TBX_OK;
+    }
+    /* Data did not fit, so a new segment should be created. */
+    else
+    {
+      result = SegTableInsert(table, addr, len, fptr, base);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableAddDataLimited ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a new segment and adds it to the end of the segment table. If it
+**            does not start at or after the end of the last segment, the segment table
+**            is marked as unsorted. Call SegTableSort() once all segments were added.
+** \param     table Pointer to the segment table.
+** \param     addr Base memory address of the segment's data.
+** \param     len Total length of the segment in bytes.
+** \param     fptr File pointer inside the firmware file where the segment starts.
+** \param     base Firmware file reader specific value for the segment.
+** \return    TBX_OK if successful, TBX_ERROR if no memory could be allocated.
+**
+****************************************************************************************/
+uint8_t SegTableInsert(tSegTable * table, uint32_t addr, uint32_t len, FSIZE_t fptr,
+                       uint32_t base)
+{
+  uint8_t          result = TBX_ERROR;
+  tSegment       * segment;
+  tSegment const * last;
+
+  /* Verify parameters. */
+  TBX_ASSERT((table != NULL) && (len > 0U));
+
+  /* Only continue with valid parameters. */
+  if ((table != NULL) && (len > 0U))
+  {
+    /* Set the result to success and only negate upon error detection from here on. */
+    result = TBX_OK;
+    /* Make sure there is space for the new segment. */
+    if (table->count == (table->blockCount * (uint32_t)SEG_TABLE_BLOCK_SIZE))
+    {
+      result = SegTableGrow(table);
+    }
+    /* Only continue if all is okay so far. */
+    if (result == TBX_OK)
+    {
+      /* Firmware files typically store their data in order. The segments then stay
+       * sorted, if the new segment starts at or after the end of the last segment.
+       */
+      if (table->count > 0U)
+      {
+        last = SegTableEntry(table, table->count - 1U);
+        if ((last->addr + last->len) > addr)
+        {
+          table->sorted = TBX_FALSE;
+        }
+      }
+      /* Store the new segment at the end of the table. */
+      segment = SegTableEntry(table, table->count);
+      segment->addr = addr;
+      segment->len = len;
+      segment->fptr = fptr;
+      segment->base = base;
+      /* The new segment is now the one that the previously added data was stored in. */
+      table->current = table->count;
+      table->count++;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableInsert ***/
+
+
+/************************************************************************************//**
+** \brief     Sorts the segments on their base memory address and checks that they do
+**            not overlap. Should be called once all firmware data was added, before
+**            obtaining or finding segments. The segments are sorted with a heap sort,
+**            which takes O(n log n) time and needs no additional memory. If the
+**            segments were added in order, they are already sorted and nothing needs to
+**            be done.
+** \param     table Pointer to the segment table.
+** \return    TBX_OK if successful, TBX_ERROR if segments overlap.
+**
+****************************************************************************************/
+uint8_t SegTableSort(tSegTable * table)
+{
+  uint8_t          result = TBX_ERROR;
+  uint32_t         idx;
+  tSegment const * previous;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    /* Set the result to success and only negate upon error detection from here on. */
+    result = TBX_OK;
+    /* Only sort if the segments were not added in order. */
+    if (table->sorted == TBX_FALSE)
+    {
+      /* Arrange the segments in a heap, with the largest base memory address first. */
+      for (idx = table->count / 2U; idx > 0U; idx--)
+      {
+        SegTableSiftDown(table, idx - 1U, table->count);
+      }
+      /* Repeatedly move the largest remaining segment to the end. */
+      for (idx = table->count - 1U; idx > 0U; idx--)
+      {
+        SegTableSwap(table, 0U, idx);
+        SegTableSiftDown(table, 0U, idx);
+      }
+      /* Each segment should not overlap with the next segment. */
+      for (idx = 1U; (idx < table->count) && (result == TBX_OK); idx++)
+      {
+        previous = SegTableEntry(table, idx - 1U);
+        if ((previous->addr + previous->len) > SegTableEntry(table, idx)->addr)
+        {
+          result = TBX_ERROR;
+        }
+      }
+      /* Update the sorted flag. */
+      if (result == TBX_OK)
+      {
+        table->sorted = TBX_TRUE;
+      }
+    }
+    /* Segment indices possibly changed, so new data should not extend a segment. */
+    table->current = table->count;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableSort ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the number of segments in the segment table.
+** \param     table Pointer to the segment table.
+** \return    Number of segments.
+**
+****************************************************************************************/
+uint32_t SegTableGetCount(tSegTable const * table)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    result = table->count;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableGetCount ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the segment at the specified index. The segments are sorted on
+**            their base memory address.
+** \param     table Pointer to the segment table.
+** \param     idx Zero-based segment index.
+** \return    Pointer to the segment if successful, NULL otherwise.
+**
+****************************************************************************************/
+tSegment const * SegTableGet(tSegTable const * table, uint32_t idx)
+{
+  tSegment const * result = NULL;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    /* Only continue if the segment index is valid. */
+    if (idx < table->count)
+    {
+      result = SegTableEntry(table, idx);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableGet ***/
+
+
+/************************************************************************************//**
+** \brief     Finds the segment that holds the data of the specified memory address, with
+**            the help of a binary search.
+** \param     table Pointer to the segment table.
+** \param     addr Memory address.
+** \return    Pointer to the segment if found, NULL otherwise.
+**
+****************************************************************************************/
+tSegment const * SegTableFind(tSegTable const * table, uint32_t addr)
+{
+  tSegment const * result = NULL;
+  uint32_t         low;
+  uint32_t         high;
+  uint32_t         middle;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Only continue with valid parameter. */
+  if (table != NULL)
+  {
+    /* Determine the index of the first segment with a base memory address larger than
+     * the specified one.
+     */
+    low = 0U;
+    high = table->count;
+    while (low < high)
+    {
+      middle = low + ((high - low) / 2U);
+      if (SegTableEntry(table, middle)->addr <= addr)
+      {
+        low = middle + 1U;
+      }
+      else
+      {
+        high = middle;
+      }
+    }
+    /* The segment before it is the only one that can hold the data of the address. */
+    if (low > 0U)
+    {
+      result = SegTableEntry(table, low - 1U);
+      if ((addr - result->addr) >= result->len)
+      {
+        result = NULL;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableFind ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the storage location of the segment at the specified index. The
+**            caller is responsible for making sure that its block is allocated.
+** \param     table Pointer to the segment table.
+** \param     idx Zero-based segment index.
+** \return    Pointer to the segment's storage location.
+**
+****************************************************************************************/
+static tSegment * SegTableEntry(tSegTable const * table, uint32_t idx)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((table != NULL) &&
+             ((idx / (uint32_t)SEG_TABLE_BLOCK_SIZE) < table->blockCount));
+
+  /* Locate the segment inside its block. */
+  return &table->blocks[idx / (uint32_t)SEG_TABLE_BLOCK_SIZE]
+                       [idx % (uint32_t)SEG_TABLE_BLOCK_SIZE];
+} /*** end of SegTableEntry ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates memory from a memory pool. The memory pool is automatically
+**            created or increased, if it was too small.
+** \param     size Size of the memory to allocate in bytes.
+** \return    Pointer to the allocated memory if successful, NULL otherwise.
+**
+****************************************************************************************/
+static void * SegTableAllocate(size_t size)
+{
+  void * result;
+
+  /* Attempt to allocate the memory. */
+  result = TbxMemPoolAllocate(size);
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (result == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1, size);
+    /* Allocation should now work. */
+    result = TbxMemPoolAllocate(size);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Adds a block to the segment table, which makes space for another
+**            SEG_TABLE_BLOCK_SIZE segments. All blocks have the same size, so released
+**            blocks can always be reused and the memory used by the segment table stays
+**            proportional to the number of segments. Only the small array with block
+**            pointers is doubled in size, when it is full.
+** \param     table Pointer to the segment table.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SegTableGrow(tSegTable * table)
+{
+  uint8_t     result = TBX_OK;
+  uint32_t    newCapacity;
+  tSegment ** newBlocks;
+  tSegment  * newBlock;
+  uint32_t    blockIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Is the array with block pointers full? */
+  if (table->blockCount == table->blockCapacity)
+  {
+    /* Determine the new capacity. */
+    newCapacity = SEG_TABLE_BLOCKS_INITIAL_CAPACITY;
+    if (table->blockCapacity > 0U)
+    {
+      newCapacity = table->blockCapacity * 2U;
+    }
+    /* Attempt to allocate memory to store the new array with block pointers. */
+    newBlocks = NULL;
+    if (newCapacity <= ((uint32_t)UINT32_MAX / (uint32_t)SEG_TABLE_BLOCK_SIZE))
+    {
+      newBlocks = SegTableAllocate(newCapacity * sizeof(tSegment *));
+    }
+    if (newBlocks == NULL)
+    {
+      result = TBX_ERROR;
+    }
+    else
+    {
+      /* Copy the block pointers to the new array and release the old one. */
+      for (blockIdx = 0U; blockIdx < table->blockCount; blockIdx++)
+      {
+        newBlocks[blockIdx] = table->blocks[blockIdx];
+      }
+      if (table->blocks != NULL)
+      {
+        TbxMemPoolRelease(table->blocks);
+      }
+      table->blocks = newBlocks;
+      table->blockCapacity = newCapacity;
+    }
+  }
+
+  /* Only continue if there is space for another block pointer. */
+  if (result == TBX_OK)
+  {
+    /* Attempt to allocate memory to store the new block. */
+    newBlock = SegTableAllocate(SEG_TABLE_BLOCK_SIZE * sizeof(tSegment));
+    if (newBlock == NULL)
+    {
+      result = TBX_ERROR;
+    }
+    else
+    {
+      table->blocks[table->blockCount] = newBlock;
+      table->blockCount++;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SegTableGrow ***/
+
+
+/************************************************************************************//**
+** \brief     Restores the heap property of the subtree at the specified root, by moving
+**            its segment down, until it has a larger base memory address than both its
+**            children.
+** \param     table Pointer to the segment table.
+** \param     root Index of the segment at the root of the subtree.
+** \param     count Number of segments that are part of the heap.
+**
+****************************************************************************************/
+static void SegTableSiftDown(tSegTable * table, uint32_t root, uint32_t count)
+{
+  uint32_t parent = root;
+  uint32_t child;
+  uint8_t  done = TBX_FALSE;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Move the segment down, until it is in the right place. */
+  while (done == TBX_FALSE)
+  {
+    child = (parent * 2U) + 1U;
+    /* Done if the segment has no children. */
+    if (child >= count)
+    {
+      done = TBX_TRUE;
+    }
+    else
+    {
+      /* Select the child with the largest base memory address. */
+      if ( ((child + 1U) < count) &&
+           (SegTableEntry(table, child)->addr < SegTableEntry(table, child + 1U)->addr) )
+      {
+        child++;
+      }
+      /* Swap with the child if that one has a larger base memory address. */
+      if (SegTableEntry(table, parent)->addr < SegTableEntry(table, child)->addr)
+      {
+        SegTableSwap(table, parent, child);
+        parent = child;
+      }
+      else
+      {
+        done = TBX_TRUE;
+      }
+    }
+  }
+} /*** end of SegTableSiftDown ***/
+
+
+/************************************************************************************//**
+** \brief     Swaps two segments in the segment table.
+** \param     table Pointer to the segment table.
+** \param     idxA Zero-based index of the first segment.
+** \param     idxB Zero-based index of the second segment.
+**
+****************************************************************************************/
+static void SegTableSwap(tSegTable * table, uint32_t idxA, uint32_t idxB)
+{
+  tSegment   temp;
+  tSegment * segmentA;
+  tSegment * segmentB;
+
+  /* Verify parameter. */
+  TBX_ASSERT(table != NULL);
+
+  /* Swap the contents of the segments. */
+  segmentA = SegTableEntry(table, idxA);
+  segmentB = SegTableEntry(table, idxB);
+  temp = *segmentA;
+  *segmentA = *segmentB;
+  *segmentB = temp;
+} /*** end of SegTableSwap ***/
+
+
+/*********************************** end of segtable.c *********************************/
@@ -0,0 +1,142 @@
+/************************************************************************************//**
+* \file         segtable.h
+* \brief        Segment table header file.
+* \ingroup      SegTable
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   SegTable Segment table
+* \brief      This module implements the table with firmware data segments that the
+*             firmware file readers collect while scanning a firmware file.
+* \ingroup    Firmware
+* \details
+* The segment table stores the segments in an array that is sorted on the segment's base
+* address. A segment is only ever extended by the data that directly follows it both in
+* memory and in the firmware file. This way the data of a segment can always be read
+* sequentially, starting at its file pointer. Firmware data that directly follows a
+* segment in memory, but is located elsewhere in the firmware file, is stored as a
+* separate segment.
+*
+* Adding firmware data takes constant time. Data that does not directly follow the
+* previously added data, is stored in a new segment at the end of the table. Once all
+* firmware data was added, SegTableSort() sorts the segments on their base address and
+* rejects firmware data that overlaps with another segment. Firmware files typically
+* store their data in order, in which case the segments are already sorted and
+* SegTableSort() returns right away. Otherwise the segments are sorted with a heap sort,
+* so opening a firmware file with out-of-order data takes O(n log n) time instead of
+* O(n^2). Obtaining a segment by its index takes constant time. Finding the segment that
+* holds the data of a memory address is done with a binary search.
+*
+* The segments are stored in fixed size blocks. This way the memory used by the segment
+* table stays proportional to the number of segments, even for firmware files with tens
+* of thousands of segments.
+****************************************************************************************/
+#ifndef SEGTABLE_H
+#define SEGTABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Number of segments that are stored in one block. Blocks are allocated one at
+ *         a time, when the segment table is full.
+ */
+#ifndef SEG_TABLE_BLOCK_SIZE
+#define SEG_TABLE_BLOCK_SIZE           (32U)
+#endif
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Structure that groups segment related info. */
+typedef struct
+{
+  /** \brief Base memory address of the segment's data. */
+  uint32_t addr;
+  /** \brief Total length of the segment in bytes. */
+  uint32_t len;
+  /** \brief File pointer inside the firmware file where this segment starts. */
+  FSIZE_t  fptr;
+  /** \brief Firmware file reader specific value, that is needed to continue parsing
+   *         the firmware file at the segment's file pointer. For example the extended
+   *         address that is in effect at the start of the segment.
+   */
+  uint32_t base;
+} tSegment;
+
+/** \brief Structure that groups all the information of a segment table. */
+typedef struct
+{
+  /** \brief Array with pointers to the blocks that store the segments. Together the
+   *         blocks form one array with segments, sorted on their base memory address.
+   */
+  tSegment ** blocks;
+  /** \brief Number of allocated blocks. */
+  uint32_t    blockCount;
+  /** \brief Number of block pointers that the block pointer array has space for. */
+  uint32_t    blockCapacity;
+  /** \brief Total number of segments. */
+  uint32_t    count;
+  /** \brief Index of the segment that the previously added data was stored in. */
+  uint32_t    current;
+  /** \brief TBX_TRUE if the segments are sorted on their base memory address and do
+   *         not overlap, TBX_FALSE if SegTableSort() still needs to sort them.
+   */
+  uint8_t     sorted;
+} tSegTable;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void             SegTableInit(tSegTable * table);
+void             SegTableClear(tSegTable * table);
+uint8_t          SegTableAddData(tSegTable * table, uint32_t addr, uint32_t len,
+                                 FSIZE_t fptr, uint32_t base);
+uint8_t          SegTableAddDataLimited(tSegTable * table, uint32_t addr, uint32_t len,
+                                        FSIZE_t fptr, uint32_t base, uint32_t maxLen);
+uint8_t          SegTableInsert(tSegTable * table, uint32_t addr, uint32_t len,
+                                FSIZE_t fptr, uint32_t base);
+uint8_t          SegTableSort(tSegTable * table);
+uint32_t         SegTableGetCount(tSegTable const * table);
+tSegment const * SegTableGet(tSegTable const * table, uint32_t idx);
+tSegment const * SegTableFind(tSegTable const * table, uint32_t addr);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEGTABLE_H */
+/*********************************** end of segtable.h *********************************/
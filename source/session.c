@@ -36,87 +36,146 @@
 * Include files
 ****************************************************************************************/
 #include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
 #include "session.h"                        /* Communication session module            */
 
 
 /****************************************************************************************
-* Local data declarations
+* Type definitions
 ****************************************************************************************/
-/** \brief Pointer to the communication protocol that is linked. */
-static tSessionProtocol const * protocolPtr = NULL;
+/** \brief Session context that groups all the information of a communication session
+ *         with one target.
+ */
+struct t_session_context
+{
+  /** \brief Pointer to the communication protocol that is linked. */
+  tSessionProtocol const * protocol;
+  /** \brief Instance of the communication protocol, as created by Create(). */
+  void                   * instance;
+  /** \brief Start time of the asynchronous operation that is in progress. */
+  uint32_t                 asyncStartTime;
+  /** \brief TBX_TRUE while an asynchronous operation is in progress. */
+  uint8_t                  asyncBusy;
+  /** \brief Statistics time category (STATS_TIME_xxx) of the asynchronous operation. */
+  uint8_t                  asyncTimeCategory;
+  /** \brief Statistics of this communication session. */
+  tStatsContext            stats;
+};
 
 
 /************************************************************************************//**
-** \brief     Initializes the communication session module for the specified protocol.
+** \brief     Creates a communication session context for the specified protocol. The
+**            context is allocated from the memory pool.
 ** \param     protocol The session protocol module to link.
 ** \param     protocolSettings Pointer to structure with protocol specific settings.
+** \param     port The port to use for communicating with the target. It must stay valid
+**            as long as the session context exists.
+** \return    Pointer to the session context if successful, NULL otherwise.
 **
 ****************************************************************************************/
-void SessionInit(tSessionProtocol const * protocol, void const * protocolSettings)
+tSessionContext * SessionCreate(tSessionProtocol const * protocol,
+                                void const * protocolSettings, tPort const * port)
 {
+  tSessionContext * result = NULL;
+
   /* Check parameters. Note that the protocolSettings parameter is allowed to be NULL,
-   * because not every protocol might need additional settings. 
+   * because not every protocol might need additional settings.
    */
-  TBX_ASSERT(protocol != NULL);
-  
-  /* Link the protocol module. */
-  protocolPtr = protocol;
-  
-  /* Initialize the protocol and pass on the settings pointer. */
-  if (protocolPtr != NULL)
+  TBX_ASSERT((protocol != NULL) && (port != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((protocol != NULL) && (port != NULL))
   {
-    /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->Init != NULL);
-    /* Only continue with a valid function pointer. */
-    if (protocolPtr->Init != NULL)
+    /* Verify the protocol's function pointers. */
+    TBX_ASSERT((protocol->Create != NULL) && (protocol->Destroy != NULL));
+    /* Only continue with valid function pointers. */
+    if ((protocol->Create != NULL) && (protocol->Destroy != NULL))
     {
-      protocolPtr->Init(protocolSettings);
+      /* Attempt to allocate the context. */
+      result = TbxMemPoolAllocate(sizeof(tSessionContext));
+      /* Automatically create or increase the memory pool if it was too small. */
+      if (result == NULL)
+      {
+        /* No need to check the return value, because we'll attempt to allocate from
+         * the memory pool right way. That will tell us if the memory pool increase was
+         * successful.
+         */
+        (void)TbxMemPoolCreate(1U, sizeof(tSessionContext));
+        /* Allocation should now work. */
+        result = TbxMemPoolAllocate(sizeof(tSessionContext));
+      }
     }
   }
-} /*** end of SessionInit ***/
+
+  /* Only continue if the context was allocated. */
+  if (result != NULL)
+  {
+    /* Link the protocol module and create its instance. */
+    result->protocol = protocol;
+    result->asyncStartTime = 0U;
+    result->asyncBusy = TBX_FALSE;
+    result->asyncTimeCategory = STATS_TIME_PROGRAM;
+    StatsInit(&result->stats, port);
+    result->instance = protocol->Create(protocolSettings, port, &result->stats);
+    /* Clean up if the protocol's instance could not be created. */
+    if (result->instance == NULL)
+    {
+      TbxMemPoolRelease(result);
+      result = NULL;
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionCreate ***/
 
 
 /************************************************************************************//**
-** \brief     Terminates the communication session module.
+** \brief     Releases a communication session context. A session that is still in
+**            progress is stopped first.
+** \param     context The session context, as created by SessionCreate().
 **
 ****************************************************************************************/
-void SessionTerminate(void)
+void SessionDestroy(tSessionContext * context)
 {
-  /* Terminate the linked protocol. */
-  if (protocolPtr != NULL) 
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
   {
-    /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->Terminate != NULL);
-    /* Only continue with a valid function pointer. */
-    if (protocolPtr->Terminate != NULL)
-    {
-      protocolPtr->Terminate();
-    }
+    /* Release the protocol's instance. */
+    context->protocol->Destroy(context->instance);
+    /* Give the context back to the memory pool. */
+    TbxMemPoolRelease(context);
   }
-  /* Unlink the protocol module. */
-  protocolPtr = NULL;
-} /*** end of SessionTerminate ***/
+} /*** end of SessionDestroy ***/
 
 
 /************************************************************************************//**
 ** \brief     Starts the firmware update session. This is where the connection with the
 **            target is made and the bootloader on the target is activated.
+** \param     context The session context, as created by SessionCreate().
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t SessionStart(void)
+uint8_t SessionStart(tSessionContext * context)
 {
   uint8_t result = TBX_ERROR;
-  
-  /* Pass the request on to the linked protocol module. */
-  if (protocolPtr != NULL)
+
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (context != NULL)
   {
     /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->Start != NULL);
+    TBX_ASSERT(context->protocol->Start != NULL);
     /* Only continue with a valid function pointer. */
-    if (protocolPtr->Start != NULL)
+    if (context->protocol->Start != NULL)
     {
-      result = protocolPtr->Start();
+      /* Pass the request on to the linked protocol module. */
+      result = context->protocol->Start(context->instance);
     }
   }
   /* Give the result back to the caller. */
@@ -128,19 +187,24 @@ uint8_t SessionStart(void)
 ** \brief    Stops the firmware update. This is where the bootloader starts the user
 **           program on the target if a valid one is present. After this the connection
 **           with the target is severed.
+** \param    context The session context, as created by SessionCreate().
 **
 ****************************************************************************************/
-void SessionStop(void)
+void SessionStop(tSessionContext * context)
 {
-  /* Pass the request on to the linked protocol module. */
-  if (protocolPtr != NULL)
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (context != NULL)
   {
     /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->Stop != NULL);
+    TBX_ASSERT(context->protocol->Stop != NULL);
     /* Only continue with a valid function pointer. */
-    if (protocolPtr->Stop != NULL)
+    if (context->protocol->Stop != NULL)
     {
-      protocolPtr->Stop();
+      /* Pass the request on to the linked protocol module. */
+      context->protocol->Stop(context->instance);
     }
   }
 } /*** end of SessionStop ***/
@@ -150,28 +214,32 @@ void SessionStop(void)
 ** \brief     Requests the bootloader to erase the specified range of memory on the
 **            target. The bootloader aligns this range to hardware specified erase 
 **            blocks.
+** \param     context The session context, as created by SessionCreate().
 ** \param     address The starting memory address for the erase operation.
 ** \param     len The total number of bytes to erase from memory.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t SessionClearMemory(uint32_t address, uint32_t len)
+uint8_t SessionClearMemory(tSessionContext * context, uint32_t address, uint32_t len)
 {
-  uint8_t result = TBX_ERROR;
+  uint8_t  result = TBX_ERROR;
+  uint32_t startTime;
   
   /* Check parameters. */
-  TBX_ASSERT(len > 0U);
+  TBX_ASSERT((context != NULL) && (len > 0U));
   
   /* Only continue if the parameters are vald. */
-  if (len > 0U)
+  if ((context != NULL) && (len > 0U))
   {
     /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->ClearMemory != NULL);
+    TBX_ASSERT(context->protocol->ClearMemory != NULL);
     /* Only continue with a valid function pointer. */
-    if (protocolPtr->ClearMemory != NULL)
+    if (context->protocol->ClearMemory != NULL)
     {
       /* Pass the request on to the linked protocol module. */
-      result = protocolPtr->ClearMemory(address, len);
+      startTime = StatsGetTime(context->stats.port);
+      result = context->protocol->ClearMemory(context->instance, address, len);
+      StatsRecordTime(&context->stats, STATS_TIME_ERASE, startTime);
     }
   }
   /* Give the result back to the caller. */
@@ -183,29 +251,34 @@ uint8_t SessionClearMemory(uint32_t address, uint32_t len)
 ** \brief     Requests the bootloader to program the specified data to memory. In case of
 **            non-volatile memory, the application needs to make sure the memory range
 **            was erased beforehand.
+** \param     context The session context, as created by SessionCreate().
 ** \param     address The starting memory address for the write operation.
 ** \param     len The number of bytes in the data buffer that should be written.
 ** \param     data Pointer to the byte array with data to write.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t SessionWriteData(uint32_t address, uint32_t len, uint8_t const * data)
+uint8_t SessionWriteData(tSessionContext * context, uint32_t address, uint32_t len,
+                         uint8_t const * data)
 {
-  uint8_t result = TBX_ERROR;
+  uint8_t  result = TBX_ERROR;
+  uint32_t startTime;
 
   /* Check parameters. */
-  TBX_ASSERT((data != NULL) && ((len > 0U)));
+  TBX_ASSERT((context != NULL) && (data != NULL) && (len > 0U));
   
   /* Only continue if the parameters are valid. */
-  if ((data != NULL) && (len > 0U)) /*lint !e774 */
+  if ((context != NULL) && (data != NULL) && (len > 0U)) /*lint !e774 */
   {
     /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->WriteData != NULL);
+    TBX_ASSERT(context->protocol->WriteData != NULL);
     /* Only continue with a valid function pointer. */
-    if (protocolPtr->WriteData != NULL)
+    if (context->protocol->WriteData != NULL)
     {
       /* Pass the request on to the linked protocol module. */
-      result = protocolPtr->WriteData(address, len, data);
+      startTime = StatsGetTime(context->stats.port);
+      result = context->protocol->WriteData(context->instance, address, len, data);
+      StatsRecordTime(&context->stats, STATS_TIME_PROGRAM, startTime);
     }
   }
   /* Give the result back to the caller. */
@@ -216,6 +289,7 @@ uint8_t SessionWriteData(uint32_t address, uint32_t len, uint8_t const * data)
 /************************************************************************************//**
 ** \brief     Request the bootloader to upload the specified range of memory. The data is
 **            stored in the data byte array to which the pointer was specified.
+** \param     context The session context, as created by SessionCreate().
 ** \param     address The starting memory address for the read operation.
 ** \param     len The number of bytes to upload from the target and store in the data 
 **            buffer.
@@ -223,23 +297,24 @@ uint8_t SessionWriteData(uint32_t address, uint32_t len, uint8_t const * data)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-uint8_t SessionReadData(uint32_t address, uint32_t len, uint8_t * data)
+uint8_t SessionReadData(tSessionContext * context, uint32_t address, uint32_t len,
+                        uint8_t * data)
 {
   uint8_t result = TBX_ERROR;
 
   /* Check parameters. */
-  TBX_ASSERT((data != NULL) && (len > 0U));
+  TBX_ASSERT((context != NULL) && (data != NULL) && (len > 0U));
   
   /* Only continue if the parameters are valid. */
-  if ((data != NULL) && (len > 0U)) /*lint !e774 */
+  if ((context != NULL) && (data != NULL) && (len > 0U)) /*lint !e774 */
   {
     /* Verify the protocol's function pointer. */
-    TBX_ASSERT(protocolPtr->ReadData != NULL);
+    TBX_ASSERT(context->protocol->ReadData != NULL);
     /* Only continue with a valid function pointer. */
-    if (protocolPtr->ReadData != NULL)
+    if (context->protocol->ReadData != NULL)
     {
       /* Pass the request on to the linked protocol module. */
-      result = protocolPtr->ReadData(address, len, data);
+      result = context->protocol->ReadData(context->instance, address, len, data);
     }
   }
   /* Give the result back to the caller. */
@@ -247,4 +322,236 @@ uint8_t SessionReadData(uint32_t address, uint32_t len, uint8_t * data)
 } /*** end of SessionReadData ***/
 
 
+/************************************************************************************//**
+** \brief     Starts the asynchronous programming of the specified data to memory. This
+**            function does not block. Call SessionTask() to continue the operation until
+**            it completed. In case of non-volatile memory, the application needs to make
+**            sure the memory range was erased beforehand.
+** \param     context The session context, as created by SessionCreate().
+** \param     address The starting memory address for the write operation.
+** \param     len The number of bytes in the data buffer that should be written.
+** \param     data Pointer to the byte array with data to write. Note that the contents
+**            of the byte array must stay valid until the operation completed.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t SessionWriteDataAsync(tSessionContext * context, uint32_t address, uint32_t len,
+                              uint8_t const * data)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t startTime;
+
+  /* Check parameters. */
+  TBX_ASSERT((context != NULL) && (data != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((context != NULL) && (data != NULL) && (len > 0U)) /*lint !e774 */
+  {
+    /* Verify the protocol's function pointer. */
+    TBX_ASSERT(context->protocol->WriteDataAsync != NULL);
+    /* Only continue with a valid function pointer. */
+    if (context->protocol->WriteDataAsync != NULL)
+    {
+      /* Pass the request on to the linked protocol module. */
+      startTime = StatsGetTime(context->stats.port);
+      result = context->protocol->WriteDataAsync(context->instance, address, len, data);
+      /* Measure the programming time until the operation completes. */
+      if (result == TBX_OK)
+      {
+        context->asyncStartTime = startTime;
+        context->asyncBusy = TBX_TRUE;
+        context->asyncTimeCategory = STATS_TIME_PROGRAM;
+      }
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionWriteDataAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the asynchronous erase of the specified range of memory on the
+**            target. This function does not block. Call SessionTask() to continue the
+**            operation until it completed. The bootloader aligns this range to hardware
+**            specified erase blocks.
+** \param     context The session context, as created by SessionCreate().
+** \param     address The starting memory address for the erase operation.
+** \param     len The total number of bytes to erase from memory.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t SessionClearMemoryAsync(tSessionContext * context, uint32_t address,
+                                uint32_t len)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t startTime;
+
+  /* Check parameters. */
+  TBX_ASSERT((context != NULL) && (len > 0U));
+
+  /* Only continue if the parameters are valid. */
+  if ((context != NULL) && (len > 0U))
+  {
+    /* Verify the protocol's function pointer. */
+    TBX_ASSERT(context->protocol->ClearMemoryAsync != NULL);
+    /* Only continue with a valid function pointer. */
+    if (context->protocol->ClearMemoryAsync != NULL)
+    {
+      /* Pass the request on to the linked protocol module. */
+      startTime = StatsGetTime(context->stats.port);
+      result = context->protocol->ClearMemoryAsync(context->instance, address, len);
+      /* Measure the erase time until the operation completes. */
+      if (result == TBX_OK)
+      {
+        context->asyncStartTime = startTime;
+        context->asyncBusy = TBX_TRUE;
+        context->asyncTimeCategory = STATS_TIME_ERASE;
+      }
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionClearMemoryAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Continues the asynchronous operation that is in progress. Without waiting,
+**            this function does not block, so it can be called periodically, while the
+**            application performs other work or sleeps in between the calls. With
+**            waiting, it can block until the operation completed. In the meantime, the
+**            port's XcpReceivePacketTimeout function, if available, waits for the
+**            response packets, such that the calling task does not use the CPU.
+** \param     context The session context, as created by SessionCreate().
+** \param     wait TBX_TRUE to wait for the operation to complete, TBX_FALSE to never
+**            wait.
+** \return    SESSION_STATUS_BUSY while the operation is still in progress,
+**            SESSION_STATUS_DONE when it completed successfully or when no operation was
+**            started, SESSION_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+uint8_t SessionTask(tSessionContext * context, uint8_t wait)
+{
+  uint8_t result = SESSION_STATUS_ERROR;
+
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (context != NULL)
+  {
+    /* Verify the protocol's function pointer. */
+    TBX_ASSERT(context->protocol->Task != NULL);
+    /* Only continue with a valid function pointer. */
+    if (context->protocol->Task != NULL)
+    {
+      /* Pass the request on to the linked protocol module. */
+      result = context->protocol->Task(context->instance, wait);
+      /* Add the erase or programming time, once the asynchronous operation
+       * completed.
+       */
+      if ((context->asyncBusy == TBX_TRUE) && (result != SESSION_STATUS_BUSY))
+      {
+        StatsRecordTime(&context->stats, context->asyncTimeCategory,
+                        context->asyncStartTime);
+        context->asyncBusy = TBX_FALSE;
+      }
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionTask ***/
+
+
+/************************************************************************************//**
+** \brief     Requests the bootloader to build a checksum over the specified range of
+**            memory. This makes it possible to find out if the memory on the target
+**            holds certain data, without uploading the data.
+** \param     context The session context, as created by SessionCreate().
+** \param     address The starting memory address of the range.
+** \param     len Pointer to the number of bytes in the range. The number of bytes that
+**            the checksum was actually built over, is written to this pointer. It is
+**            less than requested, if the bootloader limits the number of bytes that it
+**            builds a checksum over.
+** \param     type The checksum type that the bootloader used, is written to this
+**            pointer. It is one of the CHECKSUM_TYPE_xxx values.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t SessionBuildChecksum(tSessionContext * context, uint32_t address, uint32_t * len,
+                             uint8_t * type, uint32_t * checksum)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((context != NULL) && (len != NULL) && (type != NULL) &&
+             (checksum != NULL));
+
+  /* Only continue if the parameters are valid. */
+  if ((context != NULL) && (len != NULL) && (type != NULL) && (checksum != NULL) &&
+      (*len > 0U))
+  {
+    /* Verify the protocol's function pointer. */
+    TBX_ASSERT(context->protocol->BuildChecksum != NULL);
+    /* Only continue with a valid function pointer. */
+    if (context->protocol->BuildChecksum != NULL)
+    {
+      /* Pass the request on to the linked protocol module. */
+      result = context->protocol->BuildChecksum(context->instance, address, len, type,
+                                                checksum);
+    }
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionBuildChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the statistics context of the communication session.
+** \param     context The session context, as created by SessionCreate().
+** \return    Pointer to the statistics context, or NULL if the session context is
+**            not valid.
+**
+****************************************************************************************/
+tStatsContext * SessionGetStats(tSessionContext * context)
+{
+  tStatsContext * result = NULL;
+
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (context != NULL)
+  {
+    result = &context->stats;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the port that the communication session uses for communicating
+**            with the target.
+** \param     context The session context, as created by SessionCreate().
+** \return    Pointer to the port, or NULL if the session context is not valid.
+**
+****************************************************************************************/
+tPort const * SessionGetPort(tSessionContext * context)
+{
+  tPort const * result = NULL;
+
+  /* Check parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue if the parameter is valid. */
+  if (context != NULL)
+  {
+    result = context->stats.port;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SessionGetPort ***/
+
+
 /*********************************** end of session.c **********************************/
@@ -40,7 +40,9 @@
 * The Communication Session module handles the communication with the bootloader during
 * firmware updates on the target system. It contains an interface to link the desired
 * communication protocol that should be used for the communication. For example the XCP
-* protocol.
+* protocol. Each communication session is represented by a session context. This makes
+* it possible to communicate with multiple targets at the same time, for example from
+* different tasks.
 ****************************************************************************************/
 #ifndef SESSION_H
 #define SESSION_H
@@ -49,57 +51,129 @@
 extern "C" {
 #endif
 
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Status of an asynchronous operation that is still in progress. */
+#define SESSION_STATUS_BUSY            ((uint8_t)0U)
+
+/** \brief Status of an asynchronous operation that completed successfully. This is also
+ *         the status when no asynchronous operation was started.
+ */
+#define SESSION_STATUS_DONE            ((uint8_t)1U)
+
+/** \brief Status of an asynchronous operation that completed with an error. */
+#define SESSION_STATUS_ERROR           ((uint8_t)2U)
+
+
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
-/** \brief Session communication protocol interface. */
+/** \brief Session communication protocol interface. Except for the Create function,
+ *         the functions get the instance pointer that the Create function returned, as
+ *         the first parameter.
+ */
 typedef struct
 {
-  /** \brief Initializes the protocol module. */
-  void    (* Init) (void const * settings);
+  /** \brief Creates a new instance of the protocol module, which uses the specified
+   *         port for communicating with the target and records the packet exchanges
+   *         in the specified statistics context. Returns NULL if the instance could
+   *         not be created.
+   */
+  void *  (* Create) (void const * settings, tPort const * port,
+                      tStatsContext * stats);
 
-  /** \brief Terminates the protocol module. */
-  void    (* Terminate) (void);
+  /** \brief Releases an instance of the protocol module. */
+  void    (* Destroy) (void * instance);
 
   /** \brief Starts the firmware update session. This is where the connection with the
    *         target is made and the bootloader on the target is activated.
    */
-  uint8_t (* Start) (void);
+  uint8_t (* Start) (void * instance);
 
   /** \brief Stops the firmware update. This is where the bootloader starts the user
    *         program on the target if a valid one is present. After this the connection
    *         with the target is severed.
    */
-  void    (* Stop) (void);
+  void    (* Stop) (void * instance);
 
   /** \brief Requests the bootloader to erase the specified range of memory on the
    *         target. The bootloader aligns this range to hardware specified erase blocks.
    */
-  uint8_t (* ClearMemory) (uint32_t address, uint32_t len);
+  uint8_t (* ClearMemory) (void * instance, uint32_t address, uint32_t len);
 
   /** \brief Requests the bootloader to program the specified data to memory. In case of
    *         non-volatile memory, the application needs to make sure the memory range
    *         was erased beforehand.
    */
-  uint8_t (* WriteData) (uint32_t address, uint32_t len, uint8_t const * data);
+  uint8_t (* WriteData) (void * instance, uint32_t address, uint32_t len,
+                         uint8_t const * data);
 
   /** \brief Request the bootloader to upload the specified range of memory. The data is
    *         stored in the data byte array to which the pointer was specified.
    */
-  uint8_t (* ReadData) (uint32_t address, uint32_t len, uint8_t * data);
+  uint8_t (* ReadData) (void * instance, uint32_t address, uint32_t len,
+                        uint8_t * data);
+
+  /** \brief Starts the asynchronous programming of the specified data to memory. The
+   *         operation is continued by the Task function. The data must stay valid until
+   *         the operation completed.
+   */
+  uint8_t (* WriteDataAsync) (void * instance, uint32_t address, uint32_t len,
+                              uint8_t const * data);
+
+  /** \brief Starts the asynchronous erase of the specified range of memory on the
+   *         target. The operation is continued by the Task function.
+   */
+  uint8_t (* ClearMemoryAsync) (void * instance, uint32_t address, uint32_t len);
+
+  /** \brief Continues the asynchronous operation that is in progress. Without blocking
+   *         if wait is TBX_FALSE. Otherwise it may block while waiting for the target.
+   *         Returns one of the SESSION_STATUS_xxx values.
+   */
+  uint8_t (* Task) (void * instance, uint8_t wait);
+
+  /** \brief Requests the bootloader to build a checksum over the specified range of
+   *         memory. The checksum type is one of the CHECKSUM_TYPE_xxx values, as
+   *         selected by the bootloader. The bootloader can limit the number of bytes
+   *         that it builds the checksum over. The number of bytes that the checksum was
+   *         actually built over is therefore written back to len.
+   */
+  uint8_t (* BuildChecksum) (void * instance, uint32_t address, uint32_t * len,
+                             uint8_t * type, uint32_t * checksum);
 } tSessionProtocol;
 
+/** \brief Session context. It groups all the information of a communication session
+ *         with one target, such that communication sessions with multiple targets can
+ *         run at the same time. Its layout is private to the session module.
+ */
+typedef struct t_session_context tSessionContext;
+
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-void    SessionInit(tSessionProtocol const * protocol, void const * protocolSettings);
-void    SessionTerminate(void);
-uint8_t SessionStart(void);
-void    SessionStop(void);
-uint8_t SessionClearMemory(uint32_t address, uint32_t len);
-uint8_t SessionWriteData(uint32_t address, uint32_t len, uint8_t const * data);
-uint8_t SessionReadData(uint32_t address, uint32_t len, uint8_t * data);
+tSessionContext * SessionCreate(tSessionProtocol const * protocol,
+                                void const * protocolSettings, tPort const * port);
+void              SessionDestroy(tSessionContext * context);
+uint8_t           SessionStart(tSessionContext * context);
+void              SessionStop(tSessionContext * context);
+uint8_t           SessionClearMemory(tSessionContext * context, uint32_t address,
+                                     uint32_t len);
+uint8_t           SessionWriteData(tSessionContext * context, uint32_t address,
+                                   uint32_t len, uint8_t const * data);
+uint8_t           SessionReadData(tSessionContext * context, uint32_t address,
+                                  uint32_t len, uint8_t * data);
+uint8_t           SessionWriteDataAsync(tSessionContext * context, uint32_t address,
+                                        uint32_t len, uint8_t const * data);
+uint8_t           SessionClearMemoryAsync(tSessionContext * context, uint32_t address,
+                                          uint32_t len);
+uint8_t           SessionTask(tSessionContext * context, uint8_t wait);
+uint8_t           SessionBuildChecksum(tSessionContext * context, uint32_t address,
+                                       uint32_t * len, uint8_t * type,
+                                       uint32_t * checksum);
+tStatsContext   * SessionGetStats(tSessionContext * context);
+tPort const     * SessionGetPort(tSessionContext * context);
 
 
 #ifdef __cplusplus
@@ -38,6 +38,10 @@
 #include <microtbx.h>                       /* MicroTBX toolbox                        */
 #include <ff.h>                             /* FatFS                                   */
 #include "firmware.h"                       /* Firmware reader module                  */
+#include "port.h"                           /* Port module                             */
+#include "checksum.h"                       /* Checksum calculation module             */
+#include "linereader.h"                     /* Line reader                             */
+#include "segtable.h"                       /* Segment table                           */
 #include "srecreader.h"                     /* S-record firmware file reader           */
 
 
@@ -50,6 +54,28 @@
 /** \brief Size of the byte buffer to store firmware data extracted from an S-record.*/
 #define SREC_DATA_BUFFER_SIZE          (512)
 
+/** \brief Extension that is appended to the name of the firmware file, to obtain the
+ *         name of its segment index cache sidecar file.
+ */
+#define SREC_INDEX_FILE_EXT            ".idx"
+
+/** \brief Value that marks the start of a segment index sidecar file ("SRI3"). */
+#define SREC_INDEX_MAGIC               (0x33495253UL)
+
+/** \brief Number of bytes in the header record of the segment index sidecar file. It
+ *         holds the magic value, the firmware file size, its date and time, the CRC32
+ *         of its contents, the number of segments, the read index interval, the number
+ *         of read index checkpoints and a CRC16 of the record.
+ */
+#define SREC_INDEX_HEADER_SIZE         (30U)
+
+/** \brief Number of bytes in a segment record of the segment index sidecar file. It
+ *         holds the segment's address, length, file pointer and a CRC16 of the record.
+ *         The read index checkpoints are stored in the same type of record, after the
+ *         segments.
+ */
+#define SREC_INDEX_SEGMENT_SIZE        (14U)
+
 
 /****************************************************************************************
 * Configuration check
@@ -61,21 +87,24 @@
 #error "Unicode (UTF-16) mode currently not supported (_LFN_UNICODE must be 0)"
 #endif
 
+/* The segment index cache needs f_stat() to obtain the fingerprint of the firmware file.
+ * Its sidecar file appends ".idx" to the name of the firmware file, which does not fit
+ * an 8.3 filename. Verify that FatFS is configured to include f_stat() and long
+ * filenames.
+ */
+#if (SREC_INDEX_CACHE_ENABLE > 0U)
+#if (_FS_MINIMIZE > 0)
+#error "The segment index cache is not supported with _FS_MINIMIZE > 0"
+#endif
+#if (_USE_LFN == 0)
+#error "The segment index cache is not supported with _USE_LFN == 0"
+#endif
+#endif
+
 
 /****************************************************************************************
 * Type definitions
 ****************************************************************************************/
-/** \brief Structure that groups segment related info. */
-typedef struct
-{
-  /** \brief Base memory address of the segment's data. */
-  uint32_t addr;
-  /** \brief Total length of the segment in bytes. */
-  uint32_t len;
-  /** \brief File pointer inside the firmware file where this segment starts. */
-  FSIZE_t  fptr;
-} tSRecSegment;
-
 /** \brief Structure that represents the handle to the S-record file, which groups all
  *         its relevent data.
  */
@@ -83,8 +112,14 @@ typedef struct
 {
   /** \brief Boolean flag to keep track if a file is opened or not. */
   uint8_t              fileOpened;
+  /** \brief Boolean flag to keep track if the opened file and its segment information
+   *         are shared with another reader instance, which owns them.
+   */
+  uint8_t              fileShared;
   /** \brief FatFS file object handle. */
   FIL                  file;
+  /** \brief Line reader for reading the lines from the file in large blocks. */
+  tLineReader          lineReader;
   /** \brief Byte buffer for storing a line from the S-record file. */
   char                 lineBuf[SREC_LINE_BUFFER_SIZE];
   /** \brief Byte buffer for storing the data from an S-record with the help of function
@@ -95,10 +130,32 @@ typedef struct
    *         function SRecReaderSegmentGetNextData().
    */
   uint8_t              dataBuf[SREC_DATA_BUFFER_SIZE];
-  /** \brief Handle to the linked list with segments. */
-  tTbxList           * segmentList;
+  /** \brief Boolean flag to keep track if the pending line holds data. This is the
+   *         data of the line that was already read and parsed by function
+   *         SRecReaderSegmentGetNextData(), but that did not fit in the data buffer or
+   *         belongs to a different segment. It is still in lineDataBuf and the next call
+   *         of SRecReaderSegmentGetNextData() continues with it.
+   */
+  uint8_t              linePending;
+  /** \brief Memory address of the pending line's data. */
+  uint32_t             pendingAddr;
+  /** \brief Number of data bytes of the pending line. */
+  uint8_t              pendingLen;
+  /** \brief File pointer inside the firmware file where the pending line starts. */
+  FSIZE_t              pendingFPtr;
+  /** \brief Table with the segments, sorted on their base memory address. */
+  tSegTable            segmentTable;
   /** \brief Pointer to the currently opened segment. */
-  tSRecSegment const * openedSegment;
+  tSegment const     * openedSegment;
+  /** \brief Read index with checkpoints, sorted on their base memory address. Each
+   *         checkpoint holds the file pointer of a line and the number of data bytes
+   *         in the consecutive lines that follow it.
+   */
+  tSegTable            readIndex;
+#if (SREC_INDEX_CACHE_ENABLE > 0U)
+  /** \brief FatFS file object handle for the segment index sidecar file. */
+  FIL                  indexFile;
+#endif
 } tSRecHandle;
 
 /** \brief Enumeration for the different S-record line types. */
@@ -114,27 +171,46 @@ typedef enum
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
-static void            SRecReaderInit(void);
-static void            SRecReaderTerminate(void);
-static uint8_t         SRecReaderFileOpen(char const * firmwareFile);
-static void            SRecReaderFileClose(void);
-static uint8_t         SRecReaderSegmentGetCount(void);
-static uint32_t        SRecReaderSegmentGetInfo(uint8_t idx, uint32_t * address);
-static void            SRecReaderSegmentOpen(uint8_t idx);
-static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t * len);
-static uint8_t         SRecReaderCompareSegments(void const * item1, void const * item2);
+static void          * SRecReaderCreate(void);
+static void            SRecReaderDestroy(void * instance);
+static uint8_t         SRecReaderFileOpen(void * instance, char const * firmwareFile);
+static uint8_t         SRecReaderFileShare(void * instance, void const * image);
+static void            SRecReaderFileClose(void * instance);
+static uint32_t        SRecReaderSegmentGetCount(void * instance);
+static uint32_t        SRecReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                                uint32_t * address);
+static void            SRecReaderSegmentOpen(void * instance, uint32_t idx);
+static uint8_t const * SRecReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                    uint16_t * len);
+static uint8_t         SRecReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                                        uint8_t * data);
+#if (SREC_INDEX_CACHE_ENABLE > 0U)
+static uint8_t         SRecReaderIndexLoad(tSRecHandle * srecHandle,
+                                           char const * firmwareFile);
+#if (_FS_READONLY == 0)
+static void            SRecReaderIndexSave(tSRecHandle * srecHandle,
+                                           char const * firmwareFile);
+#endif
+static uint8_t         SRecReaderIndexGetContentCrc(tSRecHandle * srecHandle,
+                                                    FSIZE_t fileSize, uint32_t * crc);
+static uint8_t         SRecReaderIndexLoadTable(tSRecHandle * srecHandle,
+                                                tSegTable * table, uint32_t count);
+#if (_FS_READONLY == 0)
+static uint8_t         SRecReaderIndexSaveTable(tSRecHandle * srecHandle,
+                                                tSegTable const * table);
+#endif
+static uint8_t         SRecReaderIndexCheckTable(tSRecHandle * srecHandle,
+                                                 tSegTable const * table);
+static uint8_t         SRecReaderIndexSetFileName(tSRecHandle * srecHandle,
+                                                  char const * firmwareFile);
+static void            SRecReaderIndexSetLong(uint32_t value, uint8_t * data);
+static uint32_t        SRecReaderIndexGetLong(uint8_t const * data);
+static void            SRecReaderIndexSetCrc(uint8_t * record, uint8_t len);
+static uint8_t         SRecReaderIndexCheckCrc(uint8_t const * record, uint8_t len);
+#endif
 static uint8_t         SRecReaderParseLine(char const * line, uint32_t * address,
                                            uint8_t * len, uint8_t * data);
 static tSRecLineType   SRecReaderGetLineType(char const * line);
-static uint8_t         SRecReaderVerifyChecksum(char const * line);
-static uint8_t         SRecReaderHexStringToByte(char const * hexstring);
-
-
-/****************************************************************************************
-* Local data declarations
-****************************************************************************************/
-/** \brief Handle to the S-record file. */
-static tSRecHandle srecHandle;
 
 
 /***********************************************************************************//**
@@ -148,14 +224,16 @@ tFirmwareReader const * SRecReaderGet(void)
   /** \brief File reader structure filled with Motorola S-record parsing specifics. */
   static const tFirmwareReader srecReader =
   {
-    .Init = SRecReaderInit,
-    .Terminate = SRecReaderTerminate,
+    .Create = SRecReaderCreate,
+    .Destroy = SRecReaderDestroy,
     .FileOpen = SRecReaderFileOpen,
+    .FileShare = SRecReaderFileShare,
     .FileClose = SRecReaderFileClose,
     .SegmentGetCount = SRecReaderSegmentGetCount,
     .SegmentGetInfo = SRecReaderSegmentGetInfo,
     .SegmentOpen = SRecReaderSegmentOpen,
-    .SegmentGetNextData = SRecReaderSegmentGetNextData
+    .SegmentGetNextData = SRecReaderSegmentGetNextData,
+    .ReadAt = SRecReaderReadAt
   };
 
   /* Give the pointer to the firmware reader back to the caller. */
@@ -164,45 +242,78 @@ tFirmwareReader const * SRecReaderGet(void)
 
 
 /************************************************************************************//**
-** \brief     Initializes the S-record reader.
+** \brief     Creates an instance of the S-record reader. The instance is allocated from
+**            the memory pool.
+** \return    Pointer to the reader instance if successful, NULL otherwise.
 **
 ****************************************************************************************/
-static void SRecReaderInit(void)
+static void * SRecReaderCreate(void)
 {
-  /* Initialize the s-record handle members. */
-  srecHandle.fileOpened = TBX_FALSE;
-  srecHandle.segmentList = NULL;
-  srecHandle.openedSegment = NULL;
-} /*** end of SRecReaderInit ***/
+  tSRecHandle * srecHandle;
+
+  /* Attempt to allocate the handle. */
+  srecHandle = TbxMemPoolAllocate(sizeof(tSRecHandle));
+  /* Automatically create or increase the memory pool if it was too small. */
+  if (srecHandle == NULL)
+  {
+    /* No need to check the return value, because we'll attempt to allocate from the
+     * memory pool right way. That will tell us if the memory pool increase was
+     * successful.
+     */
+    (void)TbxMemPoolCreate(1U, sizeof(tSRecHandle));
+    /* Allocation should now work. */
+    srecHandle = TbxMemPoolAllocate(sizeof(tSRecHandle));
+  }
+
+  /* Only continue if the handle was allocated. */
+  if (srecHandle != NULL)
+  {
+    /* Initialize the s-record handle members. */
+    srecHandle->fileOpened = TBX_FALSE;
+    srecHandle->fileShared = TBX_FALSE;
+    SegTableInit(&srecHandle->segmentTable);
+    srecHandle->openedSegment = NULL;
+    SegTableInit(&srecHandle->readIndex);
+    srecHandle->linePending = TBX_FALSE;
+  }
+
+  /* Give the reader instance back to the caller. */
+  return srecHandle;
+} /*** end of SRecReaderCreate ***/
 
 
 /************************************************************************************//**
-** \brief     Terminated the S-record reader.
+** \brief     Releases an instance of the S-record reader.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 **
 ****************************************************************************************/
-static void SRecReaderTerminate(void)
+static void SRecReaderDestroy(void * instance)
 {
   /* Make sure a possibly previously opened file is closed. */
-  SRecReaderFileClose();
-} /*** end of SRecReaderTerminate ***/
+  SRecReaderFileClose(instance);
+  /* Give the handle back to the memory pool. */
+  TbxMemPoolRelease(instance);
+} /*** end of SRecReaderDestroy ***/
 
 
 /************************************************************************************//**
 ** \brief     Opens the firmware file and browses through its contents to collect
 **            information about the firmware data segment it contains.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 ** \param     firmwareFile Firmware filename including its full path.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t SRecReaderFileOpen(char const * firmwareFile)
+static uint8_t SRecReaderFileOpen(void * instance, char const * firmwareFile)
 {
+  tSRecHandle  * srecHandle = instance;
   uint8_t        result = TBX_OK;
   uint32_t       lineAddress = 0U;
   uint8_t        lineDataLen = 0U;
   uint8_t        parseResult;
   uint8_t        stopLineLoop = TBX_FALSE;
+  uint8_t        indexLoaded = TBX_FALSE;
   FSIZE_t        lineFPtr;
-  tSRecSegment * segment = NULL;
 
   /* Verify parameter. */
   TBX_ASSERT(firmwareFile != NULL);
@@ -211,9 +322,9 @@ static uint8_t SRecReaderFileOpen(char const * firmwareFile)
   if (firmwareFile != NULL)
   {
     /* Make sure a possibly previously opened file is first closed. */
-    SRecReaderFileClose();
+    SRecReaderFileClose(srecHandle);
     /* Open the file for reading. */
-    if (f_open(&srecHandle.file, firmwareFile, FA_READ) != FR_OK)
+    if (f_open(&srecHandle->file, firmwareFile, FA_READ) != FR_OK)
     {
       /* Could not open the file. Update the result to flag this problem. */
       result = TBX_ERROR;
@@ -222,40 +333,35 @@ static uint8_t SRecReaderFileOpen(char const * firmwareFile)
     else
     {
       /* Update the flag that tracks the file opened state. */
-      srecHandle.fileOpened = TBX_TRUE;
+      srecHandle->fileOpened = TBX_TRUE;
+      /* Initialize the line reader for the opened file. */
+      LineReaderInit(&srecHandle->lineReader, &srecHandle->file);
     }
 
     /* Only continue if the file was successfully opened. */
     if (result == TBX_OK)
     {
-      /* Create the linked list with segment information. */
-      srecHandle.segmentList = TbxListCreate();
-      /* Verify that the linked list could be created. */
-      if (srecHandle.segmentList == NULL)
-      {
-        /* Update the flag that tracks the file opened state. */
-        srecHandle.fileOpened = TBX_FALSE;
-        /* Close the file and update the result to flag this problem. */
-        (void)f_close(&srecHandle.file);
-        result = TBX_ERROR;
-      }
-    }
-
-    /* Only continue if the linked list was successfully created. */
-    if (result == TBX_OK)
-    {
+#if (SREC_INDEX_CACHE_ENABLE > 0U)
+      /* Attempt to load the segment information and the read index from the segment
+       * index cache. If this works, there is no need to scan through the firmware file.
+       */
+      indexLoaded = SRecReaderIndexLoad(srecHandle, firmwareFile);
+#endif
+      /* Skip the file scan, if the segment information is already known. */
+      stopLineLoop = indexLoaded;
       /* Loop to read all the lines in the file one at a time. */
       while (stopLineLoop != TBX_TRUE)
       {
         /* Store the file pointer of the current line. Needed later on in case this
          * is a new segment.
          */
-        lineFPtr = f_tell(&srecHandle.file);
+        lineFPtr = LineReaderTell(&srecHandle->lineReader);
         /* Attempt to read the next line from the file */
-        if (f_gets(srecHandle.lineBuf, SREC_LINE_BUFFER_SIZE, &srecHandle.file) == NULL)
+        if (LineReaderGets(&srecHandle->lineReader, srecHandle->lineBuf,
+                           SREC_LINE_BUFFER_SIZE) == NULL)
         {
           /* An error occured or we reached the end of the file. Was it an error? */
-          if (f_error(&srecHandle.file) > 0U)
+          if (LineReaderGetError(&srecHandle->lineReader) == TBX_TRUE)
           {
             result = TBX_ERROR;
           }
@@ -264,7 +370,7 @@ static uint8_t SRecReaderFileOpen(char const * firmwareFile)
           continue;
         }
         /* Attempt to extract data from the s-record line. */
-        parseResult = SRecReaderParseLine(srecHandle.lineBuf, &lineAddress,
+        parseResult = SRecReaderParseLine(srecHandle->lineBuf, &lineAddress,
                                           &lineDataLen, NULL);
         /* Did an error occur during line parsing? */
         if (parseResult != TBX_OK)
@@ -279,105 +385,69 @@ static uint8_t SRecReaderFileOpen(char const * firmwareFile)
          */
         if (lineDataLen > 0U)
         {
-          /* Does the parsed data fit at the end of the current segment? */
-          if (segment != NULL)
+          /* Add the data to the segment table. It extends the current segment, if it
+           * fits at its end. Otherwise a new segment is created.
+           */
+          if (SegTableAddData(&srecHandle->segmentTable, lineAddress, lineDataLen,
+                              lineFPtr, 0U) != TBX_OK)
           {
-            /* Does it fit at the end of the segment? */
-            if (lineAddress == (segment->addr + segment->len))
-            {
-              segment->len += lineDataLen;
-            }
-            /* Data did not fit in the current segment. */
-            else
-            {
-              /* A new segment should be created. Invalidate the current segment to
-               * indicate this situation.
-               */
-              segment = NULL;
-            }
+            /* No memory could be allocated. The heap is probably configured too
+             * small. Increase TBX_CONF_HEAP_SIZE to resolve the problem. All we can do
+             * now is flag the error.
+             */
+            result = TBX_ERROR;
+            stopLineLoop = TBX_TRUE;
+            continue;
           }
-
-          /* Did the parsed data not fit in the current segment? */
-          if (segment == NULL)
+#if (SREC_READ_INDEX_INTERVAL > 0U)
+          /* Add the data to the read index as well. It gets a new checkpoint once the
+           * current one holds SREC_READ_INDEX_INTERVAL bytes.
+           */
+          if (SegTableAddDataLimited(&srecHandle->readIndex, lineAddress, lineDataLen,
+                                     lineFPtr, 0U, SREC_READ_INDEX_INTERVAL) != TBX_OK)
           {
-            /* Iterate over the linked list to try and find an existing segment that the
-             * data fits in.
-             */
-            segment = TbxListGetFirstItem(srecHandle.segmentList);
-            while (segment != NULL)
-            {
-              /* Does it fit at the end of this segment? */
-              if (lineAddress == (segment->addr + segment->len))
-              {
-                /* Update the length of the segment. */
-                segment->len += lineDataLen;
-                /* Segment found and updated so break the loop. */
-                break;
-              }
-              /* Continue with the next segment. */
-              segment = TbxListGetNextItem(srecHandle.segmentList, segment);
-            }
-
-            /* Could a fitting segment not be found? */
-            if (segment == NULL)
-            {
-              /* Attempt to allocate memory to store the new segment. */
-              segment = TbxMemPoolAllocate(sizeof(tSRecSegment));
-              /* Automatically create or increase the memory pool if it was too small. */
-              if (segment == NULL)
-              {
-                /* No need to check the return value, because we'll attempt to allocate
-                 * from the memory pool right way. That will tell us if the memory pool
-                 * increase was successful.
-                 */
-                (void)TbxMemPoolCreate(1, sizeof(tSRecSegment));
-                /* Allocation should now work. */
-                segment = TbxMemPoolAllocate(sizeof(tSRecSegment));
-                /* Verify segment allocation. */
-                if (segment == NULL)
-                {
-                  /* Could not allocate memory. Heap is probably configured too small.
-                   * Increase TBX_CONF_HEAP_SIZE to resolve the problem. All we can
-                   * do now is flag the error.
-                   */
-                  result = TBX_ERROR;
-                  stopLineLoop = TBX_TRUE;
-                  continue;
-                }
-              }
-              /* Initialize the newly created segment. */
-              segment->addr = lineAddress;
-              segment->len = lineDataLen;
-              segment->fptr = lineFPtr;
-              /* Add the segment to the linked list. */
-              if (TbxListInsertItemBack(srecHandle.segmentList, segment) == TBX_ERROR)
-              {
-                /* Could not insert the segment into the linked list. Heap is probably
-                 * configured too small. Increase TBX_CONF_HEAP_SIZE to resolve the
-                 * problem. All we can do now is flag the error.
-                 */
-                result = TBX_ERROR;
-                stopLineLoop = TBX_TRUE;
-                continue;
-              }
-            }
+            /* Could not allocate memory for the checkpoint. */
+            result = TBX_ERROR;
+            stopLineLoop = TBX_TRUE;
+            continue;
           }
+#endif
         }
       }
     }
 
-    /* Sort the segments inside the linked list if all went okay so far. */
+    /* Sort the segments on their base memory address, if all went okay so far. This
+     * is also where firmware data that overlaps with another segment is rejected.
+     */
     if (result == TBX_OK)
     {
-      TbxListSortItems(srecHandle.segmentList, SRecReaderCompareSegments);
+      result = SegTableSort(&srecHandle->segmentTable);
+    }
+#if (SREC_READ_INDEX_INTERVAL > 0U)
+    if (result == TBX_OK)
+    {
+      result = SegTableSort(&srecHandle->readIndex);
+    }
+#endif
+
+    /* Finalize the segment information if all went okay so far. */
+    if (result == TBX_OK)
+    {
+#if (SREC_INDEX_CACHE_ENABLE > 0U) && (_FS_READONLY == 0)
+      /* Store the segment information in the segment index cache, if it was obtained
+       * by scanning the firmware file. This speeds up the next time this file is opened.
+       */
+      if (indexLoaded == TBX_FALSE)
+      {
+        SRecReaderIndexSave(srecHandle, firmwareFile);
+      }
+#endif
     }
     /* Perform cleanup in case the file could not be properly opened. */
     else
     {
-      /* Make sure the file is closed. This includes the release of the segments linked
-       * list.
-       */
-      SRecReaderFileClose();
+      /* Make sure the file is closed. This includes the release of the segments. */
+      SRecReaderFileClose(srecHandle);
     }
   }
 
@@ -386,38 +456,93 @@ static uint8_t SRecReaderFileOpen(char const * firmwareFile)
 } /*** end of SRecReaderFileOpen ***/
 
 
+/************************************************************************************//**
+** \brief     Opens the firmware file that another reader instance already opened. The
+**            segment information is shared with the other instance, so the firmware
+**            file does not need to be scanned again. This instance does get its own file
+**            object, such that it can read the firmware data independent from the other
+**            instance. The other instance must keep its firmware file opened, until this
+**            instance closed it.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
+** \param     image Pointer to the reader instance that opened the firmware file.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderFileShare(void * instance, void const * image)
+{
+  tSRecHandle       * srecHandle = instance;
+  tSRecHandle const * imageHandle = image;
+  uint8_t            result = TBX_ERROR;
+
+  /* Verify parameter. */
+  TBX_ASSERT(image != NULL);
+
+  /* Only continue with valid parameter. */
+  if (image != NULL)
+  {
+    /* Make sure a possibly previously opened file is first closed. */
+    SRecReaderFileClose(srecHandle);
+    /* Only continue if the other instance actually opened a file. */
+    if (imageHandle->fileOpened == TBX_TRUE)
+    {
+      /* Duplicate the file object. This gives this instance its own file pointer, just
+       * like opening the file again for reading would. The duplicate is never closed
+       * with f_close(), because it did not open the file itself.
+       */
+      srecHandle->file = imageHandle->file;
+      LineReaderInit(&srecHandle->lineReader, &srecHandle->file);
+      /* Share the segment table and the read index. These are no longer modified after
+       * the file was opened, so they can be read by both instances at the same time.
+       */
+      srecHandle->segmentTable = imageHandle->segmentTable;
+      srecHandle->readIndex = imageHandle->readIndex;
+      /* Update the flags that track the file opened state. */
+      srecHandle->fileOpened = TBX_TRUE;
+      srecHandle->fileShared = TBX_TRUE;
+      result = TBX_OK;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderFileShare ***/
+
+
 /************************************************************************************//**
 ** \brief     Closes the previously opened firmware file.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 **
 ****************************************************************************************/
-static void SRecReaderFileClose(void)
+static void SRecReaderFileClose(void * instance)
 {
-  tSRecSegment * currentSegment;
-  tSRecSegment * nextSegment;
+  tSRecHandle * srecHandle = instance;
 
   /* Only close the file if one is actually opened. */
-  if (srecHandle.fileOpened == TBX_TRUE)
+  if (srecHandle->fileOpened == TBX_TRUE)
   {
     /* Reset the flag. */
-    srecHandle.fileOpened = TBX_FALSE;
-    /* Close the file. */
-    (void)f_close(&srecHandle.file);
-    /* Iterate over the linked list contents. */
-    currentSegment = TbxListGetFirstItem(srecHandle.segmentList);
-    while (currentSegment != NULL)
+    srecHandle->fileOpened = TBX_FALSE;
+    /* Was the file opened by sharing it with another instance? */
+    if (srecHandle->fileShared == TBX_TRUE)
     {
-      /* Get the next segment, before the current segments' memory is released. */
-      nextSegment = TbxListGetNextItem(srecHandle.segmentList, currentSegment);
-      /* Give the allocated memory for the segment back to the memory pool. */
-      TbxMemPoolRelease(currentSegment);
-      /* Continue with the next segment. */
-      currentSegment = nextSegment;
+      /* Reset the flag. */
+      srecHandle->fileShared = TBX_FALSE;
+      /* The other instance owns the file and the segments. Only forget about them. */
+      SegTableInit(&srecHandle->segmentTable);
+      SegTableInit(&srecHandle->readIndex);
+    }
+    else
+    {
+      /* Close the file. */
+      (void)f_close(&srecHandle->file);
+      /* Release the segments and the read index. */
+      SegTableClear(&srecHandle->segmentTable);
+      SegTableClear(&srecHandle->readIndex);
     }
-    /* Delete the linked list with segments. */
-    TbxListDelete(srecHandle.segmentList);
-    srecHandle.segmentList = NULL;
     /* Reset the opened segment. */
-    srecHandle.openedSegment = NULL;
+    srecHandle->openedSegment = NULL;
+    /* Discard a possibly pending line. */
+    srecHandle->linePending = TBX_FALSE;
   }
 } /*** end of SRecReaderFileClose ***/
 
@@ -428,24 +553,20 @@ static void SRecReaderFileClose(void)
 **            of firmware data. A firmware file always has at least one segment. However,
 **            it can have more as well. For example if there is a gap between the vector
 **            table and the other program data.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 ** \return    Total number of firmware data segments present in the firmware file.
 **
 ****************************************************************************************/
-static uint8_t SRecReaderSegmentGetCount(void)
+static uint32_t SRecReaderSegmentGetCount(void * instance)
 {
-  uint8_t result = 0U;
-  size_t  listSize;
+  tSRecHandle * srecHandle = instance;
+  uint32_t result = 0U;
 
-  /* Only continue if a file is actually opened and segments were extracted. */
-  if ( (srecHandle.fileOpened == TBX_TRUE) && (srecHandle.segmentList != NULL) )
+  /* Only continue if a file is actually opened. */
+  if (srecHandle->fileOpened == TBX_TRUE)
   {
-    /* The number of segments equals the size of the linked list. */
-    listSize = TbxListGetSize(srecHandle.segmentList);
-    /* Only update the result if the list size fits in it. */
-    if ( (listSize > 0U) && (listSize <= (uint8_t)UINT8_MAX) )
-    {
-      result = (uint8_t)listSize;
-    }
+    /* Obtain the number of segments in the segment table. */
+    result = SegTableGetCount(&srecHandle->segmentTable);
   }
 
   /* Give the result back to the caller. */
@@ -457,6 +578,7 @@ static uint8_t SRecReaderSegmentGetCount(void)
 ** \brief     Obtains information about the specified segment, such as the base memory
 **            address that its data belongs to and the total number of data bytes in the
 **            segment.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 ** \param     idx Zero-based segment index. Valid values are between 0 and
 **            (SegmentGetCount() - 1).
 ** \param     address The base memory address of the segment's data is written to this
@@ -464,40 +586,31 @@ static uint8_t SRecReaderSegmentGetCount(void)
 ** \return    The total number of data bytes inside this segment.
 **
 ****************************************************************************************/
-static uint32_t SRecReaderSegmentGetInfo(uint8_t idx, uint32_t * address)
+static uint32_t SRecReaderSegmentGetInfo(void * instance, uint32_t idx,
+                                         uint32_t * address)
 {
+  tSRecHandle * srecHandle = instance;
   uint32_t result = 0U;
-  tSRecSegment const * segment;
+  tSegment const * segment;
 
   /* Verify parameters. */
-  TBX_ASSERT((idx < SRecReaderSegmentGetCount()) && (address != NULL));
+  TBX_ASSERT((idx < SRecReaderSegmentGetCount(srecHandle)) && (address != NULL));
 
   /* Only continue with valid parameters. */
-  if ((idx < SRecReaderSegmentGetCount()) && (address != NULL))
+  if ((idx < SRecReaderSegmentGetCount(srecHandle)) && (address != NULL))
   {
-    /* Only continue if a file is actually opened and segments were extracted. */
-    if ( (srecHandle.fileOpened == TBX_TRUE) && (srecHandle.segmentList != NULL) )
+    /* Only continue if a file is actually opened. */
+    if (srecHandle->fileOpened == TBX_TRUE)
     {
-      /* Only continue if the segment index is valid. */
-      if (idx < TbxListGetSize(srecHandle.segmentList))
+      /* Obtain the segment specified by the index. */
+      segment = SegTableGet(&srecHandle->segmentTable, idx);
+      /* Make sure a valid segment was found. */
+      if (segment != NULL)
       {
-        /* Iterate over the linked list until the segment specified by the index. */
-        segment = TbxListGetFirstItem(srecHandle.segmentList);
-        while (idx > 0U)
-        {
-          /* Move to the next segment. */
-          segment = TbxListGetNextItem(srecHandle.segmentList, segment);
-          /* Decrement the indexer. */
-          idx--;
-        }
-        /* Make sure a valid segment was found. */
-        if (segment != NULL)
-        {
-          /* Store the base memory address of the data in this segment. */
-          *address = segment->addr;
-          /* Update the result to hold the total number of bytse inside this segment. */
-          result = segment->len;
-        }
+        /* Store the base memory address of the data in this segment. */
+        *address = segment->addr;
+        /* Update the result to hold the total number of bytse inside this segment. */
+        result = segment->len;
       }
     }
   }
@@ -510,39 +623,36 @@ static uint32_t SRecReaderSegmentGetInfo(uint8_t idx, uint32_t * address)
 /************************************************************************************//**
 ** \brief     Opens the firmware data segment for reading. This should always be called
 **            before calling the SegmentGetNextData() function.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 ** \param     idx Zero-based segment index. Valid values are between 0 and
 **            (SegmentGetCount() - 1).
 **
 ****************************************************************************************/
-static void SRecReaderSegmentOpen(uint8_t idx)
+static void SRecReaderSegmentOpen(void * instance, uint32_t idx)
 {
-  tSRecSegment const * segment;
+  tSRecHandle    * srecHandle = instance;
+  tSegment const * segment;
 
   /* Verify parameter. */
-  TBX_ASSERT(idx < SRecReaderSegmentGetCount());
+  TBX_ASSERT(idx < SRecReaderSegmentGetCount(srecHandle));
 
   /* Only continue with valid parameter. */
-  if (idx < SRecReaderSegmentGetCount())
+  if (idx < SRecReaderSegmentGetCount(srecHandle))
   {
-    /* Only continue if a file is actually opened and segments were extracted. */
-    if ( (srecHandle.fileOpened == TBX_TRUE) && (srecHandle.segmentList != NULL) )
+    /* Only continue if a file is actually opened. */
+    if (srecHandle->fileOpened == TBX_TRUE)
     {
-      /* Iterate over the linked list until the segment specified by the index. */
-      segment = TbxListGetFirstItem(srecHandle.segmentList);
-      while (idx > 0U)
-      {
-        /* Move to the next segment. */
-        segment = TbxListGetNextItem(srecHandle.segmentList, segment);
-        /* Decrement the indexer. */
-        idx--;
-      }
+      /* Obtain the segment specified by the index. */
+      segment = SegTableGet(&srecHandle->segmentTable, idx);
       /* Make sure a valid segment was found. */
       if (segment != NULL)
       {
         /* Keep track of the currently openeded segment. */
-        srecHandle.openedSegment = segment;
+        srecHandle->openedSegment = segment;
+        /* A possibly pending line belongs to the previously opened segment. */
+        srecHandle->linePending = TBX_FALSE;
         /* Set the file pointer to the S-record line where this segment starts. */
-        (void)f_lseek(&srecHandle.file, segment->fptr);
+        (void)LineReaderSeek(&srecHandle->lineReader, segment->fptr);
       }
     }
   }
@@ -555,6 +665,7 @@ static void SRecReaderSegmentOpen(uint8_t idx)
 **            open the segment and afterwards you can keep calling this function to
 **            read out the segment's firmware data. When all data is read, len will be
 **            set to zero and a non-NULL pointer is returned.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
 ** \param     address The starting memory address of this chunk of firmware data is
 **            written to this pointer.
 ** \param     len  The length of the firmware data chunk is written to this pointer.
@@ -567,8 +678,10 @@ static void SRecReaderSegmentOpen(uint8_t idx)
 **            3) A NULL pointer is returned. This happens only when an error occurred.
 **
 ****************************************************************************************/
-static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t * len)
+static uint8_t const * SRecReaderSegmentGetNextData(void * instance, uint32_t * address,
+                                                    uint16_t * len)
 {
+  tSRecHandle    * srecHandle = instance;
   uint8_t  const * result = NULL;
   uint8_t          dataReadDone = TBX_FALSE;
   uint8_t          parseResult;
@@ -583,16 +696,13 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
   /* Only continue with valid parameters. */
   if ((address != NULL) && (len != NULL))
   {
-    /* Only continue if a file is actually opened, segments were extracted and a segment
-     * was actually opened.
-     */
-    if ( (srecHandle.fileOpened == TBX_TRUE) && (srecHandle.segmentList != NULL) &&
-         (srecHandle.openedSegment != NULL) )
+    /* Only continue if a file is actually opened and a segment was actually opened. */
+    if ( (srecHandle->fileOpened == TBX_TRUE) && (srecHandle->openedSegment != NULL) )
     {
       /* Set the result to the valid databuffer, which indicates success. From now on
        * only set it to NULL, in case an error was detected.
        */
-      result = srecHandle.dataBuf;
+      result = srecHandle->dataBuf;
 
       /* Initialize the lenght output parameter, since we plan on using it as a data
        * buffer indexer as well.
@@ -604,40 +714,55 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
        */
       while (dataReadDone != TBX_TRUE)
       {
-        /* Store the file pointer of the current line. Might need it later to rewind. */
-        lineFPtr = f_tell(&srecHandle.file);
-        /* Attempt to read the next line from the file. */
-        if (f_gets(srecHandle.lineBuf, SREC_LINE_BUFFER_SIZE, &srecHandle.file) == NULL)
+        /* Is there a pending line, left over from the previous call? */
+        if (srecHandle->linePending == TBX_TRUE)
         {
-          /* An error occured or we reached the end of the file. Was it an error? */
-          if (f_error(&srecHandle.file) > 0U)
+          /* Continue with its already extracted data, instead of reading and parsing
+           * the same line again.
+           */
+          srecHandle->linePending = TBX_FALSE;
+          lineFPtr = srecHandle->pendingFPtr;
+          lineAddress = srecHandle->pendingAddr;
+          lineDataLen = srecHandle->pendingLen;
+        }
+        else
+        {
+          /* Store the file pointer of the current line. Might need it to rewind. */
+          lineFPtr = LineReaderTell(&srecHandle->lineReader);
+          /* Attempt to read the next line from the file. */
+          if (LineReaderGets(&srecHandle->lineReader, srecHandle->lineBuf,
+                             SREC_LINE_BUFFER_SIZE) == NULL)
+          {
+            /* An error occured or we reached the end of the file. Was it an error? */
+            if (LineReaderGetError(&srecHandle->lineReader) == TBX_TRUE)
+            {
+              /* Flag the error by updating the result and resetting the length. */
+              *len = 0;
+              result = NULL;
+              /* Rewind the file pointer as well. */
+              (void)LineReaderSeek(&srecHandle->lineReader, lineFPtr);
+            }
+            /* Stop looping when an error occurred or we reached the end of the file. */
+            dataReadDone = TBX_TRUE;
+            continue;
+          }
+
+          /* Still here, so a line was read fron the file. Attempt to extract data from
+           * the S-record line.
+           */
+          parseResult = SRecReaderParseLine(srecHandle->lineBuf, &lineAddress,
+                                            &lineDataLen, srecHandle->lineDataBuf);
+          /* Did an error occur during line parsing? */
+          if (parseResult != TBX_OK)
           {
             /* Flag the error by updating the result and resetting the length. */
             *len = 0;
             result = NULL;
             /* Rewind the file pointer as well. */
-            (void)f_lseek(&srecHandle.file, lineFPtr);
+            (void)LineReaderSeek(&srecHandle->lineReader, lineFPtr);
+            dataReadDone = TBX_TRUE;
+            continue;
           }
-          /* Stop looping when an error occurred or we reached the end of the file. */
-          dataReadDone = TBX_TRUE;
-          continue;
-        }
-
-        /* Still here, so a line was read fron the file. Attempt to extract data from
-         * the S-record line.
-         */
-        parseResult = SRecReaderParseLine(srecHandle.lineBuf, &lineAddress,
-                                          &lineDataLen, srecHandle.lineDataBuf);
-        /* Did an error occur during line parsing? */
-        if (parseResult != TBX_OK)
-        {
-          /* Flag the error by updating the result and resetting the length. */
-          *len = 0;
-          result = NULL;
-          /* Rewind the file pointer as well. */
-          (void)f_lseek(&srecHandle.file, lineFPtr);
-          dataReadDone = TBX_TRUE;
-          continue;
         }
 
         /* Still here so parsing was okay, but only continue if data was actually
@@ -653,15 +778,18 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
             *address = lineAddress;
           }
           /* Does this newly read data still belong to the same segment? */
-          if ( (lineAddress < srecHandle.openedSegment->addr) ||
+          if ( (lineAddress < srecHandle->openedSegment->addr) ||
                ((lineAddress + lineDataLen) >
-               (srecHandle.openedSegment->addr + srecHandle.openedSegment->len)) )
+               (srecHandle->openedSegment->addr + srecHandle->openedSegment->len)) )
           {
             /* The data read from this line belongs to the a different segment. This
-             * means we are done and should not copy the data. We do rewind the file
-             * pointer, because the data hasn't actually been processed.
+             * means we are done and should not copy the data. Keep the line pending,
+             * because the data hasn't actually been processed.
              */
-            (void)f_lseek(&srecHandle.file, lineFPtr);
+            srecHandle->linePending = TBX_TRUE;
+            srecHandle->pendingFPtr = lineFPtr;
+            srecHandle->pendingAddr = lineAddress;
+            srecHandle->pendingLen = lineDataLen;
             dataReadDone = TBX_TRUE;
             continue;
           }
@@ -675,7 +803,7 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
             *len = 0;
             result = NULL;
             /* Rewind the file pointer as well. */
-            (void)f_lseek(&srecHandle.file, lineFPtr);
+            (void)LineReaderSeek(&srecHandle->lineReader, lineFPtr);
             dataReadDone = TBX_TRUE;
             continue;
 
@@ -686,10 +814,13 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
           if ((*len + lineDataLen) > (uint16_t)SREC_DATA_BUFFER_SIZE)
           {
             /* Data won't fit in the data buffer. This means we are done, but need to
-             * make sure to rewind the file pointer for the next time this function is
+             * make sure to keep the line pending for the next time this function is
              * called.
              */
-            (void)f_lseek(&srecHandle.file, lineFPtr);
+            srecHandle->linePending = TBX_TRUE;
+            srecHandle->pendingFPtr = lineFPtr;
+            srecHandle->pendingAddr = lineAddress;
+            srecHandle->pendingLen = lineDataLen;
             dataReadDone = TBX_TRUE;
             continue;
           }
@@ -699,7 +830,7 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
            */
           for (byteIdx = 0U; byteIdx < lineDataLen; byteIdx++)
           {
-            srecHandle.dataBuf[*len + byteIdx] = srecHandle.lineDataBuf[byteIdx];
+            srecHandle->dataBuf[*len + byteIdx] = srecHandle->lineDataBuf[byteIdx];
           }
           /* Update the data length. */
           *len += lineDataLen;
@@ -714,35 +845,630 @@ static uint8_t const * SRecReaderSegmentGetNextData(uint32_t * address, uint16_t
 
 
 /************************************************************************************//**
-** \brief     Compares the two segments based on their base address. Can be used for
-**            sorting the segments inside the linked list.
-** \param     item1 Pointer to the first item to compare.
-** \param     item2 Pointer to the seconds item to compare.
-** \return    TBX_TRUE if item 1 is greater than item 2. TBX_FALSE otherwise.
+** \brief     Reads firmware data at a specific memory address. The read index is used to
+**            find the line closest before the address, so that only a few lines need to
+**            be parsed. Reading from the opened segment afterwards continues where it
+**            left off.
+** \param     instance Pointer to the reader instance, as created by SRecReaderCreate().
+** \param     address Memory address of the first byte to read.
+** \param     len Number of bytes to read.
+** \param     data Byte array where the read firmware data is written to. Must be able
+**            to hold at least len bytes.
+** \return    TBX_OK if successful, TBX_ERROR if not all bytes in the range hold
+**            firmware data or in case of a read error.
 **
 ****************************************************************************************/
-static uint8_t SRecReaderCompareSegments(void const * item1, void const * item2)
+static uint8_t SRecReaderReadAt(void * instance, uint32_t address, uint32_t len,
+                                uint8_t * data)
 {
-  uint8_t              result = TBX_FALSE;
-  tSRecSegment const * segment1 = item1;
-  tSRecSegment const * segment2 = item2;
+  tSRecHandle     * srecHandle = instance;
+  uint8_t           result = TBX_ERROR;
+  tSegTable const * readIndex;
+  tSegment const  * checkpoint;
+  FSIZE_t           restoreFPtr;
+  uint32_t          lineAddress;
+  uint8_t           lineDataLen;
+  uint32_t          checkpointOffset;
+  uint32_t          dataIdx = 0U;
+  uint32_t          copyOffset;
+  uint32_t          copyLen;
+  uint32_t          byteIdx;
 
   /* Verify parameters. */
-  TBX_ASSERT((item1 != NULL) && (item2 != NULL));
+  TBX_ASSERT((len > 0U) && (data != NULL));
 
   /* Only continue with valid parameters. */
-  if ((item1 != NULL) && (item2 != NULL))
+  if ((len > 0U) && (data != NULL))
+  {
+    /* Only continue if a file is actually opened. */
+    if (srecHandle->fileOpened == TBX_TRUE)
+    {
+      /* Determine where reading from the opened segment should continue afterwards. A
+       * pending line must be read again, because its data gets overwritten.
+       */
+      if (srecHandle->linePending == TBX_TRUE)
+      {
+        restoreFPtr = srecHandle->pendingFPtr;
+        srecHandle->linePending = TBX_FALSE;
+      }
+      else
+      {
+        restoreFPtr = LineReaderTell(&srecHandle->lineReader);
+      }
+      /* Use the read index, if it was built. Otherwise reading starts at the first line
+       * of the segment.
+       */
+      readIndex = &srecHandle->readIndex;
+      if (SegTableGetCount(readIndex) == 0U)
+      {
+        readIndex = &srecHandle->segmentTable;
+      }
+      /* Set the result to success and only negate upon error detection from here on. */
+      result = TBX_OK;
+      /* Loop until all requested data is read. */
+      while ((dataIdx < len) && (result == TBX_OK))
+      {
+        /* Find the checkpoint with the line closest before the address and move the
+         * file pointer to this line.
+         */
+        checkpoint = SegTableFind(readIndex, address + dataIdx);
+        if ( (checkpoint == NULL) ||
+             (LineReaderSeek(&srecHandle->lineReader, checkpoint->fptr) != TBX_OK) )
+        {
+          /* No firmware data at this address or a read error. */
+          result = TBX_ERROR;
+          continue;
+        }
+        /* Read the checkpoint's lines, until all requested data in it is copied. */
+        checkpointOffset = 0U;
+        while ( (checkpointOffset < checkpoint->len) && (dataIdx < len) &&
+                (result == TBX_OK) )
+        {
+          /* Attempt to read and parse the next line. */
+          if ( (LineReaderGets(&srecHandle->lineReader, srecHandle->lineBuf,
+                               SREC_LINE_BUFFER_SIZE) == NULL) ||
+               (SRecReaderParseLine(srecHandle->lineBuf, &lineAddress, &lineDataLen,
+                                    srecHandle->lineDataBuf) != TBX_OK) )
+          {
+            result = TBX_ERROR;
+            continue;
+          }
+          /* Only continue if data was actually extracted. */
+          if (lineDataLen > 0U)
+          {
+            /* The checkpoint's data is stored in consecutive lines. */
+            if (lineAddress != (checkpoint->addr + checkpointOffset))
+            {
+              result = TBX_ERROR;
+              continue;
+            }
+            checkpointOffset += lineDataLen;
+            /* Copy the line's data, starting at the next address that is requested. */
+            if ((lineAddress + lineDataLen) > (address + dataIdx))
+            {
+              copyOffset = (address + dataIdx) - lineAddress;
+              copyLen = lineDataLen - copyOffset;
+              if (copyLen > (len - dataIdx))
+              {
+                copyLen = len - dataIdx;
+              }
+              for (byteIdx = 0U; byteIdx < copyLen; byteIdx++)
+              {
+                data[dataIdx + byteIdx] = srecHandle->lineDataBuf[copyOffset + byteIdx];
+              }
+              dataIdx += copyLen;
+            }
+          }
+        }
+      }
+      /* Continue reading from the opened segment where it left off. */
+      (void)LineReaderSeek(&srecHandle->lineReader, restoreFPtr);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderReadAt ***/
+
+
+#if (SREC_INDEX_CACHE_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Attempts to load the segment information of the firmware file from its
+**            segment index sidecar file. This only works if the sidecar file is intact
+**            and its fingerprint still matches. The fingerprint consists of the size,
+**            date and time of the firmware file and the CRC32 of its contents. On top
+**            of that, the first line of each segment and of each read index checkpoint
+**            must still be located at its file pointer. The segments are added to the
+**            segment table and the checkpoints to the read index.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_TRUE if the segment information was loaded, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexLoad(tSRecHandle * srecHandle, char const * firmwareFile)
+{
+  uint8_t   result = TBX_FALSE;
+  FILINFO   fileInfo;
+  UINT      bytesRead;
+  uint32_t  segmentCount;
+  uint32_t  checkpointCount;
+  uint32_t  contentCrc = 0U;
+  uint8_t * record = srecHandle->lineDataBuf;
+
+  /* Obtain the fingerprint of the firmware file and open the sidecar file. Note that
+   * the name of the sidecar file is stored in the line buffer.
+   */
+  if ( (SRecReaderIndexSetFileName(srecHandle, firmwareFile) == TBX_OK) &&
+       (f_stat(firmwareFile, &fileInfo) == FR_OK) )
+  {
+    if (f_open(&srecHandle->indexFile, srecHandle->lineBuf, FA_READ) == FR_OK)
+    {
+      /* Read and verify the header record. */
+      if ( (f_read(&srecHandle->indexFile, record, SREC_INDEX_HEADER_SIZE,
+                   &bytesRead) == FR_OK) && (bytesRead == SREC_INDEX_HEADER_SIZE) )
+      {
+        if ( (SRecReaderIndexCheckCrc(record, SREC_INDEX_HEADER_SIZE) == TBX_OK) &&
+             (SRecReaderIndexGetLong(&record[0]) == SREC_INDEX_MAGIC) &&
+             (SRecReaderIndexGetLong(&record[4]) == (uint32_t)fileInfo.fsize) &&
+             (SRecReaderIndexGetLong(&record[8]) ==
+              (((uint32_t)fileInfo.fdate << 16U) | fileInfo.ftime)) &&
+             (SRecReaderIndexGetContentCrc(srecHandle, fileInfo.fsize,
+                                           &contentCrc) == TBX_OK) &&
+             (SRecReaderIndexGetLong(&record[12]) == contentCrc) &&
+             (SRecReaderIndexGetLong(&record[20]) == SREC_READ_INDEX_INTERVAL) )
+        {
+          /* Header okay. Read the segment records, followed by the read index
+           * checkpoint records. Note that the header is no longer needed once the
+           * record buffer is reused.
+           */
+          segmentCount = SRecReaderIndexGetLong(&record[16]);
+          checkpointCount = SRecReaderIndexGetLong(&record[24]);
+          result = SRecReaderIndexLoadTable(srecHandle, &srecHandle->segmentTable,
+                                            segmentCount);
+          if (result == TBX_TRUE)
+          {
+            result = SRecReaderIndexLoadTable(srecHandle, &srecHandle->readIndex,
+                                              checkpointCount);
+          }
+        }
+      }
+      /* Close the sidecar file. */
+      (void)f_close(&srecHandle->indexFile);
+    }
+  }
+
+  /* Double-check that the segments and checkpoints are still located where the
+   * sidecar file says.
+   */
+  if (result == TBX_TRUE)
+  {
+    result = SRecReaderIndexCheckTable(srecHandle, &srecHandle->segmentTable);
+  }
+  if (result == TBX_TRUE)
+  {
+    result = SRecReaderIndexCheckTable(srecHandle, &srecHandle->readIndex);
+  }
+
+  /* Discard the segments and checkpoints that were possibly already added, if the
+   * segment information could not be completely loaded.
+   */
+  if (result != TBX_TRUE)
+  {
+    SegTableClear(&srecHandle->segmentTable);
+    SegTableClear(&srecHandle->readIndex);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexLoad ***/
+
+
+#if (_FS_READONLY == 0)
+/************************************************************************************//**
+** \brief     Stores the segment information and the read index of the firmware file in
+**            its segment index sidecar file, together with the fingerprint of the
+**            firmware file. Errors are not reported, because the sidecar file is just a
+**            cache. A partially written sidecar file is removed.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     firmwareFile Firmware filename including its full path.
+**
+****************************************************************************************/
+static void SRecReaderIndexSave(tSRecHandle * srecHandle, char const * firmwareFile)
+{
+  uint8_t   writeOk = TBX_FALSE;
+  FILINFO   fileInfo;
+  UINT      bytesWritten;
+  uint8_t * record = srecHandle->lineDataBuf;
+  uint32_t  contentCrc = 0U;
+
+  /* Obtain the fingerprint of the firmware file and create the sidecar file. Note that
+   * the name of the sidecar file is stored in the line buffer.
+   */
+  if ( (SRecReaderIndexSetFileName(srecHandle, firmwareFile) == TBX_OK) &&
+       (f_stat(firmwareFile, &fileInfo) == FR_OK) &&
+       (SRecReaderIndexGetContentCrc(srecHandle, fileInfo.fsize,
+                                     &contentCrc) == TBX_OK) )
+  {
+    if (f_open(&srecHandle->indexFile, srecHandle->lineBuf,
+               FA_CREATE_ALWAYS | FA_WRITE) == FR_OK)
+    {
+      /* Construct and write the header record. */
+      SRecReaderIndexSetLong(SREC_INDEX_MAGIC, &record[0]);
+      SRecReaderIndexSetLong((uint32_t)fileInfo.fsize, &record[4]);
+      SRecReaderIndexSetLong(((uint32_t)fileInfo.fdate << 16U) | fileInfo.ftime,
+                             &record[8]);
+      SRecReaderIndexSetLong(contentCrc, &record[12]);
+      SRecReaderIndexSetLong(SegTableGetCount(&srecHandle->segmentTable), &record[16]);
+      SRecReaderIndexSetLong(SREC_READ_INDEX_INTERVAL, &record[20]);
+      SRecReaderIndexSetLong(SegTableGetCount(&srecHandle->readIndex), &record[24]);
+      SRecReaderIndexSetCrc(record, SREC_INDEX_HEADER_SIZE);
+      if ( (f_write(&srecHandle->indexFile, record, SREC_INDEX_HEADER_SIZE,
+                    &bytesWritten) == FR_OK) &&
+           (bytesWritten == SREC_INDEX_HEADER_SIZE) )
+      {
+        writeOk = TBX_TRUE;
+      }
+      /* Write a record for each segment, followed by one for each checkpoint. */
+      if (writeOk == TBX_TRUE)
+      {
+        writeOk = SRecReaderIndexSaveTable(srecHandle, &srecHandle->segmentTable);
+      }
+      if (writeOk == TBX_TRUE)
+      {
+        writeOk = SRecReaderIndexSaveTable(srecHandle, &srecHandle->readIndex);
+      }
+      /* Close the sidecar file. */
+      if (f_close(&srecHandle->indexFile) != FR_OK)
+      {
+        writeOk = TBX_FALSE;
+      }
+      /* Remove the sidecar file, if it could not be completely written. */
+      if (writeOk != TBX_TRUE)
+      {
+        (void)f_unlink(srecHandle->lineBuf);
+      }
+    }
+  }
+} /*** end of SRecReaderIndexSave ***/
+
+
+/************************************************************************************//**
+** \brief     Writes a record to the opened segment index sidecar file, for each entry
+**            in a segment table.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     table The segment table.
+** \return    TBX_TRUE if all records were written, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexSaveTable(tSRecHandle * srecHandle,
+                                        tSegTable const * table)
+{
+  uint8_t          result = TBX_TRUE;
+  UINT             bytesWritten;
+  uint8_t        * record = srecHandle->lineDataBuf;
+  uint32_t         segmentIdx = 0U;
+  tSegment const * segment;
+
+  /* Construct and write a record for each entry. */
+  segment = SegTableGet(table, segmentIdx);
+  while ( (segment != NULL) && (result == TBX_TRUE) )
+  {
+    SRecReaderIndexSetLong(segment->addr, &record[0]);
+    SRecReaderIndexSetLong(segment->len, &record[4]);
+    SRecReaderIndexSetLong((uint32_t)segment->fptr, &record[8]);
+    SRecReaderIndexSetCrc(record, SREC_INDEX_SEGMENT_SIZE);
+    if ( (f_write(&srecHandle->indexFile, record, SREC_INDEX_SEGMENT_SIZE,
+                  &bytesWritten) != FR_OK) ||
+         (bytesWritten != SREC_INDEX_SEGMENT_SIZE) )
+    {
+      result = TBX_FALSE;
+    }
+    /* Continue with the next entry. */
+    segmentIdx++;
+    segment = SegTableGet(table, segmentIdx);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexSaveTable ***/
+#endif /* (_FS_READONLY == 0) */
+
+
+/************************************************************************************//**
+** \brief     Reads records from the opened segment index sidecar file and adds them to
+**            a segment table.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     table The segment table.
+** \param     count Number of records to read.
+** \return    TBX_TRUE if all records were read and added, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexLoadTable(tSRecHandle * srecHandle, tSegTable * table,
+                                        uint32_t count)
+{
+  uint8_t   result = TBX_TRUE;
+  UINT      bytesRead;
+  uint8_t * record = srecHandle->lineDataBuf;
+  uint32_t  recordIdx;
+
+  /* Read the records and add their entries to the table. */
+  for (recordIdx = 0U; (recordIdx < count) && (result == TBX_TRUE); recordIdx++)
+  {
+    if ( (f_read(&srecHandle->indexFile, record, SREC_INDEX_SEGMENT_SIZE,
+                 &bytesRead) != FR_OK) ||
+         (bytesRead != SREC_INDEX_SEGMENT_SIZE) ||
+         (SRecReaderIndexCheckCrc(record, SREC_INDEX_SEGMENT_SIZE) != TBX_OK) )
+    {
+      /* Sidecar file is truncated or corrupt. */
+      result = TBX_FALSE;
+    }
+    else if (SegTableInsert(table, SRecReaderIndexGetLong(&record[0]),
+                            SRecReaderIndexGetLong(&record[4]),
+                            (FSIZE_t)SRecReaderIndexGetLong(&record[8]), 0U) != TBX_OK)
+    {
+      /* Could not allocate memory for the entry. */
+      result = TBX_FALSE;
+    }
+    else
+    {
+      /* Entry added. Continue with the next one. */
+    }
+  }
+  /* The entries were stored in order, but make sure they do not overlap. */
+  if ( (result == TBX_TRUE) && (SegTableSort(table) != TBX_OK) )
+  {
+    result = TBX_FALSE;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexLoadTable ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the CRC32 over the first and the last
+**            SREC_INDEX_FINGERPRINT_SIZE bytes of the firmware file. The file is read
+**            directly, bypassing the line reader. Afterwards, the line reader restarts
+**            at the start of the file.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     fileSize Size of the firmware file in bytes.
+** \param     crc The CRC32 is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexGetContentCrc(tSRecHandle * srecHandle,
+                                            FSIZE_t fileSize, uint32_t * crc)
+{
+  uint8_t   result = TBX_OK;
+  tChecksum checksum;
+  FSIZE_t   fptr = 0U;
+  FSIZE_t   tailStart = SREC_INDEX_FINGERPRINT_SIZE;
+  FSIZE_t   chunkEnd;
+  UINT      chunkLen;
+  UINT      bytesRead;
+
+  /* Determine where the tail part starts. If the file is not larger than both parts
+   * together, the tail part simply continues where the head part ends.
+   */
+  if (fileSize > (2U * (FSIZE_t)SREC_INDEX_FINGERPRINT_SIZE))
+  {
+    tailStart = fileSize - SREC_INDEX_FINGERPRINT_SIZE;
+  }
+  (void)ChecksumInit(&checksum, CHECKSUM_TYPE_CRC_32, PortGet());
+
+  /* Feed the head part and the tail part of the file to the CRC32 calculation, one
+   * chunk at a time. The data buffer is not in use while the file is being opened.
+   */
+  while ( (fptr < fileSize) && (result == TBX_OK) )
+  {
+    /* Skip the bytes in between the head part and the tail part. */
+    if ( (fptr >= SREC_INDEX_FINGERPRINT_SIZE) && (fptr < tailStart) )
+    {
+      fptr = tailStart;
+    }
+    /* A chunk does not extend past the end of the head part or of the file. */
+    chunkEnd = fileSize;
+    if ( (fptr < SREC_INDEX_FINGERPRINT_SIZE) &&
+         (SREC_INDEX_FINGERPRINT_SIZE < fileSize) )
+    {
+      chunkEnd = SREC_INDEX_FINGERPRINT_SIZE;
+    }
+    chunkLen = SREC_DATA_BUFFER_SIZE;
+    if ((chunkEnd - fptr) < chunkLen)
+    {
+      chunkLen = (UINT)(chunkEnd - fptr);
+    }
+    /* Read the chunk and add it to the CRC32. */
+    if ( (f_lseek(&srecHandle->file, fptr) != FR_OK) ||
+         (f_read(&srecHandle->file, srecHandle->dataBuf, chunkLen,
+                 &bytesRead) != FR_OK) ||
+         (bytesRead != chunkLen) )
+    {
+      result = TBX_ERROR;
+    }
+    else
+    {
+      ChecksumUpdate(&checksum, srecHandle->dataBuf, chunkLen);
+      fptr += chunkLen;
+    }
+  }
+  *crc = ChecksumGetResult(&checksum);
+
+  /* Move the file pointer back to the start and restart the line reader there. */
+  if (f_lseek(&srecHandle->file, 0U) != FR_OK)
   {
-    /* Compare the segments based on its base address. */
-    if (segment1->addr > segment2->addr)
+    result = TBX_ERROR;
+  }
+  LineReaderInit(&srecHandle->lineReader, &srecHandle->file);
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexGetContentCrc ***/
+
+
+/************************************************************************************//**
+** \brief     Verifies that the line at the file pointer of each entry in a segment
+**            table, is an S-record with data for the entry's base address. This detects
+**            a segment index that no longer matches the firmware file, when the content
+**            CRC32 does not cover the changed part of the file. Afterwards, the line
+**            reader restarts at the start of the file.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     table The segment table, so the segments or the read index checkpoints.
+** \return    TBX_TRUE if all entries start at their file pointer, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexCheckTable(tSRecHandle * srecHandle,
+                                         tSegTable const * table)
+{
+  uint8_t          result = TBX_TRUE;
+  uint32_t         segmentIdx = 0U;
+  tSegment const * segment;
+  uint32_t         lineAddress = 0U;
+  uint8_t          lineDataLen = 0U;
+
+  /* Check the first line of each entry. */
+  segment = SegTableGet(table, segmentIdx);
+  while ( (segment != NULL) && (result == TBX_TRUE) )
+  {
+    if ( (LineReaderSeek(&srecHandle->lineReader, segment->fptr) != TBX_OK) ||
+         (LineReaderGets(&srecHandle->lineReader, srecHandle->lineBuf,
+                         SREC_LINE_BUFFER_SIZE) == NULL) ||
+         (SRecReaderParseLine(srecHandle->lineBuf, &lineAddress, &lineDataLen,
+                              NULL) != TBX_OK) ||
+         (lineDataLen == 0U) || (lineAddress != segment->addr) )
     {
-      result = TBX_TRUE;
+      /* Not the first line of the entry. */
+      result = TBX_FALSE;
     }
+    /* Continue with the next entry. */
+    segmentIdx++;
+    segment = SegTableGet(table, segmentIdx);
+  }
+
+  /* Restart the line reader at the start of the file. */
+  if (LineReaderSeek(&srecHandle->lineReader, 0U) != TBX_OK)
+  {
+    result = TBX_FALSE;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexCheckTable ***/
+
+
+/************************************************************************************//**
+** \brief     Constructs the name of the segment index sidecar file, by appending its
+**            extension to the name of the firmware file. The name is stored in the
+**            line buffer, which is not in use while the segment index is loaded or
+**            saved.
+** \param     srecHandle Pointer to the S-record file handle.
+** \param     firmwareFile Firmware filename including its full path.
+** \return    TBX_OK if successful, TBX_ERROR if the name does not fit.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexSetFileName(tSRecHandle * srecHandle,
+                                          char const * firmwareFile)
+{
+  uint8_t            result = TBX_ERROR;
+  char       const * ext = SREC_INDEX_FILE_EXT;
+  uint16_t           idx = 0U;
+  uint16_t           extIdx = 0U;
+
+  /* Copy the firmware file name. */
+  while ( (firmwareFile[idx] != '\0') && (idx < (SREC_LINE_BUFFER_SIZE - 1U)) )
+  {
+    srecHandle->lineBuf[idx] = firmwareFile[idx];
+    idx++;
+  }
+  /* Append the extension. */
+  while ( (ext[extIdx] != '\0') && (idx < (SREC_LINE_BUFFER_SIZE - 1U)) )
+  {
+    srecHandle->lineBuf[idx] = ext[extIdx];
+    idx++;
+    extIdx++;
+  }
+  /* Terminate the string. */
+  srecHandle->lineBuf[idx] = '\0';
+  /* Only successful if the complete name fit. */
+  if ( (firmwareFile[idx - extIdx] == '\0') && (ext[extIdx] == '\0') )
+  {
+    result = TBX_OK;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of SRecReaderIndexSetFileName ***/
+
+
+/************************************************************************************//**
+** \brief     Stores a 32-bit value in a byte array, in little endian byte order. This
+**            keeps the sidecar file independent of the byte order of the CPU.
+** \param     value The 32-bit value to store.
+** \param     data Byte array to store the value in. It must be at least 4 bytes long.
+**
+****************************************************************************************/
+static void SRecReaderIndexSetLong(uint32_t value, uint8_t * data)
+{
+  data[0] = (uint8_t)value;
+  data[1] = (uint8_t)(value >> 8U);
+  data[2] = (uint8_t)(value >> 16U);
+  data[3] = (uint8_t)(value >> 24U);
+} /*** end of SRecReaderIndexSetLong ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a 32-bit value from a byte array, in little endian byte order.
+** \param     data Byte array to read the value from. It must be at least 4 bytes long.
+** \return    The 32-bit value.
+**
+****************************************************************************************/
+static uint32_t SRecReaderIndexGetLong(uint8_t const * data)
+{
+  return (uint32_t)data[0] | ((uint32_t)data[1] << 8U) |
+         ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+} /*** end of SRecReaderIndexGetLong ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the CRC16 of a sidecar file record and stores it in the last two
+**            bytes of the record.
+** \param     record Byte array with the record.
+** \param     len Total number of bytes in the record, including the two CRC16 bytes.
+**
+****************************************************************************************/
+static void SRecReaderIndexSetCrc(uint8_t * record, uint8_t len)
+{
+  uint16_t crc;
+
+  crc = TbxChecksumCrc16Calculate(record, (size_t)len - 2U);
+  record[len - 2U] = (uint8_t)crc;
+  record[len - 1U] = (uint8_t)(crc >> 8U);
+} /*** end of SRecReaderIndexSetCrc ***/
+
+
+/************************************************************************************//**
+** \brief     Verifies the CRC16, which is stored in the last two bytes of a sidecar file
+**            record.
+** \param     record Byte array with the record.
+** \param     len Total number of bytes in the record, including the two CRC16 bytes.
+** \return    TBX_OK if the CRC16 is correct, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t SRecReaderIndexCheckCrc(uint8_t const * record, uint8_t len)
+{
+  uint8_t  result = TBX_ERROR;
+  uint16_t crc;
+
+  crc = TbxChecksumCrc16Calculate(record, (size_t)len - 2U);
+  if ( (record[len - 2U] == (uint8_t)crc) && (record[len - 1U] == (uint8_t)(crc >> 8U)) )
+  {
+    result = TBX_OK;
   }
 
   /* Give the result back to the caller. */
   return result;
-} /*** end of SRecReaderCompareSegments ***/
+} /*** end of SRecReaderIndexCheckCrc ***/
+#endif /* (SREC_INDEX_CACHE_ENABLE > 0U) */
 
 
 /************************************************************************************//**
@@ -769,8 +1495,11 @@ static uint8_t SRecReaderParseLine(char const * line, uint32_t * address,
   uint8_t       result = TBX_ERROR;
   tSRecLineType lineType;
   uint8_t       charIdx = 2U; /* Point to the byte count value. */
-  uint8_t       dataByteIdx;
-  uint8_t       bytesOnLine;
+  uint8_t       byteIdx;
+  uint8_t       bytesOnLine = 0U;
+  uint8_t       addressLen = 0U;
+  uint8_t       byteValue = 0U;
+  uint8_t       checksum;
 
   /* Verify parameters. Note that a NULL pointer for data is allowed. */
   TBX_ASSERT((line != NULL) && (address != NULL) && (len != NULL));
@@ -782,132 +1511,104 @@ static uint8_t SRecReaderParseLine(char const * line, uint32_t * address,
      * value upon detection of a problem.
      */
     result = TBX_OK;
-    /* Determine the s-record line type. */
-    lineType = SRecReaderGetLineType(line);
-    /* Verify the checksum on the line. Note that this is only needed for S1, S2 and S3
-     * line types, because those are the only ones this function will extract data from.
+    /* Determine the s-record line type. The S1, S2 and S3 lines differ in the amount of
+     * bytes for the memory address.
      */
-    if (lineType != LINE_TYPE_UNSUPPORTED)
+    lineType = SRecReaderGetLineType(line);
+    switch (lineType)
     {
-      if (SRecReaderVerifyChecksum(line) != TBX_OK)
-      {
-        /* Flag error due to incorrect checksum on the s-record line. */
-        result = TBX_ERROR;
-      }
+      case LINE_TYPE_S1:
+        addressLen = 2U;
+        break;
+      case LINE_TYPE_S2:
+        addressLen = 3U;
+        break;
+      case LINE_TYPE_S3:
+        addressLen = 4U;
+        break;
+      case LINE_TYPE_UNSUPPORTED:
+      default:
+        /* Not a line type with data to extract. This is not an error, but there is
+         * just no data to extract. Therefore set the data length to 0 so that the
+         * caller knows there was no data to extract.
+         */
+        *len = 0U;
+        break;
     }
 
-    /* Only continue with a valid checksum on the S1, S2 or S3 line. */
-    if (result == TBX_OK)
+    /* Only continue with an S1, S2 or S3 line. The bytes on the line are decoded in a
+     * single pass, which extracts the address and data, while calculating the checksum.
+     */
+    if (addressLen > 0U)
     {
-      /* The S1, S2 and S3 lines differ in the amount of bytes for the memory address.
-       * Therefore, filter on the line type to correctly extract the memory address.
+      /* Read out the number of bytes that follow on the line. The number of bytes must
+       * be larger than the number of address bytes plus one for the checksum.
        */
-      switch (lineType)
+      if ( (LineReaderHexStringToByte(&line[charIdx], &bytesOnLine) != TBX_OK) ||
+           (bytesOnLine <= (addressLen + 1U)) )
       {
-        case LINE_TYPE_S1:
-          /* Read out the number of bytes that follow on the line. */
-          bytesOnLine = SRecReaderHexStringToByte(&line[charIdx]);
-          /* Set the character index to point to the start of the memory address. */
-          charIdx += 2U;
-          /* Extract the 16-bit memory address. */
-          *address = (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 8U;
+        /* Invalid byte count detected on the line. Flag error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        /* Checksum starts with the byte count. */
+        checksum = bytesOnLine;
+        /* Extract the memory address, which is stored in big endian byte order. */
+        *address = 0U;
+        for (byteIdx = 0U; (byteIdx < addressLen) && (result == TBX_OK); byteIdx++)
+        {
           /* Move character index two characters forward to the next byte. */
           charIdx += 2U;
-          *address += SRecReaderHexStringToByte(&line[charIdx]);
-          /* The number of bytes on the line must be > 3 (2 for address + 1 for cs. */
-          if (bytesOnLine > 3U)
+          if (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK)
           {
-            /* Set the data byte length, so the number of data bytes to extract. */
-            *len = bytesOnLine - 3U;
+            /* Invalid character detected on the line. Flag error. */
+            result = TBX_ERROR;
           }
           else
           {
-            /* Invalid byte count detected on the line. Flag error. */
-            result = TBX_ERROR;
+            *address = (*address << 8U) | byteValue;
+            checksum += byteValue;
           }
-          break;
-        case LINE_TYPE_S2:
-          /* Read out the number of bytes that follow on the line. */
-          bytesOnLine = SRecReaderHexStringToByte(&line[charIdx]);
-          /* Set the character index to point to the start of the memory address. */
-          charIdx += 2U;
-          /* Extract the 24-bit memory address. */
-          *address = (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 16U;
-          /* Move character index two characters forward to the next byte. */
-          charIdx += 2U;
-          *address += (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 8U;
+        }
+        /* Set the data byte length, so the number of data bytes to extract. */
+        *len = bytesOnLine - addressLen - 1U;
+        /* Extract the data bytes. Skip the copying if a NULL pointer was passed for
+         * data. Note that the data bytes still need to be decoded for the checksum.
+         */
+        for (byteIdx = 0U; (byteIdx < *len) && (result == TBX_OK); byteIdx++)
+        {
           /* Move character index two characters forward to the next byte. */
           charIdx += 2U;
-          *address += SRecReaderHexStringToByte(&line[charIdx]);
-          /* The number of bytes on the line must be > 4 (3 for address + 1 for cs. */
-          if (bytesOnLine > 4U)
+          if (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK)
           {
-            /* Set the data byte length, so the number of data bytes to extract. */
-            *len = bytesOnLine - 4U;
+            /* Invalid character detected on the line. Flag error. */
+            result = TBX_ERROR;
           }
           else
           {
-            /* Invalid byte count detected on the line. Flag error. */
-            result = TBX_ERROR;
+            checksum += byteValue;
+            if (data != NULL)
+            {
+              data[byteIdx] = byteValue;
+            }
           }
-          break;
-        case LINE_TYPE_S3:
-          /* Read out the number of bytes that follow on the line. */
-          bytesOnLine = SRecReaderHexStringToByte(&line[charIdx]);
-          /* Set the character index to point to the start of the memory address. */
-          charIdx += 2U;
-          /* Extract the 32-bit memory address. */
-          *address = (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 24U;
-          /* Move character index two characters forward to the next byte. */
-          charIdx += 2U;
-          *address += (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 16U;
-          /* Move character index two characters forward to the next byte. */
-          charIdx += 2U;
-          *address += (uint32_t)SRecReaderHexStringToByte(&line[charIdx]) << 8U;
-          /* Move character index two characters forward to the next byte. */
+        }
+        /* Only continue if all bytes were successfully decoded. */
+        if (result == TBX_OK)
+        {
+          /* The checksum is calculated by summing up the values of the byte count,
+           * address and databytes and then taking the 1-complement of the sum's least
+           * significant byte. Verify it with the one at the end of the line.
+           */
+          checksum = ~checksum;
           charIdx += 2U;
-          *address += SRecReaderHexStringToByte(&line[charIdx]);
-          /* The number of bytes on the line must be > 5 (4 for address + 1 for cs. */
-          if (bytesOnLine > 5U)
-          {
-            /* Set the data byte length, so the number of data bytes to extract. */
-            *len = bytesOnLine - 5U;
-          }
-          else
+          if ( (LineReaderHexStringToByte(&line[charIdx], &byteValue) != TBX_OK) ||
+               (checksum != byteValue) )
           {
-            /* Invalid byte count detected on the line. Flag error. */
+            /* Flag error due to incorrect checksum on the s-record line. */
             result = TBX_ERROR;
           }
-          break;
-        case LINE_TYPE_UNSUPPORTED:
-        default:
-          /* Not a line type with data to extract. This is not an error, but there is
-           * just no data to extract. Therefore set the data length to 0 so that the
-           * caller knows there was no data to extract.
-           */
-          *len = 0U;
-          break;
-      }
-    }
-
-    /* Only continue if all is okay so far. This means a properly extracted memory
-     * address in the case of an S1, S2 or S3 line, or a valid unsupported line type in
-     * which case the length is set to 0.
-     */
-    if (result == TBX_OK)
-    {
-      /* Skip the data extraction and copying if a NULL pointer was passed for data. */
-      if (data != NULL)
-      {
-        /* Extract and copy the data bytes. Note that in the case of
-         * LINE_TYPE_UNSUPPORTED, len is set to 0, so nothing is actually copied.
-         */
-        for (dataByteIdx = 0U; dataByteIdx < *len; dataByteIdx++)
-        {
-          /* Move character index two characters forward to the next byte. */
-          charIdx += 2U;
-          /* Extract the byte value and store it in the data buffer. */
-          data[dataByteIdx] = SRecReaderHexStringToByte(&line[charIdx]);
         }
       }
     }
@@ -962,130 +1663,4 @@ static tSRecLineType SRecReaderGetLineType(char const * line)
 } /*** end of SRecReaderGetLineType ***/
 
 
-/************************************************************************************//**
-** \brief     Inspects an S1, S2 or S3 line from a Motorola S-Record file to
-**            determine if the checksum at the end is corrrect.
-** \param     line An S1, S2 or S3 line from the S-Record.
-** \return    TBX_OK if the checksum is correct, TBX_ERROR otherwise.
-**
-****************************************************************************************/
-static uint8_t SRecReaderVerifyChecksum(char const * line)
-{
-  uint8_t result = TBX_ERROR;
-  uint8_t bytesOnLine;
-  uint8_t checksum;
-  uint8_t charIdx;
-
-  /* Verify parameter. */
-  TBX_ASSERT(line != NULL);
-
-  /* Only continue with valid parameter. */
-  if (line != NULL)
-  {
-    /* Adjust index to point to byte count value. */
-    charIdx = 2U;
-    /* Read out the number of byte values that follow on the line. */
-    bytesOnLine = SRecReaderHexStringToByte(&line[charIdx]);
-    /* Checksum starts with the byte count. */
-    checksum = bytesOnLine;
-    /* Adjust index to the first byte of the address. */
-    charIdx += 2U;
-    /* Add byte values of address and data, but not the final checksum. */
-    do
-    {
-      /* Add the next byte value to the checksum. */
-      checksum += SRecReaderHexStringToByte(&line[charIdx]);
-      /* Update counter. */
-      bytesOnLine--;
-      /* Point to next hex string in the line. */
-      charIdx += 2U;
-    }
-    while (bytesOnLine > 1U);
-    /* The checksum is calculated by summing up the values of the byte count, address and
-     * databytes and then taking the 1-complement of the sum's least significant byte.
-     */
-    checksum = ~checksum;
-
-    /* Finally verify the calculated checksum with the one at the end of the line. */
-    if (checksum == SRecReaderHexStringToByte(&line[charIdx]))
-    {
-      /* Checksum correct so update the result. */
-      result = TBX_OK;
-    }
-  }
-
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of SRecReaderVerifyChecksum ***/
-
-
-/************************************************************************************//**
-** \brief     Helper function to convert a sequence of 2 characters that represent
-**            a hexadecimal value to the actual byte value.
-**              Example: SRecReaderHexStringToByte("2f")  --> returns 47.
-** \param     hexstring String beginning with 2 characters that represent a hexa-
-**            decimal value.
-** \return    The resulting byte value.
-**
-****************************************************************************************/
-static uint8_t SRecReaderHexStringToByte(char const * hexstring)
-{
-  uint8_t result = 0U;
-  /* Conversion table to convert a hexadecimal ASCII character to its 4-bit value. Note
-   * that there are more efficient ways of doing this conversion, for example by
-   * deducting '0' from the character value. However, MISRA does not allow typecasting
-   * a character into an integer type. Note that this constant table was made static
-   * to lower the stack load.
-   */
-  static const struct
-  {
-    char    c;
-    uint8_t b;
-  } hexConvTbl[] =
-  {
-    { '0', 0  }, { '1', 1  },  { '2', 2  },  { '3', 3  },
-    { '4', 4  }, { '5', 5  },  { '6', 6  },  { '7', 7  },
-    { '8', 8  }, { '9', 9  },  { 'a', 10 },  { 'A', 10 },
-    { 'b', 11 }, { 'B', 11 },  { 'c', 12 },  { 'C', 12 },
-    { 'd', 13 }, { 'D', 13 },  { 'e', 14 },  { 'E', 14 },
-    { 'f', 15 }, { 'F', 15 }
-  };
-  uint8_t loopCnt;
-  uint8_t tblIdx;
-  uint8_t nibbles[2];
-
-  /* Verify parameter. */
-  TBX_ASSERT(hexstring != NULL);
-
-  /* Only continue with valid parameter. */
-  if (hexstring != NULL)
-  {
-    /* Loop through both hexadecimal characters to convert them to their respective
-     * 4-bit value.
-     */
-    for (loopCnt = 0U; loopCnt < (sizeof(nibbles)/sizeof(nibbles[0])); loopCnt++)
-    {
-      /* Convert the hexadecimal ASCII character to its 4-bit value. */
-      nibbles[loopCnt] = 0;
-      for (tblIdx = 0U; tblIdx < (sizeof(hexConvTbl)/sizeof(hexConvTbl[0])); tblIdx++)
-      {
-        /* Is this the hexadecimal ASCII character to convert. */
-        if (hexConvTbl[tblIdx].c == hexstring[loopCnt])
-        {
-          /* Store its 4-bit value in the nibbles array. */
-          nibbles[loopCnt] = hexConvTbl[tblIdx].b;
-          /* Done converting this hexadecimal ASCII character. */
-          break;
-        }
-      }
-    }
-    /* Construct the actual resulting byte value from the nibbles. */
-    result = (uint8_t)(nibbles[0] << 4) + nibbles[1];
-  }
-
-  /* Give the resuts back to the caller. */
-  return result;
-} /*** end of SRecReaderHexStringToByte ***/
-
-
 /*********************************** end of srecreader.c *******************************/
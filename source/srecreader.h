@@ -47,6 +47,46 @@
 extern "C" {
 #endif
 
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Enables the segment index cache. When enabled, the segment information and
+ *         the read index that are collected when opening a firmware file, are stored
+ *         in a sidecar file with the same name and an additional ".idx" extension. The
+ *         next time the same, unchanged firmware file is opened, they are loaded from
+ *         the sidecar file, instead of scanning the entire firmware file. Requires a
+ *         FatFS configuration with long file names and without _FS_MINIMIZE. The
+ *         sidecar file can only be written if _FS_READONLY is 0.
+ */
+#ifndef SREC_INDEX_CACHE_ENABLE
+#define SREC_INDEX_CACHE_ENABLE        (0U)
+#endif
+
+/** \brief Number of bytes at the start and at the end of the firmware file, over which
+ *         the segment index cache calculates a CRC32. This CRC32 is part of the
+ *         fingerprint of the firmware file, next to its size, date and time. Without a
+ *         real-time clock, FatFS gives all files the same date and time, so the content
+ *         CRC32 is what detects a replaced file of the same size. Set it to at least
+ *         half the size of the firmware file, to cover its entire contents, at the
+ *         expense of reading the entire file each time it is opened.
+ */
+#ifndef SREC_INDEX_FINGERPRINT_SIZE
+#define SREC_INDEX_FINGERPRINT_SIZE    (4096U)
+#endif
+
+/** \brief Maximum number of firmware data bytes between two checkpoints of the read
+ *         index. The read index is built when opening a firmware file and stores the
+ *         file pointer of a line for every so many bytes of firmware data. Reading data
+ *         at a specific memory address then only needs to parse the lines starting at
+ *         the checkpoint before it. A smaller value speeds up reading, at the expense of
+ *         more RAM for the read index. Set it to 0 to disable the read index. Reading
+ *         then starts at the first line of the segment.
+ */
+#ifndef SREC_READ_INDEX_INTERVAL
+#define SREC_READ_INDEX_INTERVAL       (4096U)
+#endif
+
+
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
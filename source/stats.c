@@ -0,0 +1,530 @@
+/************************************************************************************//**
+* \file         stats.c
+* \brief        Statistics source file.
+* \ingroup      Stats
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
+
+
+#if (STATS_ENABLE > 0U)
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Size of the buffer for formatting one line of the trace dump. */
+#define STATS_LINE_SIZE                (64U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static tStatsCommand * StatsGetCommandSlot(tStatsContext * context, uint8_t command);
+#if (STATS_TRACE_SIZE > 0U)
+static uint8_t         StatsFormatNumber(char * buffer, uint32_t value, uint8_t base,
+                                         uint8_t minDigits);
+#endif
+#endif
+
+
+/************************************************************************************//**
+** \brief     Initializes a statistics context and resets its statistics.
+** \param     context The statistics context.
+** \param     port The port that offers the time reference for the measurements.
+**
+****************************************************************************************/
+void StatsInit(tStatsContext * context, tPort const * port)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (port != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (port != NULL))
+  {
+    /* Link the port and start with empty statistics. */
+    context->port = port;
+    StatsReset(context);
+  }
+} /*** end of StatsInit ***/
+
+
+/************************************************************************************//**
+** \brief     Resets all collected statistics and empties the trace ring buffer.
+** \param     context The statistics context.
+**
+****************************************************************************************/
+void StatsReset(tStatsContext * context)
+{
+#if (STATS_ENABLE > 0U)
+  uint8_t slotIdx;
+  uint8_t binIdx;
+
+  /* Verify parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
+  {
+    TbxCriticalSectionEnter();
+    for (slotIdx = 0U; slotIdx < STATS_COMMAND_SLOTS; slotIdx++)
+    {
+      context->info.commands[slotIdx].command = 0U;
+      context->info.commands[slotIdx].count = 0U;
+      context->info.commands[slotIdx].negatives = 0U;
+      context->info.commands[slotIdx].timeouts = 0U;
+      context->info.commands[slotIdx].txBytes = 0U;
+      context->info.commands[slotIdx].rxBytes = 0U;
+      context->info.commands[slotIdx].latencyCount = 0U;
+      context->info.commands[slotIdx].latencyMin = 0U;
+      context->info.commands[slotIdx].latencyMax = 0U;
+      context->info.commands[slotIdx].latencySum = 0U;
+      for (binIdx = 0U; binIdx < STATS_HISTOGRAM_SIZE; binIdx++)
+      {
+        context->info.commands[slotIdx].histogram[binIdx] = 0U;
+      }
+    }
+    context->info.commandCount = 0U;
+    context->info.eraseTime = 0U;
+    context->info.programTime = 0U;
+    context->info.parseTime = 0U;
+#if (STATS_TRACE_SIZE > 0U)
+    context->traceHead = 0U;
+    context->traceCount = 0U;
+#endif
+    TbxCriticalSectionExit();
+  }
+#else
+  /* Statistics are disabled. */
+  (void)context;
+#endif
+} /*** end of StatsReset ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains a copy of the collected statistics.
+** \param     context The statistics context.
+** \param     stats Pointer to where the statistics are copied to. When the collection
+**            of statistics is disabled, only the number of used command slots and the
+**            totals are set, all to zero.
+**
+****************************************************************************************/
+void StatsGet(tStatsContext const * context, tStats * stats)
+{
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (stats != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((context != NULL) && (stats != NULL))
+  {
+#if (STATS_ENABLE > 0U)
+    /* Copy the statistics as a whole, such that they are consistent. */
+    TbxCriticalSectionEnter();
+    *stats = context->info;
+    TbxCriticalSectionExit();
+#else
+    /* Nothing was collected. */
+    stats->commandCount = 0U;
+    stats->eraseTime = 0U;
+    stats->programTime = 0U;
+    stats->parseTime = 0U;
+#endif
+  }
+} /*** end of StatsGet ***/
+
+
+/************************************************************************************//**
+** \brief     Writes the contents of the trace ring buffer to a file, from the oldest to
+**            the newest entry. The file is formatted as comma separated values, with a
+**            header line followed by one line per packet exchange: transmit time in
+**            ms, command code in hexadecimal, result (STATS_RESULT_xxx), round-trip
+**            latency in ms and the number of bytes in the sent and received packets.
+** \param     context The statistics context.
+** \param     file Path of the file to create. An existing file is overwritten.
+** \return    TBX_OK if successful, TBX_ERROR if tracing is disabled or the file could
+**            not be written.
+**
+****************************************************************************************/
+uint8_t StatsTraceDump(tStatsContext const * context, char const * file)
+{
+  uint8_t          result = TBX_ERROR;
+#if (STATS_ENABLE > 0U) && (STATS_TRACE_SIZE > 0U)
+  FIL              fileHandle;
+  UINT             bytesWritten = 0U;
+  tStatsTraceEntry entry;
+  uint32_t         entryIdx;
+  uint32_t         entryCount;
+  uint32_t         firstIdx;
+  char             line[STATS_LINE_SIZE];
+  uint8_t          lineLen;
+  static const char header[] = "time,command,result,latency,txLen,rxLen\n";
+
+  /* Verify parameters. */
+  TBX_ASSERT((context != NULL) && (file != NULL));
+
+  /* Only continue with valid parameters and if the file could be created. */
+  if ((context != NULL) && (file != NULL))
+  {
+    if (f_open(&fileHandle, file, FA_CREATE_ALWAYS | FA_WRITE) == FR_OK)
+    {
+      /* Set a positive result and only negate upon error detection from here on. */
+      result = TBX_OK;
+      /* Write the header line. Note that the terminating null character is excluded. */
+      if (f_write(&fileHandle, header, sizeof(header) - 1U, &bytesWritten) != FR_OK)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      /* Determine the oldest entry. */
+      TbxCriticalSectionEnter();
+      entryCount = context->traceCount;
+      firstIdx = (context->traceHead + STATS_TRACE_SIZE - context->traceCount) %
+                 STATS_TRACE_SIZE;
+      TbxCriticalSectionExit();
+      /* Write one line per entry. */
+      for (entryIdx = 0U; (entryIdx < entryCount) && (result == TBX_OK); entryIdx++)
+      {
+        /* Copy the entry, such that it is consistent. */
+        TbxCriticalSectionEnter();
+        entry = context->trace[(firstIdx + entryIdx) % STATS_TRACE_SIZE];
+        TbxCriticalSectionExit();
+        /* Format the line. */
+        lineLen = StatsFormatNumber(&line[0], entry.time, 10U, 1U);
+        line[lineLen] = ',';
+        lineLen++;
+        lineLen += StatsFormatNumber(&line[lineLen], entry.command, 16U, 2U);
+        line[lineLen] = ',';
+        lineLen++;
+        lineLen += StatsFormatNumber(&line[lineLen], entry.result, 10U, 1U);
+        line[lineLen] = ',';
+        lineLen++;
+        lineLen += StatsFormatNumber(&line[lineLen], entry.latency, 10U, 1U);
+        line[lineLen] = ',';
+        lineLen++;
+        lineLen += StatsFormatNumber(&line[lineLen], entry.txLen, 10U, 1U);
+        line[lineLen] = ',';
+        lineLen++;
+        lineLen += StatsFormatNumber(&line[lineLen], entry.rxLen, 10U, 1U);
+        line[lineLen] = '\n';
+        lineLen++;
+        /* Write the line. */
+        if (f_write(&fileHandle, line, lineLen, &bytesWritten) != FR_OK)
+        {
+          /* Flag the error. */
+          result = TBX_ERROR;
+        }
+      }
+      /* Close the file, which also flushes the data that is still cached. */
+      if (f_close(&fileHandle) != FR_OK)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+  }
+#else
+  /* Tracing is disabled. */
+  (void)context;
+  (void)file;
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of StatsTraceDump ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the current time, to be used as the start time of a measurement.
+**            The start and end time of a measurement must come from the same port.
+** \param     port The port that offers the time reference.
+** \return    Current system time in milliseconds, or 0 if the port does not offer it or
+**            statistics are disabled.
+**
+****************************************************************************************/
+uint32_t StatsGetTime(tPort const * port)
+{
+  uint32_t result = 0U;
+
+#if (STATS_ENABLE > 0U)
+  /* Only obtain the time if the port offers it. */
+  if ((port != NULL) && (port->SystemGetTime != NULL))
+  {
+    result = port->SystemGetTime();
+  }
+#else
+  /* Statistics are disabled. */
+  (void)port;
+#endif
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of StatsGetTime ***/
+
+
+/************************************************************************************//**
+** \brief     Records the statistics of one packet exchange with the bootloader.
+** \param     context The statistics context.
+** \param     command Command code of the sent packet.
+** \param     result Result of the packet exchange (STATS_RESULT_xxx).
+** \param     txLen Number of bytes in the sent packet.
+** \param     rxLen Number of bytes in the received packet, or 0 if none.
+** \param     startTime Time that the packet was sent, as obtained with StatsGetTime()
+**            from the port of the statistics context.
+**
+****************************************************************************************/
+void StatsRecordCommand(tStatsContext * context, uint8_t command, uint8_t result,
+                        uint8_t txLen, uint8_t rxLen, uint32_t startTime)
+{
+#if (STATS_ENABLE > 0U)
+  tStatsCommand * slot;
+  uint32_t        latency;
+  uint8_t         binIdx = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
+  {
+    /* Determine the round-trip latency. Note that this calculation is 32-bit time
+     * overflow safe.
+     */
+    latency = StatsGetTime(context->port) - startTime;
+    /* Determine the histogram bin. Bin N counts latencies in the range 2^(N-1) until
+     * 2^N, except for bin 0 that counts latencies of 0 ms.
+     */
+    while ((binIdx < (STATS_HISTOGRAM_SIZE - 1U)) && ((latency >> binIdx) > 0U))
+    {
+      binIdx++;
+    }
+
+    TbxCriticalSectionEnter();
+    /* Update the statistics of the command, if it has a slot. */
+    slot = StatsGetCommandSlot(context, command);
+    if (slot != NULL)
+    {
+      slot->count++;
+      slot->txBytes += txLen;
+      slot->rxBytes += rxLen;
+      if (result == STATS_RESULT_NEGATIVE)
+      {
+        slot->negatives++;
+      }
+      else if (result == STATS_RESULT_TIMEOUT)
+      {
+        slot->timeouts++;
+      }
+      else
+      {
+        /* Nothing else to count. */
+      }
+      /* The latency is only meaningful if a response was received. */
+      if ((result == STATS_RESULT_OK) || (result == STATS_RESULT_NEGATIVE))
+      {
+        if ((slot->latencyCount == 0U) || (latency < slot->latencyMin))
+        {
+          slot->latencyMin = latency;
+        }
+        if (latency > slot->latencyMax)
+        {
+          slot->latencyMax = latency;
+        }
+        slot->latencyCount++;
+        slot->latencySum += latency;
+        slot->histogram[binIdx]++;
+      }
+    }
+#if (STATS_TRACE_SIZE > 0U)
+    /* Add the packet exchange to the trace ring buffer. */
+    context->trace[context->traceHead].time = startTime;
+    context->trace[context->traceHead].latency = latency;
+    context->trace[context->traceHead].command = command;
+    context->trace[context->traceHead].result = result;
+    context->trace[context->traceHead].txLen = txLen;
+    context->trace[context->traceHead].rxLen = rxLen;
+    context->traceHead = (context->traceHead + 1U) % STATS_TRACE_SIZE;
+    if (context->traceCount < STATS_TRACE_SIZE)
+    {
+      context->traceCount++;
+    }
+#endif
+    TbxCriticalSectionExit();
+  }
+#else
+  /* Statistics are disabled. */
+  (void)context;
+  (void)command;
+  (void)result;
+  (void)txLen;
+  (void)rxLen;
+  (void)startTime;
+#endif
+} /*** end of StatsRecordCommand ***/
+
+
+/************************************************************************************//**
+** \brief     Adds the time that elapsed since the start time to the total of a time
+**            category.
+** \param     context The statistics context.
+** \param     category Time category (STATS_TIME_xxx).
+** \param     startTime Start time, as obtained with StatsGetTime() from the port of the
+**            statistics context.
+**
+****************************************************************************************/
+void StatsRecordTime(tStatsContext * context, uint8_t category, uint32_t startTime)
+{
+#if (STATS_ENABLE > 0U)
+  uint32_t elapsed;
+
+  /* Verify parameter. */
+  TBX_ASSERT(context != NULL);
+
+  /* Only continue with valid parameter. */
+  if (context != NULL)
+  {
+    /* Determine the elapsed time. Note that this calculation is 32-bit time overflow
+     * safe.
+     */
+    elapsed = StatsGetTime(context->port) - startTime;
+
+    TbxCriticalSectionEnter();
+    /* Add the elapsed time to the total of the category. */
+    if (category == STATS_TIME_ERASE)
+    {
+      context->info.eraseTime += elapsed;
+    }
+    else
+    {
+      context->info.programTime += elapsed;
+    }
+    TbxCriticalSectionExit();
+  }
+#else
+  /* Statistics are disabled. */
+  (void)context;
+  (void)category;
+  (void)startTime;
+#endif
+} /*** end of StatsRecordTime ***/
+
+
+#if (STATS_ENABLE > 0U)
+/************************************************************************************//**
+** \brief     Obtains the slot with the statistics of a command. A new slot is taken
+**            into use, the first time a command is recorded. Should be called from
+**            within a critical section.
+** \param     context The statistics context.
+** \param     command Command code.
+** \return    Pointer to the slot, or NULL if all slots are in use by other commands.
+**
+****************************************************************************************/
+static tStatsCommand * StatsGetCommandSlot(tStatsContext * context, uint8_t command)
+{
+  tStatsCommand * result = NULL;
+  uint8_t         slotIdx;
+
+  /* Search for the slot of the command. */
+  for (slotIdx = 0U; (slotIdx < context->info.commandCount) && (result == NULL);
+       slotIdx++)
+  {
+    if (context->info.commands[slotIdx].command == command)
+    {
+      result = &context->info.commands[slotIdx];
+    }
+  }
+  /* Take a new slot into use, if the command does not have one yet. */
+  if ((result == NULL) && (context->info.commandCount < STATS_COMMAND_SLOTS))
+  {
+    result = &context->info.commands[context->info.commandCount];
+    result->command = command;
+    context->info.commandCount++;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of StatsGetCommandSlot ***/
+
+
+#if (STATS_TRACE_SIZE > 0U)
+/************************************************************************************//**
+** \brief     Formats an unsigned number as text, without a terminating null character.
+** \param     buffer Pointer to where the text is written to. It must be able to hold at
+**            least 10 characters.
+** \param     value The number to format.
+** \param     base Number base, so 10 for decimal or 16 for hexadecimal.
+** \param     minDigits Minimum number of digits. Leading zeros are added if needed.
+** \return    Number of characters written.
+**
+****************************************************************************************/
+static uint8_t StatsFormatNumber(char * buffer, uint32_t value, uint8_t base,
+                                 uint8_t minDigits)
+{
+  uint8_t    result = 0U;
+  char       digits[10];
+  uint8_t    digitCnt = 0U;
+  uint32_t   remaining = value;
+  static const char digitChars[] = "0123456789ABCDEF";
+
+  /* Verify parameters. */
+  TBX_ASSERT((buffer != NULL) && ((base == 10U) || (base == 16U)) && (minDigits <= 8U));
+
+  /* Only continue with valid parameters. */
+  if ((buffer != NULL) && ((base == 10U) || (base == 16U)) && (minDigits <= 8U))
+  {
+    /* Determine the digits, from the least to the most significant one. */
+    do
+    {
+      digits[digitCnt] = digitChars[remaining % base];
+      digitCnt++;
+      remaining /= base;
+    }
+    while ((remaining > 0U) || (digitCnt < minDigits));
+    /* Write the digits in the reverse order. */
+    while (digitCnt > 0U)
+    {
+      digitCnt--;
+      buffer[result] = digits[digitCnt];
+      result++;
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of StatsFormatNumber ***/
+#endif
+#endif
+
+
+/*********************************** end of stats.c ************************************/
@@ -0,0 +1,189 @@
+/************************************************************************************//**
+* \file         stats.h
+* \brief        Statistics header file.
+* \ingroup      Stats
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Stats Statistics Module
+* \brief      Module with functionality to collect statistics about the duration of a
+*             firmware update.
+* \ingroup    Library
+* \details
+* The Statistics module records, per command that is sent to the bootloader, the number
+* of packets and bytes, the number of negative responses and timeouts, and the round-trip
+* latency. It also totals the time spent on erasing and programming. Optionally, each
+* packet exchange is stored in a trace ring buffer, which can be dumped to a file. This
+* information helps to tune the timeouts and to find out where the time of a firmware
+* update goes. Each communication session collects its statistics in its own statistics
+* context, such that concurrent sessions do not affect each other's statistics.
+*
+* Note that all times are in milliseconds, because that is the resolution of the time
+* reference that the port offers. A statistics context takes its time reference from the
+* port of its communication session.
+****************************************************************************************/
+#ifndef STATS_H
+#define STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Enables the collection of statistics. Set it to 0 to save RAM and the small
+ *         run-time overhead.
+ */
+#ifndef STATS_ENABLE
+#define STATS_ENABLE                   (1U)
+#endif
+
+/** \brief Maximum number of different commands to collect statistics for. Commands that
+ *         do not fit are not recorded.
+ */
+#ifndef STATS_COMMAND_SLOTS
+#define STATS_COMMAND_SLOTS            (16U)
+#endif
+
+/** \brief Number of entries in the trace ring buffer. Once full, the oldest entry is
+ *         overwritten. Set it to 0 to disable tracing.
+ */
+#ifndef STATS_TRACE_SIZE
+#define STATS_TRACE_SIZE               (0U)
+#endif
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Number of bins in the latency histogram. Bin 0 counts latencies of 0 ms and
+ *         bin 1 of 1 ms. Each next bin covers twice the range of the previous one. So
+ *         2-3 ms, 4-7 ms, etc. The last bin counts all latencies of 64 ms and more.
+ */
+#define STATS_HISTOGRAM_SIZE           (8U)
+
+/** \brief Packet exchange result for a positive response. */
+#define STATS_RESULT_OK                ((uint8_t)0U)
+
+/** \brief Packet exchange result for a negative or invalid response. */
+#define STATS_RESULT_NEGATIVE          ((uint8_t)1U)
+
+/** \brief Packet exchange result when the packet could not be transmitted or no
+ *         response was received within the timeout time.
+ */
+#define STATS_RESULT_TIMEOUT           ((uint8_t)2U)
+
+/** \brief Packet exchange result for a packet to which no response is expected, such
+ *         as the packets inside a block.
+ */
+#define STATS_RESULT_NO_RESPONSE       ((uint8_t)3U)
+
+/** \brief Time category for erasing memory on the target. */
+#define STATS_TIME_ERASE               ((uint8_t)0U)
+
+/** \brief Time category for programming memory on the target. */
+#define STATS_TIME_PROGRAM             ((uint8_t)1U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Statistics of one command. */
+typedef struct
+{
+  uint8_t  command;                          /**< Command code.                        */
+  uint32_t count;                            /**< Number of packets sent.              */
+  uint32_t negatives;                        /**< Number of negative responses.        */
+  uint32_t timeouts;                         /**< Number of timeouts.                  */
+  uint32_t txBytes;                          /**< Total bytes in the sent packets.     */
+  uint32_t rxBytes;                          /**< Total bytes in the received packets. */
+  uint32_t latencyCount;                     /**< Number of latency measurements.      */
+  uint32_t latencyMin;                       /**< Minimum round-trip latency in ms.    */
+  uint32_t latencyMax;                       /**< Maximum round-trip latency in ms.    */
+  uint32_t latencySum;                       /**< Sum of the latencies for the average.*/
+  uint32_t histogram[STATS_HISTOGRAM_SIZE];  /**< Latency histogram.                   */
+} tStatsCommand;
+
+/** \brief Collected statistics. */
+typedef struct
+{
+  tStatsCommand commands[STATS_COMMAND_SLOTS]; /**< Statistics per command.            */
+  uint8_t       commandCount;                /**< Number of used command slots.        */
+  uint32_t      eraseTime;                   /**< Total time spent erasing in ms.      */
+  uint32_t      programTime;                 /**< Total time spent programming in ms.  */
+  uint32_t      parseTime;                   /**< Total time spent parsing in ms.      */
+} tStats;
+
+/** \brief Entry of the trace ring buffer, with the info of one packet exchange. */
+typedef struct
+{
+  uint32_t time;                             /**< Transmit time in ms.                 */
+  uint32_t latency;                          /**< Round-trip latency in ms.            */
+  uint8_t  command;                          /**< Command code.                        */
+  uint8_t  result;                           /**< Result (STATS_RESULT_xxx).           */
+  uint8_t  txLen;                            /**< Number of bytes in the sent packet.  */
+  uint8_t  rxLen;                            /**< Number of bytes in the response.     */
+} tStatsTraceEntry;
+
+/** \brief Statistics context with the statistics of one communication session. */
+typedef struct
+{
+  tPort const    * port;                     /**< Port with the time reference.        */
+#if (STATS_ENABLE > 0U)
+  tStats           info;                     /**< Collected statistics.                */
+#if (STATS_TRACE_SIZE > 0U)
+  tStatsTraceEntry trace[STATS_TRACE_SIZE];  /**< Trace ring buffer.                   */
+  uint32_t         traceHead;                /**< Index of the entry written next.     */
+  uint32_t         traceCount;               /**< Number of used trace entries.        */
+#endif
+#endif
+} tStatsContext;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void     StatsInit(tStatsContext * context, tPort const * port);
+void     StatsReset(tStatsContext * context);
+void     StatsGet(tStatsContext const * context, tStats * stats);
+uint8_t  StatsTraceDump(tStatsContext const * context, char const * file);
+uint32_t StatsGetTime(tPort const * port);
+void     StatsRecordCommand(tStatsContext * context, uint8_t command, uint8_t result,
+                            uint8_t txLen, uint8_t rxLen, uint32_t startTime);
+void     StatsRecordTime(tStatsContext * context, uint8_t category, uint32_t startTime);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STATS_H */
+/*********************************** end of stats.h ************************************/
@@ -0,0 +1,189 @@
+/************************************************************************************//**
+* \file         verify.c
+* \brief        Firmware verification source file.
+* \ingroup      Verify
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
+#include "session.h"                        /* Communication session module            */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "checksum.h"                       /* Checksum module                         */
+#include "verify.h"                         /* Firmware verification module            */
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t VerifySegment(tSessionContext * session, tFirmwareContext * firmware,
+                             uint32_t segmentIdx, uint32_t address, uint32_t len);
+
+
+/************************************************************************************//**
+** \brief     Verifies that the firmware data on the target matches the firmware data in
+**            the firmware file. Make sure the firmware file is opened and the session
+**            is started, before calling this function. Note that it reads the firmware
+**            data with FirmwareSegmentOpen() and FirmwareSegmentGetNextData().
+** \param     session The session context of the target.
+** \param     firmware The firmware context of the firmware file.
+** \return    TBX_OK if the firmware data matches, TBX_ERROR if it does not match or the
+**            bootloader could not build the checksums.
+**
+****************************************************************************************/
+uint8_t VerifyFirmware(tSessionContext * session, tFirmwareContext * firmware)
+{
+  uint8_t  result = TBX_OK;
+  uint32_t segmentIdx;
+  uint32_t segmentAddress = 0U;
+  uint32_t segmentLen;
+
+  /* Verify the firmware data of all segments. */
+  for (segmentIdx = 0U; segmentIdx < FirmwareSegmentGetCount(firmware); segmentIdx++)
+  {
+    segmentLen = FirmwareSegmentGetInfo(firmware, segmentIdx, &segmentAddress);
+    /* Only verify segments that actually hold firmware data. */
+    if ((result == TBX_OK) && (segmentLen > 0U))
+    {
+      result = VerifySegment(session, firmware, segmentIdx, segmentAddress,
+                             segmentLen);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of VerifyFirmware ***/
+
+
+/************************************************************************************//**
+** \brief     Verifies that the firmware data of a segment on the target matches the
+**            firmware data in the firmware file. The segment is verified in blocks of
+**            at most VERIFY_BLOCK_SIZE bytes. For each block, the bootloader is first
+**            requested to build its checksum, such that the local checksum can be
+**            calculated with the same checksum type, while reading the block's data.
+** \param     session The session context of the target.
+** \param     firmware The firmware context of the firmware file.
+** \param     segmentIdx Index of the segment.
+** \param     address Start address of the segment.
+** \param     len Number of bytes in the segment.
+** \return    TBX_OK if the firmware data matches, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t VerifySegment(tSessionContext * session, tFirmwareContext * firmware,
+                             uint32_t segmentIdx, uint32_t address, uint32_t len)
+{
+  uint8_t         result = TBX_OK;
+  uint32_t        currentAddress = address;
+  uint32_t        remaining = len;
+  uint32_t        blockLen;
+  uint32_t        blockRemaining = 0U;
+  uint8_t const * chunkData = NULL;
+  uint32_t        chunkAddress = 0U;
+  uint16_t        chunkLen = 0U;
+  uint32_t        updateLen;
+  uint8_t         checksumType = 0U;
+  uint32_t        checksumTarget = 0U;
+  tChecksum       checksumLocal;
+
+  /* Start reading the segment's firmware data. */
+  FirmwareSegmentOpen(firmware, segmentIdx);
+
+  /* Process the segment's firmware data, until all of it was verified. */
+  while ((result == TBX_OK) && (remaining > 0U))
+  {
+    /* Read the next chunk of firmware data, if the previous one was processed. */
+    if (chunkLen == 0U)
+    {
+      chunkData = FirmwareSegmentGetNextData(firmware, &chunkAddress, &chunkLen);
+      if ((chunkData == NULL) || (chunkLen == 0U) || (chunkAddress != currentAddress))
+      {
+        /* Could not read the firmware data. Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+    /* Start a new block, if the previous one was verified. */
+    if ((result == TBX_OK) && (blockRemaining == 0U))
+    {
+      blockLen = remaining;
+      if ((VERIFY_BLOCK_SIZE > 0U) && (blockLen > VERIFY_BLOCK_SIZE))
+      {
+        blockLen = VERIFY_BLOCK_SIZE;
+      }
+      /* Request the checksum of the block from the target and prepare the calculation
+       * of the local checksum, using the same checksum type. The target can build the
+       * checksum over less bytes than requested, which then determines the block size.
+       */
+      if (SessionBuildChecksum(session, currentAddress, &blockLen, &checksumType,
+                               &checksumTarget) != TBX_OK)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      else if (ChecksumInit(&checksumLocal, checksumType,
+                                 SessionGetPort(session)) != TBX_OK)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        blockRemaining = blockLen;
+      }
+    }
+    /* Add the chunk's data that belongs to the block to the local checksum. */
+    if (result == TBX_OK)
+    {
+      updateLen = (chunkLen < blockRemaining) ? chunkLen : blockRemaining;
+      ChecksumUpdate(&checksumLocal, chunkData, updateLen);
+      chunkData = &chunkData[updateLen];
+      chunkLen -= (uint16_t)updateLen;
+      blockRemaining -= updateLen;
+      remaining -= updateLen;
+      currentAddress += updateLen;
+      /* Compare the checksums, once all of the block's data was added. */
+      if ( (blockRemaining == 0U) &&
+           (ChecksumGetResult(&checksumLocal) != checksumTarget) )
+      {
+        /* Firmware data on the target does not match. Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of VerifySegment ***/
+
+
+/*********************************** end of verify.c ***********************************/
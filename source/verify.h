@@ -0,0 +1,78 @@
+/************************************************************************************//**
+* \file         verify.h
+* \brief        Firmware verification header file.
+* \ingroup      Verify
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   Verify Firmware Verification Module
+* \brief      Module with functionality to verify that the firmware data on the target
+*             matches the firmware file.
+* \ingroup    Library
+* \details
+* The Firmware Verification module verifies the programmed firmware data, without
+* reading it back from the target. Instead, it requests the bootloader to build a
+* checksum over the memory of each firmware segment and compares it with the checksum
+* that it calculates locally over the segment's firmware data. This only takes a few
+* packets per segment, as opposed to uploading the entire firmware data.
+****************************************************************************************/
+#ifndef VERIFY_H
+#define VERIFY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Configuration
+****************************************************************************************/
+/** \brief Maximum number of bytes that the bootloader builds a checksum over, with one
+ *         request. Segments that are larger are verified in multiple blocks. Set it to
+ *         0 to verify each segment with a single request. Note that for the checksum
+ *         types that add words, the bootloader typically requires the block size to be
+ *         a multiple of the word size.
+ */
+#ifndef VERIFY_BLOCK_SIZE
+#define VERIFY_BLOCK_SIZE              (0U)
+#endif
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+uint8_t VerifyFirmware(tSessionContext * session, tFirmwareContext * firmware);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VERIFY_H */
+/*********************************** end of verify.h ***********************************/
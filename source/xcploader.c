@@ -37,9 +37,11 @@
 ****************************************************************************************/
 #include <microtbx.h>                       /* MicroTBX toolbox                        */
 #include <ff.h>                             /* FatFS                                   */
+#include "port.h"                           /* Port module                             */
+#include "stats.h"                          /* Statistics module                       */
 #include "session.h"                        /* Communication session module            */
+#include "checksum.h"                       /* Checksum module                         */
 #include "xcploader.h"                      /* XCP communication protocol module       */
-#include "port.h"                           /* Port module                             */
 
 
 /****************************************************************************************
@@ -47,10 +49,12 @@
 ****************************************************************************************/
 /* XCP command codes as defined by the protocol currently supported by this module. */
 #define XCPLOADER_CMD_PROGRAM_MAX     (0xC9u)    /**< XCP program max command code.    */
+#define XCPLOADER_CMD_PROGRAM_NEXT    (0xCAU)    /**< XCP program next command code.   */
 #define XCPLOADER_CMD_PROGRAM_RESET   (0xCFU)    /**< XCP program reset command code.  */
 #define XCPLOADER_CMD_PROGRAM         (0xD0U)    /**< XCP program command code.        */
 #define XCPLOADER_CMD_PROGRAM_CLEAR   (0xD1U)    /**< XCP program clear command code.  */
 #define XCPLOADER_CMD_PROGRAM_START   (0xD2U)    /**< XCP program start command code.  */
+#define XCPLOADER_CMD_BUILD_CHECKSUM  (0xF3U)    /**< XCP build checksum command code. */
 #define XCPLOADER_CMD_UPLOAD          (0xF5u)    /**< XCP upload command code.         */
 #define XCPLOADER_CMD_SET_MTA         (0xF6U)    /**< XCP set mta command code.        */
 #define XCPLOADER_CMD_UNLOCK          (0xF7U)    /**< XCP unlock command code.         */
@@ -63,67 +67,180 @@
 
 /* XCP response packet IDs as defined by the protocol. */
 #define XCPLOADER_CMD_PID_RES         (0xFFU)    /**< Positive response.               */
+#define XCPLOADER_CMD_PID_ERR         (0xFEU)    /**< Error response.                  */
+
+/* XCP error codes as defined by the protocol. */
+#define XCPLOADER_ERR_OUT_OF_RANGE    (0x22U)    /**< Parameter out of range.          */
+
+/* XCP communication mode bits in COMM_MODE_PGM of the PROGRAM START response. */
+#define XCPLOADER_COMM_MODE_PGM_MASTER_BLOCK (0x01U) /**< Master block mode supported. */
 
 /** \brief Number of retries to connect to the XCP slave. */
 #define XCPLOADER_CONNECT_RETRIES     (5U)
 
 
 /****************************************************************************************
-* Local data declarations
+* Type definitions
 ****************************************************************************************/
-/** \brief The settings that should be used by the XCP loader. */
-static tXcpLoaderSettings xcpSettings;
-
-/** \brief Flag to keep track of the connection status. */
-static uint8_t            xcpConnected;
-
-/** \brief Store the byte ordering of the XCP slave. */
-static uint8_t            xcpSlaveIsIntel;
-
-/** \brief The max number of bytes in the command transmit object (master->slave). */
-static uint16_t           xcpMaxCto;
-
-/** \brief The max number of bytes in the command transmit object (master->slave) during
- *         a programming session.
+/** \brief Enumeration with the states of the asynchronous operation state machine. */
+typedef enum
+{
+  XCPLOADER_ASYNC_STATE_IDLE,                    /**< No operation in progress.        */
+  XCPLOADER_ASYNC_STATE_SET_MTA,                 /**< Waiting for SET MTA response.    */
+  XCPLOADER_ASYNC_STATE_PROGRAM,                 /**< Ready to program the next data.  */
+  XCPLOADER_ASYNC_STATE_PROGRAM_BLOCK,           /**< Sending the packets of a block.  */
+  XCPLOADER_ASYNC_STATE_PROGRAM_RES,             /**< Waiting for program response.    */
+  XCPLOADER_ASYNC_STATE_CLEAR,                   /**< Ready to send the erase command. */
+  XCPLOADER_ASYNC_STATE_CLEAR_RES                /**< Waiting for erase response.      */
+} tXcpLoaderAsyncState;
+
+/** \brief Structure that groups the information of the asynchronous operation that is
+ *         in progress.
  */
-static uint16_t           xcpMaxProgCto;
-
-/** \brief The max number of bytes in the data transmit object (slave->master). */
-static uint16_t           xcpMaxDto;
+typedef struct
+{
+  /** \brief Current state of the asynchronous operation state machine. */
+  tXcpLoaderAsyncState state;
+  /** \brief Status of the asynchronous operation (SESSION_STATUS_xxx). */
+  uint8_t              status;
+  /** \brief Pointer to the next data byte that still needs to be sent. */
+  uint8_t      const * data;
+  /** \brief Number of data bytes that still need to be sent. */
+  uint32_t             len;
+  /** \brief Number of data bytes of the current block that still need to be sent. */
+  uint8_t              blockRemaining;
+  /** \brief Number of bytes to erase, once the SET MTA response was received. Zero if
+   *         the operation does not erase memory.
+   */
+  uint32_t             clearLen;
+  /** \brief Time in milliseconds at which the last packet was transmitted. */
+  uint32_t             txTime;
+  /** \brief Maximum time in milliseconds to wait for the response packet. */
+  uint16_t             timeout;
+  /** \brief Request packet that is currently being processed. */
+  tPortXcpPacket       reqPacket;
+} tXcpLoaderAsync;
+
+/** \brief Structure that groups all the information of an XCP loader instance. Each
+ *         session context has its own instance, such that multiple targets can be
+ *         communicated with at the same time.
+ */
+typedef struct
+{
+  /** \brief The settings that should be used by the XCP loader. */
+  tXcpLoaderSettings   settings;
+  /** \brief The port that is used for communicating with the target. */
+  tPort const        * port;
+  /** \brief The statistics context that the packet exchanges are recorded in. */
+  tStatsContext      * stats;
+  /** \brief Flag to keep track of the connection status. */
+  uint8_t              connected;
+  /** \brief Store the byte ordering of the XCP slave. */
+  uint8_t              slaveIsIntel;
+  /** \brief The max number of bytes in the command transmit object (master->slave). */
+  uint16_t             maxCto;
+  /** \brief The max number of bytes in the command transmit object (master->slave)
+   *         during a programming session.
+   */
+  uint16_t             maxProgCto;
+  /** \brief The max number of bytes in the data transmit object (slave->master). */
+  uint16_t             maxDto;
+  /** \brief Flag to keep track if the slave supports master block mode during a
+   *         programming session. In this mode a block of PROGRAM and PROGRAM NEXT
+   *         packets is sent, for which the slave only sends one response at the end of
+   *         the block.
+   */
+  uint8_t              pgmMasterBlockMode;
+  /** \brief The max number of command packets in a block during a programming
+   *         session.
+   */
+  uint8_t              pgmMaxBs;
+  /** \brief The minimum separation time between the command packets in a block during
+   *         a programming session, in units of 100 microseconds.
+   */
+  uint8_t              pgmMinSt;
+  /** \brief Memory transfer address (MTA) of the slave, as far as known. The slave
+   *         automatically increments its MTA after programming or uploading data. A
+   *         SET MTA command is only needed, if the next operation does not continue at
+   *         this address.
+   */
+  uint32_t             mta;
+  /** \brief TBX_TRUE if the mta value matches the MTA of the slave. */
+  uint8_t              mtaValid;
+  /** \brief Maximum number of bytes that the slave builds a checksum over, as reported
+   *         by the slave. A value of 0 means that the slave did not report a maximum.
+   */
+  uint32_t             checksumMax;
+  /** \brief Information about the asynchronous operation that is in progress. */
+  tXcpLoaderAsync      async;
+} tXcpLoader;
 
 
 /****************************************************************************************
 * Function prototypes
 ****************************************************************************************/
 /* Protocol functions for linking to the session module. */
-static void     XcpLoaderInit(void const * settings);
-static void     XcpLoaderTerminate(void);
-static uint8_t  XcpLoaderStart(void);
-static void     XcpLoaderStop(void);
-static uint8_t  XcpLoaderClearMemory(uint32_t address, uint32_t len);
-static uint8_t  XcpLoaderWriteData(uint32_t address, uint32_t len, uint8_t const * data);
-static uint8_t  XcpLoaderReadData(uint32_t address, uint32_t len, uint8_t * data);
+static void *   XcpLoaderCreate(void const * settings, tPort const * port,
+                                tStatsContext * stats);
+static void     XcpLoaderDestroy(void * instance);
+static uint8_t  XcpLoaderStart(void * instance);
+static void     XcpLoaderStop(void * instance);
+static uint8_t  XcpLoaderClearMemory(void * instance, uint32_t address, uint32_t len);
+static uint8_t  XcpLoaderWriteData(void * instance, uint32_t address, uint32_t len,
+                                   uint8_t const * data);
+static uint8_t  XcpLoaderReadData(void * instance, uint32_t address, uint32_t len,
+                                  uint8_t * data);
+static uint8_t  XcpLoaderWriteDataAsync(void * instance, uint32_t address, uint32_t len,
+                                        uint8_t const * data);
+static uint8_t  XcpLoaderClearMemoryAsync(void * instance, uint32_t address,
+                                          uint32_t len);
+static uint8_t  XcpLoaderTask(void * instance, uint8_t wait);
+static uint8_t  XcpLoaderBuildChecksum(void * instance, uint32_t address, uint32_t * len,
+                                       uint8_t * type, uint32_t * checksum);
 /* Port dependent functions for low level XCP communication packet exchange. */
-static uint8_t  XcpExchangePacket(tPortXcpPacket const * txPacket,
+static uint8_t  XcpExchangePacket(tXcpLoader * loader, tPortXcpPacket const * txPacket,
                                   tPortXcpPacket * rxPacket, uint16_t timeout);
+static uint8_t  XcpSendPacket(tXcpLoader * loader, tPortXcpPacket const * txPacket);
+static uint8_t  XcpStartExchangePacket(tXcpLoader * loader,
+                                       tPortXcpPacket const * txPacket,
+                                       uint16_t timeout);
+static uint8_t  XcpPollExchangePacket(tXcpLoader * loader, tPortXcpPacket * rxPacket,
+                                      uint8_t wait);
+static uint8_t  XcpSeparationTimeElapsed(tXcpLoader const * loader);
+/* Asynchronous operation state machine utility functions. */
+static uint8_t  XcpLoaderAsyncStart(tXcpLoader * loader, uint32_t address);
+static uint8_t  XcpLoaderAsyncSendSetMta(tXcpLoader * loader, uint32_t address);
+static uint8_t  XcpLoaderAsyncProcess(tXcpLoader * loader, uint8_t wait);
+static void     XcpLoaderAsyncSendClear(tXcpLoader * loader);
+static void     XcpLoaderAsyncSendProgram(tXcpLoader * loader);
+static void     XcpLoaderAsyncSendBlockPacket(tXcpLoader * loader);
+static void     XcpLoaderAsyncFinish(tXcpLoader * loader, uint8_t status);
+static void     XcpLoaderAsyncAbort(tXcpLoader * loader);
 /* General module specific utility functions. */
-static void     XcpLoaderSetOrderedLong(uint32_t value, uint8_t * data);
-static uint8_t  XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen);
-static uint8_t  XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t keyLen);
+static void     XcpLoaderSetOrderedLong(tXcpLoader const * loader, uint32_t value,
+                                        uint8_t * data);
+static uint32_t XcpLoaderGetOrderedLong(tXcpLoader const * loader, uint8_t const * data);
+static uint8_t  XcpLoaderUploadSeed(tXcpLoader * loader, uint8_t * seedPtr,
+                                    uint8_t * seedLen);
+static uint8_t  XcpLoaderDownloadKeyAndUnlock(tXcpLoader * loader,
+                                              uint8_t const * keyPtr, uint8_t keyLen);
 /* XCP Command functions. */
-static uint8_t  XcpLoaderSendCmdConnect(void);
-static uint8_t  XcpLoaderSendCmdGetStatus(uint8_t * protectedResources);
-static uint8_t  XcpLoaderSendCmdProgramStart(void);
-static uint8_t  XcpLoaderSendCmdProgramReset(void);
-static uint8_t  XcpLoaderSendCmdProgram(uint8_t len, uint8_t const * data);
-static uint8_t  XcpLoaderSendCmdProgramMax(uint8_t const * data);
-static uint8_t  XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t * seed,
-                                        uint8_t * seedLen);
-static uint8_t  XcpLoaderSendCmdUnlock(uint8_t const * key, uint8_t keyLen,
-                                       uint8_t * protectedResources);
-static uint8_t  XcpLoaderSendCmdSetMta(uint32_t address);
-static uint8_t  XcpLoaderSendCmdProgramClear(uint32_t len);
-static uint8_t  XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len);
+static uint8_t  XcpLoaderSendCmdConnect(tXcpLoader * loader);
+static uint8_t  XcpLoaderSendCmdGetStatus(tXcpLoader * loader,
+                                          uint8_t * protectedResources);
+static uint8_t  XcpLoaderSendCmdProgramStart(tXcpLoader * loader);
+static uint8_t  XcpLoaderSendCmdProgramReset(tXcpLoader * loader);
+static uint8_t  XcpLoaderSendCmdProgram(tXcpLoader * loader, uint8_t len,
+                                        uint8_t const * data);
+static uint8_t  XcpLoaderSendCmdGetSeed(tXcpLoader * loader, uint8_t resource,
+                                        uint8_t mode, uint8_t * seed, uint8_t * seedLen);
+static uint8_t  XcpLoaderSendCmdUnlock(tXcpLoader * loader, uint8_t const * key,
+                                       uint8_t keyLen, uint8_t * protectedResources);
+static uint8_t  XcpLoaderSendCmdSetMta(tXcpLoader * loader, uint32_t address);
+static uint8_t  XcpLoaderSendCmdProgramClear(tXcpLoader * loader, uint32_t len);
+static uint8_t  XcpLoaderSendCmdUpload(tXcpLoader * loader, uint8_t * data, uint8_t len);
+static uint8_t  XcpLoaderSendCmdBuildChecksum(tXcpLoader * loader, uint32_t len,
+                                              uint8_t * type, uint32_t * checksum);
 
 
 /***********************************************************************************//**
@@ -139,13 +256,17 @@ tSessionProtocol const * XcpLoaderGetProtocol(void)
    */
   static const tSessionProtocol xcpLoader =
   {
-    .Init = XcpLoaderInit,
-    .Terminate = XcpLoaderTerminate,
+    .Create = XcpLoaderCreate,
+    .Destroy = XcpLoaderDestroy,
     .Start = XcpLoaderStart,
     .Stop = XcpLoaderStop,
     .ClearMemory = XcpLoaderClearMemory,
     .WriteData = XcpLoaderWriteData,
-    .ReadData = XcpLoaderReadData
+    .ReadData = XcpLoaderReadData,
+    .WriteDataAsync = XcpLoaderWriteDataAsync,
+    .ClearMemoryAsync = XcpLoaderClearMemoryAsync,
+    .Task = XcpLoaderTask,
+    .BuildChecksum = XcpLoaderBuildChecksum
   };
 
   /* Give the pointer to the session communication protocol interface structure back to
@@ -156,74 +277,116 @@ tSessionProtocol const * XcpLoaderGetProtocol(void)
 
 
 /************************************************************************************//**
-** \brief     Initializes the XCP communication protocol module.
-** \param     protocolSettings Pointer to structure with XCP protocol specific settings.
+** \brief     Creates a new instance of the XCP communication protocol module. The
+**            instance is allocated from the memory pool.
+** \param     settings Pointer to structure with XCP protocol specific settings.
+** \param     port The port to use for communicating with the target. It must stay valid
+**            as long as the instance exists.
+** \param     stats The statistics context to record the packet exchanges in. It must
+**            stay valid as long as the instance exists.
+** \return    Pointer to the instance if successful, NULL if it could not be allocated.
 **
 ****************************************************************************************/
-static void XcpLoaderInit(void const * settings)
+static void * XcpLoaderCreate(void const * settings, tPort const * port,
+                              tStatsContext * stats)
 {
+  tXcpLoader               * loader = NULL;
   tXcpLoaderSettings const * xcpSettingsPtr = settings;
 
-  /* Verify parameter. */
-  TBX_ASSERT(settings != NULL);
-
-  /* Initialize locals. */
-  xcpConnected = TBX_FALSE;
-  xcpSlaveIsIntel = TBX_FALSE;
-  xcpMaxCto = 0U;
-  xcpMaxProgCto = 0U;
-  xcpMaxDto = 0U;
-
-  /* Reset the XCP protocol specific settings. */
-  xcpSettings.timeoutT1 = 1000U;
-  xcpSettings.timeoutT3 = 2000U;
-  xcpSettings.timeoutT4 = 10000U;
-  xcpSettings.timeoutT5 = 1000U;
-  xcpSettings.timeoutT6 = 50U;
-  xcpSettings.timeoutT7 = 2000U;
-  xcpSettings.connectMode = 0U;
+  /* Verify parameters. */
+  TBX_ASSERT((settings != NULL) && (port != NULL) && (stats != NULL));
 
-  /* Only continue with valid parameter. */
-  if (settings != NULL)
+  /* Only continue with valid parameters. */
+  if ((settings != NULL) && (port != NULL) && (stats != NULL))
   {
+    /* Attempt to allocate the instance. */
+    loader = TbxMemPoolAllocate(sizeof(tXcpLoader));
+    /* Automatically create or increase the memory pool if it was too small. */
+    if (loader == NULL)
+    {
+      /* No need to check the return value, because we'll attempt to allocate from the
+       * memory pool right way. That will tell us if the memory pool increase was
+       * successful.
+       */
+      (void)TbxMemPoolCreate(1U, sizeof(tXcpLoader));
+      /* Allocation should now work. */
+      loader = TbxMemPoolAllocate(sizeof(tXcpLoader));
+    }
+  }
+
+  /* Only initialize the instance if it could be allocated. */
+  if (loader != NULL)
+  {
+    /* Initialize the instance. */
+    loader->port = port;
+    loader->stats = stats;
+    loader->connected = TBX_FALSE;
+    loader->slaveIsIntel = TBX_FALSE;
+    loader->maxCto = 0U;
+    loader->maxProgCto = 0U;
+    loader->maxDto = 0U;
+    loader->pgmMasterBlockMode = TBX_FALSE;
+    loader->pgmMaxBs = 0U;
+    loader->pgmMinSt = 0U;
+    loader->mta = 0U;
+    loader->mtaValid = TBX_FALSE;
+    loader->checksumMax = 0U;
+    loader->async.state = XCPLOADER_ASYNC_STATE_IDLE;
+    loader->async.status = SESSION_STATUS_DONE;
+    loader->async.clearLen = 0U;
     /* Shallow copy the XCP settings for later usage. */
-    xcpSettings = *xcpSettingsPtr;
+    loader->settings = *xcpSettingsPtr;
   }
-} /*** end of XcpLoaderInit ***/
+
+  /* Give the result back to the caller. */
+  return loader;
+} /*** end of XcpLoaderCreate ***/
 
 
 /************************************************************************************//**
-** \brief     Terminates the XCP communication protocol module.
+** \brief     Releases an instance of the XCP communication protocol module.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 **
 ****************************************************************************************/
-static void XcpLoaderTerminate(void)
+static void XcpLoaderDestroy(void * instance)
 {
-  /* Make sure to stop the firmware update, in case was is in progress. */
-  XcpLoaderStop();
-} /*** end of XcpLoaderTerminate ***/
+  /* Verify parameter. */
+  TBX_ASSERT(instance != NULL);
+
+  /* Only continue with valid parameter. */
+  if (instance != NULL)
+  {
+    /* Make sure to stop the firmware update, in case was is in progress. */
+    XcpLoaderStop(instance);
+    /* Give the instance back to the memory pool. */
+    TbxMemPoolRelease(instance);
+  }
+} /*** end of XcpLoaderDestroy ***/
 
 
 /************************************************************************************//**
 ** \brief     Starts the firmware update session. This is where the connection with the
 **            target is made and the bootloader on the target is activated.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderStart(void)
+static uint8_t XcpLoaderStart(void * instance)
 {
-  uint8_t result = TBX_ERROR;
-  uint8_t portFcnsValid = TBX_FALSE;
-  uint8_t retryCnt;
-  uint8_t protectedResources = 0U;
-  uint8_t seed[256] = { 0U };
-  uint8_t seedLen;
-  uint8_t key[256] = { 0U };
-  uint8_t keyLen = 0U;
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+  uint8_t      portFcnsValid = TBX_FALSE;
+  uint8_t      retryCnt;
+  uint8_t      protectedResources = 0U;
+  uint8_t      seed[256] = { 0U };
+  uint8_t      seedLen;
+  uint8_t      key[256] = { 0U };
+  uint8_t      keyLen = 0U;
 
   /* A port specific function will be used. Make sure it is valid before calling. */
-  if (PortGet() != NULL)
+  if (loader->port != NULL)
   {
-    if (PortGet()->XcpComputeKeyFromSeed != NULL)
+    if (loader->port->XcpComputeKeyFromSeed != NULL)
     {
       portFcnsValid = TBX_TRUE;
     }
@@ -234,16 +397,16 @@ static uint8_t XcpLoaderStart(void)
   if (portFcnsValid == TBX_TRUE)
   {
     /* Make sure the session is stopped before starting a new one. */
-    XcpLoaderStop();
+    XcpLoaderStop(loader);
 
     /* Attempt to connect to the target with a finite amount of retries. */
     for (retryCnt = 0U; retryCnt < XCPLOADER_CONNECT_RETRIES; retryCnt++)
     {
       /* Send the connect command. */
-      if (XcpLoaderSendCmdConnect() == TBX_OK)
+      if (XcpLoaderSendCmdConnect(loader) == TBX_OK)
       {
         /* Update connection state. */
-        xcpConnected = TBX_TRUE;
+        loader->connected = TBX_TRUE;
         /* Set a positive result and only negate it upon error detection from here on. */
         result = TBX_OK;
         /* Connected so no need to retry. */
@@ -255,7 +418,7 @@ static uint8_t XcpLoaderStart(void)
     if (result == TBX_OK)
     {
       /* Obtain the current resource protection status. */
-      if (XcpLoaderSendCmdGetStatus(&protectedResources) != TBX_OK)
+      if (XcpLoaderSendCmdGetStatus(loader, &protectedResources) != TBX_OK)
       {
         /* Could not obtain resource protection status. Flag error. */
         result = TBX_ERROR;
@@ -269,7 +432,7 @@ static uint8_t XcpLoaderStart(void)
       if ((protectedResources & XCPLOADER_RESOURCE_PGM) != 0U)
       {
         /* Upload the seed for unlocking the programming resource. */
-        if (XcpLoaderUploadSeed(seed, &seedLen) != TBX_OK)
+        if (XcpLoaderUploadSeed(loader, seed, &seedLen) != TBX_OK)
         {
           /* Flag the error. */
           result = TBX_ERROR;
@@ -279,7 +442,7 @@ static uint8_t XcpLoaderStart(void)
         if (result == TBX_OK)
         {
           /* Calculate the key, based on the uploaded seed. */
-          if (PortGet()->XcpComputeKeyFromSeed(seedLen, seed, &keyLen, key) != TBX_OK)
+          if (loader->port->XcpComputeKeyFromSeed(seedLen, seed, &keyLen, key) != TBX_OK)
           {
             /* Flag the error. */
             result = TBX_ERROR;
@@ -290,12 +453,12 @@ static uint8_t XcpLoaderStart(void)
         if (result == TBX_OK)
         {
           /* Download the key and attempt to unlock the programming resource. */
-          if (XcpLoaderDownloadKeyAndUnlock(key, keyLen) != TBX_OK)
+          if (XcpLoaderDownloadKeyAndUnlock(loader, key, keyLen) != TBX_OK)
           {
             /* Target automatically disconnects upon giving an incorrect key. Update the
              * connection state accordingly.
              */
-            xcpConnected = TBX_FALSE;
+            loader->connected = TBX_FALSE;
             /* Flag the error. */
             result = TBX_ERROR;
           }
@@ -307,7 +470,7 @@ static uint8_t XcpLoaderStart(void)
     if (result == TBX_OK)
     {
       /* Attempt to place the target in programming mode. */
-      if (XcpLoaderSendCmdProgramStart() != TBX_OK)
+      if (XcpLoaderSendCmdProgramStart(loader) != TBX_OK)
       {
         /* Could not activate programming mode. Flag error. */
         result = TBX_ERROR;
@@ -324,24 +487,35 @@ static uint8_t XcpLoaderStart(void)
 ** \brief    Stops the firmware update. This is where the bootloader starts the user
 **           program on the target if a valid one is present. After this the connection
 **           with the target is severed.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 **
 ****************************************************************************************/
-static void XcpLoaderStop(void)
+static void XcpLoaderStop(void * instance)
 {
+  tXcpLoader * loader = instance;
+
+  /* Abort the asynchronous operation, in case one is still in progress. */
+  if (loader->async.status == SESSION_STATUS_BUSY)
+  {
+    XcpLoaderAsyncAbort(loader);
+  }
+
   /* Only continue if actually connected. */
-  if (xcpConnected == TBX_TRUE)
+  if (loader->connected == TBX_TRUE)
   {
     /* End the programming session by sending the program command with size 0. */
-    if (XcpLoaderSendCmdProgram(0U, NULL) == TBX_OK)
+    if (XcpLoaderSendCmdProgram(loader, 0U, NULL) == TBX_OK)
     {
       /* Disconnect the target. Here the reset command is used instead of the disconnect
        * command, because the bootloader should start the user program on the target.
        */
-      (void)XcpLoaderSendCmdProgramReset();
+      (void)XcpLoaderSendCmdProgramReset(loader);
     }
     /* Reset connection status. */
-    xcpConnected = TBX_FALSE;
+    loader->connected = TBX_FALSE;
   }
+  /* The MTA of the slave is no longer known. */
+  loader->mtaValid = TBX_FALSE;
 } /*** end of XcpLoaderStop ***/
 
 
@@ -349,26 +523,28 @@ static void XcpLoaderStop(void)
 ** \brief     Requests the bootloader to erase the specified range of memory on the
 **            target. The bootloader aligns this range to hardware specified erase
 **            blocks.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 ** \param     address The starting memory address for the erase operation.
 ** \param     len The total number of bytes to erase from memory.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderClearMemory(uint32_t address, uint32_t len)
+static uint8_t XcpLoaderClearMemory(void * instance, uint32_t address, uint32_t len)
 {
-  uint8_t result = TBX_ERROR;
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
 
   /* Verify parameters. */
   TBX_ASSERT(len > 0U);
 
   /* Only continue with valid parameter and when actually connected. */
-  if ((len > 0U) && (xcpConnected == TBX_TRUE))
+  if ((len > 0U) && (loader->connected == TBX_TRUE))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
 
     /* First set the MTA pointer. */
-    if (XcpLoaderSendCmdSetMta(address) != TBX_OK)
+    if (XcpLoaderSendCmdSetMta(loader, address) != TBX_OK)
     {
       /* Flag the error. */
       result = TBX_ERROR;
@@ -377,7 +553,7 @@ static uint8_t XcpLoaderClearMemory(uint32_t address, uint32_t len)
     if (result == TBX_OK)
     {
       /* Flag the error. */
-      if (XcpLoaderSendCmdProgramClear(len) != TBX_OK)
+      if (XcpLoaderSendCmdProgramClear(loader, len) != TBX_OK)
       {
         result = TBX_ERROR;
       }
@@ -393,84 +569,42 @@ static uint8_t XcpLoaderClearMemory(uint32_t address, uint32_t len)
 ** \brief     Requests the bootloader to program the specified data to memory. In case of
 **            non-volatile memory, the application needs to make sure the memory range
 **            was erased beforehand.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 ** \param     address The starting memory address for the write operation.
 ** \param     len The number of bytes in the data buffer that should be written.
 ** \param     data Pointer to the byte array with data to write.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderWriteData(uint32_t address, uint32_t len, uint8_t const * data)
+static uint8_t XcpLoaderWriteData(void * instance, uint32_t address, uint32_t len,
+                                  uint8_t const * data)
 {
-  uint8_t  result = TBX_ERROR;
-  uint8_t  currentWriteCnt;
-  uint32_t bufferOffset = 0U;
-  uint8_t  continueLoop = TBX_TRUE;
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+  uint8_t      status = SESSION_STATUS_ERROR;
 
   /* Check parameters. */
   TBX_ASSERT((data != NULL) && ((len > 0U)));
 
-  /* Only continue with valid parameters, when actually connected and xcpMaxProgCto has
-   * a valid length.
-   */
-  if ((data != NULL) && (len > 0U) && (xcpConnected == TBX_TRUE) &&
-      (xcpMaxProgCto <= PORT_XCP_PACKET_SIZE_MAX) )
+  /* Only continue with valid parameters. */
+  if ((data != NULL) && (len > 0U))
   {
-    /* Set a positive result and only negate upon error detection from here on. */
-    result = TBX_OK;
-
-    /* First set the MTA pointer. */
-    if (XcpLoaderSendCmdSetMta(address) != TBX_OK)
-    {
-      /* Flag the error. */
-      result = TBX_ERROR;
-    }
-
-    /* Perform segmented programming of the data. */
-    if (result == TBX_OK)
+    /* Start the asynchronous write operation. */
+    if (XcpLoaderWriteDataAsync(loader, address, len, data) == TBX_OK)
     {
-      /* Note that the uin8_t typecast on xcpMaxProgCto inside the loop is okay, because
-       * a compile time plausibility check is performed on macro
-       * PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned 8-bit.
+      /* Keep running the state machine, until the operation completed. Allow it to wait
+       * for response packets, such that the port can block while waiting.
        */
-      while (continueLoop == TBX_TRUE)
+      do
       {
-        /* Set the current write length to make optimal use of the available packet
-         * data.
-         */
-        currentWriteCnt = (uint8_t)(len % ((uint32_t)xcpMaxProgCto - 1U));
-        /* Is the current length a perfect fit for the PROGRAM_MAX command? */
-        if (currentWriteCnt == 0U)
-        {
-          currentWriteCnt = ((uint8_t)xcpMaxProgCto - 1U);
-          /* Program data use the PROGRAN_MAX command. */
-          if (XcpLoaderSendCmdProgramMax(&data[bufferOffset]) != TBX_OK)
-          {
-            /* Could not program the data. Flag error and request the loop to stop. */
-            result = TBX_ERROR;
-            continueLoop = TBX_FALSE;
-          }
-        }
-        /* Use the PROGRAM command instead. */
-        else
-        {
-          /* Program data use the PROGRAM command. */
-          if (XcpLoaderSendCmdProgram(currentWriteCnt, &data[bufferOffset]) != TBX_OK)
-          {
-            /* Could not program the data. Flag error and request the loop to stop. */
-            result = TBX_ERROR;
-            continueLoop = TBX_FALSE;
-          }
-        }
-
-        /* Update loop variables. */
-        len -= currentWriteCnt;
-        bufferOffset += currentWriteCnt;
-        /* Stop the loop when all bytes were programmed or an error was detected. */
-        if ( (len == 0U) || (result == TBX_ERROR) )
-        {
-          continueLoop = TBX_FALSE;
-        }
+        status = XcpLoaderAsyncProcess(loader, TBX_TRUE);
       }
+      while (status == SESSION_STATUS_BUSY);
+    }
+    /* Update the result, if the operation completed successfully. */
+    if (status == SESSION_STATUS_DONE)
+    {
+      result = TBX_OK;
     }
   }
   /* Give the result back to the caller. */
@@ -481,6 +615,7 @@ static uint8_t XcpLoaderWriteData(uint32_t address, uint32_t len, uint8_t const
 /************************************************************************************//**
 ** \brief     Request the bootloader to upload the specified range of memory. The data is
 **            stored in the data byte array to which the pointer was specified.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
 ** \param     address The starting memory address for the read operation.
 ** \param     len The number of bytes to upload from the target and store in the data
 **            buffer.
@@ -488,27 +623,29 @@ static uint8_t XcpLoaderWriteData(uint32_t address, uint32_t len, uint8_t const
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderReadData(uint32_t address, uint32_t len, uint8_t * data)
+static uint8_t XcpLoaderReadData(void * instance, uint32_t address, uint32_t len,
+                                 uint8_t * data)
 {
-  uint8_t  result = TBX_ERROR;
-  uint8_t  currentReadCnt;
-  uint32_t bufferOffset = 0U;
-  uint8_t  continueLoop = TBX_TRUE;
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+  uint8_t      currentReadCnt;
+  uint32_t     bufferOffset = 0U;
+  uint8_t      continueLoop = TBX_TRUE;
 
   /* Check parameters. */
   TBX_ASSERT((data != NULL) && (len > 0U));
 
-  /* Only continue with valid parameters, when actually connected and xcpMaxDto has a
+  /* Only continue with valid parameters, when actually connected and maxDto has a
    * valid length.
    */
-  if ((data != NULL) && (len > 0U) && (xcpConnected == TBX_TRUE) &&
-      (xcpMaxDto <= PORT_XCP_PACKET_SIZE_MAX))
+  if ((data != NULL) && (len > 0U) && (loader->connected == TBX_TRUE) &&
+      (loader->maxDto <= PORT_XCP_PACKET_SIZE_MAX))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
 
     /* First set the MTA pointer. */
-    if (XcpLoaderSendCmdSetMta(address) != TBX_OK)
+    if (XcpLoaderSendCmdSetMta(loader, address) != TBX_OK)
     {
       /* Flag the error. */
       result = TBX_ERROR;
@@ -517,7 +654,7 @@ static uint8_t XcpLoaderReadData(uint32_t address, uint32_t len, uint8_t * data)
     /* Perform segmented upload of the data. */
     if (result == TBX_OK)
     {
-      /* Note that the uin8_t typecast on xcpMaxDto inside the loop is okay, because
+      /* Note that the uin8_t typecast on maxDto inside the loop is okay, because
        * a compile time plausibility check is performed on macro
        * PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned 8-bit.
        */
@@ -526,14 +663,15 @@ static uint8_t XcpLoaderReadData(uint32_t address, uint32_t len, uint8_t * data)
         /* Set the current read length to make optimal use of the available packet
          * data.
          */
-        currentReadCnt = (uint8_t)(len % ((uint32_t)xcpMaxDto - 1U));
+        currentReadCnt = (uint8_t)(len % ((uint32_t)loader->maxDto - 1U));
         if (currentReadCnt == 0U)
         {
-          currentReadCnt = ((uint8_t)xcpMaxDto - 1U);
+          currentReadCnt = ((uint8_t)loader->maxDto - 1U);
         }
 
         /* Upload some data */
-        if (XcpLoaderSendCmdUpload(&data[bufferOffset], currentReadCnt) != TBX_OK)
+        if (XcpLoaderSendCmdUpload(loader, &data[bufferOffset],
+                                   currentReadCnt) != TBX_OK)
         {
           /* Could not upload the data. Flag error and request the loop to stop. */
           result = TBX_ERROR;
@@ -557,103 +695,968 @@ static uint8_t XcpLoaderReadData(uint32_t address, uint32_t len, uint8_t * data)
 
 
 /************************************************************************************//**
-** \brief     Transmits an XCP packet on the transport layer and attempts to receive the
-**            response packet within the specified timeout. Note that this function is
-**            blocking.
-** \param     txPacket Pointer to the packet to transmit.
-** \param     rxPacket Pointer where the received packet info is stored.
-** \param     timeout Maximum time in milliseconds to wait for the reception of the
-**            response packet.
-** \return    TBX_OK if successful and a response packet was received, TBX_ERROR
-**            otherwise.
+** \brief     Starts the asynchronous programming of the specified data to memory. This
+**            function does not block. The operation is continued by XcpLoaderTask(). In
+**            case of non-volatile memory, the application needs to make sure the memory
+**            range was erased beforehand.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
+** \param     address The starting memory address for the write operation.
+** \param     len The number of bytes in the data buffer that should be written.
+** \param     data Pointer to the byte array with data to write. It must stay valid until
+**            the operation completed.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderWriteDataAsync(void * instance, uint32_t address, uint32_t len,
+                                       uint8_t const * data)
+{
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+
+  /* Check parameters. */
+  TBX_ASSERT((data != NULL) && (len > 0U));
+
+  /* Only continue with valid parameters, when actually connected, when no other
+   * operation is in progress and maxProgCto has a valid length.
+   */
+  if ((data != NULL) && (len > 0U) && (loader->connected == TBX_TRUE) &&
+      (loader->async.status != SESSION_STATUS_BUSY) && (loader->maxProgCto > 2U) &&
+      (loader->maxProgCto <= PORT_XCP_PACKET_SIZE_MAX))
+  {
+    /* Store the data to program. There is no memory to erase. */
+    loader->async.data = data;
+    loader->async.len = len;
+    loader->async.clearLen = 0U;
+    /* Start the operation by setting the MTA pointer. */
+    result = XcpLoaderAsyncStart(loader, address);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderWriteDataAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the asynchronous erase of the specified range of memory on the
+**            target. This function does not block. The operation is continued by
+**            XcpLoaderTask(). This way other work can be done, while the target erases
+**            its memory, which can take several seconds.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
+** \param     address The starting memory address for the erase operation.
+** \param     len The total number of bytes to erase from memory.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderClearMemoryAsync(void * instance, uint32_t address, uint32_t len)
+{
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+
+  /* Verify parameters. */
+  TBX_ASSERT(len > 0U);
+
+  /* Only continue with valid parameter, when actually connected and when no other
+   * operation is in progress.
+   */
+  if ((len > 0U) && (loader->connected == TBX_TRUE) &&
+      (loader->async.status != SESSION_STATUS_BUSY))
+  {
+    /* Store the number of bytes to erase. There is no data to program. */
+    loader->async.data = NULL;
+    loader->async.len = 0U;
+    loader->async.clearLen = len;
+    /* Start the operation by setting the MTA pointer. */
+    result = XcpLoaderAsyncStart(loader, address);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderClearMemoryAsync ***/
+
+
+/************************************************************************************//**
+** \brief     Continues the asynchronous operation that is in progress. It processes
+**            received response packets and sends the next request packets.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
+** \param     wait TBX_TRUE to wait for the response packets, until the operation
+**            completed, TBX_FALSE to never wait for the reception of a packet.
+** \return    SESSION_STATUS_BUSY while the operation is still in progress,
+**            SESSION_STATUS_DONE when it completed successfully or when no operation was
+**            started, SESSION_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderTask(void * instance, uint8_t wait)
+{
+  tXcpLoader * loader = instance;
+
+  /* Process the state machine. */
+  return XcpLoaderAsyncProcess(loader, wait);
+} /*** end of XcpLoaderTask ***/
+
+
+/************************************************************************************//**
+** \brief     Requests the bootloader to build a checksum over the specified range of
+**            memory. The bootloader can report that the range exceeds the maximum
+**            number of bytes that it builds a checksum over. In this case the checksum
+**            is built over this maximum number of bytes instead. The maximum is
+**            remembered, such that later requests are limited right away.
+** \param     instance Pointer to the instance, as created by XcpLoaderCreate().
+** \param     address The starting memory address of the range.
+** \param     len Pointer to the number of bytes in the range. The number of bytes that
+**            the checksum was actually built over, is written to this pointer. It can
+**            be less, if the bootloader limits the number of bytes.
+** \param     type The checksum type that the bootloader used, is written to this
+**            pointer. It is one of the CHECKSUM_TYPE_xxx values.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderBuildChecksum(void * instance, uint32_t address, uint32_t * len,
+                                      uint8_t * type, uint32_t * checksum)
+{
+  tXcpLoader * loader = instance;
+  uint8_t      result = TBX_ERROR;
+  uint8_t      retry = TBX_TRUE;
+  uint32_t     blockLen;
+
+  /* Verify parameters. */
+  TBX_ASSERT((len != NULL) && (type != NULL) && (checksum != NULL));
+
+  /* Only continue with valid parameters and when actually connected. */
+  if ((len != NULL) && (type != NULL) && (checksum != NULL) &&
+      (loader->connected == TBX_TRUE))
+  {
+    blockLen = *len;
+    /* Request the checksum. Retry with a smaller number of bytes, each time that the
+     * slave reports a maximum that is smaller than the number of bytes requested. This
+     * ends, because the maximum only decreases.
+     */
+    while ((retry == TBX_TRUE) && (blockLen > 0U))
+    {
+      retry = TBX_FALSE;
+      /* Respect the maximum number of bytes that the slave reported before. */
+      if ((loader->checksumMax > 0U) && (blockLen > loader->checksumMax))
+      {
+        blockLen = loader->checksumMax;
+      }
+      /* First set the MTA pointer. */
+      if (XcpLoaderSendCmdSetMta(loader, address) != TBX_OK)
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+      /* Now request the checksum. */
+      else if (XcpLoaderSendCmdBuildChecksum(loader, blockLen, type,
+                                             checksum) == TBX_OK)
+      {
+        /* Checksum obtained. Report the number of bytes it was built over. */
+        *len = blockLen;
+        result = TBX_OK;
+      }
+      /* Did the slave just report a smaller maximum? */
+      else if ((loader->checksumMax > 0U) && (blockLen > loader->checksumMax))
+      {
+        retry = TBX_TRUE;
+      }
+      else
+      {
+        /* Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderBuildChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Starts the asynchronous operation by sending the SET MTA command. The
+**            operation specific information must already be stored. The SET MTA
+**            command is skipped, if the MTA of the slave already holds the address.
+**            For example when programming data that directly follows the previously
+**            programmed data.
+** \param     address The memory address to set the MTA pointer to.
+** \return    TBX_OK if the operation was started, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderAsyncStart(tXcpLoader * loader, uint32_t address)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* Does the MTA of the slave already hold the address? */
+  if ((loader->mtaValid == TBX_TRUE) && (loader->mta == address))
+  {
+    /* Operation started. Continue right away with the erase or program request. */
+    if (loader->async.clearLen > 0U)
+    {
+      loader->async.state = XCPLOADER_ASYNC_STATE_CLEAR;
+    }
+    else
+    {
+      loader->async.state = XCPLOADER_ASYNC_STATE_PROGRAM;
+    }
+    loader->async.status = SESSION_STATUS_BUSY;
+    result = TBX_OK;
+  }
+  else
+  {
+    result = XcpLoaderAsyncSendSetMta(loader, address);
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderAsyncStart ***/
+
+
+/************************************************************************************//**
+** \brief     Sends the SET MTA command of the asynchronous operation.
+** \param     address The memory address to set the MTA pointer to.
+** \return    TBX_OK if the command was sent, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderAsyncSendSetMta(tXcpLoader * loader, uint32_t address)
+{
+  uint8_t result = TBX_ERROR;
+
+  /* The MTA of the slave is only known again, once the response is received. */
+  loader->mta = address;
+  loader->mtaValid = TBX_FALSE;
+  /* Prepare the SET MTA command packet. */
+  loader->async.reqPacket.data[0] = XCPLOADER_CMD_SET_MTA;
+  loader->async.reqPacket.data[1] = 0U; /* Reserved. */
+  loader->async.reqPacket.data[2] = 0U; /* Reserved. */
+  loader->async.reqPacket.data[3] = 0U; /* Address extension not supported. */
+  /* Set the address taking into account byte ordering. */
+  XcpLoaderSetOrderedLong(loader, address, &loader->async.reqPacket.data[4]);
+  loader->async.reqPacket.len = 8U;
+  /* Send the request packet. */
+  if (XcpStartExchangePacket(loader, &loader->async.reqPacket,
+                             loader->settings.timeoutT1) == TBX_OK)
+  {
+    /* Operation started. Continue by waiting for the response. */
+    loader->async.state = XCPLOADER_ASYNC_STATE_SET_MTA;
+    loader->async.status = SESSION_STATUS_BUSY;
+    result = TBX_OK;
+  }
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderAsyncSendSetMta ***/
+
+
+/************************************************************************************//**
+** \brief     Processes the asynchronous operation state machine. It processes received
+**            response packets and sends the next request packets.
+** \param     wait TBX_TRUE to wait for a response packet with the help of the port, in
+**            case it supports blocking reception, TBX_FALSE to never wait.
+** \return    SESSION_STATUS_BUSY while the operation is still in progress,
+**            SESSION_STATUS_DONE when it completed successfully or when no operation was
+**            started, SESSION_STATUS_ERROR when it completed with an error.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderAsyncProcess(tXcpLoader * loader, uint8_t wait)
+{
+  uint8_t        continueLoop = TBX_TRUE;
+  uint8_t        exchangeStatus;
+  tPortXcpPacket resPacket;
+
+  /* Keep processing the state machine until the operation completed or until it needs
+   * to wait for something.
+   */
+  while ((loader->async.status == SESSION_STATUS_BUSY) && (continueLoop == TBX_TRUE))
+  {
+    switch (loader->async.state)
+    {
+      /* Waiting for the response of the SET MTA, program or erase command. */
+      case XCPLOADER_ASYNC_STATE_SET_MTA:
+      case XCPLOADER_ASYNC_STATE_PROGRAM_RES:
+      case XCPLOADER_ASYNC_STATE_CLEAR_RES:
+        /* Check if the response packet was received. */
+        exchangeStatus = XcpPollExchangePacket(loader, &resPacket, wait);
+        if (exchangeStatus == SESSION_STATUS_BUSY)
+        {
+          /* Nothing received yet. Continue waiting the next time. */
+          continueLoop = TBX_FALSE;
+        }
+        else if ( (exchangeStatus == SESSION_STATUS_DONE) && (resPacket.len == 1U) &&
+                  (resPacket.data[0U] == XCPLOADER_CMD_PID_RES) )
+        {
+          /* Valid response. Continue with the erase, if one is still pending, or
+           * with the next data to program. The latter completes the operation, if
+           * there is no more data to program.
+           */
+          StatsRecordCommand(loader->stats, loader->async.reqPacket.data[0],
+                             STATS_RESULT_OK, loader->async.reqPacket.len, resPacket.len,
+                             loader->async.txTime);
+          /* The slave's MTA is known again, once it confirmed the SET MTA. */
+          if (loader->async.state == XCPLOADER_ASYNC_STATE_SET_MTA)
+          {
+            loader->mtaValid = TBX_TRUE;
+          }
+          if (loader->async.clearLen > 0U)
+          {
+            loader->async.state = XCPLOADER_ASYNC_STATE_CLEAR;
+          }
+          else
+          {
+            loader->async.state = XCPLOADER_ASYNC_STATE_PROGRAM;
+          }
+        }
+        else
+        {
+          /* Response timeout or not a valid or positive response. Flag the error. */
+          if (exchangeStatus == SESSION_STATUS_DONE)
+          {
+            StatsRecordCommand(loader->stats, loader->async.reqPacket.data[0],
+                               STATS_RESULT_NEGATIVE, loader->async.reqPacket.len,
+                               resPacket.len, loader->async.txTime);
+          }
+          else
+          {
+            StatsRecordCommand(loader->stats, loader->async.reqPacket.data[0],
+                               STATS_RESULT_TIMEOUT, loader->async.reqPacket.len, 0U,
+                               loader->async.txTime);
+          }
+          XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+        }
+        break;
+
+      /* Ready to program the next data. */
+      case XCPLOADER_ASYNC_STATE_PROGRAM:
+        /* All data programmed? */
+        if (loader->async.len == 0U)
+        {
+          /* Operation completed successfully. */
+          XcpLoaderAsyncFinish(loader, SESSION_STATUS_DONE);
+        }
+        /* Perform block mode programming of the data, if supported by the slave. */
+        else if (loader->pgmMasterBlockMode == TBX_TRUE)
+        {
+          /* Determine the number of data bytes in the block. This is limited by the
+           * number of packets in a block and the 8-bit number of elements parameter of
+           * the PROGRAM command. Note that the uint8_t typecast is okay, because the
+           * value was limited to UINT8_MAX.
+           */
+          loader->async.blockRemaining = UINT8_MAX;
+          if (((uint32_t)loader->pgmMaxBs * ((uint32_t)loader->maxProgCto - 2U)) <
+              UINT8_MAX)
+          {
+            loader->async.blockRemaining = (uint8_t)(loader->pgmMaxBs *
+                                                     (loader->maxProgCto - 2U));
+          }
+          if (loader->async.len < loader->async.blockRemaining)
+          {
+            loader->async.blockRemaining = (uint8_t)loader->async.len;
+          }
+          /* The first packet of the block is the PROGRAM command. */
+          loader->async.reqPacket.data[0] = XCPLOADER_CMD_PROGRAM;
+          loader->async.state = XCPLOADER_ASYNC_STATE_PROGRAM_BLOCK;
+          XcpLoaderAsyncSendBlockPacket(loader);
+        }
+        /* Perform segmented programming of the data. */
+        else
+        {
+          XcpLoaderAsyncSendProgram(loader);
+        }
+        break;
+
+      /* Sending the packets of a block. */
+      case XCPLOADER_ASYNC_STATE_PROGRAM_BLOCK:
+        /* Only send the next packet after the minimum separation time elapsed. */
+        if (XcpSeparationTimeElapsed(loader) == TBX_TRUE)
+        {
+          XcpLoaderAsyncSendBlockPacket(loader);
+        }
+        else
+        {
+          /* Continue sending the block the next time. */
+          continueLoop = TBX_FALSE;
+        }
+        break;
+
+      /* Ready to erase the memory. */
+      case XCPLOADER_ASYNC_STATE_CLEAR:
+        XcpLoaderAsyncSendClear(loader);
+        break;
+
+      /* Invalid state. Should not happen. */
+      case XCPLOADER_ASYNC_STATE_IDLE:
+      default:
+        XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+        break;
+    }
+  }
+
+  /* Give the status back to the caller. */
+  return loader->async.status;
+} /*** end of XcpLoaderAsyncProcess ***/
+
+
+/************************************************************************************//**
+** \brief     Transmits an XCP packet on the transport layer and attempts to receive the
+**            response packet within the specified timeout. Note that this function is
+**            blocking.
+** \param     txPacket Pointer to the packet to transmit.
+** \param     rxPacket Pointer where the received packet info is stored.
+** \param     timeout Maximum time in milliseconds to wait for the reception of the
+**            response packet.
+** \return    TBX_OK if successful and a response packet was received, TBX_ERROR
+**            otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpExchangePacket(tXcpLoader * loader, tPortXcpPacket const * txPacket,
+                                 tPortXcpPacket * rxPacket, uint16_t timeout)
+{
+  uint8_t  result = TBX_ERROR;
+  uint8_t  portFcnsValid = TBX_FALSE;
+  uint32_t startTime;
+  uint32_t deltaTime;
+  uint8_t  stopReception = TBX_FALSE;
+  uint32_t statsStartTime;
+
+  /* Check parameters. */
+  TBX_ASSERT((txPacket != NULL) && (rxPacket != NULL) && (timeout > 0U));
+
+  /* A few port specific function will be used. Make sure they are valid before calling
+   * them.
+   */
+  if (loader->port != NULL)
+  {
+    /* Assume the port functions are okay and only flag an error when one is not okay.
+     * Note that when combining these conditionals, the MISRA check complains about
+     * side effects, so do them individually.
+     */
+    portFcnsValid = TBX_TRUE;
+    if (loader->port->SystemGetTime == NULL)     { portFcnsValid = TBX_FALSE; }
+    if (loader->port->XcpTransmitPacket == NULL) { portFcnsValid = TBX_FALSE; }
+    if (loader->port->XcpReceivePacket == NULL)  { portFcnsValid = TBX_FALSE; }
+  }
+  TBX_ASSERT(portFcnsValid == TBX_TRUE);
+
+  /* Only continue if the parameters and the port functions are valid. Also make sure no
+   * asynchronous operation is in progress, because its response packets would otherwise
+   * get mixed up with the one of this packet exchange.
+   */
+  if ( (txPacket != NULL) && (rxPacket != NULL) && (timeout > 0U) &&
+       (portFcnsValid == TBX_TRUE) && (loader->async.status != SESSION_STATUS_BUSY) )
+  {
+    /* Set the result to success at this point and only update it upon error. */
+    result = TBX_OK;
+
+    /* Request the port to transmit the XCP packet using the application's implemented
+     * transport layer.
+     */
+    statsStartTime = StatsGetTime(loader->port);
+    if (loader->port->XcpTransmitPacket(txPacket) != TBX_OK)
+    {
+      /* Flag error. */
+      result = TBX_ERROR;
+    }
+
+    /* Only continue if all is okay so far. */
+    if (result == TBX_OK)
+    {
+      /* Store the start time of the response reception. */
+      startTime = loader->port->SystemGetTime();
+
+      /* Attempt to receive the XCP response packet within the timeout in a blocking
+       * manner. Let the port perform the blocking, if it supports this.
+       */
+      if (loader->port->XcpReceivePacketTimeout != NULL)
+      {
+        if (loader->port->XcpReceivePacketTimeout(rxPacket, timeout) != TBX_TRUE)
+        {
+          /* Reception timeout occurred. Update the result to reflect this. */
+          result = TBX_ERROR;
+        }
+        /* Reception already completed, so skip the polling loop. */
+        stopReception = TBX_TRUE;
+      }
+      while (stopReception == TBX_FALSE)
+      {
+        /* Check if a new XCP reponse package was received. */
+        if (loader->port->XcpReceivePacket(rxPacket) == TBX_TRUE)
+        {
+          /* Response complete, so stop looping. */
+          stopReception = TBX_TRUE;
+        }
+        /* Check if the timeout time elapsed before continuing with the XCP packet
+         * reception.
+         */
+        else
+        {
+          /* Calculate elapsed time while waiting for the XCP response packet. Note that
+           * this calculation is 32-bit time overflow safe.
+           */
+          deltaTime = loader->port->SystemGetTime() - startTime;
+          if (deltaTime > timeout)
+          {
+            /* Reception timeout occurred. Update the result to reflect this and stop
+             * looping.
+             */
+            result = TBX_ERROR;
+            stopReception = TBX_TRUE;
+          }
+        }
+      }
+    }
+
+    /* Record the statistics of the packet exchange. */
+    if (result != TBX_OK)
+    {
+      StatsRecordCommand(loader->stats, txPacket->data[0], STATS_RESULT_TIMEOUT,
+                         txPacket->len, 0U, statsStartTime);
+    }
+    else if (rxPacket->data[0] != XCPLOADER_CMD_PID_RES)
+    {
+      StatsRecordCommand(loader->stats, txPacket->data[0], STATS_RESULT_NEGATIVE,
+                         txPacket->len, rxPacket->len, statsStartTime);
+    }
+    else
+    {
+      StatsRecordCommand(loader->stats, txPacket->data[0], STATS_RESULT_OK,
+                         txPacket->len, rxPacket->len, statsStartTime);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpExchangePacket ***/
+
+
+/************************************************************************************//**
+** \brief     Transmits an XCP packet on the transport layer, without waiting for a
+**            response packet. Used for the packets inside a block, for which the slave
+**            does not send a response.
+** \param     txPacket Pointer to the packet to transmit.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpSendPacket(tXcpLoader * loader, tPortXcpPacket const * txPacket)
+{
+  uint8_t result = TBX_ERROR;
+  uint8_t portFcnsValid = TBX_FALSE;
+
+  /* Check parameters. */
+  TBX_ASSERT(txPacket != NULL);
+
+  /* A port specific function will be used. Make sure it is valid before calling. */
+  if (loader->port != NULL)
+  {
+    if (loader->port->XcpTransmitPacket != NULL)
+    {
+      portFcnsValid = TBX_TRUE;
+    }
+  }
+  TBX_ASSERT(portFcnsValid == TBX_TRUE);
+
+  /* Only continue if the parameter and the port function are valid. */
+  if ( (txPacket != NULL) && (portFcnsValid == TBX_TRUE) )
+  {
+    /* Request the port to transmit the XCP packet using the application's implemented
+     * transport layer.
+     */
+    result = loader->port->XcpTransmitPacket(txPacket);
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpSendPacket ***/
+
+
+/************************************************************************************//**
+** \brief     Transmits an XCP packet on the transport layer and starts the timeout
+**            time for the reception of the response packet. Use XcpPollExchangePacket()
+**            to check for the reception of the response packet, without blocking.
+** \param     txPacket Pointer to the packet to transmit.
+** \param     timeout Maximum time in milliseconds to wait for the reception of the
+**            response packet.
+** \return    TBX_OK if the packet was transmitted, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpStartExchangePacket(tXcpLoader * loader,
+                                      tPortXcpPacket const * txPacket, uint16_t timeout)
+{
+  uint8_t result = TBX_ERROR;
+  uint8_t portFcnsValid = TBX_FALSE;
+
+  /* Check parameters. */
+  TBX_ASSERT((txPacket != NULL) && (timeout > 0U));
+
+  /* A port specific function will be used. Make sure it is valid before calling. */
+  if (loader->port != NULL)
+  {
+    if (loader->port->SystemGetTime != NULL)
+    {
+      portFcnsValid = TBX_TRUE;
+    }
+  }
+  TBX_ASSERT(portFcnsValid == TBX_TRUE);
+
+  /* Only continue if the parameters and the port function are valid. */
+  if ( (txPacket != NULL) && (timeout > 0U) && (portFcnsValid == TBX_TRUE) )
+  {
+    /* Send the packet. */
+    result = XcpSendPacket(loader, txPacket);
+    /* Store the start time and the timeout of the response reception. */
+    loader->async.txTime = loader->port->SystemGetTime();
+    loader->async.timeout = timeout;
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpStartExchangePacket ***/
+
+
+/************************************************************************************//**
+** \brief     Checks if the response packet to the packet that was transmitted with
+**            XcpStartExchangePacket() was received. This function does not block,
+**            unless waiting is requested and the port supports blocking reception.
+** \param     rxPacket Pointer where the received packet info is stored.
+** \param     wait TBX_TRUE to let the port block until the response packet was received
+**            or the timeout time elapsed, TBX_FALSE to never block.
+** \return    SESSION_STATUS_BUSY if the response packet was not yet received,
+**            SESSION_STATUS_DONE if the response packet was received and
+**            SESSION_STATUS_ERROR if it was not received within the timeout time.
+**
+****************************************************************************************/
+static uint8_t XcpPollExchangePacket(tXcpLoader * loader, tPortXcpPacket * rxPacket,
+                                     uint8_t wait)
+{
+  uint8_t  result = SESSION_STATUS_ERROR;
+  uint8_t  portFcnsValid = TBX_FALSE;
+  uint8_t  received = TBX_FALSE;
+  uint32_t deltaTime;
+
+  /* Check parameters. */
+  TBX_ASSERT(rxPacket != NULL);
+
+  /* A few port specific function will be used. Make sure they are valid before calling
+   * them.
+   */
+  if (loader->port != NULL)
+  {
+    /* Assume the port functions are okay and only flag an error when one is not okay.
+     * Note that when combining these conditionals, the MISRA check complains about
+     * side effects, so do them individually.
+     */
+    portFcnsValid = TBX_TRUE;
+    if (loader->port->SystemGetTime == NULL)     { portFcnsValid = TBX_FALSE; }
+    if (loader->port->XcpReceivePacket == NULL)  { portFcnsValid = TBX_FALSE; }
+  }
+  TBX_ASSERT(portFcnsValid == TBX_TRUE);
+
+  /* Only continue if the parameter and the port functions are valid. */
+  if ( (rxPacket != NULL) && (portFcnsValid == TBX_TRUE) )
+  {
+    /* Calculate elapsed time while waiting for the XCP response packet. Note that this
+     * calculation is 32-bit time overflow safe.
+     */
+    deltaTime = loader->port->SystemGetTime() - loader->async.txTime;
+    /* Let the port block for the remainder of the timeout time, if requested and
+     * supported.
+     */
+    if ( (wait == TBX_TRUE) && (loader->port->XcpReceivePacketTimeout != NULL) &&
+         (deltaTime < loader->async.timeout) )
+    {
+      received = loader->port->XcpReceivePacketTimeout(rxPacket,
+                                                    loader->async.timeout - deltaTime);
+    }
+    /* Otherwise just check if a new XCP reponse package was received. */
+    else
+    {
+      received = loader->port->XcpReceivePacket(rxPacket);
+    }
+    /* Check if a new XCP reponse package was received. */
+    if (received == TBX_TRUE)
+    {
+      /* Response received. */
+      result = SESSION_STATUS_DONE;
+    }
+    else
+    {
+      /* Update the elapsed time while waiting for the XCP response packet. */
+      deltaTime = loader->port->SystemGetTime() - loader->async.txTime;
+      /* Still waiting for the response, if the timeout did not yet elapse. */
+      if (deltaTime <= loader->async.timeout)
+      {
+        result = SESSION_STATUS_BUSY;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpPollExchangePacket ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if the minimum separation time, that the slave requires in
+**            between the packets of a block, elapsed since the last packet was
+**            transmitted. The separation time is specified in units of 100 microseconds,
+**            while the port offers a millisecond time reference. The separation time is
+**            therefore rounded up to make sure it is never too short.
+** \return    TBX_TRUE if the separation time elapsed, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpSeparationTimeElapsed(tXcpLoader const * loader)
+{
+  uint8_t  result = TBX_TRUE;
+  uint32_t minStMs;
+
+  /* Convert the separation time to milliseconds, while rounding up. */
+  minStMs = ((uint32_t)loader->pgmMinSt + 9U) / 10U;
+
+  /* Only check the time if a separation time is needed and the port's time function is
+   * valid.
+   */
+  if ( (minStMs > 0U) && (loader->port != NULL) )
+  {
+    if (loader->port->SystemGetTime != NULL)
+    {
+      /* More than the separation time must have elapsed. More than, because the
+       * transmit time could have been sampled right before the millisecond time
+       * incremented. Note that this calculation is 32-bit time overflow safe.
+       */
+      if ((loader->port->SystemGetTime() - loader->async.txTime) <= minStMs)
+      {
+        result = TBX_FALSE;
+      }
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpSeparationTimeElapsed ***/
+
+
+/************************************************************************************//**
+** \brief     Sends the next data of the asynchronous write operation with the XCP
+**            PROGRAM or PROGRAM MAX command, whichever makes optimal use of the
+**            available packet data.
+**
+****************************************************************************************/
+static void XcpLoaderAsyncSendProgram(tXcpLoader * loader)
+{
+  uint8_t currentWriteCnt;
+  uint8_t cnt;
+
+  /* Set the current write length to make optimal use of the available packet data. Note
+   * that the uin8_t typecast on maxProgCto is okay, because a compile time
+   * plausibility check is performed on macro PORT_XCP_PACKET_SIZE_MAX, to make sure it
+   * fits in unsigned 8-bit.
+   */
+  currentWriteCnt = (uint8_t)(loader->async.len % ((uint32_t)loader->maxProgCto - 1U));
+  /* Is the current length a perfect fit for the PROGRAM_MAX command? */
+  if (currentWriteCnt == 0U)
+  {
+    currentWriteCnt = ((uint8_t)loader->maxProgCto - 1U);
+    /* Prepare the PROGRAM MAX command request packet. */
+    loader->async.reqPacket.data[0] = XCPLOADER_CMD_PROGRAM_MAX;
+    for (cnt = 0U; cnt < currentWriteCnt; cnt++)
+    {
+      loader->async.reqPacket.data[cnt + 1U] = loader->async.data[cnt];
+    }
+    loader->async.reqPacket.len = currentWriteCnt + 1U;
+  }
+  /* Use the PROGRAM command instead. */
+  else
+  {
+    /* Prepare the PROGRAM command request packet. */
+    loader->async.reqPacket.data[0] = XCPLOADER_CMD_PROGRAM;
+    loader->async.reqPacket.data[1] = currentWriteCnt;
+    for (cnt = 0U; cnt < currentWriteCnt; cnt++)
+    {
+      loader->async.reqPacket.data[cnt + 2U] = loader->async.data[cnt];
+    }
+    loader->async.reqPacket.len = currentWriteCnt + 2U;
+  }
+  /* Update the data that still needs to be sent. */
+  loader->async.data = &loader->async.data[currentWriteCnt];
+  loader->async.len -= currentWriteCnt;
+  /* The slave increments its MTA by the number of programmed bytes. */
+  loader->mta += currentWriteCnt;
+
+  /* Send the request packet. */
+  if (XcpStartExchangePacket(loader, &loader->async.reqPacket,
+                             loader->settings.timeoutT5) == TBX_OK)
+  {
+    /* Continue by waiting for the response. */
+    loader->async.state = XCPLOADER_ASYNC_STATE_PROGRAM_RES;
+  }
+  else
+  {
+    /* Could not send the packet. Flag the error. */
+    XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+  }
+} /*** end of XcpLoaderAsyncSendProgram ***/
+
+
+/************************************************************************************//**
+** \brief     Sends the next packet of the block that is currently being programmed. The
+**            first packet of the block is an XCP PROGRAM command with the total number
+**            of bytes in the block. The other packets are XCP PROGRAM NEXT commands with
+**            the remaining number of bytes in the block. The slave only sends a response
+**            to the last packet in the block.
+**
+****************************************************************************************/
+static void XcpLoaderAsyncSendBlockPacket(tXcpLoader * loader)
+{
+  uint8_t currentLen;
+  uint8_t cnt;
+
+  /* Determine the number of data bytes for this packet. */
+  currentLen = (uint8_t)loader->maxProgCto - 2U;
+  if (currentLen > loader->async.blockRemaining)
+  {
+    currentLen = loader->async.blockRemaining;
+  }
+  /* Complete the packet. Note that the command code was already set. */
+  loader->async.reqPacket.data[1] = loader->async.blockRemaining;
+  for (cnt = 0U; cnt < currentLen; cnt++)
+  {
+    loader->async.reqPacket.data[cnt + 2U] = loader->async.data[cnt];
+  }
+  loader->async.reqPacket.len = currentLen + 2U;
+  /* Update the data that still needs to be sent. */
+  loader->async.data = &loader->async.data[currentLen];
+  loader->async.len -= currentLen;
+  loader->async.blockRemaining -= currentLen;
+  /* The slave increments its MTA by the number of programmed bytes. */
+  loader->mta += currentLen;
+
+  /* Is this the last packet in the block? */
+  if (loader->async.blockRemaining == 0U)
+  {
+    /* Send the request packet, for which the response packet is expected. */
+    if (XcpStartExchangePacket(loader, &loader->async.reqPacket,
+                               loader->settings.timeoutT5) == TBX_OK)
+    {
+      /* Continue by waiting for the response of the entire block. */
+      loader->async.state = XCPLOADER_ASYNC_STATE_PROGRAM_RES;
+    }
+    else
+    {
+      /* Could not send the packet. Flag the error. */
+      XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+    }
+  }
+  /* Not the last packet, so no response is to be expected. */
+  else
+  {
+    /* Send the packet, while storing its transmit time for the separation time. */
+    if (XcpStartExchangePacket(loader, &loader->async.reqPacket,
+                               loader->settings.timeoutT5) == TBX_OK)
+    {
+      StatsRecordCommand(loader->stats, loader->async.reqPacket.data[0],
+                         STATS_RESULT_NO_RESPONSE, loader->async.reqPacket.len, 0U,
+                         loader->async.txTime);
+      /* The next packets in the block are PROGRAM NEXT commands. */
+      loader->async.reqPacket.data[0] = XCPLOADER_CMD_PROGRAM_NEXT;
+    }
+    else
+    {
+      /* Could not send the packet. Flag the error. */
+      XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+    }
+  }
+} /*** end of XcpLoaderAsyncSendBlockPacket ***/
+
+
+/************************************************************************************//**
+** \brief     Sends the XCP PROGRAM CLEAR command of the asynchronous erase operation.
+**            Its response is received with the erase timeout.
 **
 ****************************************************************************************/
-static uint8_t XcpExchangePacket(tPortXcpPacket const * txPacket,
-                                 tPortXcpPacket * rxPacket, uint16_t timeout)
+static void XcpLoaderAsyncSendClear(tXcpLoader * loader)
 {
-  uint8_t  result = TBX_ERROR;
-  uint8_t  portFcnsValid = TBX_FALSE;
-  uint32_t startTime;
-  uint32_t deltaTime;
-  uint8_t  stopReception = TBX_FALSE;
+  /* Prepare the command packet. */
+  loader->async.reqPacket.data[0] = XCPLOADER_CMD_PROGRAM_CLEAR;
+  loader->async.reqPacket.data[1] = 0U; /* Use absolute mode. */
+  loader->async.reqPacket.data[2] = 0U; /* Reserved. */
+  loader->async.reqPacket.data[3] = 0U; /* Reserved. */
+  /* Set the erase length taking into account byte ordering. */
+  XcpLoaderSetOrderedLong(loader, loader->async.clearLen,
+                          &loader->async.reqPacket.data[4]);
+  loader->async.reqPacket.len = 8U;
+  /* The erase is no longer pending, once its command is sent. */
+  loader->async.clearLen = 0U;
+  /* Do not rely on the slave's MTA after an erase. */
+  loader->mtaValid = TBX_FALSE;
+
+  /* Send the request packet. */
+  if (XcpStartExchangePacket(loader, &loader->async.reqPacket,
+                             loader->settings.timeoutT4) == TBX_OK)
+  {
+    /* Continue by waiting for the response. */
+    loader->async.state = XCPLOADER_ASYNC_STATE_CLEAR_RES;
+  }
+  else
+  {
+    /* Could not send the packet. Flag the error. */
+    XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+  }
+} /*** end of XcpLoaderAsyncSendClear ***/
 
-  /* Check parameters. */
-  TBX_ASSERT((txPacket != NULL) && (rxPacket != NULL) && (timeout > 0U));
 
-  /* A few port specific function will be used. Make sure they are valid before calling
-   * them.
-   */
-  if (PortGet() != NULL)
+/************************************************************************************//**
+** \brief     Completes the asynchronous operation that is in progress.
+** \param     status The status to complete the operation with (SESSION_STATUS_xxx).
+**
+****************************************************************************************/
+static void XcpLoaderAsyncFinish(tXcpLoader * loader, uint8_t status)
+{
+  /* Update the status and go back to the idle state. */
+  loader->async.status = status;
+  loader->async.state = XCPLOADER_ASYNC_STATE_IDLE;
+  /* The MTA of the slave is not known after an error. */
+  if (status == SESSION_STATUS_ERROR)
   {
-    /* Assume the port functions are okay and only flag an error when one is not okay.
-     * Note that when combining these conditionals, the MISRA check complains about
-     * side effects, so do them individually.
-     */
-    portFcnsValid = TBX_TRUE;
-    if (PortGet()->SystemGetTime == NULL)     { portFcnsValid = TBX_FALSE; }
-    if (PortGet()->XcpTransmitPacket == NULL) { portFcnsValid = TBX_FALSE; }
-    if (PortGet()->XcpReceivePacket == NULL)  { portFcnsValid = TBX_FALSE; }
+    loader->mtaValid = TBX_FALSE;
   }
-  TBX_ASSERT(portFcnsValid == TBX_TRUE);
+} /*** end of XcpLoaderAsyncFinish ***/
 
-  /* Only continue if the parameters and the port functions are valid. */
-  if ( (txPacket != NULL) && (rxPacket != NULL) && (timeout > 0U) &&
-       (portFcnsValid == TBX_TRUE) )
-  {
-    /* Set the result to success at this point and only update it upon error. */
-    result = TBX_OK;
 
-    /* Request the port to transmit the XCP packet using the application's implemented
-     * transport layer.
-     */
-    if (PortGet()->XcpTransmitPacket(txPacket) != TBX_OK)
-    {
-      /* Flag error. */
-      result = TBX_ERROR;
-    }
+/************************************************************************************//**
+** \brief     Aborts the asynchronous operation that is still in progress. A response
+**            packet that the slave still owes is first awaited, until it is received or
+**            until its timeout time elapsed. Afterwards all packets that were already
+**            received are discarded. This prevents a late response from being taken as
+**            the response to the next command.
+** \param     loader Pointer to the loader instance.
+**
+****************************************************************************************/
+static void XcpLoaderAsyncAbort(tXcpLoader * loader)
+{
+  uint8_t        exchangeStatus = SESSION_STATUS_DONE;
+  uint8_t        received = TBX_TRUE;
+  tPortXcpPacket resPacket;
 
-    /* Only continue if all is okay so far. */
-    if (result == TBX_OK)
+  /* Wait for the response packet of the request in progress, if any. */
+  if ( (loader->async.state == XCPLOADER_ASYNC_STATE_SET_MTA) ||
+       (loader->async.state == XCPLOADER_ASYNC_STATE_PROGRAM_RES) ||
+       (loader->async.state == XCPLOADER_ASYNC_STATE_CLEAR_RES) )
+  {
+    exchangeStatus = SESSION_STATUS_BUSY;
+  }
+  while (exchangeStatus == SESSION_STATUS_BUSY)
+  {
+    exchangeStatus = XcpPollExchangePacket(loader, &resPacket, TBX_TRUE);
+  }
+  /* Discard all packets that were already received, such as an error response to one
+   * of the packets of a block.
+   */
+  if (loader->port != NULL)
+  {
+    if (loader->port->XcpReceivePacket != NULL)
     {
-      /* Store the start time of the response reception. */
-      startTime = PortGet()->SystemGetTime();
-
-      /* Attempt to receive the XCP response packet within the timeout in a blocking
-       * manner.
-       */
-      while (stopReception == TBX_FALSE)
+      while (received == TBX_TRUE)
       {
-        /* Check if a new XCP reponse package was received. */
-        if (PortGet()->XcpReceivePacket(rxPacket) == TBX_TRUE)
-        {
-          /* Response complete, so stop looping. */
-          stopReception = TBX_TRUE;
-        }
-        /* Check if the timeout time elapsed before continuing with the XCP packet
-         * reception.
-         */
-        else
-        {
-          /* Calculate elapsed time while waiting for the XCP response packet. Note that
-           * this calculation is 32-bit time overflow safe.
-           */
-          deltaTime = PortGet()->SystemGetTime() - startTime;
-          if (deltaTime > timeout)
-          {
-            /* Reception timeout occurred. Update the result to reflect this and stop
-             * looping.
-             */
-            result = TBX_ERROR;
-            stopReception = TBX_TRUE;
-          }
-        }
+        received = loader->port->XcpReceivePacket(&resPacket);
       }
     }
   }
-
-  /* Give the result back to the caller. */
-  return result;
-} /*** end of XcpExchangePacket ***/
+  /* Complete the operation with an error. */
+  XcpLoaderAsyncFinish(loader, SESSION_STATUS_ERROR);
+} /*** end of XcpLoaderAsyncAbort ***/
 
 
 /************************************************************************************//**
@@ -663,7 +1666,8 @@ static uint8_t XcpExchangePacket(tPortXcpPacket const * txPacket,
 ** \param     data Array to the buffer for storage.
 **
 ****************************************************************************************/
-static void XcpLoaderSetOrderedLong(uint32_t value, uint8_t * data)
+static void XcpLoaderSetOrderedLong(tXcpLoader const * loader, uint32_t value,
+                                    uint8_t * data)
 {
   /* Verify parameter. */
   TBX_ASSERT(data != NULL);
@@ -671,7 +1675,7 @@ static void XcpLoaderSetOrderedLong(uint32_t value, uint8_t * data)
   /* Only continue with valid parameter. */
   if (data != NULL)
   {
-    if (xcpSlaveIsIntel == TBX_TRUE)
+    if (loader->slaveIsIntel == TBX_TRUE)
     {
       data[3] = (uint8_t)(value >> 24U);
       data[2] = (uint8_t)(value >> 16U);
@@ -689,6 +1693,44 @@ static void XcpLoaderSetOrderedLong(uint32_t value, uint8_t * data)
 } /*** end of XcpLoaderSetOrderedLong ***/
 
 
+/************************************************************************************//**
+** \brief     Reads a 32-bit value from a byte buffer, taking into account Intel
+**            or Motorola byte ordering.
+** \param     data Array to the buffer with the value.
+** \return    The 32-bit value.
+**
+****************************************************************************************/
+static uint32_t XcpLoaderGetOrderedLong(tXcpLoader const * loader, uint8_t const * data)
+{
+  uint32_t result = 0U;
+
+  /* Verify parameter. */
+  TBX_ASSERT(data != NULL);
+
+  /* Only continue with valid parameter. */
+  if (data != NULL)
+  {
+    if (loader->slaveIsIntel == TBX_TRUE)
+    {
+      result  = ((uint32_t)data[3] << 24U);
+      result |= ((uint32_t)data[2] << 16U);
+      result |= ((uint32_t)data[1] <<  8U);
+      result |= (uint32_t)data[0];
+    }
+    else
+    {
+      result  = ((uint32_t)data[0] << 24U);
+      result |= ((uint32_t)data[1] << 16U);
+      result |= ((uint32_t)data[2] <<  8U);
+      result |= (uint32_t)data[3];
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderGetOrderedLong ***/
+
+
 /************************************************************************************//**
 ** \brief     Uploads the seed from the target.
 ** \param     seedPtr Byte array to store the bytes of the seed.
@@ -696,7 +1738,8 @@ static void XcpLoaderSetOrderedLong(uint32_t value, uint8_t * data)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen)
+static uint8_t XcpLoaderUploadSeed(tXcpLoader * loader, uint8_t * seedPtr,
+                                   uint8_t * seedLen)
 {
   uint8_t result = TBX_ERROR;
   uint8_t remainingLen = 0;
@@ -706,8 +1749,9 @@ static uint8_t XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen)
   /* Verify parameter. */
   TBX_ASSERT((seedPtr != NULL) && (seedLen != NULL));
 
-  /* Only continue with valid parameter and xcpMaxDto has a valid length. */
-  if ((seedPtr != NULL) && (seedLen != NULL) && (xcpMaxDto <= PORT_XCP_PACKET_SIZE_MAX))
+  /* Only continue with valid parameter and maxDto has a valid length. */
+  if ((seedPtr != NULL) && (seedLen != NULL) &&
+      (loader->maxDto <= PORT_XCP_PACKET_SIZE_MAX))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
@@ -716,10 +1760,10 @@ static uint8_t XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen)
      * is okay, because a compile time plausibility check is performed on macro
      * PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned 8-bit.
      */
-    maxSeedBytesPerDto = (uint8_t)xcpMaxDto - 2U;
+    maxSeedBytesPerDto = (uint8_t)loader->maxDto - 2U;
 
     /* Request (first part of) the seed for unlocking the programming resources. */
-    if (XcpLoaderSendCmdGetSeed(XCPLOADER_RESOURCE_PGM, 0U, &seedPtr[seedIdx],
+    if (XcpLoaderSendCmdGetSeed(loader, XCPLOADER_RESOURCE_PGM, 0U, &seedPtr[seedIdx],
         &remainingLen) != TBX_OK)
     {
       /* Could not read the first part of the seed. Flag error. */
@@ -739,8 +1783,8 @@ static uint8_t XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen)
       {
         /* Update the seed indexer for the next part. */
         seedIdx += maxSeedBytesPerDto;
-        if (XcpLoaderSendCmdGetSeed(XCPLOADER_RESOURCE_PGM, 1U, &seedPtr[seedIdx],
-            &remainingLen) != TBX_OK)
+        if (XcpLoaderSendCmdGetSeed(loader, XCPLOADER_RESOURCE_PGM, 1U,
+                                    &seedPtr[seedIdx], &remainingLen) != TBX_OK)
         {
           /* Could not read the next part of the seed. Flag error and abort. */
           result = TBX_ERROR;
@@ -762,7 +1806,8 @@ static uint8_t XcpLoaderUploadSeed(uint8_t * seedPtr, uint8_t * seedLen)
 ** \return    TBX_OK if the programming resource is unlocked, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t keyLen)
+static uint8_t XcpLoaderDownloadKeyAndUnlock(tXcpLoader * loader,
+                                             uint8_t const * keyPtr, uint8_t keyLen)
 {
   uint8_t result = TBX_ERROR;
   uint8_t currentlyProtectedResources = 0U;
@@ -774,8 +1819,8 @@ static uint8_t XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t key
   /* Verify parameters. */
   TBX_ASSERT((keyPtr != NULL) && (keyLen > 0U));
 
-  /* Only continue with valid parameters and xcpMaxCto has a valid length. */
-  if ((keyPtr != NULL) && (keyLen > 0U) && (xcpMaxCto <= PORT_XCP_PACKET_SIZE_MAX))
+  /* Only continue with valid parameters and maxCto has a valid length. */
+  if ((keyPtr != NULL) && (keyLen > 0U) && (loader->maxCto <= PORT_XCP_PACKET_SIZE_MAX))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
@@ -784,7 +1829,7 @@ static uint8_t XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t key
      * is okay, because a compile time plausibility check is performed on macro
      * PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned 8-bit.
      */
-    maxKeyBytesPerCto = (uint8_t)xcpMaxCto - 2U;
+    maxKeyBytesPerCto = (uint8_t)loader->maxCto - 2U;
 
     /* Initialize remaining length. */
     remainingLen = keyLen;
@@ -799,7 +1844,7 @@ static uint8_t XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t key
         currentLen = maxKeyBytesPerCto;
       }
       /* Send the (possible partial) unlock command. */
-      if (XcpLoaderSendCmdUnlock(&keyPtr[keyIdx], remainingLen,
+      if (XcpLoaderSendCmdUnlock(loader, &keyPtr[keyIdx], remainingLen,
           &currentlyProtectedResources) != TBX_OK)
       {
         /* Flag the error and abort the loop. */
@@ -832,7 +1877,7 @@ static uint8_t XcpLoaderDownloadKeyAndUnlock(uint8_t const * keyPtr, uint8_t key
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdConnect(void)
+static uint8_t XcpLoaderSendCmdConnect(tXcpLoader * loader)
 {
   uint8_t        result = TBX_OK;
   tPortXcpPacket reqPacket;
@@ -840,11 +1885,12 @@ static uint8_t XcpLoaderSendCmdConnect(void)
 
   /* Prepare the command request packet. */
   reqPacket.data[0] = XCPLOADER_CMD_CONNECT;
-  reqPacket.data[1] = xcpSettings.connectMode;
+  reqPacket.data[1] = loader->settings.connectMode;
   reqPacket.len = 2U;
 
   /* Send the request packet and attempt to receive the response packet. */
-  if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT6) != TBX_OK)
+  if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                        loader->settings.timeoutT6) != TBX_OK)
   {
     /* Did not receive a response packet in time. Flag the error. */
     result = TBX_ERROR;
@@ -867,35 +1913,38 @@ static uint8_t XcpLoaderSendCmdConnect(void)
     /* Store slave's byte ordering information. */
     if ((resPacket.data[2] & 0x01U) == 0U)
     {
-      xcpSlaveIsIntel = TBX_TRUE;
+      loader->slaveIsIntel = TBX_TRUE;
     }
     else
     {
-      xcpSlaveIsIntel = TBX_FALSE;
+      loader->slaveIsIntel = TBX_FALSE;
     }
     /* Store max number of bytes the slave allows for master->slave packets. */
-    xcpMaxCto = resPacket.data[3];
-    xcpMaxProgCto = xcpMaxCto;
+    loader->maxCto = resPacket.data[3];
+    loader->maxProgCto = loader->maxCto;
+    loader->pgmMasterBlockMode = TBX_FALSE;
     /* Store max number of bytes the slave allows for slave->master packets. */
-    if (xcpSlaveIsIntel == TBX_TRUE)
+    if (loader->slaveIsIntel == TBX_TRUE)
     {
-      xcpMaxDto = (uint16_t)(resPacket.data[4] + ((uint16_t)resPacket.data[5] << 8U));
+      loader->maxDto = (uint16_t)(resPacket.data[4] +
+                                  ((uint16_t)resPacket.data[5] << 8U));
     }
     else
     {
-      xcpMaxDto = (uint16_t)(resPacket.data[5] + ((uint16_t)resPacket.data[4] << 8U));
+      loader->maxDto = (uint16_t)(resPacket.data[5] +
+                                  ((uint16_t)resPacket.data[4] << 8U));
     }
     /* Double check size configuration. CTO length can be adjusted. DTO not. */
-    if (xcpMaxCto > PORT_XCP_PACKET_SIZE_MAX)
+    if (loader->maxCto > PORT_XCP_PACKET_SIZE_MAX)
     {
-      xcpMaxCto = PORT_XCP_PACKET_SIZE_MAX;
+      loader->maxCto = PORT_XCP_PACKET_SIZE_MAX;
     }
-    if (xcpMaxDto > PORT_XCP_PACKET_SIZE_MAX)
+    if (loader->maxDto > PORT_XCP_PACKET_SIZE_MAX)
     {
       /* Cannot process slave response messages of this length. Flag error. */
       result = TBX_ERROR;
     }
-    if ( (xcpMaxCto == 0U) || (xcpMaxDto == 0U) )
+    if ( (loader->maxCto == 0U) || (loader->maxDto == 0U) )
     {
       /* Invalid CTO or DTO settings detected. Flag error. */
       result = TBX_ERROR;
@@ -913,7 +1962,8 @@ static uint8_t XcpLoaderSendCmdConnect(void)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdGetStatus(uint8_t * protectedResources)
+static uint8_t XcpLoaderSendCmdGetStatus(tXcpLoader * loader,
+                                         uint8_t * protectedResources)
 {
   uint8_t        result = TBX_ERROR;
   tPortXcpPacket reqPacket;
@@ -932,7 +1982,8 @@ static uint8_t XcpLoaderSendCmdGetStatus(uint8_t * protectedResources)
     reqPacket.len = 1U;
 
     /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT1) != TBX_OK)
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
     {
       /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
@@ -967,7 +2018,7 @@ static uint8_t XcpLoaderSendCmdGetStatus(uint8_t * protectedResources)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdProgramStart(void)
+static uint8_t XcpLoaderSendCmdProgramStart(tXcpLoader * loader)
 {
   uint8_t        result = TBX_OK;
   tPortXcpPacket reqPacket;
@@ -978,7 +2029,8 @@ static uint8_t XcpLoaderSendCmdProgramStart(void)
   reqPacket.len = 1U;
 
   /* Send the request packet and attempt to receive the response packet. */
-  if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT3) != TBX_OK)
+  if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                        loader->settings.timeoutT3) != TBX_OK)
   {
     /* Did not receive a response packet in time. Flag the error. */
     result = TBX_ERROR;
@@ -1001,10 +2053,22 @@ static uint8_t XcpLoaderSendCmdProgramStart(void)
     /* Store max number of bytes the slave allows for master->slave packets during the
      * programming session.
      */
-    xcpMaxProgCto = resPacket.data[3];
-    if (xcpMaxProgCto > PORT_XCP_PACKET_SIZE_MAX)
+    loader->maxProgCto = resPacket.data[3];
+    if (loader->maxProgCto > PORT_XCP_PACKET_SIZE_MAX)
+    {
+      loader->maxProgCto = PORT_XCP_PACKET_SIZE_MAX;
+    }
+    /* Store the master block mode info for the programming session. Block mode only
+     * makes sense if at least 2 packets fit in a block and a PROGRAM packet can hold
+     * at least one data byte.
+     */
+    loader->pgmMasterBlockMode = TBX_FALSE;
+    loader->pgmMaxBs = resPacket.data[4];
+    loader->pgmMinSt = resPacket.data[5];
+    if ( ((resPacket.data[2] & XCPLOADER_COMM_MODE_PGM_MASTER_BLOCK) != 0U) &&
+         (loader->pgmMaxBs > 1U) && (loader->maxProgCto > 2U) )
     {
-      xcpMaxProgCto = PORT_XCP_PACKET_SIZE_MAX;
+      loader->pgmMasterBlockMode = TBX_TRUE;
     }
   }
 
@@ -1019,7 +2083,7 @@ static uint8_t XcpLoaderSendCmdProgramStart(void)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdProgramReset(void)
+static uint8_t XcpLoaderSendCmdProgramReset(tXcpLoader * loader)
 {
   uint8_t        result = TBX_OK;
   tPortXcpPacket reqPacket;
@@ -1033,7 +2097,8 @@ static uint8_t XcpLoaderSendCmdProgramReset(void)
    * okay if no response is received as this is allowed for the program reset command.
    * Just make sure to only process the response if one was actually received.
    */
-  if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT5) == TBX_OK)
+  if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                        loader->settings.timeoutT5) == TBX_OK)
   {
     /* Check if the response was valid. */
     if ( (resPacket.len != 1U) || (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) )
@@ -1055,7 +2120,8 @@ static uint8_t XcpLoaderSendCmdProgramReset(void)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdProgram(uint8_t len, uint8_t const * data)
+static uint8_t XcpLoaderSendCmdProgram(tXcpLoader * loader, uint8_t len,
+                                       uint8_t const * data)
 {
   uint8_t        result = TBX_ERROR;
   tPortXcpPacket reqPacket;
@@ -1074,7 +2140,8 @@ static uint8_t XcpLoaderSendCmdProgram(uint8_t len, uint8_t const * data)
   /* Only continue if this number of bytes actually fits in this command and with a
    * valid CTO length.
    */
-  if( (len <= (xcpMaxProgCto-2U)) && (xcpMaxProgCto <= PORT_XCP_PACKET_SIZE_MAX) )
+  if( (len <= (loader->maxProgCto-2U)) &&
+      (loader->maxProgCto <= PORT_XCP_PACKET_SIZE_MAX) )
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
@@ -1094,7 +2161,8 @@ static uint8_t XcpLoaderSendCmdProgram(uint8_t len, uint8_t const * data)
     reqPacket.len = len + 2U;
 
     /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT5) != TBX_OK)
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT5) != TBX_OK)
     {
       /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
@@ -1117,66 +2185,6 @@ static uint8_t XcpLoaderSendCmdProgram(uint8_t len, uint8_t const * data)
 } /*** end of XcpLoaderSendCmdProgram ***/
 
 
-/************************************************************************************//**
-** \brief     Sends the XCP PROGRAM MAX command.
-** \param     data Array with data bytes to program.
-** \return    TBX_OK if successful, TBX_ERROR otherwise.
-**
-****************************************************************************************/
-static uint8_t XcpLoaderSendCmdProgramMax(uint8_t const * data)
-{
-  uint8_t        result = TBX_ERROR;
-  tPortXcpPacket reqPacket;
-  tPortXcpPacket resPacket;
-  uint8_t        cnt;
-
-  /* Verify parameters. */
-  TBX_ASSERT(data != NULL);
-
-  /* Only continue with valid parameter and a valid CTO length. */
-  if ((xcpMaxProgCto <= PORT_XCP_PACKET_SIZE_MAX) && (data != NULL))
-  {
-    /* Set a positive result and only negate upon error detection from here on. */
-    result = TBX_OK;
-    /* Prepare the command request packet. */
-    reqPacket.data[0] = XCPLOADER_CMD_PROGRAM_MAX;
-
-    /* Copy the date bytes to program. */
-    for (cnt = 0U; cnt < (xcpMaxProgCto-1U); cnt++)
-    {
-      reqPacket.data[cnt+1U] = data[cnt];
-    }
-    /* Note that the uin8_t typecast is okay, because a compile time plausibility check
-     * is performed on macro PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in
-     * unsigned 8-bit.
-     */
-    reqPacket.len = (uint8_t)xcpMaxProgCto;
-
-    /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT5) != TBX_OK)
-    {
-      /* Did not receive a response packet in time. Flag the error. */
-      result = TBX_ERROR;
-    }
-
-    /* Only continue if a response packet was received. */
-    if (result == TBX_OK)
-    {
-      /* Check if the response was valid. */
-      if ( (resPacket.len != 1U) || (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) )
-      {
-        /* Not a valid or positive response. Flag the error. */
-        result = TBX_ERROR;
-      }
-    }
-  }
-
-  /* Give the result back to the caller. */
-  return result;
-
-} /*** end of XcpLoaderSendCmdProgramMax ***/
-
-
 /************************************************************************************//**
 ** \brief     Sends the XCP Get Seed command.
 ** \param     resource The resource to unlock (XCPPROTECT_RESOURCE_xxx).
@@ -1186,7 +2194,8 @@ static uint8_t XcpLoaderSendCmdProgramMax(uint8_t const * data)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t * seed,
+static uint8_t XcpLoaderSendCmdGetSeed(tXcpLoader * loader, uint8_t resource,
+                                       uint8_t mode, uint8_t * seed,
                                        uint8_t * seedLen)
 {
   uint8_t        result = TBX_ERROR;
@@ -1198,11 +2207,11 @@ static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t *
   /* Verify parameters. */
   TBX_ASSERT((seed != NULL) && (seedLen != NULL));
 
-  /* Only continue with valid parameters, a supported resource value and xcpMaxDto has
+  /* Only continue with valid parameters, a supported resource value and maxDto has
    * a valid length.
    */
   if ((seed != NULL) && (seedLen != NULL) && (resource == XCPLOADER_RESOURCE_PGM) &&
-      (xcpMaxDto <= PORT_XCP_PACKET_SIZE_MAX))
+      (loader->maxDto <= PORT_XCP_PACKET_SIZE_MAX))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
@@ -1214,7 +2223,8 @@ static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t *
     reqPacket.len = 3U;
 
     /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT1) != TBX_OK)
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
     {
       /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
@@ -1224,7 +2234,7 @@ static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t *
     if (result == TBX_OK)
     {
       /* Check if the response was valid. */
-      if ( (resPacket.len <= 2U) || (resPacket.len > xcpMaxDto) ||
+      if ( (resPacket.len <= 2U) || (resPacket.len > loader->maxDto) ||
            (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) )
       {
         /* Not a valid or positive response. Flag the error. */
@@ -1238,14 +2248,14 @@ static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t *
       /* Store the seed length. */
       *seedLen = resPacket.data[1];
       /* Determine the number of seed bytes in the current response. Note that the uin8_t
-       * typecast on xcpMaxDto is okay, because a compile time plausibility check is
+       * typecast on maxDto is okay, because a compile time plausibility check is
        * performed on macro PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned
        * 8-bit.
        */
       currentSeedLen = *seedLen;
-      if (currentSeedLen > ((uint8_t)xcpMaxDto - 2U))
+      if (currentSeedLen > ((uint8_t)loader->maxDto - 2U))
       {
-        currentSeedLen = ((uint8_t)xcpMaxDto - 2U);
+        currentSeedLen = ((uint8_t)loader->maxDto - 2U);
       }
       /* Store the seed bytes. */
       for (cnt = 0U; cnt < currentSeedLen; cnt++)
@@ -1267,7 +2277,8 @@ static uint8_t XcpLoaderSendCmdGetSeed(uint8_t resource, uint8_t mode, uint8_t *
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdUnlock(uint8_t const * key, uint8_t keyLen,
+static uint8_t XcpLoaderSendCmdUnlock(tXcpLoader * loader, uint8_t const * key,
+                                      uint8_t keyLen,
                                       uint8_t * protectedResources)
 {
   uint8_t        result = TBX_ERROR;
@@ -1289,13 +2300,13 @@ static uint8_t XcpLoaderSendCmdUnlock(uint8_t const * key, uint8_t keyLen,
     reqPacket.data[0] = XCPLOADER_CMD_UNLOCK;
     reqPacket.data[1] = keyLen;
     /* Determine number of key bytes for the packet. Note that the uin8_t typecast on
-     * xcpMaxCto is okay, because a compile time plausibility check is performed on macro
+     * maxCto is okay, because a compile time plausibility check is performed on macro
      * PORT_XCP_PACKET_SIZE_MAX, to make sure it fits in unsigned 8-bit.
      */
     keyCurrentLen = keyLen;
-    if (keyCurrentLen > ((uint8_t)xcpMaxCto - 2U))
+    if (keyCurrentLen > ((uint8_t)loader->maxCto - 2U))
     {
-      keyCurrentLen = (uint8_t)xcpMaxCto - 2U;
+      keyCurrentLen = (uint8_t)loader->maxCto - 2U;
     }
     /* Copy key bytes. */
     for (cnt = 0; cnt < keyCurrentLen; cnt++)
@@ -1305,7 +2316,8 @@ static uint8_t XcpLoaderSendCmdUnlock(uint8_t const * key, uint8_t keyLen,
     reqPacket.len = keyCurrentLen + 2U;
 
     /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT1) != TBX_OK)
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
     {
       /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
@@ -1335,42 +2347,56 @@ static uint8_t XcpLoaderSendCmdUnlock(uint8_t const * key, uint8_t keyLen,
 
 
 /************************************************************************************//**
-** \brief     Sends the XCP Set MTA command.
+** \brief     Sends the XCP Set MTA command. The command is skipped, if the MTA of the
+**            slave already holds the address.
 ** \param     address New MTA address for the slave.
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdSetMta(uint32_t address)
+static uint8_t XcpLoaderSendCmdSetMta(tXcpLoader * loader, uint32_t address)
 {
   uint8_t        result = TBX_OK;
   tPortXcpPacket reqPacket;
   tPortXcpPacket resPacket;
 
-  /* Prepare the command packet. */
-  reqPacket.data[0] = XCPLOADER_CMD_SET_MTA;
-  reqPacket.data[1] = 0U; /* Reserved. */
-  reqPacket.data[2] = 0U; /* Reserved. */
-  reqPacket.data[3] = 0U; /* Address extension not supported. */
-  /* Set the address taking into account byte ordering. */
-  XcpLoaderSetOrderedLong(address, &reqPacket.data[4]);
-  reqPacket.len = 8U;
-
-  /* Send the request packet and attempt to receive the response packet. */
-  if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT1) != TBX_OK)
+  /* Only send the command, if the MTA of the slave does not already hold the address. */
+  if ((loader->mtaValid == TBX_FALSE) || (loader->mta != address))
   {
-    /* Did not receive a response packet in time. Flag the error. */
-    result = TBX_ERROR;
-  }
+    /* Prepare the command packet. */
+    reqPacket.data[0] = XCPLOADER_CMD_SET_MTA;
+    reqPacket.data[1] = 0U; /* Reserved. */
+    reqPacket.data[2] = 0U; /* Reserved. */
+    reqPacket.data[3] = 0U; /* Address extension not supported. */
+    /* Set the address taking into account byte ordering. */
+    XcpLoaderSetOrderedLong(loader, address, &reqPacket.data[4]);
+    reqPacket.len = 8U;
 
-  /* Only continue if a response packet was received. */
-  if (result == TBX_OK)
-  {
-    /* Check if the response was valid. */
-    if ( (resPacket.len != 1U) || (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) )
+    /* Send the request packet and attempt to receive the response packet. */
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
     {
-      /* Not a valid or positive response. Flag the error. */
+      /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
     }
+
+    /* Only continue if a response packet was received. */
+    if (result == TBX_OK)
+    {
+      /* Check if the response was valid. */
+      if ( (resPacket.len != 1U) || (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) )
+      {
+        /* Not a valid or positive response. Flag the error. */
+        result = TBX_ERROR;
+      }
+    }
+
+    /* Keep track of the slave's MTA. */
+    loader->mta = address;
+    loader->mtaValid = TBX_FALSE;
+    if (result == TBX_OK)
+    {
+      loader->mtaValid = TBX_TRUE;
+    }
   }
 
   /* Give the result back to the caller. */
@@ -1384,7 +2410,7 @@ static uint8_t XcpLoaderSendCmdSetMta(uint32_t address)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdProgramClear(uint32_t len)
+static uint8_t XcpLoaderSendCmdProgramClear(tXcpLoader * loader, uint32_t len)
 {
   uint8_t        result = TBX_OK;
   tPortXcpPacket reqPacket;
@@ -1396,11 +2422,14 @@ static uint8_t XcpLoaderSendCmdProgramClear(uint32_t len)
   reqPacket.data[2] = 0U; /* Reserved. */
   reqPacket.data[3] = 0U; /* Reserved. */
   /* Set the erase length taking into account byte ordering. */
-  XcpLoaderSetOrderedLong(len, &reqPacket.data[4]);
+  XcpLoaderSetOrderedLong(loader, len, &reqPacket.data[4]);
   reqPacket.len = 8U;
+  /* Do not rely on the slave's MTA after an erase. */
+  loader->mtaValid = TBX_FALSE;
 
   /* Send the request packet and attempt to receive the response packet. */
-  if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT4) != TBX_OK)
+  if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                        loader->settings.timeoutT4) != TBX_OK)
   {
     /* Did not receive a response packet in time. Flag the error. */
     result = TBX_ERROR;
@@ -1429,7 +2458,7 @@ static uint8_t XcpLoaderSendCmdProgramClear(uint32_t len)
 ** \return    TBX_OK if successful, TBX_ERROR otherwise.
 **
 ****************************************************************************************/
-static uint8_t XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len)
+static uint8_t XcpLoaderSendCmdUpload(tXcpLoader * loader, uint8_t * data, uint8_t len)
 {
   uint8_t        result = TBX_ERROR;
   tPortXcpPacket reqPacket;
@@ -1440,7 +2469,7 @@ static uint8_t XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len)
   TBX_ASSERT((data != NULL) && (len > 0U));
 
   /* Only continue with valid parameters and a valid DTO length. */
-  if ((data != NULL) && (len > 0U) && (len < xcpMaxDto))
+  if ((data != NULL) && (len > 0U) && (len < loader->maxDto))
   {
     /* Set a positive result and only negate upon error detection from here on. */
     result = TBX_OK;
@@ -1451,7 +2480,8 @@ static uint8_t XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len)
     reqPacket.len = 2U;
 
     /* Send the request packet and attempt to receive the response packet. */
-    if (XcpExchangePacket(&reqPacket, &resPacket, xcpSettings.timeoutT1) != TBX_OK)
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
     {
       /* Did not receive a response packet in time. Flag the error. */
       result = TBX_ERROR;
@@ -1476,6 +2506,13 @@ static uint8_t XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len)
       {
         data[cnt] = resPacket.data[cnt + 1U];
       }
+      /* The slave incremented its MTA by the number of uploaded bytes. */
+      loader->mta += len;
+    }
+    else
+    {
+      /* The MTA of the slave is not known after an error. */
+      loader->mtaValid = TBX_FALSE;
     }
   }
 
@@ -1484,4 +2521,112 @@ static uint8_t XcpLoaderSendCmdUpload(uint8_t * data, uint8_t len)
 } /*** end of XcpLoaderSendCmdUpload ***/
 
 
+/************************************************************************************//**
+** \brief     Sends the XCP BUILD CHECKSUM command. If the slave rejects the command,
+**            because the number of bytes exceeds its maximum, this maximum is stored
+**            in the loader.
+** \param     len Number of bytes to build the checksum over, starting at the MTA
+**            address.
+** \param     type The checksum type that the slave used, is written to this pointer.
+**            It is one of the CHECKSUM_TYPE_xxx values. For checksum types that add
+**            words, the CHECKSUM_TYPE_BIG_ENDIAN flag is set for Motorola slaves.
+** \param     checksum The checksum value is written to this pointer.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t XcpLoaderSendCmdBuildChecksum(tXcpLoader * loader, uint32_t len,
+                                             uint8_t * type,
+                                             uint32_t * checksum)
+{
+  uint8_t        result = TBX_ERROR;
+  uint32_t       maxLen;
+  tPortXcpPacket reqPacket;
+  tPortXcpPacket resPacket;
+
+  /* Verify parameters. */
+  TBX_ASSERT((type != NULL) && (checksum != NULL));
+
+  /* Only continue with valid parameters. */
+  if ((type != NULL) && (checksum != NULL))
+  {
+    /* Set a positive result and only negate upon error detection from here on. */
+    result = TBX_OK;
+
+    /* Prepare the command packet. */
+    reqPacket.data[0] = XCPLOADER_CMD_BUILD_CHECKSUM;
+    reqPacket.data[1] = 0U; /* Reserved. */
+    reqPacket.data[2] = 0U; /* Reserved. */
+    reqPacket.data[3] = 0U; /* Reserved. */
+    /* Set the block size taking into account byte ordering. */
+    XcpLoaderSetOrderedLong(loader, len, &reqPacket.data[4]);
+    reqPacket.len = 8U;
+    /* Do not rely on the slave's MTA after building a checksum. */
+    loader->mtaValid = TBX_FALSE;
+
+    /* Send the request packet and attempt to receive the response packet. */
+    if (XcpExchangePacket(loader, &reqPacket, &resPacket,
+                          loader->settings.timeoutT1) != TBX_OK)
+    {
+      /* Did not receive a response packet in time. Flag the error. */
+      result = TBX_ERROR;
+    }
+
+    /* Only continue if a response packet was received. */
+    if (result == TBX_OK)
+    {
+      /* Did the slave report that the block size exceeds its maximum? In this case the
+       * response holds the maximum block size. It is stored rounded down to a multiple
+       * of 4 bytes, to suit the checksum types that add 16-bit or 32-bit words.
+       */
+      if ( (resPacket.len == 8U) && (resPacket.data[0U] == XCPLOADER_CMD_PID_ERR) &&
+           (resPacket.data[1U] == XCPLOADER_ERR_OUT_OF_RANGE) )
+      {
+        maxLen = XcpLoaderGetOrderedLong(loader, &resPacket.data[4]);
+        if (maxLen >= 4U)
+        {
+          maxLen -= maxLen % 4U;
+        }
+        if ((maxLen > 0U) && (maxLen < len))
+        {
+          loader->checksumMax = maxLen;
+        }
+        /* Still flag the error, because the checksum was not built. */
+        result = TBX_ERROR;
+      }
+      /* Check if the response was valid and holds a supported checksum type. Note that
+       * the checksum type values match the ones of the XCP protocol.
+       */
+      else if ( (resPacket.len != 8U) ||
+                (resPacket.data[0U] != XCPLOADER_CMD_PID_RES) ||
+                (resPacket.data[1U] < CHECKSUM_TYPE_ADD_11) ||
+                (resPacket.data[1U] > CHECKSUM_TYPE_CRC_32) )
+      {
+        /* Not a valid or positive response. Flag the error. */
+        result = TBX_ERROR;
+      }
+      else
+      {
+        /* Valid response. Nothing else to do here. */
+      }
+    }
+
+    /* Only process the response data in case the response was valid. */
+    if (result == TBX_OK)
+    {
+      /* Store the checksum type, including the slave's byte ordering. */
+      *type = resPacket.data[1U];
+      if (loader->slaveIsIntel == TBX_FALSE)
+      {
+        *type |= CHECKSUM_TYPE_BIG_ENDIAN;
+      }
+      /* Store the checksum value taking into account byte ordering. */
+      *checksum = XcpLoaderGetOrderedLong(loader, &resPacket.data[4]);
+    }
+  }
+
+  /* Give the result back to the caller. */
+  return result;
+} /*** end of XcpLoaderSendCmdBuildChecksum ***/
+
+
 /*********************************** end of xcploader.c ********************************/
@@ -0,0 +1,249 @@
+/************************************************************************************//**
+* \file         bench_checksum.c
+* \brief        Checksum calculation benchmark.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostBenchChecksum Checksum calculation benchmark
+* \brief      Measures how fast the checksum module calculates each checksum type.
+* \details
+* Calculates each checksum type that the XCP BUILD_CHECKSUM command supports over a
+* buffer with random data and reports the throughput in MB/s. The data is fed to the
+* checksum module in chunks of the size that the firmware reader module typically
+* returns. Each checksum is calculated a second time with chunks of an odd size, to
+* check that the result does not depend on how the data is split up. Before that, the
+* checksums of the standard check string "123456789" are compared against their known
+* values.
+*
+* The program is built twice: bench_checksum uses the table driven CRC calculation and
+* bench_checksum_bitwise the bitwise one (CHECKSUM_CRC_TABLE_ENABLE set to 0). Both
+* report the checksum values, so their results can be compared.
+*
+* Run with --quick to use a smaller buffer.
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <stdlib.h>                         /* for standard library                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "microblt.h"                       /* LibMicroBLT                             */
+#include "port.h"                           /* Port module                             */
+#include "checksum.h"                       /* Checksum module                         */
+#include "benchutil.h"                      /* Benchmark utilities                     */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Chunk size in bytes for the throughput measurement. */
+#define BENCH_CHUNK_SIZE               (4096U)
+
+/** \brief Odd chunk size in bytes for the check of the incremental calculation. */
+#define BENCH_ODD_CHUNK_SIZE           (1021U)
+
+/** \brief Standard check string for the known answer tests. */
+#define BENCH_CHECK_STRING             "123456789"
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Checksum type to benchmark. */
+typedef struct
+{
+  char const * name;                        /**< name for the report                   */
+  uint8_t      type;                        /**< checksum type                         */
+} tBenchChecksum;
+
+/** \brief Known checksum of the standard check string. */
+typedef struct
+{
+  char const * name;                        /**< name for the report                   */
+  uint8_t      type;                        /**< checksum type                         */
+  uint32_t     expected;                    /**< checksum of the check string          */
+} tBenchKnownAnswer;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint32_t BenchChecksumCalculate(uint8_t type, uint8_t const * data, uint32_t len,
+                                       uint32_t chunkSize);
+
+
+/****************************************************************************************
+* Local constant declarations
+****************************************************************************************/
+/** \brief Checksum types to benchmark. */
+static const tBenchChecksum benchChecksums[] =
+{
+  { "ADD_11",       CHECKSUM_TYPE_ADD_11 },
+  { "ADD_12",       CHECKSUM_TYPE_ADD_12 },
+  { "ADD_14",       CHECKSUM_TYPE_ADD_14 },
+  { "ADD_22",       CHECKSUM_TYPE_ADD_22 },
+  { "ADD_24",       CHECKSUM_TYPE_ADD_24 },
+  { "ADD_44",       CHECKSUM_TYPE_ADD_44 },
+  { "ADD_44 (BE)",  CHECKSUM_TYPE_ADD_44 | CHECKSUM_TYPE_BIG_ENDIAN },
+  { "CRC_16",       CHECKSUM_TYPE_CRC_16 },
+  { "CRC_16_CITT",  CHECKSUM_TYPE_CRC_16_CITT },
+  { "CRC_32",       CHECKSUM_TYPE_CRC_32 }
+};
+
+/** \brief Known checksums of the standard check string. */
+static const tBenchKnownAnswer benchKnownAnswers[] =
+{
+  { "ADD_11",       CHECKSUM_TYPE_ADD_11,      0x000000DDUL },
+  { "ADD_12",       CHECKSUM_TYPE_ADD_12,      0x000001DDUL },
+  { "ADD_14",       CHECKSUM_TYPE_ADD_14,      0x000001DDUL },
+  { "CRC_16",       CHECKSUM_TYPE_CRC_16,      0x0000BB3DUL },
+  { "CRC_16_CITT",  CHECKSUM_TYPE_CRC_16_CITT, 0x000029B1UL },
+  { "CRC_32",       CHECKSUM_TYPE_CRC_32,      0xCBF43926UL }
+};
+
+
+/************************************************************************************//**
+** \brief     Program entry point.
+** \param     argc Number of program arguments.
+** \param     argv Program arguments.
+** \return    0 if all checksums were calculated correctly and consistently, 1
+**            otherwise.
+**
+****************************************************************************************/
+int main(int argc, char const * const argv[])
+{
+  int       exitCode = 0;
+  uint32_t  len = 64UL * 1024UL * 1024UL;
+  uint8_t * data;
+  uint32_t  idx;
+  uint32_t  state = 1U;
+  uint32_t  checksum;
+  uint64_t  startTime;
+  uint64_t  elapsedTime;
+
+  if (BenchIsQuick(argc, argv) == TBX_TRUE)
+  {
+    len = 1024UL * 1024UL;
+  }
+  data = malloc(len);
+  if (data == NULL)
+  {
+    (void)printf("Could not allocate the data buffer\n");
+    exitCode = 1;
+  }
+  else
+  {
+    /* Fill the buffer with pseudo random data. */
+    for (idx = 0U; idx < len; idx++)
+    {
+      state ^= state << 13U;
+      state ^= state >> 17U;
+      state ^= state << 5U;
+      data[idx] = (uint8_t)(state >> 24U);
+    }
+#if (CHECKSUM_CRC_TABLE_ENABLE > 0U)
+    (void)printf("%u KB, table driven CRC calculation\n", (unsigned)(len / 1024U));
+#else
+    (void)printf("%u KB, bitwise CRC calculation\n", (unsigned)(len / 1024U));
+#endif
+    /* Check the results against the known checksums of the check string. */
+    for (idx = 0U; idx < (sizeof(benchKnownAnswers) / sizeof(benchKnownAnswers[0]));
+         idx++)
+    {
+      checksum = BenchChecksumCalculate(benchKnownAnswers[idx].type,
+                                        (uint8_t const *)BENCH_CHECK_STRING,
+                                        sizeof(BENCH_CHECK_STRING) - 1U,
+                                        BENCH_CHUNK_SIZE);
+      if (checksum != benchKnownAnswers[idx].expected)
+      {
+        (void)printf("%-12s FAILED: %08X instead of %08X for \"%s\"\n",
+                     benchKnownAnswers[idx].name, (unsigned)checksum,
+                     (unsigned)benchKnownAnswers[idx].expected, BENCH_CHECK_STRING);
+        exitCode = 1;
+      }
+    }
+    (void)printf("%-12s %10s %10s %10s\n", "type", "checksum", "time[ms]", "MB/s");
+    for (idx = 0U; idx < (sizeof(benchChecksums) / sizeof(benchChecksums[0])); idx++)
+    {
+      startTime = BenchGetTimeUs();
+      checksum = BenchChecksumCalculate(benchChecksums[idx].type, data, len,
+                                        BENCH_CHUNK_SIZE);
+      elapsedTime = BenchGetTimeUs() - startTime;
+      (void)printf("%-12s   %08X %10.2f %10.1f\n", benchChecksums[idx].name,
+                   (unsigned)checksum, (double)elapsedTime / 1000.0,
+                   BenchGetMBps(len, elapsedTime));
+      if (BenchChecksumCalculate(benchChecksums[idx].type, data, len,
+                                 BENCH_ODD_CHUNK_SIZE) != checksum)
+      {
+        (void)printf("%-12s FAILED: result depends on the chunk size\n",
+                     benchChecksums[idx].name);
+        exitCode = 1;
+      }
+    }
+    free(data);
+  }
+  return exitCode;
+} /*** end of main ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates a checksum over the data, which is fed to the checksum module
+**            in chunks.
+** \param     type Checksum type.
+** \param     data The data.
+** \param     len Number of bytes.
+** \param     chunkSize Number of bytes per chunk.
+** \return    The checksum.
+**
+****************************************************************************************/
+static uint32_t BenchChecksumCalculate(uint8_t type, uint8_t const * data, uint32_t len,
+                                       uint32_t chunkSize)
+{
+  tChecksum checksum;
+  uint32_t  offset;
+  uint32_t  chunkLen;
+
+  /* Without a port, all checksums are calculated in software. */
+  (void)ChecksumInit(&checksum, type, NULL);
+  for (offset = 0U; offset < len; offset += chunkLen)
+  {
+    chunkLen = len - offset;
+    if (chunkLen > chunkSize)
+    {
+      chunkLen = chunkSize;
+    }
+    ChecksumUpdate(&checksum, &data[offset], chunkLen);
+  }
+  return ChecksumGetResult(&checksum);
+} /*** end of BenchChecksumCalculate ***/
+
+
+/*********************************** end of bench_checksum.c ***************************/
@@ -0,0 +1,171 @@
+/************************************************************************************//**
+* \file         bench_flash.c
+* \brief        End-to-end flashing benchmark.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostBenchFlash End-to-end flashing benchmark
+* \brief      Measures the time to flash a firmware file onto simulated targets.
+* \details
+* Generates an S-record firmware file and flashes it onto simulated targets on a
+* 500 kbit/s CAN bus, with the different update methods of the library, with and
+* without master block mode. It reports the flashing time on the virtual clock, the
+* resulting throughput, the number of packets and the number of firmware data bytes per
+* packet. Because the virtual clock does not depend on the speed of the host, the
+* results can be compared between protocol optimizations. The time it took on the host
+* is reported as well.
+*
+* Run with --quick to flash a smaller firmware file.
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "imagegen.h"                       /* Firmware image generator                */
+#include "benchutil.h"                      /* Benchmark utilities                     */
+#include "simtarget.h"                      /* Simulated XCP bootloader target         */
+#include "hostupdate.h"                     /* Firmware update runner                  */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief FatFS path of the firmware file. */
+#define BENCH_FIRMWARE_FILE            "0:flash.srec"
+
+/** \brief Number of data segments in the firmware file. */
+#define BENCH_SEGMENT_COUNT            (4U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Benchmark run. */
+typedef struct
+{
+  char const * name;                        /**< name for the report                   */
+  uint8_t      method;                      /**< update method                         */
+  uint8_t      blockMode;                   /**< master block mode supported by target */
+  uint8_t      nodeCount;                   /**< number of nodes                       */
+} tBenchRun;
+
+
+/****************************************************************************************
+* Local constant declarations
+****************************************************************************************/
+/** \brief Benchmark runs. */
+static const tBenchRun benchRuns[] =
+{
+  { "segmented", UPDATE_METHOD_SEGMENTED, TBX_FALSE, 1U },
+  { "segmented", UPDATE_METHOD_SEGMENTED, TBX_TRUE,  1U },
+  { "pipeline",  UPDATE_METHOD_PIPELINE,  TBX_FALSE, 1U },
+  { "pipeline",  UPDATE_METHOD_PIPELINE,  TBX_TRUE,  1U },
+  { "scheduler", UPDATE_METHOD_SCHEDULER, TBX_TRUE,  1U },
+  { "scheduler", UPDATE_METHOD_SCHEDULER, TBX_TRUE,  2U },
+  { "scheduler", UPDATE_METHOD_SCHEDULER, TBX_TRUE,  4U }
+};
+
+
+/************************************************************************************//**
+** \brief     Program entry point.
+** \param     argc Number of program arguments.
+** \param     argv Program arguments.
+** \return    0 if all updates succeeded, 1 otherwise.
+**
+****************************************************************************************/
+int main(int argc, char const * const argv[])
+{
+  int              exitCode = 0;
+  uint8_t          result = TBX_OK;
+  uint32_t         dataSize = 256UL * 1024UL;
+  uint32_t         runIdx;
+  uint32_t         totalBytes;
+  tImage           image;
+  tSimTargetConfig config;
+  tUpdateResult    update;
+
+  if (BenchIsQuick(argc, argv) == TBX_TRUE)
+  {
+    dataSize = 32UL * 1024UL;
+  }
+  SimTargetConfigDefault(&config);
+  if ( (ImageCreate(&image, config.flashBase, config.flashSize) != TBX_OK) ||
+       (ImageGenerate(&image, 1U, BENCH_SEGMENT_COUNT,
+                      dataSize / BENCH_SEGMENT_COUNT) != TBX_OK) ||
+       (ImageWriteSRecord(&image, BENCH_FIRMWARE_FILE, 32U) != TBX_OK) )
+  {
+    (void)printf("Could not generate the firmware file\n");
+    result = TBX_ERROR;
+  }
+  else
+  {
+    (void)printf("%u KB firmware data on a %u kbit/s bus, MAX_CTO %u, MAX_BS %u\n",
+                 (unsigned)(ImageGetDataSize(&image) / 1024U),
+                 (unsigned)(config.bitRate / 1000U), (unsigned)config.maxCtoPgm,
+                 (unsigned)config.maxBs);
+    (void)printf("%-10s %5s %5s %10s %10s %10s %10s %10s\n", "method", "block", "nodes",
+                 "time[ms]", "KB/s", "packets", "bytes/pkt", "host[ms]");
+    for (runIdx = 0U; runIdx < (sizeof(benchRuns) / sizeof(benchRuns[0])); runIdx++)
+    {
+      config.blockMode = benchRuns[runIdx].blockMode;
+      if (UpdateRun(&image, BENCH_FIRMWARE_FILE, benchRuns[runIdx].method,
+                    benchRuns[runIdx].nodeCount, &config, &update) != TBX_OK)
+      {
+        (void)printf("%-10s %5u %5u FAILED\n", benchRuns[runIdx].name,
+                     (unsigned)benchRuns[runIdx].blockMode,
+                     (unsigned)benchRuns[runIdx].nodeCount);
+        result = TBX_ERROR;
+      }
+      else
+      {
+        totalBytes = ImageGetDataSize(&image) * benchRuns[runIdx].nodeCount;
+        (void)printf("%-10s %5u %5u %10.1f %10.1f %10u %10.2f %10.1f\n",
+                     benchRuns[runIdx].name, (unsigned)benchRuns[runIdx].blockMode,
+                     (unsigned)benchRuns[runIdx].nodeCount,
+                     (double)update.simTimeUs / 1000.0,
+                     BenchGetMBps(totalBytes, update.simTimeUs) * 1024.0,
+                     (unsigned)update.packets,
+                     (double)totalBytes / (double)update.packets,
+                     (double)update.hostTimeUs / 1000.0);
+      }
+    }
+  }
+  ImageDestroy(&image);
+  if (result != TBX_OK)
+  {
+    exitCode = 1;
+  }
+  return exitCode;
+} /*** end of main ***/
+
+
+/*********************************** end of bench_flash.c ******************************/
@@ -0,0 +1,387 @@
+/************************************************************************************//**
+* \file         bench_reader.c
+* \brief        Firmware file reader benchmark.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostBenchReader Firmware file reader benchmark
+* \brief      Measures how fast the firmware file readers parse firmware files.
+* \details
+* Generates S-record, Intel HEX and binary firmware files of increasing size, reads them
+* completely with the firmware reader module and reports the time it took to open the
+* file, which builds the segment table, and to read all segment data. The throughput is
+* reported in MB/s of firmware file data and of firmware data. The file is opened a
+* second time to show the effect of the segment index cache, if enabled. All read data
+* is compared against the generated image, so the benchmark doubles as a test.
+*
+* Run with --quick to skip the largest firmware file.
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <string.h>                         /* for string utilities                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "microblt.h"                       /* LibMicroBLT                             */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "imagegen.h"                       /* Firmware image generator                */
+#include "benchutil.h"                      /* Benchmark utilities                     */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Base address of the generated firmware images. */
+#define BENCH_IMAGE_BASE               (0x08000000UL)
+
+/** \brief Extra memory image space for the gaps between the data segments. */
+#define BENCH_IMAGE_GAP_SPACE          (IMAGE_SEGMENT_COUNT_MAX * 0x2000UL)
+
+/** \brief Number of data segments in the S-record and Intel HEX firmware files. */
+#define BENCH_SEGMENT_COUNT            (4U)
+
+/** \brief Number of data bytes per S-record and Intel HEX data record. */
+#define BENCH_RECORD_LEN               (32U)
+
+/** \brief Number of data bytes per random access read, after reopening the file. */
+#define BENCH_READ_AT_LEN              (256U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Firmware file format to benchmark. */
+typedef struct
+{
+  char const * name;                        /**< name for the report                   */
+  char const * path;                        /**< FatFS path of the firmware file       */
+  uint8_t      readerType;                  /**< firmware file reader type             */
+  uint32_t     segmentCount;                /**< number of data segments               */
+} tBenchFormat;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t BenchReaderRun(tImage * image, tBenchFormat const * format,
+                              uint32_t dataSize);
+static uint8_t BenchReaderReadAll(tBltFirmwareCtx * firmware, tImage const * image);
+static uint8_t BenchReaderReadAtAll(tBltFirmwareCtx * firmware, tImage const * image);
+
+
+/****************************************************************************************
+* Local constant declarations
+****************************************************************************************/
+/** \brief Firmware file formats to benchmark. */
+static const tBenchFormat benchFormats[] =
+{
+  { "srec", "0:bench.srec", BLT_FIRMWARE_READER_SRECORD, BENCH_SEGMENT_COUNT },
+  { "hex",  "0:bench.hex",  BLT_FIRMWARE_READER_INTELHEX, BENCH_SEGMENT_COUNT },
+  { "bin",  "0:bench.bin",  BLT_FIRMWARE_READER_BINARY, 1U }
+};
+
+/** \brief Firmware data sizes to benchmark. */
+static const uint32_t benchDataSizes[] =
+{
+  64UL * 1024UL,
+  1024UL * 1024UL,
+  16UL * 1024UL * 1024UL
+};
+
+
+/************************************************************************************//**
+** \brief     Program entry point.
+** \param     argc Number of program arguments.
+** \param     argv Program arguments.
+** \return    0 if all firmware files were read correctly, 1 otherwise.
+**
+****************************************************************************************/
+int main(int argc, char const * const argv[])
+{
+  int      exitCode = 0;
+  uint8_t  result = TBX_OK;
+  uint32_t sizeCount = sizeof(benchDataSizes) / sizeof(benchDataSizes[0]);
+  uint32_t sizeIdx;
+  uint32_t formatIdx;
+  tImage   image;
+
+  if (BenchIsQuick(argc, argv) == TBX_TRUE)
+  {
+    sizeCount--;
+  }
+  if (ImageCreate(&image, BENCH_IMAGE_BASE,
+                  benchDataSizes[sizeCount - 1U] + BENCH_IMAGE_GAP_SPACE) != TBX_OK)
+  {
+    (void)printf("Could not allocate the memory image\n");
+    result = TBX_ERROR;
+  }
+  else
+  {
+    (void)printf("%-5s %10s %10s %10s %10s %10s %10s %10s %10s\n", "type", "data[KB]",
+                 "file[KB]", "open[ms]", "read[ms]", "reopen[ms]", "readat[ms]",
+                 "file[MB/s]", "data[MB/s]");
+    for (sizeIdx = 0U; sizeIdx < sizeCount; sizeIdx++)
+    {
+      for (formatIdx = 0U; formatIdx < (sizeof(benchFormats) / sizeof(benchFormats[0]));
+           formatIdx++)
+      {
+        if (BenchReaderRun(&image, &benchFormats[formatIdx],
+                           benchDataSizes[sizeIdx]) != TBX_OK)
+        {
+          result = TBX_ERROR;
+        }
+      }
+    }
+    ImageDestroy(&image);
+  }
+  if (result != TBX_OK)
+  {
+    exitCode = 1;
+  }
+  return exitCode;
+} /*** end of main ***/
+
+
+/************************************************************************************//**
+** \brief     Generates a firmware file, reads it with the firmware reader module and
+**            reports the results.
+** \param     image Firmware image.
+** \param     format Firmware file format.
+** \param     dataSize Total number of firmware data bytes.
+** \return    TBX_OK if the firmware file was read correctly, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t BenchReaderRun(tImage * image, tBenchFormat const * format,
+                              uint32_t dataSize)
+{
+  uint8_t           result = TBX_ERROR;
+  tBltFirmwareCtx * firmware;
+  FILINFO           fileInfo;
+  char              indexPath[64];
+  uint64_t          startTime;
+  uint64_t          openTime;
+  uint64_t          readTime;
+  uint64_t          reopenTime;
+  uint64_t          readAtTime = 0U;
+
+  /* Generate the firmware file. */
+  if (ImageGenerate(image, dataSize, format->segmentCount,
+                    dataSize / format->segmentCount) == TBX_OK)
+  {
+    if (format->readerType == BLT_FIRMWARE_READER_SRECORD)
+    {
+      result = ImageWriteSRecord(image, format->path, BENCH_RECORD_LEN);
+    }
+    else if (format->readerType == BLT_FIRMWARE_READER_INTELHEX)
+    {
+      result = ImageWriteIntelHex(image, format->path, BENCH_RECORD_LEN);
+    }
+    else
+    {
+      result = ImageWriteBinary(image, format->path);
+    }
+  }
+  /* Remove a segment index sidecar file from a previous run. */
+  (void)snprintf(indexPath, sizeof(indexPath), "%s.idx", format->path);
+  (void)f_unlink(indexPath);
+
+  firmware = BltFirmwareCtxCreate(format->readerType);
+  if ((result == TBX_OK) && (firmware != NULL) &&
+      (f_stat(format->path, &fileInfo) == FR_OK))
+  {
+    /* Open the file, which builds the segment table, and read all data. */
+    startTime = BenchGetTimeUs();
+    result = BltFirmwareCtxFileOpen(firmware, format->path);
+    openTime = BenchGetTimeUs() - startTime;
+    if (result == TBX_OK)
+    {
+      startTime = BenchGetTimeUs();
+      result = BenchReaderReadAll(firmware, image);
+      readTime = BenchGetTimeUs() - startTime;
+      (void)BltFirmwareCtxFileClose(firmware);
+    }
+    /* Open the file again. With the segment index cache, this loads the segment
+     * information and read index from the sidecar file. Then read all data again, both
+     * sequentially and with random access.
+     */
+    if (result == TBX_OK)
+    {
+      startTime = BenchGetTimeUs();
+      result = BltFirmwareCtxFileOpen(firmware, format->path);
+      reopenTime = BenchGetTimeUs() - startTime;
+      if (result == TBX_OK)
+      {
+        result = BenchReaderReadAll(firmware, image);
+        if (result == TBX_OK)
+        {
+          startTime = BenchGetTimeUs();
+          result = BenchReaderReadAtAll(firmware, image);
+          readAtTime = BenchGetTimeUs() - startTime;
+        }
+        (void)BltFirmwareCtxFileClose(firmware);
+      }
+    }
+    if (result == TBX_OK)
+    {
+      (void)printf("%-5s %10u %10u %10.2f %10.2f %10.2f %10.2f %10.1f %10.1f\n",
+                   format->name, (unsigned)(dataSize / 1024U),
+                   (unsigned)(fileInfo.fsize / 1024U), (double)openTime / 1000.0,
+                   (double)readTime / 1000.0, (double)reopenTime / 1000.0,
+                   (double)readAtTime / 1000.0,
+                   BenchGetMBps(fileInfo.fsize, openTime + readTime),
+                   BenchGetMBps(ImageGetDataSize(image), openTime + readTime));
+    }
+  }
+  else
+  {
+    result = TBX_ERROR;
+  }
+  if (firmware != NULL)
+  {
+    (void)BltFirmwareCtxDestroy(firmware);
+  }
+  if (result != TBX_OK)
+  {
+    (void)printf("%-5s %10u FAILED\n", format->name, (unsigned)(dataSize / 1024U));
+  }
+  return result;
+} /*** end of BenchReaderRun ***/
+
+
+/************************************************************************************//**
+** \brief     Reads all segment data from the opened firmware file and compares it
+**            against the firmware image. Segments that the library merges because of
+**            FIRMWARE_GAP_FILL_MAX, are compared as one segment, including the gap.
+** \param     firmware Firmware context.
+** \param     image Firmware image.
+** \return    TBX_OK if all data was read and matches, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t BenchReaderReadAll(tBltFirmwareCtx * firmware, tImage const * image)
+{
+  uint8_t         result = TBX_ERROR;
+  uint32_t        segmentIdx;
+  uint32_t        segmentAddress;
+  uint32_t        segmentLen;
+  uint32_t        address;
+  uint16_t        len;
+  uint32_t        readLen;
+  uint8_t const * data;
+  uint32_t        segmentCount;
+  tImageSegment   segments[IMAGE_SEGMENT_COUNT_MAX];
+
+  segmentCount = ImageMergeSegments(image, FIRMWARE_GAP_FILL_MAX, segments);
+  if (BltFirmwareCtxSegmentGetCount(firmware) == segmentCount)
+  {
+    result = TBX_OK;
+    for (segmentIdx = 0U; segmentIdx < segmentCount; segmentIdx++)
+    {
+      segmentLen = BltFirmwareCtxSegmentGetInfo(firmware, segmentIdx, &segmentAddress);
+      if ( (segmentAddress != segments[segmentIdx].address) ||
+           (segmentLen != segments[segmentIdx].len) )
+      {
+        result = TBX_ERROR;
+        break;
+      }
+      /* Read the segment data chunk by chunk. */
+      readLen = 0U;
+      BltFirmwareCtxSegmentOpen(firmware, segmentIdx);
+      do
+      {
+        data = BltFirmwareCtxSegmentGetNextData(firmware, &address, &len);
+        if ( (data == NULL) ||
+             ((len > 0U) &&
+              ((address != (segmentAddress + readLen)) ||
+               (memcmp(data, &image->data[address - image->base], len) != 0))) )
+        {
+          result = TBX_ERROR;
+        }
+        readLen += len;
+      }
+      while ((result == TBX_OK) && (len > 0U));
+      if ((result != TBX_OK) || (readLen != segmentLen))
+      {
+        result = TBX_ERROR;
+        break;
+      }
+    }
+  }
+  return result;
+} /*** end of BenchReaderReadAll ***/
+
+
+/************************************************************************************//**
+** \brief     Reads all segment data from the opened firmware file with random access,
+**            from the end of each segment to its start, and compares it against the
+**            firmware image.
+** \param     firmware Firmware context.
+** \param     image Firmware image.
+** \return    TBX_OK if all data was read and matches, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t BenchReaderReadAtAll(tBltFirmwareCtx * firmware, tImage const * image)
+{
+  uint8_t       result = TBX_OK;
+  uint32_t      segmentIdx;
+  uint32_t      segmentAddress;
+  uint32_t      segmentLen;
+  uint32_t      offset;
+  uint32_t      len;
+  uint8_t       data[BENCH_READ_AT_LEN];
+  uint32_t      segmentCount;
+  tImageSegment segments[IMAGE_SEGMENT_COUNT_MAX];
+
+  segmentCount = ImageMergeSegments(image, FIRMWARE_GAP_FILL_MAX, segments);
+  for (segmentIdx = 0U; (segmentIdx < segmentCount) && (result == TBX_OK);
+       segmentIdx++)
+  {
+    segmentLen = BltFirmwareCtxSegmentGetInfo(firmware, segmentIdx, &segmentAddress);
+    /* Read the segment data chunk by chunk, starting with the last chunk. */
+    offset = segmentLen;
+    while ((offset > 0U) && (result == TBX_OK))
+    {
+      len = (offset > BENCH_READ_AT_LEN) ? BENCH_READ_AT_LEN : offset;
+      offset -= len;
+      if ( (BltFirmwareCtxReadAt(firmware, segmentAddress + offset, len,
+                                 data) != TBX_OK) ||
+           (memcmp(data, &image->data[segmentAddress + offset - image->base],
+                   len) != 0) )
+      {
+        result = TBX_ERROR;
+      }
+    }
+  }
+  return result;
+} /*** end of BenchReaderReadAtAll ***/
+
+
+/*********************************** end of bench_reader.c *****************************/
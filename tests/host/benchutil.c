@@ -0,0 +1,101 @@
+/************************************************************************************//**
+* \file         benchutil.c
+* \brief        Benchmark utilities source file.
+* \ingroup      HostBenchUtil
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <string.h>                         /* for string utilities                    */
+#include <time.h>                           /* for time measurement                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "benchutil.h"                      /* Benchmark utilities                     */
+
+
+/************************************************************************************//**
+** \brief     Obtains the time of a monotonic clock.
+** \return    Time in microseconds.
+**
+****************************************************************************************/
+uint64_t BenchGetTimeUs(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000U) + ((uint64_t)now.tv_nsec / 1000U);
+} /*** end of BenchGetTimeUs ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the throughput.
+** \param     bytes Number of processed bytes.
+** \param     timeUs Time it took in microseconds.
+** \return    Throughput in megabytes (1024 * 1024 bytes) per second.
+**
+****************************************************************************************/
+double BenchGetMBps(uint64_t bytes, uint64_t timeUs)
+{
+  double result = 0.0;
+
+  if (timeUs > 0U)
+  {
+    result = ((double)bytes / (1024.0 * 1024.0)) / ((double)timeUs / 1000000.0);
+  }
+  return result;
+} /*** end of BenchGetMBps ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if the benchmark should do a quick run, with smaller data sets.
+**            The tests registered with CTest use this to keep the test time short.
+** \param     argc Number of program arguments.
+** \param     argv Program arguments.
+** \return    TBX_TRUE if the --quick argument is present, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+uint8_t BenchIsQuick(int argc, char const * const argv[])
+{
+  uint8_t result = TBX_FALSE;
+  int     argIdx;
+
+  for (argIdx = 1; argIdx < argc; argIdx++)
+  {
+    if (strcmp(argv[argIdx], "--quick") == 0)
+    {
+      result = TBX_TRUE;
+    }
+  }
+  return result;
+} /*** end of BenchIsQuick ***/
+
+
+/*********************************** end of benchutil.c ********************************/
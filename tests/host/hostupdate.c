@@ -0,0 +1,420 @@
+/************************************************************************************//**
+* \file         hostupdate.c
+* \brief        Firmware update runner source file.
+* \ingroup      HostUpdate
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <string.h>                         /* for string utilities                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "microblt.h"                       /* LibMicroBLT                             */
+#include "benchutil.h"                      /* Benchmark utilities                     */
+#include "hostupdate.h"                     /* Firmware update runner                  */
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint8_t UpdatePipeline(tBltSessionCtx * const sessions[],
+                              tBltFirmwareCtx * const firmwares[], uint8_t nodeCount);
+static uint8_t UpdateScheduler(tBltSessionCtx * const sessions[],
+                               tBltFirmwareCtx * const firmwares[], uint8_t nodeCount);
+
+
+/****************************************************************************************
+* Local constant declarations
+****************************************************************************************/
+/** \brief XCP session settings for the simulated targets. */
+static const tBltSessionSettingsXcpV10 updateSessionSettings =
+{
+  1000U,                                    /* T1 command response timeout             */
+  2000U,                                    /* T3 start programming timeout            */
+  10000U,                                   /* T4 erase memory timeout                 */
+  1000U,                                    /* T5 program memory and reset timeout     */
+  50U,                                      /* T6 connect response timeout             */
+  2000U,                                    /* T7 busy wait timer timeout              */
+  0U                                        /* connection mode                         */
+};
+
+
+/************************************************************************************//**
+** \brief     Performs a firmware update on one or more simulated targets.
+** \param     image Firmware image, which is also stored in the firmware file.
+** \param     firmwareFile FatFS path of the S-record firmware file.
+** \param     method Update method (UPDATE_METHOD_xxx).
+** \param     nodeCount Number of nodes to update. Not used by the segmented method.
+** \param     config Configuration of the simulated targets.
+** \param     result Storage for the results.
+** \return    TBX_OK if the update succeeded, the targets verified it, the statistics of
+**            each session match the packets of its target and the flash memory of all
+**            targets matches the firmware image, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t UpdateRun(tImage const * image, char const * firmwareFile, uint8_t method,
+                  uint8_t nodeCount, tSimTargetConfig const * config,
+                  tUpdateResult * result)
+{
+  uint8_t           status = TBX_OK;
+  tBltFirmwareCtx * sharedFirmware;
+  tBltFirmwareCtx * firmwares[SIM_TARGET_COUNT_MAX] = { NULL };
+  tBltSessionCtx  * sessions[SIM_TARGET_COUNT_MAX] = { NULL };
+  uint64_t          startTime;
+  uint8_t           nodeIdx;
+  tSimTargetStats const * stats;
+  tStats            sessionStats;
+  uint32_t          sessionPackets;
+  uint8_t           slotIdx;
+
+  (void)memset(result, 0, sizeof(*result));
+  if ((method == UPDATE_METHOD_SEGMENTED) || (nodeCount == 0U))
+  {
+    nodeCount = 1U;
+  }
+  TBX_ASSERT(nodeCount <= SIM_TARGET_COUNT_MAX);
+  TBX_ASSERT((image->base == config->flashBase) && (image->size <= config->flashSize));
+
+  /* Scan the firmware file once and share it with the firmware contexts of the nodes. */
+  sharedFirmware = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  if ( (sharedFirmware == NULL) ||
+       (BltFirmwareCtxFileOpen(sharedFirmware, firmwareFile) != TBX_OK) )
+  {
+    status = TBX_ERROR;
+  }
+  /* Create the simulated targets and connect to them. */
+  SimTargetSetTimeUs(0U);
+  startTime = BenchGetTimeUs();
+  for (nodeIdx = 0U; (nodeIdx < nodeCount) && (status == TBX_OK); nodeIdx++)
+  {
+    firmwares[nodeIdx] = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+    if ( (SimTargetCreate(nodeIdx, config) != TBX_OK) || (firmwares[nodeIdx] == NULL) ||
+         (BltFirmwareCtxFileShare(firmwares[nodeIdx], sharedFirmware) != TBX_OK) )
+    {
+      status = TBX_ERROR;
+    }
+    else
+    {
+      sessions[nodeIdx] = UpdateSessionCreate(nodeIdx);
+      if (sessions[nodeIdx] == NULL)
+      {
+        status = TBX_ERROR;
+      }
+    }
+  }
+  /* Perform the update. */
+  if (status == TBX_OK)
+  {
+    if (method == UPDATE_METHOD_SEGMENTED)
+    {
+      status = UpdateSegmented(sessions[0], firmwares[0]);
+    }
+    else if (method == UPDATE_METHOD_PIPELINE)
+    {
+      status = UpdatePipeline(sessions, firmwares, nodeCount);
+    }
+    else
+    {
+      status = UpdateScheduler(sessions, firmwares, nodeCount);
+    }
+  }
+  result->hostTimeUs = BenchGetTimeUs() - startTime;
+  result->simTimeUs = SimTargetGetTimeUs();
+  /* Let the targets verify the programmed firmware data with checksums. */
+  for (nodeIdx = 0U; (nodeIdx < nodeCount) && (status == TBX_OK); nodeIdx++)
+  {
+    if (BltSessionCtxVerify(sessions[nodeIdx], firmwares[nodeIdx]) != TBX_OK)
+    {
+      (void)printf("Verification of node %u failed\n", (unsigned)nodeIdx);
+      status = TBX_ERROR;
+    }
+    /* A CRC checksum is offered to the CRC hook of the port of the session. */
+    else if ( (config->checksumType >= BLT_CHECKSUM_TYPE_CRC_16) &&
+              (config->checksumType <= BLT_CHECKSUM_TYPE_CRC_32) &&
+              (SimTargetGetStats(nodeIdx)->crcCalculateCalls == 0U) )
+    {
+      (void)printf("CRC hook of node %u not used\n", (unsigned)nodeIdx);
+      status = TBX_ERROR;
+    }
+    else
+    {
+      /* Node verified. */
+    }
+  }
+  /* Disconnect, collect the results and check the flash memory contents. */
+  for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+  {
+    if (sessions[nodeIdx] != NULL)
+    {
+      /* Each session only counts the packets that were sent to its own target. */
+      BltSessionCtxGetStats(sessions[nodeIdx], &sessionStats);
+      sessionPackets = 0U;
+      for (slotIdx = 0U; slotIdx < sessionStats.commandCount; slotIdx++)
+      {
+        sessionPackets += sessionStats.commands[slotIdx].count;
+        /* No response takes longer than the longest timeout. Note that no port is
+         * linked with BltPortInit(), so the latencies must be measured with the port
+         * of the session.
+         */
+        if ( (status == TBX_OK) &&
+             (sessionStats.commands[slotIdx].latencyMax >
+              updateSessionSettings.timeoutT4) )
+        {
+          (void)printf("Latency of node %u exceeds the timeout\n", (unsigned)nodeIdx);
+          status = TBX_ERROR;
+        }
+      }
+      if ( (status == TBX_OK) &&
+           (sessionPackets != SimTargetGetStats(nodeIdx)->rxPackets) )
+      {
+        (void)printf("Statistics of node %u do not match its packets\n",
+                     (unsigned)nodeIdx);
+        status = TBX_ERROR;
+      }
+      BltSessionCtxStop(sessions[nodeIdx]);
+      BltSessionCtxDestroy(sessions[nodeIdx]);
+    }
+    if (firmwares[nodeIdx] != NULL)
+    {
+      (void)BltFirmwareCtxDestroy(firmwares[nodeIdx]);
+    }
+  }
+  for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+  {
+    stats = SimTargetGetStats(nodeIdx);
+    result->packets += stats->rxPackets;
+    result->bytes += stats->rxBytes;
+    result->violations += stats->violations;
+    if ( (status == TBX_OK) &&
+         (memcmp(SimTargetGetFlash(nodeIdx), image->data, image->size) != 0) )
+    {
+      (void)printf("Flash memory of node %u does not match\n", (unsigned)nodeIdx);
+      status = TBX_ERROR;
+    }
+    SimTargetDestroy(nodeIdx);
+  }
+  if (result->violations > 0U)
+  {
+    status = TBX_ERROR;
+  }
+  if (sharedFirmware != NULL)
+  {
+    (void)BltFirmwareCtxDestroy(sharedFirmware);
+  }
+  return status;
+} /*** end of UpdateRun ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a session context for a simulated target and starts the session.
+** \param     nodeIdx Index of the simulated target, which must already be created.
+** \return    The session context if successful, NULL otherwise.
+**
+****************************************************************************************/
+tBltSessionCtx * UpdateSessionCreate(uint8_t nodeIdx)
+{
+  tBltSessionCtx * result;
+
+  result = BltSessionCtxCreate(BLT_SESSION_XCP_V10, &updateSessionSettings,
+                               SimTargetGetPort(nodeIdx));
+  if ((result != NULL) && (BltSessionCtxStart(result) != TBX_OK))
+  {
+    BltSessionCtxDestroy(result);
+    result = NULL;
+  }
+  return result;
+} /*** end of UpdateSessionCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Erases all segments and then programs one segment after the other. Like
+**            on a real target, the erase operation covers complete flash sectors. The
+**            segments are therefore all erased first, because two segments can share a
+**            sector.
+** \param     session Session context.
+** \param     firmware Firmware context.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t UpdateSegmented(tBltSessionCtx * session, tBltFirmwareCtx * firmware)
+{
+  uint8_t         result = TBX_OK;
+  uint32_t        segmentIdx;
+  uint32_t        segmentAddress;
+  uint32_t        segmentLen;
+  uint32_t        address;
+  uint16_t        len;
+  uint8_t const * data;
+
+  for (segmentIdx = 0U; segmentIdx < BltFirmwareCtxSegmentGetCount(firmware);
+       segmentIdx++)
+  {
+    segmentLen = BltFirmwareCtxSegmentGetInfo(firmware, segmentIdx, &segmentAddress);
+    if (BltSessionCtxClearMemory(session, segmentAddress, segmentLen) != TBX_OK)
+    {
+      result = TBX_ERROR;
+      break;
+    }
+  }
+  for (segmentIdx = 0U; (segmentIdx < BltFirmwareCtxSegmentGetCount(firmware)) &&
+                        (result == TBX_OK); segmentIdx++)
+  {
+    BltFirmwareCtxSegmentOpen(firmware, segmentIdx);
+    do
+    {
+      data = BltFirmwareCtxSegmentGetNextData(firmware, &address, &len);
+      if ( (data == NULL) ||
+           ((len > 0U) &&
+            (BltSessionCtxWriteData(session, address, len, data) != TBX_OK)) )
+      {
+        result = TBX_ERROR;
+      }
+    }
+    while ((result == TBX_OK) && (len > 0U));
+  }
+  return result;
+} /*** end of UpdateSegmented ***/
+
+
+/************************************************************************************//**
+** \brief     Erases and programs with the firmware update pipeline. A single node waits
+**            for its target in the pipeline task. Multiple nodes each get their own
+**            pipeline context, which are all progressed from the same loop.
+** \param     sessions Session contexts of the nodes.
+** \param     firmwares Firmware contexts of the nodes.
+** \param     nodeCount Number of nodes.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t UpdatePipeline(tBltSessionCtx * const sessions[],
+                              tBltFirmwareCtx * const firmwares[], uint8_t nodeCount)
+{
+  uint8_t           result = TBX_OK;
+  uint8_t           status[SIM_TARGET_COUNT_MAX];
+  tBltPipelineCtx * pipelines[SIM_TARGET_COUNT_MAX] = { NULL };
+  uint8_t           busy;
+  uint8_t           nodeIdx;
+
+  for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+  {
+    pipelines[nodeIdx] = BltPipelineCtxCreate();
+    if (pipelines[nodeIdx] == NULL)
+    {
+      result = TBX_ERROR;
+    }
+    else
+    {
+      BltPipelineCtxStartWithErase(pipelines[nodeIdx], sessions[nodeIdx],
+                                   firmwares[nodeIdx]);
+    }
+  }
+  if (result == TBX_OK)
+  {
+    do
+    {
+      busy = TBX_FALSE;
+      for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+      {
+        if (nodeCount == 1U)
+        {
+          status[nodeIdx] = BltPipelineCtxTaskWait(pipelines[nodeIdx]);
+        }
+        else
+        {
+          status[nodeIdx] = BltPipelineCtxTask(pipelines[nodeIdx]);
+        }
+        if (status[nodeIdx] == BLT_PIPELINE_STATUS_BUSY)
+        {
+          busy = TBX_TRUE;
+        }
+      }
+    }
+    while (busy == TBX_TRUE);
+    for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+    {
+      if (status[nodeIdx] != BLT_PIPELINE_STATUS_DONE)
+      {
+        result = TBX_ERROR;
+      }
+    }
+  }
+  for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+  {
+    if (pipelines[nodeIdx] != NULL)
+    {
+      BltPipelineCtxDestroy(pipelines[nodeIdx]);
+    }
+  }
+  return result;
+} /*** end of UpdatePipeline ***/
+
+
+/************************************************************************************//**
+** \brief     Erases and programs all nodes at the same time with the scheduler.
+** \param     sessions Session contexts of the nodes.
+** \param     firmwares Firmware contexts of the nodes.
+** \param     nodeCount Number of nodes.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+static uint8_t UpdateScheduler(tBltSessionCtx * const sessions[],
+                               tBltFirmwareCtx * const firmwares[], uint8_t nodeCount)
+{
+  uint8_t result = TBX_OK;
+  uint8_t status;
+  uint8_t nodeIdx;
+
+  BltSchedulerStart();
+  for (nodeIdx = 0U; nodeIdx < nodeCount; nodeIdx++)
+  {
+    if (BltSchedulerAddNode(sessions[nodeIdx], firmwares[nodeIdx]) != TBX_OK)
+    {
+      result = TBX_ERROR;
+    }
+  }
+  if (result == TBX_OK)
+  {
+    do
+    {
+      status = BltSchedulerTask();
+    }
+    while (status == BLT_SCHEDULER_STATUS_BUSY);
+    if (status != BLT_SCHEDULER_STATUS_DONE)
+    {
+      result = TBX_ERROR;
+    }
+  }
+  return result;
+} /*** end of UpdateScheduler ***/
+
+
+/*********************************** end of hostupdate.c *******************************/
@@ -0,0 +1,106 @@
+/************************************************************************************//**
+* \file         hostupdate.h
+* \brief        Firmware update runner header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostUpdate Firmware update runner
+* \brief      Performs a complete firmware update on simulated targets.
+* \details
+* Runs a firmware update with the library on one or more simulated targets, with one of
+* the update methods that the library offers, and checks that the flash memory of each
+* target matches the firmware image afterwards. It reports the simulated flashing time
+* on the virtual clock, the time it took on the host and the communication statistics.
+****************************************************************************************/
+#ifndef HOSTUPDATE_H
+#define HOSTUPDATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdint.h>                         /* for standard integer types              */
+#include "microblt.h"                       /* LibMicroBLT                             */
+#include "imagegen.h"                       /* Firmware image generator                */
+#include "simtarget.h"                      /* Simulated XCP bootloader target         */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Erases and programs one segment after the other with the synchronous session
+ *         API. Always updates one node.
+ */
+#define UPDATE_METHOD_SEGMENTED        (0U)
+
+/** \brief Erases and programs with the firmware update pipeline. Each node gets its own
+ *         pipeline context and all nodes are progressed from the same loop.
+ */
+#define UPDATE_METHOD_PIPELINE         (1U)
+
+/** \brief Programs all nodes at the same time with the multi-node update scheduler. */
+#define UPDATE_METHOD_SCHEDULER        (2U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Results of a firmware update. */
+typedef struct
+{
+  uint64_t simTimeUs;                       /**< flashing time on the virtual clock    */
+  uint64_t hostTimeUs;                      /**< flashing time on the host             */
+  uint32_t packets;                         /**< packets sent to all targets           */
+  uint32_t bytes;                           /**< bytes sent to all targets             */
+  uint32_t violations;                      /**< protocol violations on all targets    */
+} tUpdateResult;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+uint8_t UpdateRun(tImage const * image, char const * firmwareFile, uint8_t method,
+                  uint8_t nodeCount, tSimTargetConfig const * config,
+                  tUpdateResult * result);
+tBltSessionCtx * UpdateSessionCreate(uint8_t nodeIdx);
+uint8_t UpdateSegmented(tBltSessionCtx * session, tBltFirmwareCtx * firmware);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOSTUPDATE_H */
+
+
+/*********************************** end of hostupdate.h *******************************/
@@ -0,0 +1,419 @@
+/************************************************************************************//**
+* \file         imagegen.c
+* \brief        Firmware image generator source file.
+* \ingroup      HostImageGen
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <stdlib.h>                         /* for standard library                    */
+#include <string.h>                         /* for string utilities                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include "imagegen.h"                       /* Firmware image generator                */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Minimum number of bytes between two data segments. */
+#define IMAGE_SEGMENT_GAP_MIN          (0x1000U)
+
+/** \brief Maximum number of bytes that is randomly added to the segment gap. */
+#define IMAGE_SEGMENT_GAP_RANDOM       (0x0800U)
+
+/** \brief Maximum length of a host path, including the terminating null character. */
+#define IMAGE_PATH_MAX                 (512U)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint32_t ImageRandom(uint32_t * state);
+static FILE   * ImageFileOpen(char const * path);
+
+
+/************************************************************************************//**
+** \brief     Creates an erased memory image.
+** \param     image Firmware image.
+** \param     base Base address of the memory image.
+** \param     size Size of the memory image in bytes.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t ImageCreate(tImage * image, uint32_t base, uint32_t size)
+{
+  uint8_t result = TBX_ERROR;
+
+  image->base = base;
+  image->size = size;
+  image->segmentCount = 0U;
+  image->data = malloc(size);
+  if (image->data != NULL)
+  {
+    (void)memset(image->data, IMAGE_ERASED_VALUE, size);
+    result = TBX_OK;
+  }
+  return result;
+} /*** end of ImageCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases the memory image.
+** \param     image Firmware image.
+**
+****************************************************************************************/
+void ImageDestroy(tImage * image)
+{
+  free(image->data);
+  image->data = NULL;
+  image->segmentCount = 0U;
+} /*** end of ImageDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Fills the memory image with data segments of random data. The segments
+**            are placed in ascending order, separated by gaps of a random size.
+** \param     image Firmware image.
+** \param     seed Seed for the random data, so that images can be reproduced.
+** \param     segmentCount Number of data segments.
+** \param     segmentLen Number of data bytes in each segment.
+** \return    TBX_OK if successful, TBX_ERROR if the segments do not fit.
+**
+****************************************************************************************/
+uint8_t ImageGenerate(tImage * image, uint32_t seed, uint32_t segmentCount,
+                      uint32_t segmentLen)
+{
+  uint8_t  result = TBX_ERROR;
+  uint32_t state = seed | 1U;
+  uint32_t offset = 0U;
+  uint32_t segmentIdx;
+  uint32_t byteIdx;
+
+  (void)memset(image->data, IMAGE_ERASED_VALUE, image->size);
+  image->segmentCount = 0U;
+  if (segmentCount <= IMAGE_SEGMENT_COUNT_MAX)
+  {
+    result = TBX_OK;
+    for (segmentIdx = 0U; segmentIdx < segmentCount; segmentIdx++)
+    {
+      /* Make sure the segment fits. */
+      if ((image->size - offset) < segmentLen)
+      {
+        result = TBX_ERROR;
+        break;
+      }
+      image->segments[segmentIdx].address = image->base + offset;
+      image->segments[segmentIdx].len = segmentLen;
+      for (byteIdx = 0U; byteIdx < segmentLen; byteIdx++)
+      {
+        image->data[offset + byteIdx] = (uint8_t)(ImageRandom(&state) >> 24U);
+      }
+      image->segmentCount++;
+      /* Continue after a gap. */
+      offset += segmentLen + IMAGE_SEGMENT_GAP_MIN +
+                (ImageRandom(&state) % IMAGE_SEGMENT_GAP_RANDOM);
+      if (offset > image->size)
+      {
+        offset = image->size;
+      }
+    }
+  }
+  return result;
+} /*** end of ImageGenerate ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the total number of data bytes in all segments.
+** \param     image Firmware image.
+** \return    Number of data bytes.
+**
+****************************************************************************************/
+uint32_t ImageGetDataSize(tImage const * image)
+{
+  uint32_t result = 0U;
+  uint32_t segmentIdx;
+
+  for (segmentIdx = 0U; segmentIdx < image->segmentCount; segmentIdx++)
+  {
+    result += image->segments[segmentIdx].len;
+  }
+  return result;
+} /*** end of ImageGetDataSize ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the data segments, as the library reports them when it merges
+**            segments with a gap of at most maxGap bytes in between. The gaps in the
+**            memory image hold erased bytes, which matches the default gap fill byte.
+** \param     image Firmware image.
+** \param     maxGap Maximum size of the gap between two merged segments. Zero disables
+**            the merging of segments.
+** \param     segments Storage for at least IMAGE_SEGMENT_COUNT_MAX merged segments.
+** \return    Number of merged segments.
+**
+****************************************************************************************/
+uint32_t ImageMergeSegments(tImage const * image, uint32_t maxGap,
+                            tImageSegment segments[])
+{
+  uint32_t result = 0U;
+  uint32_t segmentIdx;
+  uint32_t end;
+
+  for (segmentIdx = 0U; segmentIdx < image->segmentCount; segmentIdx++)
+  {
+    /* Extend the previous segment, if the gap in between is small enough. */
+    if ((result > 0U) && (maxGap > 0U))
+    {
+      end = segments[result - 1U].address + segments[result - 1U].len;
+      if ((image->segments[segmentIdx].address - end) <= maxGap)
+      {
+        segments[result - 1U].len = (image->segments[segmentIdx].address +
+                                     image->segments[segmentIdx].len) -
+                                    segments[result - 1U].address;
+        continue;
+      }
+    }
+    segments[result] = image->segments[segmentIdx];
+    result++;
+  }
+  return result;
+} /*** end of ImageMergeSegments ***/
+
+
+/************************************************************************************//**
+** \brief     Writes the data segments to a S-record firmware file, with S3 data records
+**            and CRLF line endings.
+** \param     image Firmware image.
+** \param     path FatFS path of the firmware file.
+** \param     recordLen Maximum number of data bytes per record.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t ImageWriteSRecord(tImage const * image, char const * path, uint8_t recordLen)
+{
+  uint8_t  result = TBX_ERROR;
+  FILE   * file;
+  uint32_t segmentIdx;
+  uint32_t offset;
+  uint32_t address;
+  uint32_t len;
+  uint32_t byteIdx;
+  uint8_t  checksum;
+  uint8_t  value;
+
+  file = ImageFileOpen(path);
+  if ((file != NULL) && (recordLen > 0U) && (recordLen <= 250U))
+  {
+    (void)fprintf(file, "S00F000068656C6C6F202020202000003C\r\n");
+    for (segmentIdx = 0U; segmentIdx < image->segmentCount; segmentIdx++)
+    {
+      for (offset = 0U; offset < image->segments[segmentIdx].len; offset += len)
+      {
+        address = image->segments[segmentIdx].address + offset;
+        len = image->segments[segmentIdx].len - offset;
+        if (len > recordLen)
+        {
+          len = recordLen;
+        }
+        checksum = (uint8_t)(len + 5U);
+        checksum += (uint8_t)(address >> 24U) + (uint8_t)(address >> 16U) +
+                    (uint8_t)(address >> 8U) + (uint8_t)address;
+        (void)fprintf(file, "S3%02X%08X", (unsigned)(len + 5U), (unsigned)address);
+        for (byteIdx = 0U; byteIdx < len; byteIdx++)
+        {
+          value = image->data[(address - image->base) + byteIdx];
+          checksum += value;
+          (void)fprintf(file, "%02X", (unsigned)value);
+        }
+        (void)fprintf(file, "%02X\r\n", (unsigned)(uint8_t)~checksum);
+      }
+    }
+    (void)fprintf(file, "S70500000000FA\r\n");
+    result = TBX_OK;
+  }
+  if ((file != NULL) && (fclose(file) != 0))
+  {
+    result = TBX_ERROR;
+  }
+  return result;
+} /*** end of ImageWriteSRecord ***/
+
+
+/************************************************************************************//**
+** \brief     Writes the data segments to an Intel HEX firmware file, with extended
+**            linear address records and CRLF line endings.
+** \param     image Firmware image.
+** \param     path FatFS path of the firmware file.
+** \param     recordLen Maximum number of data bytes per record.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t ImageWriteIntelHex(tImage const * image, char const * path, uint8_t recordLen)
+{
+  uint8_t  result = TBX_ERROR;
+  FILE   * file;
+  uint32_t segmentIdx;
+  uint32_t offset;
+  uint32_t address;
+  uint32_t len;
+  uint32_t byteIdx;
+  uint32_t upperAddress = 0xFFFFFFFFUL;
+  uint8_t  checksum;
+  uint8_t  value;
+
+  file = ImageFileOpen(path);
+  if ((file != NULL) && (recordLen > 0U))
+  {
+    for (segmentIdx = 0U; segmentIdx < image->segmentCount; segmentIdx++)
+    {
+      for (offset = 0U; offset < image->segments[segmentIdx].len; offset += len)
+      {
+        address = image->segments[segmentIdx].address + offset;
+        len = image->segments[segmentIdx].len - offset;
+        if (len > recordLen)
+        {
+          len = recordLen;
+        }
+        /* A data record cannot cross a 64 KB boundary. */
+        if (((address & 0xFFFFU) + len) > 0x10000UL)
+        {
+          len = 0x10000UL - (address & 0xFFFFU);
+        }
+        /* Write an extended linear address record if the upper address changed. */
+        if ((address >> 16U) != upperAddress)
+        {
+          upperAddress = address >> 16U;
+          checksum = (uint8_t)(2U + 4U + (upperAddress >> 8U) + upperAddress);
+          (void)fprintf(file, ":02000004%04X%02X\r\n", (unsigned)upperAddress,
+                        (unsigned)(uint8_t)(0U - checksum));
+        }
+        checksum = (uint8_t)(len + (address >> 8U) + address);
+        (void)fprintf(file, ":%02X%04X00", (unsigned)len, (unsigned)(address & 0xFFFFU));
+        for (byteIdx = 0U; byteIdx < len; byteIdx++)
+        {
+          value = image->data[(address - image->base) + byteIdx];
+          checksum += value;
+          (void)fprintf(file, "%02X", (unsigned)value);
+        }
+        (void)fprintf(file, "%02X\r\n", (unsigned)(uint8_t)(0U - checksum));
+      }
+    }
+    (void)fprintf(file, ":00000001FF\r\n");
+    result = TBX_OK;
+  }
+  if ((file != NULL) && (fclose(file) != 0))
+  {
+    result = TBX_ERROR;
+  }
+  return result;
+} /*** end of ImageWriteIntelHex ***/
+
+
+/************************************************************************************//**
+** \brief     Writes the first data segment to a binary firmware file, with the 8 byte
+**            header that holds the base address. A binary firmware file can only hold
+**            one data segment.
+** \param     image Firmware image.
+** \param     path FatFS path of the firmware file.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t ImageWriteBinary(tImage const * image, char const * path)
+{
+  uint8_t  result = TBX_ERROR;
+  FILE   * file;
+  uint8_t  header[8] = { 'M', 'B', 'I', 'N', 0U, 0U, 0U, 0U };
+  uint32_t address;
+  uint32_t len;
+
+  file = ImageFileOpen(path);
+  if ((file != NULL) && (image->segmentCount > 0U))
+  {
+    address = image->segments[0].address;
+    len = image->segments[0].len;
+    header[4] = (uint8_t)address;
+    header[5] = (uint8_t)(address >> 8U);
+    header[6] = (uint8_t)(address >> 16U);
+    header[7] = (uint8_t)(address >> 24U);
+    if ( (fwrite(header, 1U, sizeof(header), file) == sizeof(header)) &&
+         (fwrite(&image->data[address - image->base], 1U, len, file) == len) )
+    {
+      result = TBX_OK;
+    }
+  }
+  if ((file != NULL) && (fclose(file) != 0))
+  {
+    result = TBX_ERROR;
+  }
+  return result;
+} /*** end of ImageWriteBinary ***/
+
+
+/************************************************************************************//**
+** \brief     Generates the next pseudo random number. A fixed generator is used instead
+**            of rand(), such that the images are the same on all hosts.
+** \param     state State of the generator.
+** \return    Pseudo random number.
+**
+****************************************************************************************/
+static uint32_t ImageRandom(uint32_t * state)
+{
+  /* Xorshift32. */
+  *state ^= *state << 13U;
+  *state ^= *state >> 17U;
+  *state ^= *state << 5U;
+  return *state;
+} /*** end of ImageRandom ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a firmware file on the host.
+** \param     path FatFS path of the firmware file.
+** \return    Host file handle or NULL if the file could not be created.
+**
+****************************************************************************************/
+static FILE * ImageFileOpen(char const * path)
+{
+  FILE * result = NULL;
+  char   hostPath[IMAGE_PATH_MAX];
+
+  if (FfHostGetPath(path, hostPath, sizeof(hostPath)) == FR_OK)
+  {
+    result = fopen(hostPath, "wb");
+  }
+  return result;
+} /*** end of ImageFileOpen ***/
+
+
+/*********************************** end of imagegen.c *********************************/
@@ -0,0 +1,109 @@
+/************************************************************************************//**
+* \file         imagegen.h
+* \brief        Firmware image generator header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostImageGen Firmware image generator
+* \brief      Generates firmware images with random data and writes them as firmware
+*             files.
+* \details
+* The firmware image generator creates a memory image of the flash memory on the
+* target, filled with random firmware data segments. It can write the image to a
+* S-record, Intel HEX or binary firmware file, so that the host harness can read the
+* file with the library and compare the result against the memory image.
+****************************************************************************************/
+#ifndef IMAGEGEN_H
+#define IMAGEGEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdint.h>                         /* for standard integer types              */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Maximum number of data segments in a firmware image. */
+#define IMAGE_SEGMENT_COUNT_MAX        (16U)
+
+/** \brief Value of an erased byte in the memory image. */
+#define IMAGE_ERASED_VALUE             (0xFFU)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Firmware data segment. */
+typedef struct
+{
+  uint32_t address;                         /**< start address of the segment          */
+  uint32_t len;                             /**< number of data bytes in the segment   */
+} tImageSegment;
+
+/** \brief Firmware image. */
+typedef struct
+{
+  uint32_t        base;                     /**< base address of the memory image      */
+  uint32_t        size;                     /**< size of the memory image              */
+  uint8_t       * data;                     /**< memory image                          */
+  uint32_t        segmentCount;             /**< number of data segments               */
+  tImageSegment   segments[IMAGE_SEGMENT_COUNT_MAX]; /**< data segments                */
+} tImage;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+uint8_t  ImageCreate(tImage * image, uint32_t base, uint32_t size);
+void     ImageDestroy(tImage * image);
+uint8_t  ImageGenerate(tImage * image, uint32_t seed, uint32_t segmentCount,
+                       uint32_t segmentLen);
+uint8_t  ImageWriteSRecord(tImage const * image, char const * path, uint8_t recordLen);
+uint8_t  ImageWriteIntelHex(tImage const * image, char const * path, uint8_t recordLen);
+uint8_t  ImageWriteBinary(tImage const * image, char const * path);
+uint32_t ImageGetDataSize(tImage const * image);
+uint32_t ImageMergeSegments(tImage const * image, uint32_t maxGap,
+                            tImageSegment segments[]);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGEGEN_H */
+
+
+/*********************************** end of imagegen.h *********************************/
@@ -0,0 +1,1186 @@
+/************************************************************************************//**
+* \file         simtarget.c
+* \brief        Simulated XCP bootloader target source file.
+* \ingroup      HostSimTarget
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <stdlib.h>                         /* for standard library                    */
+#include <string.h>                         /* for string utilities                    */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include "simtarget.h"                      /* Simulated XCP bootloader target         */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Time that the virtual clock advances, each time that a port is polled for a
+ *         response packet that is not yet available.
+ */
+#define SIM_TARGET_POLL_TICK_US        (10U)
+
+/** \brief Maximum number of response packets that can be queued per target. */
+#define SIM_TARGET_RESPONSE_QUEUE_SIZE (4U)
+
+/* XCP command codes. */
+#define SIM_CMD_PROGRAM_NEXT           (0xCAU)
+#define SIM_CMD_PROGRAM_MAX            (0xC9U)
+#define SIM_CMD_PROGRAM_RESET          (0xCFU)
+#define SIM_CMD_PROGRAM                (0xD0U)
+#define SIM_CMD_PROGRAM_CLEAR          (0xD1U)
+#define SIM_CMD_PROGRAM_START          (0xD2U)
+#define SIM_CMD_BUILD_CHECKSUM         (0xF3U)
+#define SIM_CMD_UPLOAD                 (0xF5U)
+#define SIM_CMD_SET_MTA                (0xF6U)
+#define SIM_CMD_UNLOCK                 (0xF7U)
+#define SIM_CMD_GET_SEED               (0xF8U)
+#define SIM_CMD_GET_STATUS             (0xFDU)
+#define SIM_CMD_CONNECT                (0xFFU)
+
+/* XCP packet identifiers and error codes. */
+#define SIM_PID_RES                    (0xFFU)
+#define SIM_PID_ERR                    (0xFEU)
+#define SIM_ERR_CMD_UNKNOWN            (0x20U)
+#define SIM_ERR_OUT_OF_RANGE           (0x22U)
+#define SIM_ERR_ACCESS_LOCKED          (0x25U)
+#define SIM_ERR_SEQUENCE               (0x29U)
+#define SIM_ERR_GENERIC                (0x31U)
+
+/** \brief XCP programming resource. */
+#define SIM_RESOURCE_PGM               (0x10U)
+
+/** \brief Seed length of the seed and key algorithm. */
+#define SIM_SEED_LEN                   (4U)
+
+/** \brief Defines the port functions of a target, which pass the call on to the
+ *         functions that operate on the target with the specified index.
+ */
+#define SIM_TARGET_PORT_FUNCTIONS(idx)                                                  \
+  static uint8_t SimTargetXcpTransmitPacket##idx(tPortXcpPacket const * txPacket)       \
+  {                                                                                     \
+    return SimTargetXcpTransmitPacket(&simTargets[idx], txPacket);                      \
+  }                                                                                     \
+  static uint8_t SimTargetXcpReceivePacket##idx(tPortXcpPacket * rxPacket)              \
+  {                                                                                     \
+    return SimTargetXcpReceivePacket(&simTargets[idx], rxPacket);                       \
+  }                                                                                     \
+  static uint8_t SimTargetXcpReceivePacketTimeout##idx(tPortXcpPacket * rxPacket,       \
+                                                       uint32_t timeout)                \
+  {                                                                                     \
+    return SimTargetXcpReceivePacketTimeout(&simTargets[idx], rxPacket, timeout);       \
+  }                                                                                     \
+  static uint8_t SimTargetCrcCalculate##idx(uint8_t type, uint32_t * crc,               \
+                                            uint8_t const * data, uint32_t len)         \
+  {                                                                                     \
+    return SimTargetCrcCalculate(&simTargets[idx], type, crc, data, len);               \
+  }
+
+/** \brief Initializes the port of the target with the specified index. */
+#define SIM_TARGET_PORT(idx)                                                            \
+  {                                                                                     \
+    SimTargetSystemGetTime,                                                             \
+    SimTargetXcpTransmitPacket##idx,                                                    \
+    SimTargetXcpReceivePacket##idx,                                                     \
+    SimTargetXcpComputeKeyFromSeed,                                                     \
+    SimTargetXcpReceivePacketTimeout##idx,                                              \
+    SimTargetCrcCalculate##idx                                                          \
+  }
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Response packet that waits for its transmission. */
+typedef struct
+{
+  tPortXcpPacket packet;                    /**< response packet                       */
+  uint64_t       readyTime;                 /**< time that it is available to the host */
+} tSimTargetResponse;
+
+/** \brief State of a simulated target. */
+typedef struct
+{
+  tSimTargetConfig   config;                /**< configuration                         */
+  tSimTargetStats    stats;                 /**< statistics                            */
+  uint8_t          * flash;                 /**< flash memory contents                 */
+  uint32_t           mta;                   /**< memory transfer address               */
+  uint8_t            mtaSet;                /**< MTA set since the last programming    */
+  uint8_t            connected;             /**< connected to the host                 */
+  uint8_t            locked;                /**< programming resource is locked        */
+  uint8_t            programming;           /**< programming session was started       */
+  uint64_t           busyUntil;             /**< time that the last command completes  */
+  tSimTargetResponse responses[SIM_TARGET_RESPONSE_QUEUE_SIZE]; /**< response queue    */
+  uint8_t            responseHead;          /**< index of the oldest queued response   */
+  uint8_t            responseCount;         /**< number of queued responses            */
+  uint8_t            blockActive;           /**< master block transfer in progress     */
+  uint8_t            blockRemaining;        /**< bytes remaining in the block          */
+  uint8_t            blockPackets;          /**< packets received in the block         */
+  uint8_t            blockError;            /**< programming error during the block    */
+  uint64_t           blockLastTime;         /**< time of the last packet in the block  */
+} tSimTarget;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static uint32_t SimTargetSystemGetTime(void);
+static uint8_t  SimTargetXcpTransmitPacket(tSimTarget * target,
+                                           tPortXcpPacket const * txPacket);
+static uint8_t  SimTargetXcpReceivePacket(tSimTarget * target,
+                                          tPortXcpPacket * rxPacket);
+static uint8_t  SimTargetXcpReceivePacketTimeout(tSimTarget * target,
+                                                 tPortXcpPacket * rxPacket,
+                                                 uint32_t timeout);
+static uint8_t  SimTargetXcpComputeKeyFromSeed(uint8_t seedLen, uint8_t const * seedPtr,
+                                               uint8_t * keyLenPtr, uint8_t * keyPtr);
+static uint8_t  SimTargetCrcCalculate(tSimTarget * target, uint8_t type, uint32_t * crc,
+                                      uint8_t const * data, uint32_t len);
+static uint32_t SimTargetProcess(tSimTarget * target, tPortXcpPacket const * request,
+                                 tPortXcpPacket * response);
+static uint32_t SimTargetProgram(tSimTarget * target, uint8_t const * data, uint32_t len,
+                                 uint8_t * error);
+static uint32_t SimTargetChecksum(tSimTarget const * target, uint32_t address,
+                                  uint32_t len);
+static void     SimTargetSetError(tPortXcpPacket * response, uint8_t code);
+static uint8_t  SimTargetInFlash(tSimTarget const * target, uint32_t address,
+                                 uint32_t len);
+static uint32_t SimTargetGetLong(tSimTarget const * target, uint8_t const * data);
+static void     SimTargetSetLong(tSimTarget const * target, uint32_t value,
+                                 uint8_t * data);
+static uint64_t SimTargetFrameTime(tSimTarget const * target, uint8_t len);
+static void     SimTargetViolation(tSimTarget * target, char const * description);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief State of the simulated targets. */
+static tSimTarget simTargets[SIM_TARGET_COUNT_MAX];
+
+/** \brief Virtual clock in microseconds, shared by all targets. */
+static uint64_t simTargetTime;
+
+/** \brief Seed that a locked target reports. */
+static const uint8_t simTargetSeed[SIM_SEED_LEN] = { 0x12U, 0x34U, 0x56U, 0x78U };
+
+
+/****************************************************************************************
+* Port functions
+****************************************************************************************/
+SIM_TARGET_PORT_FUNCTIONS(0)
+SIM_TARGET_PORT_FUNCTIONS(1)
+SIM_TARGET_PORT_FUNCTIONS(2)
+SIM_TARGET_PORT_FUNCTIONS(3)
+
+/** \brief Ports of the simulated targets. */
+static const tPort simTargetPorts[SIM_TARGET_COUNT_MAX] =
+{
+  SIM_TARGET_PORT(0),
+  SIM_TARGET_PORT(1),
+  SIM_TARGET_PORT(2),
+  SIM_TARGET_PORT(3)
+};
+
+
+/************************************************************************************//**
+** \brief     Fills the configuration with the default settings. These model a target
+**            with 1 MB of flash memory in 16 KB sectors, on a 500 kbit/s CAN bus.
+** \param     config Configuration.
+**
+****************************************************************************************/
+void SimTargetConfigDefault(tSimTargetConfig * config)
+{
+  uint32_t cmdIdx;
+
+  config->flashBase = 0x08000000UL;
+  config->flashSize = 1024UL * 1024UL;
+  config->sectorSize = 16UL * 1024UL;
+  config->eraseTimeUs = 250000UL;
+  config->programTimeUs = 4UL;
+  config->checksumTimeUs = 50UL;
+  for (cmdIdx = 0U; cmdIdx < 256U; cmdIdx++)
+  {
+    config->commandTimeUs[cmdIdx] = 50UL;
+  }
+  config->bitRate = 500000UL;
+  config->frameOverheadBits = 47UL;
+  config->buildChecksumMax = 0UL;
+  config->programAlignment = 0UL;
+  config->maxCto = 8U;
+  config->maxCtoPgm = 8U;
+  config->blockMode = TBX_FALSE;
+  config->maxBs = 16U;
+  config->minSt = 0U;
+  config->seedKey = TBX_TRUE;
+  config->intel = TBX_TRUE;
+  config->checksumType = 0x06U;
+} /*** end of SimTargetConfigDefault ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a simulated target with erased flash memory.
+** \param     idx Index of the target.
+** \param     config Configuration.
+** \return    TBX_OK if successful, TBX_ERROR otherwise.
+**
+****************************************************************************************/
+uint8_t SimTargetCreate(uint8_t idx, tSimTargetConfig const * config)
+{
+  uint8_t      result = TBX_ERROR;
+  tSimTarget * target;
+
+  if (idx < SIM_TARGET_COUNT_MAX)
+  {
+    SimTargetDestroy(idx);
+    target = &simTargets[idx];
+    target->config = *config;
+    target->flash = malloc(config->flashSize);
+    if (target->flash != NULL)
+    {
+      (void)memset(target->flash, 0xFF, config->flashSize);
+      result = TBX_OK;
+    }
+  }
+  return result;
+} /*** end of SimTargetCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a simulated target and resets its state.
+** \param     idx Index of the target.
+**
+****************************************************************************************/
+void SimTargetDestroy(uint8_t idx)
+{
+  if (idx < SIM_TARGET_COUNT_MAX)
+  {
+    free(simTargets[idx].flash);
+    (void)memset(&simTargets[idx], 0, sizeof(simTargets[idx]));
+  }
+} /*** end of SimTargetDestroy ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the port through which the library communicates with the target.
+** \param     idx Index of the target.
+** \return    The port.
+**
+****************************************************************************************/
+tPort const * SimTargetGetPort(uint8_t idx)
+{
+  TBX_ASSERT(idx < SIM_TARGET_COUNT_MAX);
+
+  return &simTargetPorts[idx];
+} /*** end of SimTargetGetPort ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the configuration of the target. It can be changed while the
+**            target is in use, for example to inject communication delays.
+** \param     idx Index of the target.
+** \return    The configuration.
+**
+****************************************************************************************/
+tSimTargetConfig * SimTargetGetConfig(uint8_t idx)
+{
+  TBX_ASSERT(idx < SIM_TARGET_COUNT_MAX);
+
+  return &simTargets[idx].config;
+} /*** end of SimTargetGetConfig ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the statistics of the target.
+** \param     idx Index of the target.
+** \return    The statistics.
+**
+****************************************************************************************/
+tSimTargetStats const * SimTargetGetStats(uint8_t idx)
+{
+  TBX_ASSERT(idx < SIM_TARGET_COUNT_MAX);
+
+  return &simTargets[idx].stats;
+} /*** end of SimTargetGetStats ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the contents of the flash memory of the target.
+** \param     idx Index of the target.
+** \return    The flash memory contents, starting at the configured base address.
+**
+****************************************************************************************/
+uint8_t const * SimTargetGetFlash(uint8_t idx)
+{
+  TBX_ASSERT(idx < SIM_TARGET_COUNT_MAX);
+
+  return simTargets[idx].flash;
+} /*** end of SimTargetGetFlash ***/
+
+
+/************************************************************************************//**
+** \brief     Corrupts one byte in the flash memory of the target, by inverting all of
+**            its bits. Corrupting the same byte again restores it.
+** \param     idx Index of the target.
+** \param     address Address of the byte in flash memory.
+**
+****************************************************************************************/
+void SimTargetCorrupt(uint8_t idx, uint32_t address)
+{
+  tSimTarget * target;
+
+  TBX_ASSERT(idx < SIM_TARGET_COUNT_MAX);
+
+  target = &simTargets[idx];
+  TBX_ASSERT((address >= target->config.flashBase) &&
+             ((address - target->config.flashBase) < target->config.flashSize));
+
+  target->flash[address - target->config.flashBase] ^= 0xFFU;
+} /*** end of SimTargetCorrupt ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the time of the virtual clock.
+** \return    Time in microseconds.
+**
+****************************************************************************************/
+uint64_t SimTargetGetTimeUs(void)
+{
+  return simTargetTime;
+} /*** end of SimTargetGetTimeUs ***/
+
+
+/************************************************************************************//**
+** \brief     Sets the time of the virtual clock.
+** \param     timeUs Time in microseconds.
+**
+****************************************************************************************/
+void SimTargetSetTimeUs(uint64_t timeUs)
+{
+  simTargetTime = timeUs;
+} /*** end of SimTargetSetTimeUs ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the time of the virtual clock in milliseconds. Each call advances
+**            the clock by a microsecond, such that a loop that only waits for the time
+**            to pass, still terminates.
+** \return    Time in milliseconds.
+**
+****************************************************************************************/
+static uint32_t SimTargetSystemGetTime(void)
+{
+  simTargetTime++;
+  return (uint32_t)(simTargetTime / 1000U);
+} /*** end of SimTargetSystemGetTime ***/
+
+
+/************************************************************************************//**
+** \brief     Transmits a packet from the host to the target. The target processes the
+**            command and queues its response packet, which becomes available once the
+**            target completed the command.
+** \param     target The target.
+** \param     txPacket The packet.
+** \return    TBX_OK.
+**
+****************************************************************************************/
+static uint8_t SimTargetXcpTransmitPacket(tSimTarget * target,
+                                          tPortXcpPacket const * txPacket)
+{
+  tPortXcpPacket       response;
+  tSimTargetResponse * queued;
+  uint32_t             processTime;
+  uint64_t             startTime;
+
+  TBX_ASSERT(target->flash != NULL);
+
+  /* The packet occupies the bus. */
+  simTargetTime += SimTargetFrameTime(target, txPacket->len);
+  target->stats.rxPackets++;
+  target->stats.rxBytes += txPacket->len;
+  if (txPacket->len > 0U)
+  {
+    target->stats.commandCount[txPacket->data[0]]++;
+  }
+  /* The target starts processing the command once it completed the previous one. */
+  startTime = simTargetTime;
+  if (target->busyUntil > startTime)
+  {
+    startTime = target->busyUntil;
+  }
+  response.len = 0U;
+  processTime = SimTargetProcess(target, txPacket, &response);
+  target->busyUntil = startTime + processTime;
+  /* Queue the response packet, if any. */
+  if (response.len > 0U)
+  {
+    if (target->responseCount >= SIM_TARGET_RESPONSE_QUEUE_SIZE)
+    {
+      SimTargetViolation(target, "too many outstanding commands");
+    }
+    else
+    {
+      queued = &target->responses[(target->responseHead + target->responseCount) %
+                                  SIM_TARGET_RESPONSE_QUEUE_SIZE];
+      queued->packet = response;
+      queued->readyTime = target->busyUntil + SimTargetFrameTime(target, response.len);
+      target->responseCount++;
+    }
+  }
+  return TBX_OK;
+} /*** end of SimTargetXcpTransmitPacket ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to receive a response packet from the target. If none is
+**            available, the virtual clock advances by a poll tick.
+** \param     target The target.
+** \param     rxPacket Storage for the packet.
+** \return    TBX_TRUE if a packet was received, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SimTargetXcpReceivePacket(tSimTarget * target, tPortXcpPacket * rxPacket)
+{
+  uint8_t              result = TBX_FALSE;
+  tSimTargetResponse * queued = &target->responses[target->responseHead];
+
+  if ((target->responseCount > 0U) && (queued->readyTime <= simTargetTime))
+  {
+    *rxPacket = queued->packet;
+    target->responseHead = (uint8_t)((target->responseHead + 1U) %
+                                     SIM_TARGET_RESPONSE_QUEUE_SIZE);
+    target->responseCount--;
+    target->stats.txPackets++;
+    target->stats.txBytes += rxPacket->len;
+    result = TBX_TRUE;
+  }
+  else
+  {
+    simTargetTime += SIM_TARGET_POLL_TICK_US;
+  }
+  return result;
+} /*** end of SimTargetXcpReceivePacket ***/
+
+
+/************************************************************************************//**
+** \brief     Attempts to receive a response packet from the target, while blocking for
+**            at most the specified timeout. The virtual clock skips ahead to the time
+**            that the packet becomes available or the timeout expires.
+** \param     target The target.
+** \param     rxPacket Storage for the packet.
+** \param     timeout Timeout in milliseconds.
+** \return    TBX_TRUE if a packet was received, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SimTargetXcpReceivePacketTimeout(tSimTarget * target,
+                                                tPortXcpPacket * rxPacket,
+                                                uint32_t timeout)
+{
+  uint8_t  result = TBX_FALSE;
+  uint64_t endTime = simTargetTime + ((uint64_t)timeout * 1000U);
+  uint64_t readyTime;
+
+  if (target->responseCount > 0U)
+  {
+    readyTime = target->responses[target->responseHead].readyTime;
+    if (readyTime <= endTime)
+    {
+      if (readyTime > simTargetTime)
+      {
+        simTargetTime = readyTime;
+      }
+      result = SimTargetXcpReceivePacket(target, rxPacket);
+    }
+  }
+  if (result == TBX_FALSE)
+  {
+    simTargetTime = endTime;
+  }
+  return result;
+} /*** end of SimTargetXcpReceivePacketTimeout ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the key to unlock the programming resource. The key of the
+**            simulated target is the seed with each byte decremented by one.
+** \param     seedLen Length of the seed.
+** \param     seedPtr The seed.
+** \param     keyLenPtr Storage for the length of the key.
+** \param     keyPtr Storage for the key.
+** \return    TBX_OK.
+**
+****************************************************************************************/
+static uint8_t SimTargetXcpComputeKeyFromSeed(uint8_t seedLen, uint8_t const * seedPtr,
+                                              uint8_t * keyLenPtr, uint8_t * keyPtr)
+{
+  uint8_t idx;
+
+  for (idx = 0U; idx < seedLen; idx++)
+  {
+    keyPtr[idx] = (uint8_t)(seedPtr[idx] - 1U);
+  }
+  *keyLenPtr = seedLen;
+  return TBX_OK;
+} /*** end of SimTargetXcpComputeKeyFromSeed ***/
+
+
+/************************************************************************************//**
+** \brief     Offers a CRC calculation to the port of the target. The port only counts
+**            the calls, so the host can check that it uses the port of the session.
+**            The library then calculates the CRC in software.
+** \param     target The target.
+** \param     type CRC checksum type.
+** \param     crc The intermediate CRC value.
+** \param     data The data.
+** \param     len Number of bytes.
+** \return    TBX_ERROR.
+**
+****************************************************************************************/
+static uint8_t SimTargetCrcCalculate(tSimTarget * target, uint8_t type, uint32_t * crc,
+                                     uint8_t const * data, uint32_t len)
+{
+  (void)type;
+  (void)crc;
+  (void)data;
+  (void)len;
+  target->stats.crcCalculateCalls++;
+  return TBX_ERROR;
+} /*** end of SimTargetCrcCalculate ***/
+
+
+/************************************************************************************//**
+** \brief     Processes a command packet, like the OpenBLT bootloader does.
+** \param     target The target.
+** \param     request The command packet.
+** \param     response Storage for the response packet. Its length stays zero if the
+**            command has no response.
+** \return    Time in microseconds that the target needs to process the command.
+**
+****************************************************************************************/
+static uint32_t SimTargetProcess(tSimTarget * target, tPortXcpPacket const * request,
+                                 tPortXcpPacket * response)
+{
+  tSimTargetConfig const * config = &target->config;
+  uint8_t  const         * data = request->data;
+  uint32_t                 result = 0U;
+  uint32_t                 len;
+  uint32_t                 firstSector;
+  uint32_t                 lastSector;
+  uint8_t                  maxCto = config->maxCto;
+  uint8_t                  keyLen;
+  uint8_t                  key[SIM_SEED_LEN];
+  uint8_t                  error = TBX_FALSE;
+  uint8_t                  idx;
+
+  if (target->programming == TBX_TRUE)
+  {
+    maxCto = config->maxCtoPgm;
+  }
+  if ((request->len == 0U) || (request->len > maxCto))
+  {
+    SimTargetViolation(target, "invalid packet length");
+  }
+  /* Only CONNECT is processed while not connected. */
+  else if ((target->connected == TBX_FALSE) && (data[0] != SIM_CMD_CONNECT))
+  {
+  }
+  /* A master block transfer cannot be interrupted. */
+  else if ((target->blockActive == TBX_TRUE) && (data[0] != SIM_CMD_PROGRAM_NEXT))
+  {
+    SimTargetViolation(target, "interrupted block transfer");
+    target->blockActive = TBX_FALSE;
+  }
+  else
+  {
+    result = config->commandTimeUs[data[0]];
+    response->data[0] = SIM_PID_RES;
+    response->len = 1U;
+    switch (data[0])
+    {
+      case SIM_CMD_CONNECT:
+        target->connected = TBX_TRUE;
+        target->locked = config->seedKey;
+        target->programming = TBX_FALSE;
+        target->blockActive = TBX_FALSE;
+        response->data[1] = SIM_RESOURCE_PGM;
+        response->data[3] = config->maxCto;
+        /* Byte ordering and the maximum slave to master packet length. */
+        if (config->intel == TBX_TRUE)
+        {
+          response->data[2] = 0x00U;
+          response->data[4] = config->maxCto;
+          response->data[5] = 0U;
+        }
+        else
+        {
+          response->data[2] = 0x01U;
+          response->data[4] = 0U;
+          response->data[5] = config->maxCto;
+        }
+        response->data[6] = 0x01U;
+        response->data[7] = 0x01U;
+        response->len = 8U;
+        break;
+
+      case SIM_CMD_GET_STATUS:
+        response->data[1] = 0U;
+        response->data[2] = 0U;
+        if (target->locked == TBX_TRUE)
+        {
+          response->data[2] = SIM_RESOURCE_PGM;
+        }
+        response->data[3] = 0U;
+        response->data[4] = 0U;
+        response->data[5] = 0U;
+        response->len = 6U;
+        break;
+
+      case SIM_CMD_GET_SEED:
+        if ((data[1] != 0U) || (data[2] != SIM_RESOURCE_PGM))
+        {
+          SimTargetSetError(response, SIM_ERR_OUT_OF_RANGE);
+        }
+        else if (target->locked == TBX_FALSE)
+        {
+          response->data[1] = 0U;
+          response->len = 2U;
+        }
+        else
+        {
+          response->data[1] = SIM_SEED_LEN;
+          (void)memcpy(&response->data[2], simTargetSeed, SIM_SEED_LEN);
+          response->len = 2U + SIM_SEED_LEN;
+        }
+        break;
+
+      case SIM_CMD_UNLOCK:
+        (void)SimTargetXcpComputeKeyFromSeed(SIM_SEED_LEN, simTargetSeed, &keyLen, key);
+        if ((data[1] != keyLen) || (memcmp(&data[2], key, keyLen) != 0))
+        {
+          SimTargetSetError(response, SIM_ERR_ACCESS_LOCKED);
+        }
+        else
+        {
+          target->locked = TBX_FALSE;
+          response->data[1] = 0U;
+          response->len = 2U;
+        }
+        break;
+
+      case SIM_CMD_SET_MTA:
+        target->mta = SimTargetGetLong(target, &data[4]);
+        target->mtaSet = TBX_TRUE;
+        break;
+
+      case SIM_CMD_UPLOAD:
+        if ( (data[1] >= config->maxCto) ||
+             (SimTargetInFlash(target, target->mta, data[1]) == TBX_FALSE) )
+        {
+          SimTargetSetError(response, SIM_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+          (void)memcpy(&response->data[1],
+                       &target->flash[target->mta - config->flashBase], data[1]);
+          response->len = (uint8_t)(data[1] + 1U);
+          target->mta += data[1];
+        }
+        break;
+
+      case SIM_CMD_BUILD_CHECKSUM:
+        len = SimTargetGetLong(target, &data[4]);
+        if ((config->buildChecksumMax > 0U) && (len > config->buildChecksumMax))
+        {
+          SimTargetSetError(response, SIM_ERR_OUT_OF_RANGE);
+          response->data[2] = 0U;
+          response->data[3] = 0U;
+          SimTargetSetLong(target, config->buildChecksumMax, &response->data[4]);
+          response->len = 8U;
+        }
+        else if (SimTargetInFlash(target, target->mta, len) == TBX_FALSE)
+        {
+          SimTargetSetError(response, SIM_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+          response->data[1] = config->checksumType;
+          response->data[2] = 0U;
+          response->data[3] = 0U;
+          SimTargetSetLong(target, SimTargetChecksum(target, target->mta, len),
+                           &response->data[4]);
+          response->len = 8U;
+          result += (uint32_t)(((uint64_t)len * config->checksumTimeUs) / 1024U);
+          target->mta += len;
+        }
+        break;
+
+      case SIM_CMD_PROGRAM_START:
+        if (target->locked == TBX_TRUE)
+        {
+          SimTargetSetError(response, SIM_ERR_ACCESS_LOCKED);
+        }
+        else
+        {
+          target->programming = TBX_TRUE;
+          response->data[1] = 0U;
+          response->data[2] = config->blockMode;
+          response->data[3] = config->maxCtoPgm;
+          response->data[4] = config->maxBs;
+          response->data[5] = config->minSt;
+          response->data[6] = 0U;
+          response->len = 7U;
+        }
+        break;
+
+      case SIM_CMD_PROGRAM_CLEAR:
+        len = SimTargetGetLong(target, &data[4]);
+        if ( (target->programming == TBX_FALSE) ||
+             (SimTargetInFlash(target, target->mta, len) == TBX_FALSE) || (len == 0U) )
+        {
+          SimTargetSetError(response, SIM_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+          /* Erase all sectors that the range touches. */
+          firstSector = (target->mta - config->flashBase) / config->sectorSize;
+          lastSector = ((target->mta - config->flashBase) + len - 1U) /
+                       config->sectorSize;
+          (void)memset(&target->flash[firstSector * config->sectorSize], 0xFF,
+                       ((lastSector - firstSector) + 1U) * config->sectorSize);
+          target->stats.erasedSectors += (lastSector - firstSector) + 1U;
+          result += ((lastSector - firstSector) + 1U) * config->eraseTimeUs;
+        }
+        break;
+
+      case SIM_CMD_PROGRAM:
+        if (target->programming == TBX_FALSE)
+        {
+          SimTargetSetError(response, SIM_ERR_SEQUENCE);
+        }
+        /* A length of zero ends the programming. */
+        else if (data[1] == 0U)
+        {
+        }
+        /* More data than fits in this packet starts a master block transfer. */
+        else if (data[1] > (request->len - 2U))
+        {
+          if (config->blockMode == TBX_FALSE)
+          {
+            SimTargetViolation(target, "block transfer not supported");
+            SimTargetSetError(response, SIM_ERR_SEQUENCE);
+          }
+          else
+          {
+            len = SimTargetProgram(target, &data[2], request->len - 2U,
+                                   &target->blockError);
+            result += len * config->programTimeUs;
+            target->blockActive = TBX_TRUE;
+            target->blockRemaining = (uint8_t)(data[1] - len);
+            target->blockPackets = 1U;
+            target->blockLastTime = simTargetTime;
+            response->len = 0U;
+          }
+        }
+        else
+        {
+          /* Without master block mode, the host writes a chunk that is not a multiple
+           * of the packet size, by starting with a PROGRAM command. Such a chunk must
+           * start on the alignment, unless it is the first one after SET_MTA, so at
+           * the start of a segment.
+           */
+          if ( (config->programAlignment > 1U) && (target->mtaSet == TBX_FALSE) &&
+               ((target->mta % config->programAlignment) != 0U) )
+          {
+            SimTargetViolation(target, "chunk not aligned");
+          }
+          result += SimTargetProgram(target, &data[2], data[1], &error) *
+                    config->programTimeUs;
+          if (error == TBX_TRUE)
+          {
+            SimTargetSetError(response, SIM_ERR_GENERIC);
+          }
+        }
+        break;
+
+      case SIM_CMD_PROGRAM_MAX:
+        if (target->programming == TBX_FALSE)
+        {
+          SimTargetSetError(response, SIM_ERR_SEQUENCE);
+        }
+        else
+        {
+          result += SimTargetProgram(target, &data[1], config->maxCtoPgm - 1U, &error) *
+                    config->programTimeUs;
+          if (error == TBX_TRUE)
+          {
+            SimTargetSetError(response, SIM_ERR_GENERIC);
+          }
+        }
+        break;
+
+      case SIM_CMD_PROGRAM_NEXT:
+        response->len = 0U;
+        if ((target->blockActive == TBX_FALSE) || (data[1] != target->blockRemaining))
+        {
+          SimTargetViolation(target, "unexpected PROGRAM_NEXT");
+          target->blockActive = TBX_FALSE;
+          SimTargetSetError(response, SIM_ERR_SEQUENCE);
+          break;
+        }
+        target->blockPackets++;
+        if (target->blockPackets > config->maxBs)
+        {
+          SimTargetViolation(target, "block larger than MAX_BS");
+        }
+        if ((simTargetTime - target->blockLastTime) < ((uint64_t)config->minSt * 100U))
+        {
+          SimTargetViolation(target, "packets closer than MIN_ST");
+        }
+        target->blockLastTime = simTargetTime;
+        len = request->len - 2U;
+        if (len > data[1])
+        {
+          len = data[1];
+        }
+        len = SimTargetProgram(target, &data[2], len, &target->blockError);
+        result += len * config->programTimeUs;
+        target->blockRemaining = (uint8_t)(target->blockRemaining - len);
+        /* Respond once the block is complete. */
+        if (target->blockRemaining == 0U)
+        {
+          target->blockActive = TBX_FALSE;
+          response->data[0] = SIM_PID_RES;
+          response->len = 1U;
+          if (target->blockError == TBX_TRUE)
+          {
+            SimTargetSetError(response, SIM_ERR_GENERIC);
+          }
+          target->blockError = TBX_FALSE;
+        }
+        break;
+
+      case SIM_CMD_PROGRAM_RESET:
+        target->connected = TBX_FALSE;
+        target->programming = TBX_FALSE;
+        break;
+
+      default:
+        SimTargetSetError(response, SIM_ERR_CMD_UNKNOWN);
+        break;
+    }
+    /* Unused in the responses that do not fill all bytes. */
+    for (idx = response->len; idx < 8U; idx++)
+    {
+      response->data[idx] = 0U;
+    }
+  }
+  return result;
+} /*** end of SimTargetProcess ***/
+
+
+/************************************************************************************//**
+** \brief     Programs data into the flash memory at the memory transfer address.
+** \param     target The target.
+** \param     data The data.
+** \param     len Number of bytes.
+** \param     error Set to TBX_TRUE if the data could not be programmed, because it is
+**            outside the flash memory or the flash memory was not erased.
+** \return    Number of bytes that were processed.
+**
+****************************************************************************************/
+static uint32_t SimTargetProgram(tSimTarget * target, uint8_t const * data, uint32_t len,
+                                 uint8_t * error)
+{
+  uint8_t  * flash;
+  uint32_t   idx;
+
+  target->mtaSet = TBX_FALSE;
+  if (SimTargetInFlash(target, target->mta, len) == TBX_FALSE)
+  {
+    *error = TBX_TRUE;
+  }
+  else
+  {
+    flash = &target->flash[target->mta - target->config.flashBase];
+    for (idx = 0U; idx < len; idx++)
+    {
+      if (flash[idx] != 0xFFU)
+      {
+        *error = TBX_TRUE;
+      }
+      flash[idx] &= data[idx];
+    }
+    target->stats.programmedBytes += len;
+  }
+  target->mta += len;
+  return len;
+} /*** end of SimTargetProgram ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the checksum of the configured type over flash memory.
+** \param     target The target.
+** \param     address Start address.
+** \param     len Number of bytes.
+** \return    The checksum.
+**
+****************************************************************************************/
+static uint32_t SimTargetChecksum(tSimTarget const * target, uint32_t address,
+                                  uint32_t len)
+{
+  uint8_t const * data = &target->flash[address - target->config.flashBase];
+  uint32_t        result = 0U;
+  uint32_t        idx;
+  uint8_t         bit;
+  uint16_t        word;
+
+  switch (target->config.checksumType)
+  {
+    case 0x01U:
+    case 0x02U:
+    case 0x03U:
+      for (idx = 0U; idx < len; idx++)
+      {
+        result += data[idx];
+      }
+      if (target->config.checksumType == 0x01U)
+      {
+        result &= 0xFFU;
+      }
+      else if (target->config.checksumType == 0x02U)
+      {
+        result &= 0xFFFFU;
+      }
+      break;
+
+    case 0x04U:
+    case 0x05U:
+      for (idx = 0U; (idx + 1U) < len; idx += 2U)
+      {
+        if (target->config.intel == TBX_TRUE)
+        {
+          word = (uint16_t)(data[idx] | ((uint16_t)data[idx + 1U] << 8U));
+        }
+        else
+        {
+          word = (uint16_t)(data[idx + 1U] | ((uint16_t)data[idx] << 8U));
+        }
+        result += word;
+      }
+      if (target->config.checksumType == 0x04U)
+      {
+        result &= 0xFFFFU;
+      }
+      break;
+
+    case 0x06U:
+      for (idx = 0U; (idx + 3U) < len; idx += 4U)
+      {
+        result += SimTargetGetLong(target, &data[idx]);
+      }
+      break;
+
+    case 0x07U:
+      /* CRC16 with polynomial 0x8005, reflected, initial value 0x0000. */
+      for (idx = 0U; idx < len; idx++)
+      {
+        result ^= data[idx];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+          if ((result & 1U) != 0U)
+          {
+            result = (result >> 1U) ^ 0xA001U;
+          }
+          else
+          {
+            result >>= 1U;
+          }
+        }
+      }
+      break;
+
+    case 0x08U:
+      /* CRC16 CCITT with polynomial 0x1021, initial value 0xFFFF. */
+      result = TbxChecksumCrc16Calculate(data, len);
+      break;
+
+    case 0x09U:
+      /* CRC32 with polynomial 0x04C11DB7, reflected, initial value 0xFFFFFFFF. */
+      result = 0xFFFFFFFFUL;
+      for (idx = 0U; idx < len; idx++)
+      {
+        result ^= data[idx];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+          if ((result & 1U) != 0U)
+          {
+            result = (result >> 1U) ^ 0xEDB88320UL;
+          }
+          else
+          {
+            result >>= 1U;
+          }
+        }
+      }
+      result = ~result;
+      break;
+
+    default:
+      break;
+  }
+  return result;
+} /*** end of SimTargetChecksum ***/
+
+
+/************************************************************************************//**
+** \brief     Turns the response packet into a negative response.
+** \param     response The response packet.
+** \param     code XCP error code.
+**
+****************************************************************************************/
+static void SimTargetSetError(tPortXcpPacket * response, uint8_t code)
+{
+  response->data[0] = SIM_PID_ERR;
+  response->data[1] = code;
+  response->len = 2U;
+} /*** end of SimTargetSetError ***/
+
+
+/************************************************************************************//**
+** \brief     Determines if a memory range is located in the flash memory.
+** \param     target The target.
+** \param     address Start address.
+** \param     len Number of bytes.
+** \return    TBX_TRUE if it is in the flash memory, TBX_FALSE otherwise.
+**
+****************************************************************************************/
+static uint8_t SimTargetInFlash(tSimTarget const * target, uint32_t address,
+                                uint32_t len)
+{
+  uint8_t result = TBX_FALSE;
+
+  if ( (address >= target->config.flashBase) &&
+       (((uint64_t)address + len) <=
+        ((uint64_t)target->config.flashBase + target->config.flashSize)) )
+  {
+    result = TBX_TRUE;
+  }
+  return result;
+} /*** end of SimTargetInFlash ***/
+
+
+/************************************************************************************//**
+** \brief     Reads a 32-bit value in the byte ordering of the target.
+** \param     target The target.
+** \param     data Bytes of the value.
+** \return    The value.
+**
+****************************************************************************************/
+static uint32_t SimTargetGetLong(tSimTarget const * target, uint8_t const * data)
+{
+  uint32_t result;
+
+  if (target->config.intel == TBX_TRUE)
+  {
+    result = (uint32_t)data[0] | ((uint32_t)data[1] << 8U) |
+             ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+  }
+  else
+  {
+    result = (uint32_t)data[3] | ((uint32_t)data[2] << 8U) |
+             ((uint32_t)data[1] << 16U) | ((uint32_t)data[0] << 24U);
+  }
+  return result;
+} /*** end of SimTargetGetLong ***/
+
+
+/************************************************************************************//**
+** \brief     Writes a 32-bit value in the byte ordering of the target.
+** \param     target The target.
+** \param     value The value.
+** \param     data Storage for the bytes of the value.
+**
+****************************************************************************************/
+static void SimTargetSetLong(tSimTarget const * target, uint32_t value, uint8_t * data)
+{
+  uint8_t idx;
+
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    if (target->config.intel == TBX_TRUE)
+    {
+      data[idx] = (uint8_t)(value >> (8U * idx));
+    }
+    else
+    {
+      data[3U - idx] = (uint8_t)(value >> (8U * idx));
+    }
+  }
+} /*** end of SimTargetSetLong ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates the time that a packet occupies the bus.
+** \param     target The target.
+** \param     len Number of bytes in the packet.
+** \return    Time in microseconds.
+**
+****************************************************************************************/
+static uint64_t SimTargetFrameTime(tSimTarget const * target, uint8_t len)
+{
+  uint64_t result = 0U;
+
+  if (target->config.bitRate > 0U)
+  {
+    result = (((uint64_t)target->config.frameOverheadBits + (8U * (uint64_t)len)) *
+              1000000U) / target->config.bitRate;
+  }
+  return result;
+} /*** end of SimTargetFrameTime ***/
+
+
+/************************************************************************************//**
+** \brief     Records a violation of the XCP protocol by the host.
+** \param     target The target.
+** \param     description Description of the violation.
+**
+****************************************************************************************/
+static void SimTargetViolation(tSimTarget * target, char const * description)
+{
+  target->stats.violations++;
+  (void)fprintf(stderr, "Simulated target %u: %s\n",
+                (unsigned)(target - &simTargets[0]), description);
+} /*** end of SimTargetViolation ***/
+
+
+/*********************************** end of simtarget.c ********************************/
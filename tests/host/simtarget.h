@@ -0,0 +1,141 @@
+/************************************************************************************//**
+* \file         simtarget.h
+* \brief        Simulated XCP bootloader target header file.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostSimTarget Simulated XCP bootloader target
+* \brief      In-process simulation of a microcontroller that runs the OpenBLT
+*             bootloader, plugged into the library through a tPort.
+* \details
+* The simulated target implements the XCP slave side of the OpenBLT bootloader, with
+* the commands CONNECT, GET_STATUS, GET_SEED, UNLOCK, SET_MTA, UPLOAD, BUILD_CHECKSUM,
+* PROGRAM_START, PROGRAM_CLEAR, PROGRAM, PROGRAM_MAX, PROGRAM_NEXT and PROGRAM_RESET.
+* Its flash memory model consists of equally sized sectors. Programming a byte that is
+* not erased is reported as an error, just like on a real flash memory.
+*
+* All targets share one virtual clock with a microsecond resolution, which models the
+* communication bus between the host and the targets. Transmitting a packet advances
+* the clock by the time it occupies the bus. A response packet becomes available after
+* the time that the target needs to process the command. Each time that the library
+* polls for a response packet, without one being available, the clock advances by a
+* small tick. Blocking for a response packet skips the clock ahead. This makes the
+* measured flashing times deterministic and independent of the speed of the host.
+*
+* Multiple targets can be simulated at the same time, each with its own port. Just like
+* nodes on a CAN bus with their own CAN identifiers, each port only receives the
+* response packets of its own target.
+****************************************************************************************/
+#ifndef SIMTARGET_H
+#define SIMTARGET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdint.h>                         /* for standard integer types              */
+#include "port.h"                           /* Port module                             */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Maximum number of targets that can be simulated at the same time. */
+#define SIM_TARGET_COUNT_MAX           (4U)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+/** \brief Configuration of a simulated target. */
+typedef struct
+{
+  uint32_t flashBase;                       /**< start address of the flash memory     */
+  uint32_t flashSize;                       /**< size of the flash memory              */
+  uint32_t sectorSize;                      /**< size of a flash sector                */
+  uint32_t eraseTimeUs;                     /**< time to erase one sector              */
+  uint32_t programTimeUs;                   /**< time to program one byte              */
+  uint32_t checksumTimeUs;                  /**< time to build the checksum of a KB    */
+  uint32_t commandTimeUs[256];              /**< time to process each command          */
+  uint32_t bitRate;                         /**< bit rate of the bus in bits/s         */
+  uint32_t frameOverheadBits;               /**< bits of a packet besides its data     */
+  uint32_t buildChecksumMax;                /**< max BUILD_CHECKSUM block size, 0=any  */
+  uint32_t programAlignment;                /**< alignment of written chunks, 0=any    */
+  uint8_t  maxCto;                          /**< max master to slave packet length     */
+  uint8_t  maxCtoPgm;                       /**< max packet length while programming   */
+  uint8_t  blockMode;                       /**< supports master block mode            */
+  uint8_t  maxBs;                           /**< max packets in a block                */
+  uint8_t  minSt;                           /**< min packet separation in 100 us       */
+  uint8_t  seedKey;                         /**< programming resource is locked        */
+  uint8_t  intel;                           /**< little endian (Intel) byte ordering   */
+  uint8_t  checksumType;                    /**< type reported by BUILD_CHECKSUM       */
+} tSimTargetConfig;
+
+/** \brief Statistics of a simulated target. */
+typedef struct
+{
+  uint32_t commandCount[256];               /**< received packets per command          */
+  uint32_t rxPackets;                       /**< packets received from the host        */
+  uint32_t txPackets;                       /**< packets transmitted to the host       */
+  uint32_t rxBytes;                         /**< bytes received from the host          */
+  uint32_t txBytes;                         /**< bytes transmitted to the host         */
+  uint32_t programmedBytes;                 /**< bytes programmed into flash           */
+  uint32_t erasedSectors;                   /**< sectors that were erased              */
+  uint32_t violations;                      /**< protocol violations by the host       */
+  uint32_t crcCalculateCalls;               /**< CRC calculations offered to the port  */
+} tSimTargetStats;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void                    SimTargetConfigDefault(tSimTargetConfig * config);
+uint8_t                 SimTargetCreate(uint8_t idx, tSimTargetConfig const * config);
+void                    SimTargetDestroy(uint8_t idx);
+tPort const           * SimTargetGetPort(uint8_t idx);
+tSimTargetConfig      * SimTargetGetConfig(uint8_t idx);
+tSimTargetStats const * SimTargetGetStats(uint8_t idx);
+uint8_t const         * SimTargetGetFlash(uint8_t idx);
+void                    SimTargetCorrupt(uint8_t idx, uint32_t address);
+uint64_t                SimTargetGetTimeUs(void);
+void                    SimTargetSetTimeUs(uint64_t timeUs);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIMTARGET_H */
+
+
+/*********************************** end of simtarget.h ********************************/
@@ -0,0 +1,354 @@
+/************************************************************************************//**
+* \file         ff.c
+* \brief        FatFS stand-in source file for host builds.
+* \ingroup      HostFatFs
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <string.h>                         /* for string utilities                    */
+#include <time.h>                           /* for time conversion                     */
+#include <sys/stat.h>                       /* for file status                         */
+#include "ff.h"                             /* FatFS stand-in                          */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Maximum length of a host path, including the terminating null character. */
+#define FF_HOST_PATH_MAX               (512U)
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Host directory that the FatFS paths are relative to. */
+static char  ffHostRoot[FF_HOST_PATH_MAX] = ".";
+
+/** \brief Flag to report a fixed date and time stamp, as FatFS with _FS_NORTC does. */
+static uint8_t ffHostFixedTime = 0U;
+
+/** \brief Fixed date stamp in the FatFS format. */
+static WORD  ffHostFixedDate;
+
+/** \brief Fixed time stamp in the FatFS format. */
+static WORD  ffHostFixedTimeStamp;
+
+
+/************************************************************************************//**
+** \brief     Sets the host directory that the FatFS paths are relative to.
+** \param     root Path of the directory.
+**
+****************************************************************************************/
+void FfHostSetRoot(char const * root)
+{
+  (void)snprintf(ffHostRoot, sizeof(ffHostRoot), "%s", root);
+} /*** end of FfHostSetRoot ***/
+
+
+/************************************************************************************//**
+** \brief     Configures f_stat() to report a fixed date and time stamp.
+** \param     enable 1 to report the fixed date and time stamp, 0 to report the
+**            modification time of the host file.
+** \param     fdate Date stamp in the FatFS format.
+** \param     ftime Time stamp in the FatFS format.
+**
+****************************************************************************************/
+void FfHostSetFixedTime(uint8_t enable, WORD fdate, WORD ftime)
+{
+  ffHostFixedTime = enable;
+  ffHostFixedDate = fdate;
+  ffHostFixedTimeStamp = ftime;
+} /*** end of FfHostSetFixedTime ***/
+
+
+/************************************************************************************//**
+** \brief     Converts a FatFS path to the path of the file on the host.
+** \param     path FatFS path, optionally with a drive prefix.
+** \param     hostPath Buffer for the host path.
+** \param     size Size of the buffer.
+** \return    FR_OK if successful, FR_INVALID_NAME if the host path does not fit in the
+**            buffer.
+**
+****************************************************************************************/
+FRESULT FfHostGetPath(TCHAR const * path, char * hostPath, size_t size)
+{
+  FRESULT      result = FR_OK;
+  char const * colon;
+  int          len;
+
+  /* Remove the drive prefix. */
+  colon = strchr(path, ':');
+  if (colon != NULL)
+  {
+    path = colon + 1;
+  }
+  /* Remove the leading directory separator. */
+  if ((path[0] == '/') || (path[0] == '\\'))
+  {
+    path++;
+  }
+  /* Never access a truncated path, because it refers to another file. */
+  len = snprintf(hostPath, size, "%s/%s", ffHostRoot, path);
+  if ((len < 0) || ((size_t)len >= size))
+  {
+    result = FR_INVALID_NAME;
+  }
+  return result;
+} /*** end of FfHostGetPath ***/
+
+
+/************************************************************************************//**
+** \brief     Opens a file.
+** \param     fp File object.
+** \param     path FatFS path of the file.
+** \param     mode Access mode flags.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_open(FIL * fp, TCHAR const * path, BYTE mode)
+{
+  FRESULT result;
+  char    hostPath[FF_HOST_PATH_MAX];
+  long    size;
+
+  fp->fp = NULL;
+  result = FfHostGetPath(path, hostPath, sizeof(hostPath));
+  if (result != FR_OK)
+  {
+    /* Host path too long. */
+  }
+  else if ((mode & FA_CREATE_ALWAYS) != 0U)
+  {
+    fp->fp = fopen(hostPath, "w+b");
+  }
+  else if ((mode & FA_WRITE) != 0U)
+  {
+    fp->fp = fopen(hostPath, "r+b");
+  }
+  else
+  {
+    fp->fp = fopen(hostPath, "rb");
+  }
+  if (fp->fp != NULL)
+  {
+    (void)fseek(fp->fp, 0L, SEEK_END);
+    size = ftell(fp->fp);
+    (void)fseek(fp->fp, 0L, SEEK_SET);
+    fp->fptr = 0U;
+    fp->objsize = (FSIZE_t)size;
+  }
+  else if (result == FR_OK)
+  {
+    result = FR_NO_FILE;
+  }
+  return result;
+} /*** end of f_open ***/
+
+
+/************************************************************************************//**
+** \brief     Closes a file.
+** \param     fp File object.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_close(FIL * fp)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+
+  if (fp->fp != NULL)
+  {
+    result = FR_OK;
+    if (fclose(fp->fp) != 0)
+    {
+      result = FR_DISK_ERR;
+    }
+    fp->fp = NULL;
+  }
+  return result;
+} /*** end of f_close ***/
+
+
+/************************************************************************************//**
+** \brief     Reads data from a file.
+** \param     fp File object.
+** \param     buff Buffer for the data.
+** \param     btr Number of bytes to read.
+** \param     br Number of bytes that were read.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_read(FIL * fp, void * buff, UINT btr, UINT * br)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+  size_t  len;
+
+  *br = 0U;
+  if (fp->fp != NULL)
+  {
+    result = FR_DISK_ERR;
+    len = 0U;
+    if (fseek(fp->fp, (long)fp->fptr, SEEK_SET) == 0)
+    {
+      len = fread(buff, 1U, btr, fp->fp);
+      if (ferror(fp->fp) == 0)
+      {
+        result = FR_OK;
+      }
+    }
+    fp->fptr += (FSIZE_t)len;
+    *br = (UINT)len;
+  }
+  return result;
+} /*** end of f_read ***/
+
+
+/************************************************************************************//**
+** \brief     Writes data to a file.
+** \param     fp File object.
+** \param     buff Buffer with the data.
+** \param     btw Number of bytes to write.
+** \param     bw Number of bytes that were written.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_write(FIL * fp, void const * buff, UINT btw, UINT * bw)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+  size_t  len;
+
+  *bw = 0U;
+  if (fp->fp != NULL)
+  {
+    result = FR_DISK_ERR;
+    len = 0U;
+    if (fseek(fp->fp, (long)fp->fptr, SEEK_SET) == 0)
+    {
+      len = fwrite(buff, 1U, btw, fp->fp);
+      if (len == btw)
+      {
+        result = FR_OK;
+      }
+    }
+    fp->fptr += (FSIZE_t)len;
+    if (fp->fptr > fp->objsize)
+    {
+      fp->objsize = fp->fptr;
+    }
+    *bw = (UINT)len;
+  }
+  return result;
+} /*** end of f_write ***/
+
+
+/************************************************************************************//**
+** \brief     Moves the read/write pointer of a file.
+** \param     fp File object.
+** \param     ofs Offset from the start of the file.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_lseek(FIL * fp, FSIZE_t ofs)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+
+  if (fp->fp != NULL)
+  {
+    fp->fptr = ofs;
+    result = FR_OK;
+  }
+  return result;
+} /*** end of f_lseek ***/
+
+
+/************************************************************************************//**
+** \brief     Obtains the size and the date and time stamp of a file.
+** \param     path FatFS path of the file.
+** \param     fno File information.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_stat(TCHAR const * path, FILINFO * fno)
+{
+  FRESULT     result;
+  char        hostPath[FF_HOST_PATH_MAX];
+  struct stat status;
+  struct tm * modified;
+
+  result = FfHostGetPath(path, hostPath, sizeof(hostPath));
+  if ((result == FR_OK) && (stat(hostPath, &status) != 0))
+  {
+    result = FR_NO_FILE;
+  }
+  if (result == FR_OK)
+  {
+    fno->fsize = (FSIZE_t)status.st_size;
+    if (ffHostFixedTime != 0U)
+    {
+      fno->fdate = ffHostFixedDate;
+      fno->ftime = ffHostFixedTimeStamp;
+    }
+    else
+    {
+      /* Convert to the FatFS format, including its two second resolution. */
+      modified = localtime(&status.st_mtime);
+      fno->fdate = (WORD)((((modified->tm_year - 80) & 0x7F) << 9) |
+                          ((modified->tm_mon + 1) << 5) | modified->tm_mday);
+      fno->ftime = (WORD)((modified->tm_hour << 11) | (modified->tm_min << 5) |
+                          (modified->tm_sec / 2));
+    }
+  }
+  return result;
+} /*** end of f_stat ***/
+
+
+/************************************************************************************//**
+** \brief     Removes a file.
+** \param     path FatFS path of the file.
+** \return    FR_OK if successful, an error code otherwise.
+**
+****************************************************************************************/
+FRESULT f_unlink(TCHAR const * path)
+{
+  FRESULT result;
+  char    hostPath[FF_HOST_PATH_MAX];
+
+  result = FfHostGetPath(path, hostPath, sizeof(hostPath));
+  if ((result == FR_OK) && (remove(hostPath) != 0))
+  {
+    result = FR_NO_FILE;
+  }
+  return result;
+} /*** end of f_unlink ***/
+
+
+/*********************************** end of ff.c ***************************************/
@@ -0,0 +1,148 @@
+/************************************************************************************//**
+* \file         ff.h
+* \brief        FatFS stand-in header file for host builds.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostFatFs FatFS stand-in
+* \brief      Minimal FatFS API that maps onto files of the host file system.
+* \details
+* The host harness builds the library sources on a PC, without a FatFS volume. This
+* stand-in offers the FatFS types, constants and functions that the library sources
+* use and implements them with the C standard input/output functions. The drive prefix
+* of a path (e.g. "0:") is removed and the remainder is looked up relative to the root
+* directory set with FfHostSetRoot().
+*
+* Just like with FatFS, the read/write pointer is part of the FIL object. The library
+* relies on this, when it copies a FIL object to share an opened file. The stand-in
+* therefore moves the host file pointer to the one of the FIL object on each access.
+*
+* FatFS stores the modification time with a two second resolution, or not at all when
+* configured with _FS_NORTC. FfHostSetFixedTime() emulates the latter, so that tests can
+* rewrite a file without changing its date and time stamp.
+****************************************************************************************/
+#ifndef FF_H
+#define FF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <stdint.h>                         /* for standard integer types              */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/* Configuration that the library sources check. */
+#define _FS_READONLY                   (0)
+#define _FS_MINIMIZE                   (0)
+#define _LFN_UNICODE                   (0)
+#define _USE_LFN                       (1)
+
+/* File access mode flags. */
+#define FA_READ                        (0x01U)
+#define FA_WRITE                       (0x02U)
+#define FA_CREATE_ALWAYS               (0x08U)
+
+/** \brief Obtains the read/write pointer of a file. */
+#define f_tell(fp)                     ((fp)->fptr)
+
+/** \brief Obtains the size of a file. */
+#define f_size(fp)                     ((fp)->objsize)
+
+
+/****************************************************************************************
+* Type definitions
+****************************************************************************************/
+typedef unsigned int  UINT;
+typedef uint8_t       BYTE;
+typedef uint16_t      WORD;
+typedef uint32_t      DWORD;
+typedef DWORD         FSIZE_t;
+typedef char          TCHAR;
+
+/** \brief Function results. Only the values that the library sources and this stand-in
+ *         use.
+ */
+typedef enum
+{
+  FR_OK = 0,
+  FR_DISK_ERR,
+  FR_NO_FILE,
+  FR_DENIED,
+  FR_INVALID_OBJECT,
+  FR_INVALID_NAME
+} FRESULT;
+
+/** \brief File object. */
+typedef struct
+{
+  FILE    * fp;                             /**< host file handle                      */
+  FSIZE_t   fptr;                           /**< file read/write pointer               */
+  FSIZE_t   objsize;                        /**< file size                             */
+} FIL;
+
+/** \brief File information. */
+typedef struct
+{
+  FSIZE_t   fsize;                          /**< file size                             */
+  WORD      fdate;                          /**< modified date                         */
+  WORD      ftime;                          /**< modified time                         */
+} FILINFO;
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+FRESULT f_open(FIL * fp, TCHAR const * path, BYTE mode);
+FRESULT f_close(FIL * fp);
+FRESULT f_read(FIL * fp, void * buff, UINT btr, UINT * br);
+FRESULT f_write(FIL * fp, void const * buff, UINT btw, UINT * bw);
+FRESULT f_lseek(FIL * fp, FSIZE_t ofs);
+FRESULT f_stat(TCHAR const * path, FILINFO * fno);
+FRESULT f_unlink(TCHAR const * path);
+void    FfHostSetRoot(char const * root);
+void    FfHostSetFixedTime(uint8_t enable, WORD fdate, WORD ftime);
+FRESULT FfHostGetPath(TCHAR const * path, char * hostPath, size_t size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FF_H */
+
+
+/*********************************** end of ff.h ***************************************/
@@ -0,0 +1,184 @@
+/************************************************************************************//**
+* \file         microtbx.c
+* \brief        MicroTBX stand-in source file for host builds.
+* \ingroup      HostMicroTbx
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <stdlib.h>                         /* for standard library                    */
+#include <pthread.h>                        /* for POSIX threads                       */
+#include "microtbx.h"                       /* MicroTBX stand-in                       */
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TbxCriticalSectionInit(void);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Makes sure the critical section mutex is initialized only once. */
+static pthread_once_t  tbxCriticalSectionOnce = PTHREAD_ONCE_INIT;
+
+/** \brief Recursive mutex that implements the critical section. MicroTBX allows nested
+ *         critical sections.
+ */
+static pthread_mutex_t tbxCriticalSectionMutex;
+
+
+/************************************************************************************//**
+** \brief     Reports a failed assertion and aborts the program.
+** \param     file Name of the source file with the assertion.
+** \param     line Line number of the assertion.
+**
+****************************************************************************************/
+void TbxAssertTrigger(char const * file, uint32_t line)
+{
+  (void)fprintf(stderr, "Assertion failed in %s at line %u\n", file, (unsigned)line);
+  abort();
+} /*** end of TbxAssertTrigger ***/
+
+
+/************************************************************************************//**
+** \brief     Creates a memory pool. On the host, all allocations come from the heap, so
+**            there is nothing to create.
+** \param     numBlocks Number of blocks in the pool.
+** \param     blockSize Size of each block in bytes.
+** \return    TBX_OK.
+**
+****************************************************************************************/
+uint8_t TbxMemPoolCreate(size_t numBlocks, size_t blockSize)
+{
+  (void)numBlocks;
+  (void)blockSize;
+
+  return TBX_OK;
+} /*** end of TbxMemPoolCreate ***/
+
+
+/************************************************************************************//**
+** \brief     Allocates a block of memory.
+** \param     size Size of the block in bytes.
+** \return    Pointer to the allocated block or NULL if out of memory.
+**
+****************************************************************************************/
+void * TbxMemPoolAllocate(size_t size)
+{
+  return malloc(size);
+} /*** end of TbxMemPoolAllocate ***/
+
+
+/************************************************************************************//**
+** \brief     Releases a block of memory that was allocated with TbxMemPoolAllocate().
+** \param     memPtr Pointer to the block.
+**
+****************************************************************************************/
+void TbxMemPoolRelease(void * memPtr)
+{
+  free(memPtr);
+} /*** end of TbxMemPoolRelease ***/
+
+
+/************************************************************************************//**
+** \brief     Enters a critical section.
+**
+****************************************************************************************/
+void TbxCriticalSectionEnter(void)
+{
+  (void)pthread_once(&tbxCriticalSectionOnce, TbxCriticalSectionInit);
+  (void)pthread_mutex_lock(&tbxCriticalSectionMutex);
+} /*** end of TbxCriticalSectionEnter ***/
+
+
+/************************************************************************************//**
+** \brief     Exits a critical section.
+**
+****************************************************************************************/
+void TbxCriticalSectionExit(void)
+{
+  (void)pthread_mutex_unlock(&tbxCriticalSectionMutex);
+} /*** end of TbxCriticalSectionExit ***/
+
+
+/************************************************************************************//**
+** \brief     Calculates a CRC16 CCITT over the data, with polynomial 0x1021 and initial
+**            value 0xFFFF.
+** \param     data Byte array with the data.
+** \param     len Number of bytes in the data.
+** \return    The CRC16 value.
+**
+****************************************************************************************/
+uint16_t TbxChecksumCrc16Calculate(uint8_t const * data, size_t len)
+{
+  uint16_t crc = 0xFFFFU;
+  size_t   idx;
+  uint8_t  bit;
+
+  for (idx = 0U; idx < len; idx++)
+  {
+    crc ^= (uint16_t)((uint16_t)data[idx] << 8U);
+    for (bit = 0U; bit < 8U; bit++)
+    {
+      if ((crc & 0x8000U) != 0U)
+      {
+        crc = (uint16_t)((crc << 1U) ^ 0x1021U);
+      }
+      else
+      {
+        crc = (uint16_t)(crc << 1U);
+      }
+    }
+  }
+  return crc;
+} /*** end of TbxChecksumCrc16Calculate ***/
+
+
+/************************************************************************************//**
+** \brief     Initializes the recursive mutex of the critical section.
+**
+****************************************************************************************/
+static void TbxCriticalSectionInit(void)
+{
+  pthread_mutexattr_t attr;
+
+  (void)pthread_mutexattr_init(&attr);
+  (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  (void)pthread_mutex_init(&tbxCriticalSectionMutex, &attr);
+  (void)pthread_mutexattr_destroy(&attr);
+} /*** end of TbxCriticalSectionInit ***/
+
+
+/*********************************** end of microtbx.c *********************************/
@@ -0,0 +1,99 @@
+/************************************************************************************//**
+* \file         microtbx.h
+* \brief        MicroTBX stand-in header file for host builds.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostMicroTbx MicroTBX stand-in
+* \brief      Minimal host implementation of the MicroTBX functionality that the library
+*             uses.
+* \details
+* The host harness builds the library sources on a PC, without the MicroTBX submodule
+* and its microcontroller ports. This stand-in offers the small part of the MicroTBX API
+* that the library sources use. Memory pools are backed by the C library heap and the
+* critical section by a recursive mutex.
+****************************************************************************************/
+#ifndef MICROTBX_H
+#define MICROTBX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdint.h>                         /* for standard integer types              */
+#include <stddef.h>                         /* for standard definitions                */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief Boolean true value. */
+#define TBX_TRUE                       (1U)
+
+/** \brief Boolean false value. */
+#define TBX_FALSE                      (0U)
+
+/** \brief Generic okay value. */
+#define TBX_OK                         (1U)
+
+/** \brief Generic error value. */
+#define TBX_ERROR                      (0U)
+
+/** \brief Heap size. Only referenced by comments and error messages in the library. */
+#define TBX_CONF_HEAP_SIZE             (0U)
+
+/** \brief Run-time assertion. Reports the failed condition and aborts the program. */
+#define TBX_ASSERT(cond)               { if (!(cond)) { TbxAssertTrigger(__FILE__, \
+                                                                         __LINE__); } }
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+void     TbxAssertTrigger(char const * file, uint32_t line);
+uint8_t  TbxMemPoolCreate(size_t numBlocks, size_t blockSize);
+void   * TbxMemPoolAllocate(size_t size);
+void     TbxMemPoolRelease(void * memPtr);
+void     TbxCriticalSectionEnter(void);
+void     TbxCriticalSectionExit(void);
+uint16_t TbxChecksumCrc16Calculate(uint8_t const * data, size_t len);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MICROTBX_H */
+
+
+/*********************************** end of microtbx.h *********************************/
@@ -0,0 +1,471 @@
+/************************************************************************************//**
+* \file         test_update.c
+* \brief        End-to-end firmware update test.
+* \internal
+*----------------------------------------------------------------------------------------
+*                          C O P Y R I G H T
+*----------------------------------------------------------------------------------------
+*   Copyright (c) 2022 by Feaser     www.feaser.com     All rights reserved
+*
+*----------------------------------------------------------------------------------------
+*                            L I C E N S E
+*----------------------------------------------------------------------------------------
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* \endinternal
+****************************************************************************************/
+/************************************************************************************//**
+* \defgroup   HostTestUpdate End-to-end firmware update test
+* \brief      Checks firmware updates on simulated targets.
+* \details
+* Flashes a firmware file onto simulated targets with each update method of the library
+* and checks that the flash memory matches the firmware file, that the library does not
+* violate the XCP protocol and that the protocol optimizations actually speed up the
+* update.
+****************************************************************************************/
+
+/****************************************************************************************
+* Include files
+****************************************************************************************/
+#include <stdio.h>                          /* for standard input/output functions     */
+#include <microtbx.h>                       /* MicroTBX toolbox                        */
+#include <ff.h>                             /* FatFS                                   */
+#include <string.h>                         /* for string utilities                    */
+#include "microblt.h"                       /* LibMicroBLT                             */
+#include "firmware.h"                       /* Firmware reader module                  */
+#include "imagegen.h"                       /* Firmware image generator                */
+#include "simtarget.h"                      /* Simulated XCP bootloader target         */
+#include "hostupdate.h"                     /* Firmware update runner                  */
+
+
+/****************************************************************************************
+* Macro definitions
+****************************************************************************************/
+/** \brief FatFS path of the firmware file. */
+#define TEST_FIRMWARE_FILE             "0:test.srec"
+
+/** \brief Maximum gap between merged segments, larger than all gaps in the image. */
+#define TEST_GAP_FILL_MAX              (8192U)
+
+/** \brief Command code of the XCP SET_MTA command. */
+#define TEST_CMD_SET_MTA               (0xF6U)
+
+/** \brief Checks a condition and reports it when it does not hold. */
+#define TEST_CHECK(cond)               TestCheck((cond), #cond)
+
+
+/****************************************************************************************
+* Function prototypes
+****************************************************************************************/
+static void TestShare(tImage const * image);
+static void TestDelta(tImage * image, tSimTargetConfig const * config);
+static void TestVerify(tImage const * image, tSimTargetConfig const * config);
+static void TestGapFill(tImage const * image, tSimTargetConfig const * config);
+static void TestDeltaRun(tBltSessionCtx * session, tImage const * image,
+                         tSimTargetConfig const * config, uint32_t * updated);
+static void TestCheck(int condition, char const * description);
+
+
+/****************************************************************************************
+* Local data declarations
+****************************************************************************************/
+/** \brief Number of failed checks. */
+static uint32_t testFailures;
+
+
+/************************************************************************************//**
+** \brief     Program entry point.
+** \return    0 if all checks passed, 1 otherwise.
+**
+****************************************************************************************/
+int main(void)
+{
+  int              exitCode = 0;
+  tImage           image;
+  tSimTargetConfig config;
+  tUpdateResult    segmented;
+  tUpdateResult    block;
+  tUpdateResult    pipeline;
+  tUpdateResult    single;
+  tUpdateResult    multi;
+  tUpdateResult    pipelines;
+  tUpdateResult    scratch;
+
+  SimTargetConfigDefault(&config);
+#if defined(FIRMWARE_CHUNK_ALIGNMENT)
+  /* Each chunk, besides the first one of a segment, must start on the alignment. */
+  config.programAlignment = FIRMWARE_CHUNK_ALIGNMENT;
+#endif
+  TEST_CHECK(ImageCreate(&image, config.flashBase, config.flashSize) == TBX_OK);
+  TEST_CHECK(ImageGenerate(&image, 2U, 3U, 20000U) == TBX_OK);
+  TEST_CHECK(ImageWriteSRecord(&image, TEST_FIRMWARE_FILE, 32U) == TBX_OK);
+
+  /* Segmented update, without and with master block mode. */
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SEGMENTED, 1U, &config,
+                       &segmented) == TBX_OK);
+  config.blockMode = TBX_TRUE;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SEGMENTED, 1U, &config,
+                       &block) == TBX_OK);
+  TEST_CHECK(block.simTimeUs < segmented.simTimeUs);
+
+  /* Master block mode with a minimum separation time between the packets. */
+  config.minSt = 2U;
+  config.maxBs = 8U;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SEGMENTED, 1U, &config,
+                       &scratch) == TBX_OK);
+  config.minSt = 0U;
+  config.maxBs = 16U;
+
+  /* Target that limits the number of bytes it builds a checksum over. */
+  config.buildChecksumMax = 1000U;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SEGMENTED, 1U, &config,
+                       &scratch) == TBX_OK);
+  config.buildChecksumMax = 0U;
+
+  /* Targets that build a CRC32 checksum, each with its own port and CRC hook. */
+  config.checksumType = 0x09U;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SCHEDULER, 2U, &config,
+                       &scratch) == TBX_OK);
+  config.checksumType = 0x06U;
+
+  /* Pipeline, with a big endian target. */
+  config.intel = TBX_FALSE;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_PIPELINE, 1U, &config,
+                       &pipeline) == TBX_OK);
+  config.intel = TBX_TRUE;
+
+  /* Multiple nodes take much less time than updating them one after the other. This
+   * only works if the bus is not the bottleneck, so simulate a slower flash memory.
+   */
+  config.programTimeUs = 50U;
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SCHEDULER, 1U, &config,
+                       &single) == TBX_OK);
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_SCHEDULER, 3U, &config,
+                       &multi) == TBX_OK);
+  TEST_CHECK(multi.simTimeUs < (2U * single.simTimeUs));
+  /* Same for multiple pipelines that run at the same time, each with its own context. */
+  TEST_CHECK(UpdateRun(&image, TEST_FIRMWARE_FILE, UPDATE_METHOD_PIPELINE, 3U, &config,
+                       &pipelines) == TBX_OK);
+  TEST_CHECK(pipelines.simTimeUs < (2U * single.simTimeUs));
+
+  /* Firmware file that is shared by multiple firmware contexts. */
+  TestShare(&image);
+
+  /* Differential update, also with a target that limits its checksum block size. */
+  TestDelta(&image, &config);
+  config.buildChecksumMax = 1000U;
+  TestDelta(&image, &config);
+  config.buildChecksumMax = 0U;
+
+  /* Verification of a target with corrupted flash memory, also with a target that
+   * limits its checksum block size, such that the corruption is in a later block.
+   */
+  TestVerify(&image, &config);
+  config.buildChecksumMax = 1000U;
+  TestVerify(&image, &config);
+  config.buildChecksumMax = 0U;
+
+  /* Segmented update without and with the merging of segments. */
+  TestGapFill(&image, &config);
+
+  ImageDestroy(&image);
+  /* Do not leave the generated firmware file behind in the working directory. */
+  (void)f_unlink(TEST_FIRMWARE_FILE);
+  (void)printf("segmented %.1f ms, block mode %.1f ms, pipeline %.1f ms, "
+               "1 node %.1f ms, 3 nodes %.1f ms, 3 pipelines %.1f ms\n",
+               (double)segmented.simTimeUs / 1000.0, (double)block.simTimeUs / 1000.0,
+               (double)pipeline.simTimeUs / 1000.0, (double)single.simTimeUs / 1000.0,
+               (double)multi.simTimeUs / 1000.0, (double)pipelines.simTimeUs / 1000.0);
+  if (testFailures > 0U)
+  {
+    exitCode = 1;
+  }
+  return exitCode;
+} /*** end of main ***/
+
+
+/************************************************************************************//**
+** \brief     Checks that the firmware context that opened a firmware file, cannot close
+**            it or be destroyed, while other firmware contexts still share it. The
+**            firmware contexts that share it, must still be able to read its data.
+** \param     image Firmware image of the firmware file.
+**
+****************************************************************************************/
+static void TestShare(tImage const * image)
+{
+  tBltFirmwareCtx * owner;
+  tBltFirmwareCtx * shares[2];
+  uint32_t          shareIdx;
+  uint32_t          address;
+  uint8_t           data[64];
+  tImageSegment     segments[IMAGE_SEGMENT_COUNT_MAX];
+  uint32_t          segmentCount;
+
+  owner = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  shares[0] = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  shares[1] = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  TEST_CHECK((owner != NULL) && (shares[0] != NULL) && (shares[1] != NULL));
+  TEST_CHECK(BltFirmwareCtxFileOpen(owner, TEST_FIRMWARE_FILE) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxFileShare(shares[0], owner) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxFileShare(shares[1], owner) == TBX_OK);
+  /* The owner cannot close, reopen or release its firmware file, while it is shared. */
+  TEST_CHECK(BltFirmwareCtxFileClose(owner) == TBX_ERROR);
+  TEST_CHECK(BltFirmwareCtxFileOpen(owner, TEST_FIRMWARE_FILE) == TBX_ERROR);
+  TEST_CHECK(BltFirmwareCtxDestroy(owner) == TBX_ERROR);
+  /* The firmware contexts that share it, still read the firmware data. */
+  segmentCount = ImageMergeSegments(image, FIRMWARE_GAP_FILL_MAX, segments);
+  for (shareIdx = 0U; shareIdx < 2U; shareIdx++)
+  {
+    TEST_CHECK(BltFirmwareCtxSegmentGetCount(shares[shareIdx]) == segmentCount);
+    address = image->segments[image->segmentCount - 1U].address;
+    TEST_CHECK(BltFirmwareCtxReadAt(shares[shareIdx], address, sizeof(data),
+                                    data) == TBX_OK);
+    TEST_CHECK(memcmp(data, &image->data[address - image->base], sizeof(data)) == 0);
+  }
+  /* Once the last share is closed, the owner can close its firmware file. */
+  TEST_CHECK(BltFirmwareCtxFileClose(shares[0]) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxFileClose(owner) == TBX_ERROR);
+  TEST_CHECK(BltFirmwareCtxDestroy(shares[1]) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxFileClose(owner) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxDestroy(shares[0]) == TBX_OK);
+  TEST_CHECK(BltFirmwareCtxDestroy(owner) == TBX_OK);
+} /*** end of TestShare ***/
+
+
+/************************************************************************************//**
+** \brief     Checks the differential update. It programs the firmware file onto an
+**            erased target, runs it again without changes and then once more after
+**            changing one byte of the firmware file. Only the sector with the changed
+**            byte should be erased and programmed again. The firmware file is restored
+**            afterwards.
+** \param     image Firmware image of the firmware file.
+** \param     config Configuration of the simulated target.
+**
+****************************************************************************************/
+static void TestDelta(tImage * image, tSimTargetConfig const * config)
+{
+  tBltSessionCtx  * session = NULL;
+  uint32_t          updated;
+  uint32_t          erasedSectors;
+  uint32_t          offset;
+
+  SimTargetSetTimeUs(0U);
+  TEST_CHECK(SimTargetCreate(0U, config) == TBX_OK);
+  session = UpdateSessionCreate(0U);
+  TEST_CHECK(session != NULL);
+  if (session != NULL)
+  {
+    /* Program the firmware file onto the erased target. */
+    TestDeltaRun(session, image, config, &updated);
+    TEST_CHECK(updated > 0U);
+    /* Without changes, all sectors are unchanged and nothing is erased. */
+    erasedSectors = SimTargetGetStats(0U)->erasedSectors;
+    TestDeltaRun(session, image, config, &updated);
+    TEST_CHECK(updated == 0U);
+    TEST_CHECK(SimTargetGetStats(0U)->erasedSectors == erasedSectors);
+    /* Change one byte in the second segment. Only its sector is updated. */
+    offset = (image->segments[1].address - image->base) + 100U;
+    image->data[offset] ^= 0x5AU;
+    TEST_CHECK(ImageWriteSRecord(image, TEST_FIRMWARE_FILE, 32U) == TBX_OK);
+    TestDeltaRun(session, image, config, &updated);
+    TEST_CHECK(updated == 1U);
+    TEST_CHECK(SimTargetGetStats(0U)->erasedSectors == (erasedSectors + 1U));
+    TEST_CHECK(SimTargetGetStats(0U)->violations == 0U);
+    /* Restore the firmware file. */
+    image->data[offset] ^= 0x5AU;
+    TEST_CHECK(ImageWriteSRecord(image, TEST_FIRMWARE_FILE, 32U) == TBX_OK);
+    BltSessionCtxStop(session);
+    BltSessionCtxDestroy(session);
+  }
+  SimTargetDestroy(0U);
+} /*** end of TestDelta ***/
+
+
+/************************************************************************************//**
+** \brief     Checks that the verification detects corrupted flash memory on the target.
+**            After programming the firmware file, one byte is corrupted in the first
+**            block of the first segment and afterwards in the middle of the last
+**            segment.
+** \param     image Firmware image of the firmware file.
+** \param     config Configuration of the simulated target.
+**
+****************************************************************************************/
+static void TestVerify(tImage const * image, tSimTargetConfig const * config)
+{
+  tBltSessionCtx  * session = NULL;
+  tBltFirmwareCtx * firmware = NULL;
+  uint32_t          updated;
+  uint32_t          addresses[2];
+  uint8_t           addressIdx;
+
+  addresses[0] = image->segments[0].address;
+  addresses[1] = image->segments[image->segmentCount - 1U].address +
+                 (image->segments[image->segmentCount - 1U].len / 2U);
+  SimTargetSetTimeUs(0U);
+  TEST_CHECK(SimTargetCreate(0U, config) == TBX_OK);
+  session = UpdateSessionCreate(0U);
+  firmware = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  TEST_CHECK((session != NULL) && (firmware != NULL));
+  if ((session != NULL) && (firmware != NULL))
+  {
+    TestDeltaRun(session, image, config, &updated);
+    TEST_CHECK(BltFirmwareCtxFileOpen(firmware, TEST_FIRMWARE_FILE) == TBX_OK);
+    TEST_CHECK(BltSessionCtxVerify(session, firmware) == TBX_OK);
+    for (addressIdx = 0U; addressIdx < 2U; addressIdx++)
+    {
+      SimTargetCorrupt(0U, addresses[addressIdx]);
+      TEST_CHECK(BltSessionCtxVerify(session, firmware) == TBX_ERROR);
+      /* Restore the corrupted byte. */
+      SimTargetCorrupt(0U, addresses[addressIdx]);
+      TEST_CHECK(BltSessionCtxVerify(session, firmware) == TBX_OK);
+    }
+  }
+  if (firmware != NULL)
+  {
+    (void)BltFirmwareCtxDestroy(firmware);
+  }
+  if (session != NULL)
+  {
+    BltSessionCtxStop(session);
+    BltSessionCtxDestroy(session);
+  }
+  SimTargetDestroy(0U);
+} /*** end of TestVerify ***/
+
+
+/************************************************************************************//**
+** \brief     Checks that merging the segments of the firmware file reduces the number
+**            of times that the memory transfer address is set on the target, while the
+**            flash memory still matches the firmware image afterwards.
+** \param     image Firmware image of the firmware file.
+** \param     config Configuration of the simulated target.
+**
+****************************************************************************************/
+static void TestGapFill(tImage const * image, tSimTargetConfig const * config)
+{
+  tBltSessionCtx  * session;
+  tBltFirmwareCtx * firmware;
+  uint32_t          setMtaCounts[2] = { 0U, 0U };
+  uint8_t           runIdx;
+
+  for (runIdx = 0U; runIdx < 2U; runIdx++)
+  {
+    SimTargetSetTimeUs(0U);
+    TEST_CHECK(SimTargetCreate(0U, config) == TBX_OK);
+    session = UpdateSessionCreate(0U);
+    firmware = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+    TEST_CHECK((session != NULL) && (firmware != NULL));
+    if ((session != NULL) && (firmware != NULL))
+    {
+      /* The first run does not merge segments, the second one merges all of them. */
+      TEST_CHECK(BltFirmwareCtxFileOpen(firmware, TEST_FIRMWARE_FILE) == TBX_OK);
+      BltFirmwareCtxSetGapFill(firmware, (runIdx == 0U) ? 0U : TEST_GAP_FILL_MAX,
+                               IMAGE_ERASED_VALUE);
+      TEST_CHECK(BltFirmwareCtxSegmentGetCount(firmware) ==
+                 ((runIdx == 0U) ? image->segmentCount : 1U));
+      TEST_CHECK(UpdateSegmented(session, firmware) == TBX_OK);
+      TEST_CHECK(BltSessionCtxVerify(session, firmware) == TBX_OK);
+      TEST_CHECK(memcmp(SimTargetGetFlash(0U), image->data, image->size) == 0);
+      TEST_CHECK(SimTargetGetStats(0U)->violations == 0U);
+      setMtaCounts[runIdx] = SimTargetGetStats(0U)->commandCount[TEST_CMD_SET_MTA];
+    }
+    if (firmware != NULL)
+    {
+      (void)BltFirmwareCtxDestroy(firmware);
+    }
+    if (session != NULL)
+    {
+      BltSessionCtxStop(session);
+      BltSessionCtxDestroy(session);
+    }
+    SimTargetDestroy(0U);
+  }
+  TEST_CHECK(setMtaCounts[1] < setMtaCounts[0]);
+} /*** end of TestGapFill ***/
+
+
+/************************************************************************************//**
+** \brief     Runs a differential update over all flash sectors of the simulated target
+**            and checks that its flash memory matches the firmware image afterwards.
+** \param     session Session context of the simulated target.
+** \param     image Firmware image of the firmware file.
+** \param     config Configuration of the simulated target.
+** \param     updated Storage for the number of sectors that were updated.
+**
+****************************************************************************************/
+static void TestDeltaRun(tBltSessionCtx * session, tImage const * image,
+                         tSimTargetConfig const * config, uint32_t * updated)
+{
+  tBltFirmwareCtx * firmware;
+  tBltDeltaCtx    * delta;
+  uint32_t          sectorIdx;
+  uint8_t           status;
+
+  *updated = 0U;
+  firmware = BltFirmwareCtxCreate(BLT_FIRMWARE_READER_SRECORD);
+  delta = BltDeltaCtxCreate();
+  TEST_CHECK((firmware != NULL) && (delta != NULL));
+  if ((firmware != NULL) && (delta != NULL))
+  {
+    TEST_CHECK(BltFirmwareCtxFileOpen(firmware, TEST_FIRMWARE_FILE) == TBX_OK);
+    BltDeltaCtxStart(delta, session, firmware);
+    for (sectorIdx = 0U; sectorIdx < (config->flashSize / config->sectorSize);
+         sectorIdx++)
+    {
+      status = BltDeltaCtxUpdateSector(delta, config->flashBase +
+                                       (sectorIdx * config->sectorSize),
+                                       config->sectorSize);
+      TEST_CHECK((status == BLT_DELTA_STATUS_UNCHANGED) ||
+                 (status == BLT_DELTA_STATUS_UPDATED));
+      if (status == BLT_DELTA_STATUS_UPDATED)
+      {
+        (*updated)++;
+      }
+    }
+    TEST_CHECK(BltDeltaCtxStop(delta) == TBX_OK);
+    TEST_CHECK(memcmp(SimTargetGetFlash(0U), image->data, image->size) == 0);
+  }
+  if (delta != NULL)
+  {
+    BltDeltaCtxDestroy(delta);
+  }
+  if (firmware != NULL)
+  {
+    (void)BltFirmwareCtxDestroy(firmware);
+  }
+} /*** end of TestDeltaRun ***/
+
+
+/************************************************************************************//**
+** \brief     Reports a failed check.
+** \param     condition Zero if the check failed, non-zero otherwise.
+** \param     description Description of the check.
+**
+****************************************************************************************/
+static void TestCheck(int condition, char const * description)
+{
+  if (condition == 0)
+  {
+    (void)printf("FAILED: %s\n", description);
+    testFailures++;
+  }
+} /*** end of TestCheck ***/
+
+
+/*********************************** end of test_update.c ******************************/